@@ -93,6 +93,19 @@ AC_DEFUN([AX_LIBODRAW_CHECK_LOCAL],
 
   dnl Check for internationalization functions in libodraw/libodraw_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions included in libodraw/libodraw_mapped_file.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([mmap munmap posix_madvise sysconf])
+
+  dnl Headers and functions included in libodraw/libodraw_io_uring.c
+  AC_CHECK_HEADERS([linux/io_uring.h sys/syscall.h sys/uio.h])
+
+  AC_CHECK_FUNCS([syscall])
+
+  dnl Functions included in libodraw/libodraw_direct_file.c
+  AC_CHECK_FUNCS([pread])
 ])
 
 dnl Function to detect if odrawtools dependencies are available
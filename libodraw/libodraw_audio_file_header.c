@@ -0,0 +1,800 @@
+/*
+ * Audio (WAVE and AIFF) file header functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_audio_file_header.h"
+#include "libodraw_definitions.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+
+/* Creates an audio file header
+ * Make sure the value audio_file_header is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_audio_file_header_initialize(
+     libodraw_audio_file_header_t **audio_file_header,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_audio_file_header_initialize";
+
+	if( audio_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid audio file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( *audio_file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid audio file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*audio_file_header = memory_allocate_structure(
+	                      libodraw_audio_file_header_t );
+
+	if( *audio_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create audio file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *audio_file_header,
+	     0,
+	     sizeof( libodraw_audio_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear audio file header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *audio_file_header != NULL )
+	{
+		memory_free(
+		 *audio_file_header );
+
+		*audio_file_header = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an audio file header
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_audio_file_header_free(
+     libodraw_audio_file_header_t **audio_file_header,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_audio_file_header_free";
+
+	if( audio_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid audio file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( *audio_file_header != NULL )
+	{
+		memory_free(
+		 *audio_file_header );
+
+		*audio_file_header = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the data of a WAVE format (fmt) chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_audio_file_header_read_wave_format_data(
+     libodraw_audio_file_header_t *audio_file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_audio_file_header_read_wave_format_data";
+	uint16_t format_type  = 0;
+
+	if( audio_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid audio file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 16 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 data,
+	 format_type );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 2 ] ),
+	 audio_file_header->number_of_channels );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 audio_file_header->sample_rate );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 14 ] ),
+	 audio_file_header->bits_per_sample );
+
+	/* The extensible format stores the actual format type in the first 2 bytes of the sub format identifier
+	 */
+	if( ( format_type == 0xfffe )
+	 && ( data_size >= 40 ) )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ 24 ] ),
+		 format_type );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format type\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 format_type );
+
+		libcnotify_printf(
+		 "%s: number of channels\t: %" PRIu16 "\n",
+		 function,
+		 audio_file_header->number_of_channels );
+
+		libcnotify_printf(
+		 "%s: sample rate\t\t: %" PRIu32 "\n",
+		 function,
+		 audio_file_header->sample_rate );
+
+		libcnotify_printf(
+		 "%s: bits per sample\t: %" PRIu16 "\n",
+		 function,
+		 audio_file_header->bits_per_sample );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* Only uncompressed PCM samples can be read without conversion
+	 */
+	if( format_type != 0x0001 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format type: 0x%04" PRIx16 ".",
+		 function,
+		 format_type );
+
+		return( -1 );
+	}
+	audio_file_header->byte_order = LIBODRAW_ENDIAN_LITTLE;
+
+	return( 1 );
+}
+
+/* Reads the data of an AIFF common (COMM) chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_audio_file_header_read_aiff_common_data(
+     libodraw_audio_file_header_t *audio_file_header,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t is_aifc,
+     libcerror_error_t **error )
+{
+	static char *function         = "libodraw_audio_file_header_read_aiff_common_data";
+	uint64_t sample_rate          = 0;
+	uint16_t sample_rate_exponent = 0;
+
+	if( audio_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid audio file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 18 )
+	 || ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( is_aifc != 0 )
+	  &&  ( data_size < 22 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 data,
+	 audio_file_header->number_of_channels );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 6 ] ),
+	 audio_file_header->bits_per_sample );
+
+	/* The sample rate is stored as an 80-bit IEEE 754 extended precision floating-point value
+	 * with an explicit integer bit in the 64-bit mantissa
+	 */
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 8 ] ),
+	 sample_rate_exponent );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( data[ 10 ] ),
+	 sample_rate );
+
+	sample_rate_exponent &= 0x7fff;
+
+	if( ( sample_rate_exponent < 16383 )
+	 || ( sample_rate_exponent > ( 16383 + 31 ) ) )
+	{
+		audio_file_header->sample_rate = 0;
+	}
+	else
+	{
+		audio_file_header->sample_rate = (uint32_t) ( sample_rate >> ( 16383 + 63 - sample_rate_exponent ) );
+	}
+	audio_file_header->byte_order = LIBODRAW_ENDIAN_BIG;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of channels\t: %" PRIu16 "\n",
+		 function,
+		 audio_file_header->number_of_channels );
+
+		libcnotify_printf(
+		 "%s: bits per sample\t: %" PRIu16 "\n",
+		 function,
+		 audio_file_header->bits_per_sample );
+
+		libcnotify_printf(
+		 "%s: sample rate\t\t: %" PRIu32 "\n",
+		 function,
+		 audio_file_header->sample_rate );
+
+		if( is_aifc != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compression type\t: %c%c%c%c\n",
+			 function,
+			 data[ 18 ],
+			 data[ 19 ],
+			 data[ 20 ],
+			 data[ 21 ] );
+		}
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* AIFF-C files can contain uncompressed big-endian (NONE, twos)
+	 * or little-endian (sowt) samples
+	 */
+	if( is_aifc != 0 )
+	{
+		if( memory_compare(
+		     &( data[ 18 ] ),
+		     "sowt",
+		     4 ) == 0 )
+		{
+			audio_file_header->byte_order = LIBODRAW_ENDIAN_LITTLE;
+		}
+		else if( ( memory_compare(
+		            &( data[ 18 ] ),
+		            "NONE",
+		            4 ) != 0 )
+		      && ( memory_compare(
+		            &( data[ 18 ] ),
+		            "twos",
+		            4 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the audio file header from a WAVE or AIFF file using a Basic File IO (bfio) pool
+ * This determines the offset and size of the sample data by walking the chunks of the file,
+ * the sample data must be 16-bit stereo PCM at 44.1 kHz, which is the layout of CD-DA sectors
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_audio_file_header_read_file_io_pool(
+     libodraw_audio_file_header_t *audio_file_header,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	uint8_t chunk_data[ 40 ];
+	uint8_t chunk_header_data[ 12 ];
+
+	static char *function      = "libodraw_audio_file_header_read_file_io_pool";
+	size64_t file_size         = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = 0;
+	off64_t file_offset        = 0;
+	uint32_t chunk_size        = 0;
+	uint32_t sound_data_offset = 0;
+	uint8_t data_chunk_found   = 0;
+	uint8_t format_chunk_found = 0;
+	uint8_t is_aifc            = 0;
+
+	if( audio_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid audio file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_type != LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+	 && ( file_type != LIBODRAW_FILE_TYPE_AUDIO_AIFF ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_size(
+	     file_io_pool,
+	     file_io_pool_entry,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d size.",
+		 function,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              file_io_pool,
+	              file_io_pool_entry,
+	              chunk_header_data,
+	              12,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) 12 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+	{
+		if( ( memory_compare(
+		       chunk_header_data,
+		       "RIFF",
+		       4 ) != 0 )
+		 || ( memory_compare(
+		       &( chunk_header_data[ 8 ] ),
+		       "WAVE",
+		       4 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported WAVE file signature.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( memory_compare(
+		     chunk_header_data,
+		     "FORM",
+		     4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported AIFF file signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     &( chunk_header_data[ 8 ] ),
+		     "AIFC",
+		     4 ) == 0 )
+		{
+			is_aifc = 1;
+		}
+		else if( memory_compare(
+		          &( chunk_header_data[ 8 ] ),
+		          "AIFF",
+		          4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported AIFF file form type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_offset = 12;
+
+	while( ( (size64_t) file_offset + 8 ) <= file_size )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              file_io_pool,
+		              file_io_pool_entry,
+		              chunk_header_data,
+		              8,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		if( file_type == LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( chunk_header_data[ 4 ] ),
+			 chunk_size );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( chunk_header_data[ 4 ] ),
+			 chunk_size );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: chunk: %c%c%c%c at offset: %" PRIi64 " of size: %" PRIu32 "\n",
+			 function,
+			 chunk_header_data[ 0 ],
+			 chunk_header_data[ 1 ],
+			 chunk_header_data[ 2 ],
+			 chunk_header_data[ 3 ],
+			 file_offset,
+			 chunk_size );
+		}
+#endif
+		file_offset += 8;
+
+		if( ( ( file_type == LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+		  &&  ( memory_compare(
+		         chunk_header_data,
+		         "fmt ",
+		         4 ) == 0 ) )
+		 || ( ( file_type == LIBODRAW_FILE_TYPE_AUDIO_AIFF )
+		  &&  ( memory_compare(
+		         chunk_header_data,
+		         "COMM",
+		         4 ) == 0 ) ) )
+		{
+			read_size = 40;
+
+			if( (size_t) chunk_size < read_size )
+			{
+				read_size = (size_t) chunk_size;
+			}
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              file_io_pool,
+			              file_io_pool_entry,
+			              chunk_data,
+			              read_size,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read format chunk data.",
+				 function );
+
+				return( -1 );
+			}
+			if( file_type == LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+			{
+				if( libodraw_audio_file_header_read_wave_format_data(
+				     audio_file_header,
+				     chunk_data,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read WAVE format chunk.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				if( libodraw_audio_file_header_read_aiff_common_data(
+				     audio_file_header,
+				     chunk_data,
+				     read_size,
+				     is_aifc,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read AIFF common chunk.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			format_chunk_found = 1;
+		}
+		else if( ( file_type == LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+		      && ( memory_compare(
+		            chunk_header_data,
+		            "data",
+		            4 ) == 0 ) )
+		{
+			audio_file_header->data_offset = file_offset;
+			audio_file_header->data_size   = (size64_t) chunk_size;
+
+			data_chunk_found = 1;
+		}
+		else if( ( file_type == LIBODRAW_FILE_TYPE_AUDIO_AIFF )
+		      && ( memory_compare(
+		            chunk_header_data,
+		            "SSND",
+		            4 ) == 0 ) )
+		{
+			/* The sound data chunk starts with the offset of the first sample
+			 * relative to the end of the 8 bytes of the offset and block size values
+			 */
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              file_io_pool,
+			              file_io_pool_entry,
+			              chunk_data,
+			              8,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sound data chunk data.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 chunk_data,
+			 sound_data_offset );
+
+			if( ( chunk_size < 8 )
+			 || ( sound_data_offset > ( chunk_size - 8 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid sound data offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			audio_file_header->data_offset = file_offset + 8 + sound_data_offset;
+			audio_file_header->data_size   = (size64_t) ( chunk_size - 8 - sound_data_offset );
+
+			data_chunk_found = 1;
+		}
+		if( ( format_chunk_found != 0 )
+		 && ( data_chunk_found != 0 ) )
+		{
+			break;
+		}
+		/* Chunks are padded to an even size
+		 */
+		file_offset += (off64_t) chunk_size + ( chunk_size & 1 );
+	}
+	if( format_chunk_found == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing format chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_chunk_found == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing sample data chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( audio_file_header->number_of_channels != 2 )
+	 || ( audio_file_header->bits_per_sample != 16 )
+	 || ( audio_file_header->sample_rate != 44100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sample format: %" PRIu16 " channels of %" PRIu16 "-bit samples at %" PRIu32 " Hz.",
+		 function,
+		 audio_file_header->number_of_channels,
+		 audio_file_header->bits_per_sample,
+		 audio_file_header->sample_rate );
+
+		return( -1 );
+	}
+	/* Some writers store a placeholder data size, the sample data cannot extend beyond the end of the file
+	 */
+	if( (size64_t) audio_file_header->data_offset > file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sample data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( audio_file_header->data_size > ( file_size - audio_file_header->data_offset ) )
+	{
+		audio_file_header->data_size = file_size - audio_file_header->data_offset;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Audio (WAVE and AIFF) file header functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_AUDIO_FILE_HEADER_H )
+#define _LIBODRAW_AUDIO_FILE_HEADER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_audio_file_header libodraw_audio_file_header_t;
+
+struct libodraw_audio_file_header
+{
+	/* The number of channels
+	 */
+	uint16_t number_of_channels;
+
+	/* The number of bits per sample
+	 */
+	uint16_t bits_per_sample;
+
+	/* The sample rate
+	 */
+	uint32_t sample_rate;
+
+	/* The byte order of the samples
+	 */
+	uint8_t byte_order;
+
+	/* The offset of the sample data relative to the start of the file
+	 */
+	off64_t data_offset;
+
+	/* The size of the sample data
+	 */
+	size64_t data_size;
+};
+
+int libodraw_audio_file_header_initialize(
+     libodraw_audio_file_header_t **audio_file_header,
+     libcerror_error_t **error );
+
+int libodraw_audio_file_header_free(
+     libodraw_audio_file_header_t **audio_file_header,
+     libcerror_error_t **error );
+
+int libodraw_audio_file_header_read_wave_format_data(
+     libodraw_audio_file_header_t *audio_file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libodraw_audio_file_header_read_aiff_common_data(
+     libodraw_audio_file_header_t *audio_file_header,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t is_aifc,
+     libcerror_error_t **error );
+
+int libodraw_audio_file_header_read_file_io_pool(
+     libodraw_audio_file_header_t *audio_file_header,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     uint8_t file_type,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_AUDIO_FILE_HEADER_H ) */
+
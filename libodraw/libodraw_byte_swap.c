@@ -0,0 +1,223 @@
+/*
+ * Byte swap functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_byte_swap.h"
+#include "libodraw_libcerror.h"
+
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+#include <immintrin.h>
+#endif
+
+/* The kernel used by libodraw_byte_swap_16bit
+ * the kernel is determined on first use, which is safe to race since
+ * every thread will determine the same kernel
+ */
+static libodraw_byte_swap_kernel_t libodraw_byte_swap_kernel = NULL;
+
+/* Swaps the bytes of 16-bit values in place
+ */
+void libodraw_byte_swap_16bit_scalar(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint8_t byte_value = 0;
+
+	for( data_offset = 0;
+	     ( data_offset + 2 ) <= data_size;
+	     data_offset += 2 )
+	{
+		byte_value              = data[ data_offset ];
+		data[ data_offset ]     = data[ data_offset + 1 ];
+		data[ data_offset + 1 ] = byte_value;
+	}
+}
+
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+
+/* Swaps the bytes of 16-bit values in place
+ * This function uses SSE2, which is part of the x86-64 base instruction set,
+ * SSE2 has no byte shuffle hence the bytes are swapped using 16-bit shifts
+ */
+void libodraw_byte_swap_16bit_sse2(
+      uint8_t *data,
+      size_t data_size )
+{
+	__m128i value0     = _mm_setzero_si128();
+	__m128i value1     = _mm_setzero_si128();
+	__m128i value2     = _mm_setzero_si128();
+	__m128i value3     = _mm_setzero_si128();
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     ( data_offset + 64 ) <= data_size;
+	     data_offset += 64 )
+	{
+		value0 = _mm_loadu_si128( (const __m128i *) &( data[ data_offset ] ) );
+		value1 = _mm_loadu_si128( (const __m128i *) &( data[ data_offset + 16 ] ) );
+		value2 = _mm_loadu_si128( (const __m128i *) &( data[ data_offset + 32 ] ) );
+		value3 = _mm_loadu_si128( (const __m128i *) &( data[ data_offset + 48 ] ) );
+
+		value0 = _mm_or_si128( _mm_slli_epi16( value0, 8 ), _mm_srli_epi16( value0, 8 ) );
+		value1 = _mm_or_si128( _mm_slli_epi16( value1, 8 ), _mm_srli_epi16( value1, 8 ) );
+		value2 = _mm_or_si128( _mm_slli_epi16( value2, 8 ), _mm_srli_epi16( value2, 8 ) );
+		value3 = _mm_or_si128( _mm_slli_epi16( value3, 8 ), _mm_srli_epi16( value3, 8 ) );
+
+		_mm_storeu_si128( (__m128i *) &( data[ data_offset ] ), value0 );
+		_mm_storeu_si128( (__m128i *) &( data[ data_offset + 16 ] ), value1 );
+		_mm_storeu_si128( (__m128i *) &( data[ data_offset + 32 ] ), value2 );
+		_mm_storeu_si128( (__m128i *) &( data[ data_offset + 48 ] ), value3 );
+	}
+	for( ;
+	     ( data_offset + 16 ) <= data_size;
+	     data_offset += 16 )
+	{
+		value0 = _mm_loadu_si128( (const __m128i *) &( data[ data_offset ] ) );
+		value0 = _mm_or_si128( _mm_slli_epi16( value0, 8 ), _mm_srli_epi16( value0, 8 ) );
+
+		_mm_storeu_si128( (__m128i *) &( data[ data_offset ] ), value0 );
+	}
+	libodraw_byte_swap_16bit_scalar(
+	 &( data[ data_offset ] ),
+	 data_size - data_offset );
+}
+
+/* Swaps the bytes of 16-bit values in place
+ * This function uses the AVX2 byte shuffle to swap 32 bytes per instruction
+ * Only call this function if the CPU supports AVX2
+ */
+__attribute__((target("avx2"))) void libodraw_byte_swap_16bit_avx2(
+                                      uint8_t *data,
+                                      size_t data_size )
+{
+	__m256i shuffle_mask = _mm256_setr_epi8(
+	                        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+	                        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+	__m256i value0       = _mm256_setzero_si256();
+	__m256i value1       = _mm256_setzero_si256();
+	__m128i value        = _mm_setzero_si128();
+	size_t data_offset   = 0;
+
+	for( data_offset = 0;
+	     ( data_offset + 64 ) <= data_size;
+	     data_offset += 64 )
+	{
+		value0 = _mm256_loadu_si256( (const __m256i *) &( data[ data_offset ] ) );
+		value1 = _mm256_loadu_si256( (const __m256i *) &( data[ data_offset + 32 ] ) );
+
+		value0 = _mm256_shuffle_epi8( value0, shuffle_mask );
+		value1 = _mm256_shuffle_epi8( value1, shuffle_mask );
+
+		_mm256_storeu_si256( (__m256i *) &( data[ data_offset ] ), value0 );
+		_mm256_storeu_si256( (__m256i *) &( data[ data_offset + 32 ] ), value1 );
+	}
+	/* The remaining data is swapped using VEX encoded 128-bit instructions
+	 * since mixing legacy SSE and AVX instructions incurs a transition penalty
+	 */
+	for( ;
+	     ( data_offset + 16 ) <= data_size;
+	     data_offset += 16 )
+	{
+		value = _mm_loadu_si128( (const __m128i *) &( data[ data_offset ] ) );
+		value = _mm_shuffle_epi8( value, _mm256_castsi256_si128( shuffle_mask ) );
+
+		_mm_storeu_si128( (__m128i *) &( data[ data_offset ] ), value );
+	}
+	libodraw_byte_swap_16bit_scalar(
+	 &( data[ data_offset ] ),
+	 data_size - data_offset );
+}
+
+#endif /* defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD ) */
+
+/* Retrieves the byte swap kernel best supported by the CPU
+ * Returns the kernel
+ */
+libodraw_byte_swap_kernel_t libodraw_byte_swap_get_kernel(
+                             void )
+{
+	if( libodraw_byte_swap_kernel == NULL )
+	{
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			libodraw_byte_swap_kernel = &libodraw_byte_swap_16bit_avx2;
+		}
+		else
+		{
+			libodraw_byte_swap_kernel = &libodraw_byte_swap_16bit_sse2;
+		}
+#else
+		libodraw_byte_swap_kernel = &libodraw_byte_swap_16bit_scalar;
+#endif
+	}
+	return( libodraw_byte_swap_kernel );
+}
+
+/* Swaps the bytes of 16-bit values in place
+ * This is used to convert big-endian audio samples to little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_byte_swap_16bit(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libodraw_byte_swap_kernel_t kernel = NULL;
+	static char *function              = "libodraw_byte_swap_16bit";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	kernel = libodraw_byte_swap_get_kernel();
+
+	kernel(
+	 data,
+	 data_size );
+
+	return( 1 );
+}
+
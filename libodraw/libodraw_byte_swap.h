@@ -0,0 +1,76 @@
+/*
+ * Byte swap functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_BYTE_SWAP_H )
+#define _LIBODRAW_BYTE_SWAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SSE2 and AVX2 kernels are only built for x86-64 using a GCC compatible compiler
+ */
+#if defined( __GNUC__ ) && defined( __x86_64__ ) && !defined( LIBODRAW_BYTE_SWAP_NO_SIMD )
+#define LIBODRAW_BYTE_SWAP_HAVE_SIMD	1
+#endif
+
+/* A 16-bit byte swap kernel
+ * The data size must be a multiple of 2
+ */
+typedef void (*libodraw_byte_swap_kernel_t)(
+               uint8_t *data,
+               size_t data_size );
+
+void libodraw_byte_swap_16bit_scalar(
+      uint8_t *data,
+      size_t data_size );
+
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+
+void libodraw_byte_swap_16bit_sse2(
+      uint8_t *data,
+      size_t data_size );
+
+void libodraw_byte_swap_16bit_avx2(
+      uint8_t *data,
+      size_t data_size );
+
+#endif /* defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD ) */
+
+libodraw_byte_swap_kernel_t libodraw_byte_swap_get_kernel(
+                             void );
+
+int libodraw_byte_swap_16bit(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_BYTE_SWAP_H ) */
+
@@ -0,0 +1,734 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libodraw_checksum.h"
+#include "libodraw_libcerror.h"
+
+/* The EDC is a CRC-32 with the (reversed) polynomial 0xd8018001
+ * which is calculated least significant bit first without pre and post conditioning
+ */
+#define LIBODRAW_CHECKSUM_EDC_POLYNOMIAL	0xd8018001UL
+
+/* The slice-by-8 tables of the EDC of all 8-bit messages
+ * table 0 contains the regular byte-wise table
+ * The tables are constant so they can be shared by multiple threads without synchronization
+ */
+static const uint32_t libodraw_checksum_edc_table[ 8 ][ 256 ] = {
+	{
+		0x00000000UL, 0x90910101UL, 0x91210201UL, 0x01b00300UL, 0x92410401UL, 0x02d00500UL,
+		0x03600600UL, 0x93f10701UL, 0x94810801UL, 0x04100900UL, 0x05a00a00UL, 0x95310b01UL,
+		0x06c00c00UL, 0x96510d01UL, 0x97e10e01UL, 0x07700f00UL, 0x99011001UL, 0x09901100UL,
+		0x08201200UL, 0x98b11301UL, 0x0b401400UL, 0x9bd11501UL, 0x9a611601UL, 0x0af01700UL,
+		0x0d801800UL, 0x9d111901UL, 0x9ca11a01UL, 0x0c301b00UL, 0x9fc11c01UL, 0x0f501d00UL,
+		0x0ee01e00UL, 0x9e711f01UL, 0x82012001UL, 0x12902100UL, 0x13202200UL, 0x83b12301UL,
+		0x10402400UL, 0x80d12501UL, 0x81612601UL, 0x11f02700UL, 0x16802800UL, 0x86112901UL,
+		0x87a12a01UL, 0x17302b00UL, 0x84c12c01UL, 0x14502d00UL, 0x15e02e00UL, 0x85712f01UL,
+		0x1b003000UL, 0x8b913101UL, 0x8a213201UL, 0x1ab03300UL, 0x89413401UL, 0x19d03500UL,
+		0x18603600UL, 0x88f13701UL, 0x8f813801UL, 0x1f103900UL, 0x1ea03a00UL, 0x8e313b01UL,
+		0x1dc03c00UL, 0x8d513d01UL, 0x8ce13e01UL, 0x1c703f00UL, 0xb4014001UL, 0x24904100UL,
+		0x25204200UL, 0xb5b14301UL, 0x26404400UL, 0xb6d14501UL, 0xb7614601UL, 0x27f04700UL,
+		0x20804800UL, 0xb0114901UL, 0xb1a14a01UL, 0x21304b00UL, 0xb2c14c01UL, 0x22504d00UL,
+		0x23e04e00UL, 0xb3714f01UL, 0x2d005000UL, 0xbd915101UL, 0xbc215201UL, 0x2cb05300UL,
+		0xbf415401UL, 0x2fd05500UL, 0x2e605600UL, 0xbef15701UL, 0xb9815801UL, 0x29105900UL,
+		0x28a05a00UL, 0xb8315b01UL, 0x2bc05c00UL, 0xbb515d01UL, 0xbae15e01UL, 0x2a705f00UL,
+		0x36006000UL, 0xa6916101UL, 0xa7216201UL, 0x37b06300UL, 0xa4416401UL, 0x34d06500UL,
+		0x35606600UL, 0xa5f16701UL, 0xa2816801UL, 0x32106900UL, 0x33a06a00UL, 0xa3316b01UL,
+		0x30c06c00UL, 0xa0516d01UL, 0xa1e16e01UL, 0x31706f00UL, 0xaf017001UL, 0x3f907100UL,
+		0x3e207200UL, 0xaeb17301UL, 0x3d407400UL, 0xadd17501UL, 0xac617601UL, 0x3cf07700UL,
+		0x3b807800UL, 0xab117901UL, 0xaaa17a01UL, 0x3a307b00UL, 0xa9c17c01UL, 0x39507d00UL,
+		0x38e07e00UL, 0xa8717f01UL, 0xd8018001UL, 0x48908100UL, 0x49208200UL, 0xd9b18301UL,
+		0x4a408400UL, 0xdad18501UL, 0xdb618601UL, 0x4bf08700UL, 0x4c808800UL, 0xdc118901UL,
+		0xdda18a01UL, 0x4d308b00UL, 0xdec18c01UL, 0x4e508d00UL, 0x4fe08e00UL, 0xdf718f01UL,
+		0x41009000UL, 0xd1919101UL, 0xd0219201UL, 0x40b09300UL, 0xd3419401UL, 0x43d09500UL,
+		0x42609600UL, 0xd2f19701UL, 0xd5819801UL, 0x45109900UL, 0x44a09a00UL, 0xd4319b01UL,
+		0x47c09c00UL, 0xd7519d01UL, 0xd6e19e01UL, 0x46709f00UL, 0x5a00a000UL, 0xca91a101UL,
+		0xcb21a201UL, 0x5bb0a300UL, 0xc841a401UL, 0x58d0a500UL, 0x5960a600UL, 0xc9f1a701UL,
+		0xce81a801UL, 0x5e10a900UL, 0x5fa0aa00UL, 0xcf31ab01UL, 0x5cc0ac00UL, 0xcc51ad01UL,
+		0xcde1ae01UL, 0x5d70af00UL, 0xc301b001UL, 0x5390b100UL, 0x5220b200UL, 0xc2b1b301UL,
+		0x5140b400UL, 0xc1d1b501UL, 0xc061b601UL, 0x50f0b700UL, 0x5780b800UL, 0xc711b901UL,
+		0xc6a1ba01UL, 0x5630bb00UL, 0xc5c1bc01UL, 0x5550bd00UL, 0x54e0be00UL, 0xc471bf01UL,
+		0x6c00c000UL, 0xfc91c101UL, 0xfd21c201UL, 0x6db0c300UL, 0xfe41c401UL, 0x6ed0c500UL,
+		0x6f60c600UL, 0xfff1c701UL, 0xf881c801UL, 0x6810c900UL, 0x69a0ca00UL, 0xf931cb01UL,
+		0x6ac0cc00UL, 0xfa51cd01UL, 0xfbe1ce01UL, 0x6b70cf00UL, 0xf501d001UL, 0x6590d100UL,
+		0x6420d200UL, 0xf4b1d301UL, 0x6740d400UL, 0xf7d1d501UL, 0xf661d601UL, 0x66f0d700UL,
+		0x6180d800UL, 0xf111d901UL, 0xf0a1da01UL, 0x6030db00UL, 0xf3c1dc01UL, 0x6350dd00UL,
+		0x62e0de00UL, 0xf271df01UL, 0xee01e001UL, 0x7e90e100UL, 0x7f20e200UL, 0xefb1e301UL,
+		0x7c40e400UL, 0xecd1e501UL, 0xed61e601UL, 0x7df0e700UL, 0x7a80e800UL, 0xea11e901UL,
+		0xeba1ea01UL, 0x7b30eb00UL, 0xe8c1ec01UL, 0x7850ed00UL, 0x79e0ee00UL, 0xe971ef01UL,
+		0x7700f000UL, 0xe791f101UL, 0xe621f201UL, 0x76b0f300UL, 0xe541f401UL, 0x75d0f500UL,
+		0x7460f600UL, 0xe4f1f701UL, 0xe381f801UL, 0x7310f900UL, 0x72a0fa00UL, 0xe231fb01UL,
+		0x71c0fc00UL, 0xe151fd01UL, 0xe0e1fe01UL, 0x7070ff00UL
+	},
+	{
+		0x00000000UL, 0x90019000UL, 0x90002003UL, 0x0001b003UL, 0x90034005UL, 0x0002d005UL,
+		0x00036006UL, 0x9002f006UL, 0x90058009UL, 0x00041009UL, 0x0005a00aUL, 0x9004300aUL,
+		0x0006c00cUL, 0x9007500cUL, 0x9006e00fUL, 0x0007700fUL, 0x90080011UL, 0x00099011UL,
+		0x00082012UL, 0x9009b012UL, 0x000b4014UL, 0x900ad014UL, 0x900b6017UL, 0x000af017UL,
+		0x000d8018UL, 0x900c1018UL, 0x900da01bUL, 0x000c301bUL, 0x900ec01dUL, 0x000f501dUL,
+		0x000ee01eUL, 0x900f701eUL, 0x90130021UL, 0x00129021UL, 0x00132022UL, 0x9012b022UL,
+		0x00104024UL, 0x9011d024UL, 0x90106027UL, 0x0011f027UL, 0x00168028UL, 0x90171028UL,
+		0x9016a02bUL, 0x0017302bUL, 0x9015c02dUL, 0x0014502dUL, 0x0015e02eUL, 0x9014702eUL,
+		0x001b0030UL, 0x901a9030UL, 0x901b2033UL, 0x001ab033UL, 0x90184035UL, 0x0019d035UL,
+		0x00186036UL, 0x9019f036UL, 0x901e8039UL, 0x001f1039UL, 0x001ea03aUL, 0x901f303aUL,
+		0x001dc03cUL, 0x901c503cUL, 0x901de03fUL, 0x001c703fUL, 0x90250041UL, 0x00249041UL,
+		0x00252042UL, 0x9024b042UL, 0x00264044UL, 0x9027d044UL, 0x90266047UL, 0x0027f047UL,
+		0x00208048UL, 0x90211048UL, 0x9020a04bUL, 0x0021304bUL, 0x9023c04dUL, 0x0022504dUL,
+		0x0023e04eUL, 0x9022704eUL, 0x002d0050UL, 0x902c9050UL, 0x902d2053UL, 0x002cb053UL,
+		0x902e4055UL, 0x002fd055UL, 0x002e6056UL, 0x902ff056UL, 0x90288059UL, 0x00291059UL,
+		0x0028a05aUL, 0x9029305aUL, 0x002bc05cUL, 0x902a505cUL, 0x902be05fUL, 0x002a705fUL,
+		0x00360060UL, 0x90379060UL, 0x90362063UL, 0x0037b063UL, 0x90354065UL, 0x0034d065UL,
+		0x00356066UL, 0x9034f066UL, 0x90338069UL, 0x00321069UL, 0x0033a06aUL, 0x9032306aUL,
+		0x0030c06cUL, 0x9031506cUL, 0x9030e06fUL, 0x0031706fUL, 0x903e0071UL, 0x003f9071UL,
+		0x003e2072UL, 0x903fb072UL, 0x003d4074UL, 0x903cd074UL, 0x903d6077UL, 0x003cf077UL,
+		0x003b8078UL, 0x903a1078UL, 0x903ba07bUL, 0x003a307bUL, 0x9038c07dUL, 0x0039507dUL,
+		0x0038e07eUL, 0x9039707eUL, 0x90490081UL, 0x00489081UL, 0x00492082UL, 0x9048b082UL,
+		0x004a4084UL, 0x904bd084UL, 0x904a6087UL, 0x004bf087UL, 0x004c8088UL, 0x904d1088UL,
+		0x904ca08bUL, 0x004d308bUL, 0x904fc08dUL, 0x004e508dUL, 0x004fe08eUL, 0x904e708eUL,
+		0x00410090UL, 0x90409090UL, 0x90412093UL, 0x0040b093UL, 0x90424095UL, 0x0043d095UL,
+		0x00426096UL, 0x9043f096UL, 0x90448099UL, 0x00451099UL, 0x0044a09aUL, 0x9045309aUL,
+		0x0047c09cUL, 0x9046509cUL, 0x9047e09fUL, 0x0046709fUL, 0x005a00a0UL, 0x905b90a0UL,
+		0x905a20a3UL, 0x005bb0a3UL, 0x905940a5UL, 0x0058d0a5UL, 0x005960a6UL, 0x9058f0a6UL,
+		0x905f80a9UL, 0x005e10a9UL, 0x005fa0aaUL, 0x905e30aaUL, 0x005cc0acUL, 0x905d50acUL,
+		0x905ce0afUL, 0x005d70afUL, 0x905200b1UL, 0x005390b1UL, 0x005220b2UL, 0x9053b0b2UL,
+		0x005140b4UL, 0x9050d0b4UL, 0x905160b7UL, 0x0050f0b7UL, 0x005780b8UL, 0x905610b8UL,
+		0x9057a0bbUL, 0x005630bbUL, 0x9054c0bdUL, 0x005550bdUL, 0x0054e0beUL, 0x905570beUL,
+		0x006c00c0UL, 0x906d90c0UL, 0x906c20c3UL, 0x006db0c3UL, 0x906f40c5UL, 0x006ed0c5UL,
+		0x006f60c6UL, 0x906ef0c6UL, 0x906980c9UL, 0x006810c9UL, 0x0069a0caUL, 0x906830caUL,
+		0x006ac0ccUL, 0x906b50ccUL, 0x906ae0cfUL, 0x006b70cfUL, 0x906400d1UL, 0x006590d1UL,
+		0x006420d2UL, 0x9065b0d2UL, 0x006740d4UL, 0x9066d0d4UL, 0x906760d7UL, 0x0066f0d7UL,
+		0x006180d8UL, 0x906010d8UL, 0x9061a0dbUL, 0x006030dbUL, 0x9062c0ddUL, 0x006350ddUL,
+		0x0062e0deUL, 0x906370deUL, 0x907f00e1UL, 0x007e90e1UL, 0x007f20e2UL, 0x907eb0e2UL,
+		0x007c40e4UL, 0x907dd0e4UL, 0x907c60e7UL, 0x007df0e7UL, 0x007a80e8UL, 0x907b10e8UL,
+		0x907aa0ebUL, 0x007b30ebUL, 0x9079c0edUL, 0x007850edUL, 0x0079e0eeUL, 0x907870eeUL,
+		0x007700f0UL, 0x907690f0UL, 0x907720f3UL, 0x0076b0f3UL, 0x907440f5UL, 0x0075d0f5UL,
+		0x007460f6UL, 0x9075f0f6UL, 0x907280f9UL, 0x007310f9UL, 0x0072a0faUL, 0x907330faUL,
+		0x0071c0fcUL, 0x907050fcUL, 0x9071e0ffUL, 0x007070ffUL
+	},
+	{
+		0x00000000UL, 0x00900190UL, 0x01200320UL, 0x01b002b0UL, 0x02400640UL, 0x02d007d0UL,
+		0x03600560UL, 0x03f004f0UL, 0x04800c80UL, 0x04100d10UL, 0x05a00fa0UL, 0x05300e30UL,
+		0x06c00ac0UL, 0x06500b50UL, 0x07e009e0UL, 0x07700870UL, 0x09001900UL, 0x09901890UL,
+		0x08201a20UL, 0x08b01bb0UL, 0x0b401f40UL, 0x0bd01ed0UL, 0x0a601c60UL, 0x0af01df0UL,
+		0x0d801580UL, 0x0d101410UL, 0x0ca016a0UL, 0x0c301730UL, 0x0fc013c0UL, 0x0f501250UL,
+		0x0ee010e0UL, 0x0e701170UL, 0x12003200UL, 0x12903390UL, 0x13203120UL, 0x13b030b0UL,
+		0x10403440UL, 0x10d035d0UL, 0x11603760UL, 0x11f036f0UL, 0x16803e80UL, 0x16103f10UL,
+		0x17a03da0UL, 0x17303c30UL, 0x14c038c0UL, 0x14503950UL, 0x15e03be0UL, 0x15703a70UL,
+		0x1b002b00UL, 0x1b902a90UL, 0x1a202820UL, 0x1ab029b0UL, 0x19402d40UL, 0x19d02cd0UL,
+		0x18602e60UL, 0x18f02ff0UL, 0x1f802780UL, 0x1f102610UL, 0x1ea024a0UL, 0x1e302530UL,
+		0x1dc021c0UL, 0x1d502050UL, 0x1ce022e0UL, 0x1c702370UL, 0x24006400UL, 0x24906590UL,
+		0x25206720UL, 0x25b066b0UL, 0x26406240UL, 0x26d063d0UL, 0x27606160UL, 0x27f060f0UL,
+		0x20806880UL, 0x20106910UL, 0x21a06ba0UL, 0x21306a30UL, 0x22c06ec0UL, 0x22506f50UL,
+		0x23e06de0UL, 0x23706c70UL, 0x2d007d00UL, 0x2d907c90UL, 0x2c207e20UL, 0x2cb07fb0UL,
+		0x2f407b40UL, 0x2fd07ad0UL, 0x2e607860UL, 0x2ef079f0UL, 0x29807180UL, 0x29107010UL,
+		0x28a072a0UL, 0x28307330UL, 0x2bc077c0UL, 0x2b507650UL, 0x2ae074e0UL, 0x2a707570UL,
+		0x36005600UL, 0x36905790UL, 0x37205520UL, 0x37b054b0UL, 0x34405040UL, 0x34d051d0UL,
+		0x35605360UL, 0x35f052f0UL, 0x32805a80UL, 0x32105b10UL, 0x33a059a0UL, 0x33305830UL,
+		0x30c05cc0UL, 0x30505d50UL, 0x31e05fe0UL, 0x31705e70UL, 0x3f004f00UL, 0x3f904e90UL,
+		0x3e204c20UL, 0x3eb04db0UL, 0x3d404940UL, 0x3dd048d0UL, 0x3c604a60UL, 0x3cf04bf0UL,
+		0x3b804380UL, 0x3b104210UL, 0x3aa040a0UL, 0x3a304130UL, 0x39c045c0UL, 0x39504450UL,
+		0x38e046e0UL, 0x38704770UL, 0x4800c800UL, 0x4890c990UL, 0x4920cb20UL, 0x49b0cab0UL,
+		0x4a40ce40UL, 0x4ad0cfd0UL, 0x4b60cd60UL, 0x4bf0ccf0UL, 0x4c80c480UL, 0x4c10c510UL,
+		0x4da0c7a0UL, 0x4d30c630UL, 0x4ec0c2c0UL, 0x4e50c350UL, 0x4fe0c1e0UL, 0x4f70c070UL,
+		0x4100d100UL, 0x4190d090UL, 0x4020d220UL, 0x40b0d3b0UL, 0x4340d740UL, 0x43d0d6d0UL,
+		0x4260d460UL, 0x42f0d5f0UL, 0x4580dd80UL, 0x4510dc10UL, 0x44a0dea0UL, 0x4430df30UL,
+		0x47c0dbc0UL, 0x4750da50UL, 0x46e0d8e0UL, 0x4670d970UL, 0x5a00fa00UL, 0x5a90fb90UL,
+		0x5b20f920UL, 0x5bb0f8b0UL, 0x5840fc40UL, 0x58d0fdd0UL, 0x5960ff60UL, 0x59f0fef0UL,
+		0x5e80f680UL, 0x5e10f710UL, 0x5fa0f5a0UL, 0x5f30f430UL, 0x5cc0f0c0UL, 0x5c50f150UL,
+		0x5de0f3e0UL, 0x5d70f270UL, 0x5300e300UL, 0x5390e290UL, 0x5220e020UL, 0x52b0e1b0UL,
+		0x5140e540UL, 0x51d0e4d0UL, 0x5060e660UL, 0x50f0e7f0UL, 0x5780ef80UL, 0x5710ee10UL,
+		0x56a0eca0UL, 0x5630ed30UL, 0x55c0e9c0UL, 0x5550e850UL, 0x54e0eae0UL, 0x5470eb70UL,
+		0x6c00ac00UL, 0x6c90ad90UL, 0x6d20af20UL, 0x6db0aeb0UL, 0x6e40aa40UL, 0x6ed0abd0UL,
+		0x6f60a960UL, 0x6ff0a8f0UL, 0x6880a080UL, 0x6810a110UL, 0x69a0a3a0UL, 0x6930a230UL,
+		0x6ac0a6c0UL, 0x6a50a750UL, 0x6be0a5e0UL, 0x6b70a470UL, 0x6500b500UL, 0x6590b490UL,
+		0x6420b620UL, 0x64b0b7b0UL, 0x6740b340UL, 0x67d0b2d0UL, 0x6660b060UL, 0x66f0b1f0UL,
+		0x6180b980UL, 0x6110b810UL, 0x60a0baa0UL, 0x6030bb30UL, 0x63c0bfc0UL, 0x6350be50UL,
+		0x62e0bce0UL, 0x6270bd70UL, 0x7e009e00UL, 0x7e909f90UL, 0x7f209d20UL, 0x7fb09cb0UL,
+		0x7c409840UL, 0x7cd099d0UL, 0x7d609b60UL, 0x7df09af0UL, 0x7a809280UL, 0x7a109310UL,
+		0x7ba091a0UL, 0x7b309030UL, 0x78c094c0UL, 0x78509550UL, 0x79e097e0UL, 0x79709670UL,
+		0x77008700UL, 0x77908690UL, 0x76208420UL, 0x76b085b0UL, 0x75408140UL, 0x75d080d0UL,
+		0x74608260UL, 0x74f083f0UL, 0x73808b80UL, 0x73108a10UL, 0x72a088a0UL, 0x72308930UL,
+		0x71c08dc0UL, 0x71508c50UL, 0x70e08ee0UL, 0x70708f70UL
+	},
+	{
+		0x00000000UL, 0x41000001UL, 0x82000002UL, 0xc3000003UL, 0xb4030007UL, 0xf5030006UL,
+		0x36030005UL, 0x77030004UL, 0xd805000dUL, 0x9905000cUL, 0x5a05000fUL, 0x1b05000eUL,
+		0x6c06000aUL, 0x2d06000bUL, 0xee060008UL, 0xaf060009UL, 0x00090019UL, 0x41090018UL,
+		0x8209001bUL, 0xc309001aUL, 0xb40a001eUL, 0xf50a001fUL, 0x360a001cUL, 0x770a001dUL,
+		0xd80c0014UL, 0x990c0015UL, 0x5a0c0016UL, 0x1b0c0017UL, 0x6c0f0013UL, 0x2d0f0012UL,
+		0xee0f0011UL, 0xaf0f0010UL, 0x00120032UL, 0x41120033UL, 0x82120030UL, 0xc3120031UL,
+		0xb4110035UL, 0xf5110034UL, 0x36110037UL, 0x77110036UL, 0xd817003fUL, 0x9917003eUL,
+		0x5a17003dUL, 0x1b17003cUL, 0x6c140038UL, 0x2d140039UL, 0xee14003aUL, 0xaf14003bUL,
+		0x001b002bUL, 0x411b002aUL, 0x821b0029UL, 0xc31b0028UL, 0xb418002cUL, 0xf518002dUL,
+		0x3618002eUL, 0x7718002fUL, 0xd81e0026UL, 0x991e0027UL, 0x5a1e0024UL, 0x1b1e0025UL,
+		0x6c1d0021UL, 0x2d1d0020UL, 0xee1d0023UL, 0xaf1d0022UL, 0x00240064UL, 0x41240065UL,
+		0x82240066UL, 0xc3240067UL, 0xb4270063UL, 0xf5270062UL, 0x36270061UL, 0x77270060UL,
+		0xd8210069UL, 0x99210068UL, 0x5a21006bUL, 0x1b21006aUL, 0x6c22006eUL, 0x2d22006fUL,
+		0xee22006cUL, 0xaf22006dUL, 0x002d007dUL, 0x412d007cUL, 0x822d007fUL, 0xc32d007eUL,
+		0xb42e007aUL, 0xf52e007bUL, 0x362e0078UL, 0x772e0079UL, 0xd8280070UL, 0x99280071UL,
+		0x5a280072UL, 0x1b280073UL, 0x6c2b0077UL, 0x2d2b0076UL, 0xee2b0075UL, 0xaf2b0074UL,
+		0x00360056UL, 0x41360057UL, 0x82360054UL, 0xc3360055UL, 0xb4350051UL, 0xf5350050UL,
+		0x36350053UL, 0x77350052UL, 0xd833005bUL, 0x9933005aUL, 0x5a330059UL, 0x1b330058UL,
+		0x6c30005cUL, 0x2d30005dUL, 0xee30005eUL, 0xaf30005fUL, 0x003f004fUL, 0x413f004eUL,
+		0x823f004dUL, 0xc33f004cUL, 0xb43c0048UL, 0xf53c0049UL, 0x363c004aUL, 0x773c004bUL,
+		0xd83a0042UL, 0x993a0043UL, 0x5a3a0040UL, 0x1b3a0041UL, 0x6c390045UL, 0x2d390044UL,
+		0xee390047UL, 0xaf390046UL, 0x004800c8UL, 0x414800c9UL, 0x824800caUL, 0xc34800cbUL,
+		0xb44b00cfUL, 0xf54b00ceUL, 0x364b00cdUL, 0x774b00ccUL, 0xd84d00c5UL, 0x994d00c4UL,
+		0x5a4d00c7UL, 0x1b4d00c6UL, 0x6c4e00c2UL, 0x2d4e00c3UL, 0xee4e00c0UL, 0xaf4e00c1UL,
+		0x004100d1UL, 0x414100d0UL, 0x824100d3UL, 0xc34100d2UL, 0xb44200d6UL, 0xf54200d7UL,
+		0x364200d4UL, 0x774200d5UL, 0xd84400dcUL, 0x994400ddUL, 0x5a4400deUL, 0x1b4400dfUL,
+		0x6c4700dbUL, 0x2d4700daUL, 0xee4700d9UL, 0xaf4700d8UL, 0x005a00faUL, 0x415a00fbUL,
+		0x825a00f8UL, 0xc35a00f9UL, 0xb45900fdUL, 0xf55900fcUL, 0x365900ffUL, 0x775900feUL,
+		0xd85f00f7UL, 0x995f00f6UL, 0x5a5f00f5UL, 0x1b5f00f4UL, 0x6c5c00f0UL, 0x2d5c00f1UL,
+		0xee5c00f2UL, 0xaf5c00f3UL, 0x005300e3UL, 0x415300e2UL, 0x825300e1UL, 0xc35300e0UL,
+		0xb45000e4UL, 0xf55000e5UL, 0x365000e6UL, 0x775000e7UL, 0xd85600eeUL, 0x995600efUL,
+		0x5a5600ecUL, 0x1b5600edUL, 0x6c5500e9UL, 0x2d5500e8UL, 0xee5500ebUL, 0xaf5500eaUL,
+		0x006c00acUL, 0x416c00adUL, 0x826c00aeUL, 0xc36c00afUL, 0xb46f00abUL, 0xf56f00aaUL,
+		0x366f00a9UL, 0x776f00a8UL, 0xd86900a1UL, 0x996900a0UL, 0x5a6900a3UL, 0x1b6900a2UL,
+		0x6c6a00a6UL, 0x2d6a00a7UL, 0xee6a00a4UL, 0xaf6a00a5UL, 0x006500b5UL, 0x416500b4UL,
+		0x826500b7UL, 0xc36500b6UL, 0xb46600b2UL, 0xf56600b3UL, 0x366600b0UL, 0x776600b1UL,
+		0xd86000b8UL, 0x996000b9UL, 0x5a6000baUL, 0x1b6000bbUL, 0x6c6300bfUL, 0x2d6300beUL,
+		0xee6300bdUL, 0xaf6300bcUL, 0x007e009eUL, 0x417e009fUL, 0x827e009cUL, 0xc37e009dUL,
+		0xb47d0099UL, 0xf57d0098UL, 0x367d009bUL, 0x777d009aUL, 0xd87b0093UL, 0x997b0092UL,
+		0x5a7b0091UL, 0x1b7b0090UL, 0x6c780094UL, 0x2d780095UL, 0xee780096UL, 0xaf780097UL,
+		0x00770087UL, 0x41770086UL, 0x82770085UL, 0xc3770084UL, 0xb4740080UL, 0xf5740081UL,
+		0x36740082UL, 0x77740083UL, 0xd872008aUL, 0x9972008bUL, 0x5a720088UL, 0x1b720089UL,
+		0x6c71008dUL, 0x2d71008cUL, 0xee71008fUL, 0xaf71008eUL
+	},
+	{
+		0x00000000UL, 0x90d00101UL, 0x91a30201UL, 0x01730300UL, 0x93450401UL, 0x03950500UL,
+		0x02e60600UL, 0x92360701UL, 0x96890801UL, 0x06590900UL, 0x072a0a00UL, 0x97fa0b01UL,
+		0x05cc0c00UL, 0x951c0d01UL, 0x946f0e01UL, 0x04bf0f00UL, 0x9d111001UL, 0x0dc11100UL,
+		0x0cb21200UL, 0x9c621301UL, 0x0e541400UL, 0x9e841501UL, 0x9ff71601UL, 0x0f271700UL,
+		0x0b981800UL, 0x9b481901UL, 0x9a3b1a01UL, 0x0aeb1b00UL, 0x98dd1c01UL, 0x080d1d00UL,
+		0x097e1e00UL, 0x99ae1f01UL, 0x8a212001UL, 0x1af12100UL, 0x1b822200UL, 0x8b522301UL,
+		0x19642400UL, 0x89b42501UL, 0x88c72601UL, 0x18172700UL, 0x1ca82800UL, 0x8c782901UL,
+		0x8d0b2a01UL, 0x1ddb2b00UL, 0x8fed2c01UL, 0x1f3d2d00UL, 0x1e4e2e00UL, 0x8e9e2f01UL,
+		0x17303000UL, 0x87e03101UL, 0x86933201UL, 0x16433300UL, 0x84753401UL, 0x14a53500UL,
+		0x15d63600UL, 0x85063701UL, 0x81b93801UL, 0x11693900UL, 0x101a3a00UL, 0x80ca3b01UL,
+		0x12fc3c00UL, 0x822c3d01UL, 0x835f3e01UL, 0x138f3f00UL, 0xa4414001UL, 0x34914100UL,
+		0x35e24200UL, 0xa5324301UL, 0x37044400UL, 0xa7d44501UL, 0xa6a74601UL, 0x36774700UL,
+		0x32c84800UL, 0xa2184901UL, 0xa36b4a01UL, 0x33bb4b00UL, 0xa18d4c01UL, 0x315d4d00UL,
+		0x302e4e00UL, 0xa0fe4f01UL, 0x39505000UL, 0xa9805101UL, 0xa8f35201UL, 0x38235300UL,
+		0xaa155401UL, 0x3ac55500UL, 0x3bb65600UL, 0xab665701UL, 0xafd95801UL, 0x3f095900UL,
+		0x3e7a5a00UL, 0xaeaa5b01UL, 0x3c9c5c00UL, 0xac4c5d01UL, 0xad3f5e01UL, 0x3def5f00UL,
+		0x2e606000UL, 0xbeb06101UL, 0xbfc36201UL, 0x2f136300UL, 0xbd256401UL, 0x2df56500UL,
+		0x2c866600UL, 0xbc566701UL, 0xb8e96801UL, 0x28396900UL, 0x294a6a00UL, 0xb99a6b01UL,
+		0x2bac6c00UL, 0xbb7c6d01UL, 0xba0f6e01UL, 0x2adf6f00UL, 0xb3717001UL, 0x23a17100UL,
+		0x22d27200UL, 0xb2027301UL, 0x20347400UL, 0xb0e47501UL, 0xb1977601UL, 0x21477700UL,
+		0x25f87800UL, 0xb5287901UL, 0xb45b7a01UL, 0x248b7b00UL, 0xb6bd7c01UL, 0x266d7d00UL,
+		0x271e7e00UL, 0xb7ce7f01UL, 0xf8818001UL, 0x68518100UL, 0x69228200UL, 0xf9f28301UL,
+		0x6bc48400UL, 0xfb148501UL, 0xfa678601UL, 0x6ab78700UL, 0x6e088800UL, 0xfed88901UL,
+		0xffab8a01UL, 0x6f7b8b00UL, 0xfd4d8c01UL, 0x6d9d8d00UL, 0x6cee8e00UL, 0xfc3e8f01UL,
+		0x65909000UL, 0xf5409101UL, 0xf4339201UL, 0x64e39300UL, 0xf6d59401UL, 0x66059500UL,
+		0x67769600UL, 0xf7a69701UL, 0xf3199801UL, 0x63c99900UL, 0x62ba9a00UL, 0xf26a9b01UL,
+		0x605c9c00UL, 0xf08c9d01UL, 0xf1ff9e01UL, 0x612f9f00UL, 0x72a0a000UL, 0xe270a101UL,
+		0xe303a201UL, 0x73d3a300UL, 0xe1e5a401UL, 0x7135a500UL, 0x7046a600UL, 0xe096a701UL,
+		0xe429a801UL, 0x74f9a900UL, 0x758aaa00UL, 0xe55aab01UL, 0x776cac00UL, 0xe7bcad01UL,
+		0xe6cfae01UL, 0x761faf00UL, 0xefb1b001UL, 0x7f61b100UL, 0x7e12b200UL, 0xeec2b301UL,
+		0x7cf4b400UL, 0xec24b501UL, 0xed57b601UL, 0x7d87b700UL, 0x7938b800UL, 0xe9e8b901UL,
+		0xe89bba01UL, 0x784bbb00UL, 0xea7dbc01UL, 0x7aadbd00UL, 0x7bdebe00UL, 0xeb0ebf01UL,
+		0x5cc0c000UL, 0xcc10c101UL, 0xcd63c201UL, 0x5db3c300UL, 0xcf85c401UL, 0x5f55c500UL,
+		0x5e26c600UL, 0xcef6c701UL, 0xca49c801UL, 0x5a99c900UL, 0x5beaca00UL, 0xcb3acb01UL,
+		0x590ccc00UL, 0xc9dccd01UL, 0xc8afce01UL, 0x587fcf00UL, 0xc1d1d001UL, 0x5101d100UL,
+		0x5072d200UL, 0xc0a2d301UL, 0x5294d400UL, 0xc244d501UL, 0xc337d601UL, 0x53e7d700UL,
+		0x5758d800UL, 0xc788d901UL, 0xc6fbda01UL, 0x562bdb00UL, 0xc41ddc01UL, 0x54cddd00UL,
+		0x55bede00UL, 0xc56edf01UL, 0xd6e1e001UL, 0x4631e100UL, 0x4742e200UL, 0xd792e301UL,
+		0x45a4e400UL, 0xd574e501UL, 0xd407e601UL, 0x44d7e700UL, 0x4068e800UL, 0xd0b8e901UL,
+		0xd1cbea01UL, 0x411beb00UL, 0xd32dec01UL, 0x43fded00UL, 0x428eee00UL, 0xd25eef01UL,
+		0x4bf0f000UL, 0xdb20f101UL, 0xda53f201UL, 0x4a83f300UL, 0xd8b5f401UL, 0x4865f500UL,
+		0x4916f600UL, 0xd9c6f701UL, 0xdd79f801UL, 0x4da9f900UL, 0x4cdafa00UL, 0xdc0afb01UL,
+		0x4e3cfc00UL, 0xdeecfd01UL, 0xdf9ffe01UL, 0x4f4fff00UL
+	},
+	{
+		0x00000000UL, 0x9001d100UL, 0x9000a203UL, 0x00017303UL, 0x90024405UL, 0x00039505UL,
+		0x0002e606UL, 0x90033706UL, 0x90078809UL, 0x00065909UL, 0x00072a0aUL, 0x9006fb0aUL,
+		0x0005cc0cUL, 0x90041d0cUL, 0x90056e0fUL, 0x0004bf0fUL, 0x900c1011UL, 0x000dc111UL,
+		0x000cb212UL, 0x900d6312UL, 0x000e5414UL, 0x900f8514UL, 0x900ef617UL, 0x000f2717UL,
+		0x000b9818UL, 0x900a4918UL, 0x900b3a1bUL, 0x000aeb1bUL, 0x9009dc1dUL, 0x00080d1dUL,
+		0x00097e1eUL, 0x9008af1eUL, 0x901b2021UL, 0x001af121UL, 0x001b8222UL, 0x901a5322UL,
+		0x00196424UL, 0x9018b524UL, 0x9019c627UL, 0x00181727UL, 0x001ca828UL, 0x901d7928UL,
+		0x901c0a2bUL, 0x001ddb2bUL, 0x901eec2dUL, 0x001f3d2dUL, 0x001e4e2eUL, 0x901f9f2eUL,
+		0x00173030UL, 0x9016e130UL, 0x90179233UL, 0x00164333UL, 0x90157435UL, 0x0014a535UL,
+		0x0015d636UL, 0x90140736UL, 0x9010b839UL, 0x00116939UL, 0x00101a3aUL, 0x9011cb3aUL,
+		0x0012fc3cUL, 0x90132d3cUL, 0x90125e3fUL, 0x00138f3fUL, 0x90354041UL, 0x00349141UL,
+		0x0035e242UL, 0x90343342UL, 0x00370444UL, 0x9036d544UL, 0x9037a647UL, 0x00367747UL,
+		0x0032c848UL, 0x90331948UL, 0x90326a4bUL, 0x0033bb4bUL, 0x90308c4dUL, 0x00315d4dUL,
+		0x00302e4eUL, 0x9031ff4eUL, 0x00395050UL, 0x90388150UL, 0x9039f253UL, 0x00382353UL,
+		0x903b1455UL, 0x003ac555UL, 0x003bb656UL, 0x903a6756UL, 0x903ed859UL, 0x003f0959UL,
+		0x003e7a5aUL, 0x903fab5aUL, 0x003c9c5cUL, 0x903d4d5cUL, 0x903c3e5fUL, 0x003def5fUL,
+		0x002e6060UL, 0x902fb160UL, 0x902ec263UL, 0x002f1363UL, 0x902c2465UL, 0x002df565UL,
+		0x002c8666UL, 0x902d5766UL, 0x9029e869UL, 0x00283969UL, 0x00294a6aUL, 0x90289b6aUL,
+		0x002bac6cUL, 0x902a7d6cUL, 0x902b0e6fUL, 0x002adf6fUL, 0x90227071UL, 0x0023a171UL,
+		0x0022d272UL, 0x90230372UL, 0x00203474UL, 0x9021e574UL, 0x90209677UL, 0x00214777UL,
+		0x0025f878UL, 0x90242978UL, 0x90255a7bUL, 0x00248b7bUL, 0x9027bc7dUL, 0x00266d7dUL,
+		0x00271e7eUL, 0x9026cf7eUL, 0x90698081UL, 0x00685181UL, 0x00692282UL, 0x9068f382UL,
+		0x006bc484UL, 0x906a1584UL, 0x906b6687UL, 0x006ab787UL, 0x006e0888UL, 0x906fd988UL,
+		0x906eaa8bUL, 0x006f7b8bUL, 0x906c4c8dUL, 0x006d9d8dUL, 0x006cee8eUL, 0x906d3f8eUL,
+		0x00659090UL, 0x90644190UL, 0x90653293UL, 0x0064e393UL, 0x9067d495UL, 0x00660595UL,
+		0x00677696UL, 0x9066a796UL, 0x90621899UL, 0x0063c999UL, 0x0062ba9aUL, 0x90636b9aUL,
+		0x00605c9cUL, 0x90618d9cUL, 0x9060fe9fUL, 0x00612f9fUL, 0x0072a0a0UL, 0x907371a0UL,
+		0x907202a3UL, 0x0073d3a3UL, 0x9070e4a5UL, 0x007135a5UL, 0x007046a6UL, 0x907197a6UL,
+		0x907528a9UL, 0x0074f9a9UL, 0x00758aaaUL, 0x90745baaUL, 0x00776cacUL, 0x9076bdacUL,
+		0x9077ceafUL, 0x00761fafUL, 0x907eb0b1UL, 0x007f61b1UL, 0x007e12b2UL, 0x907fc3b2UL,
+		0x007cf4b4UL, 0x907d25b4UL, 0x907c56b7UL, 0x007d87b7UL, 0x007938b8UL, 0x9078e9b8UL,
+		0x90799abbUL, 0x00784bbbUL, 0x907b7cbdUL, 0x007aadbdUL, 0x007bdebeUL, 0x907a0fbeUL,
+		0x005cc0c0UL, 0x905d11c0UL, 0x905c62c3UL, 0x005db3c3UL, 0x905e84c5UL, 0x005f55c5UL,
+		0x005e26c6UL, 0x905ff7c6UL, 0x905b48c9UL, 0x005a99c9UL, 0x005beacaUL, 0x905a3bcaUL,
+		0x00590cccUL, 0x9058ddccUL, 0x9059aecfUL, 0x00587fcfUL, 0x9050d0d1UL, 0x005101d1UL,
+		0x005072d2UL, 0x9051a3d2UL, 0x005294d4UL, 0x905345d4UL, 0x905236d7UL, 0x0053e7d7UL,
+		0x005758d8UL, 0x905689d8UL, 0x9057fadbUL, 0x00562bdbUL, 0x90551cddUL, 0x0054cdddUL,
+		0x0055bedeUL, 0x90546fdeUL, 0x9047e0e1UL, 0x004631e1UL, 0x004742e2UL, 0x904693e2UL,
+		0x0045a4e4UL, 0x904475e4UL, 0x904506e7UL, 0x0044d7e7UL, 0x004068e8UL, 0x9041b9e8UL,
+		0x9040caebUL, 0x00411bebUL, 0x90422cedUL, 0x0043fdedUL, 0x00428eeeUL, 0x90435feeUL,
+		0x004bf0f0UL, 0x904a21f0UL, 0x904b52f3UL, 0x004a83f3UL, 0x9049b4f5UL, 0x004865f5UL,
+		0x004916f6UL, 0x9048c7f6UL, 0x904c78f9UL, 0x004da9f9UL, 0x004cdafaUL, 0x904d0bfaUL,
+		0x004e3cfcUL, 0x904fedfcUL, 0x904e9effUL, 0x004f4fffUL
+	},
+	{
+		0x00000000UL, 0x009001d1UL, 0x012003a2UL, 0x01b00273UL, 0x02400744UL, 0x02d00695UL,
+		0x036004e6UL, 0x03f00537UL, 0x04800e88UL, 0x04100f59UL, 0x05a00d2aUL, 0x05300cfbUL,
+		0x06c009ccUL, 0x0650081dUL, 0x07e00a6eUL, 0x07700bbfUL, 0x09001d10UL, 0x09901cc1UL,
+		0x08201eb2UL, 0x08b01f63UL, 0x0b401a54UL, 0x0bd01b85UL, 0x0a6019f6UL, 0x0af01827UL,
+		0x0d801398UL, 0x0d101249UL, 0x0ca0103aUL, 0x0c3011ebUL, 0x0fc014dcUL, 0x0f50150dUL,
+		0x0ee0177eUL, 0x0e7016afUL, 0x12003a20UL, 0x12903bf1UL, 0x13203982UL, 0x13b03853UL,
+		0x10403d64UL, 0x10d03cb5UL, 0x11603ec6UL, 0x11f03f17UL, 0x168034a8UL, 0x16103579UL,
+		0x17a0370aUL, 0x173036dbUL, 0x14c033ecUL, 0x1450323dUL, 0x15e0304eUL, 0x1570319fUL,
+		0x1b002730UL, 0x1b9026e1UL, 0x1a202492UL, 0x1ab02543UL, 0x19402074UL, 0x19d021a5UL,
+		0x186023d6UL, 0x18f02207UL, 0x1f8029b8UL, 0x1f102869UL, 0x1ea02a1aUL, 0x1e302bcbUL,
+		0x1dc02efcUL, 0x1d502f2dUL, 0x1ce02d5eUL, 0x1c702c8fUL, 0x24007440UL, 0x24907591UL,
+		0x252077e2UL, 0x25b07633UL, 0x26407304UL, 0x26d072d5UL, 0x276070a6UL, 0x27f07177UL,
+		0x20807ac8UL, 0x20107b19UL, 0x21a0796aUL, 0x213078bbUL, 0x22c07d8cUL, 0x22507c5dUL,
+		0x23e07e2eUL, 0x23707fffUL, 0x2d006950UL, 0x2d906881UL, 0x2c206af2UL, 0x2cb06b23UL,
+		0x2f406e14UL, 0x2fd06fc5UL, 0x2e606db6UL, 0x2ef06c67UL, 0x298067d8UL, 0x29106609UL,
+		0x28a0647aUL, 0x283065abUL, 0x2bc0609cUL, 0x2b50614dUL, 0x2ae0633eUL, 0x2a7062efUL,
+		0x36004e60UL, 0x36904fb1UL, 0x37204dc2UL, 0x37b04c13UL, 0x34404924UL, 0x34d048f5UL,
+		0x35604a86UL, 0x35f04b57UL, 0x328040e8UL, 0x32104139UL, 0x33a0434aUL, 0x3330429bUL,
+		0x30c047acUL, 0x3050467dUL, 0x31e0440eUL, 0x317045dfUL, 0x3f005370UL, 0x3f9052a1UL,
+		0x3e2050d2UL, 0x3eb05103UL, 0x3d405434UL, 0x3dd055e5UL, 0x3c605796UL, 0x3cf05647UL,
+		0x3b805df8UL, 0x3b105c29UL, 0x3aa05e5aUL, 0x3a305f8bUL, 0x39c05abcUL, 0x39505b6dUL,
+		0x38e0591eUL, 0x387058cfUL, 0x4800e880UL, 0x4890e951UL, 0x4920eb22UL, 0x49b0eaf3UL,
+		0x4a40efc4UL, 0x4ad0ee15UL, 0x4b60ec66UL, 0x4bf0edb7UL, 0x4c80e608UL, 0x4c10e7d9UL,
+		0x4da0e5aaUL, 0x4d30e47bUL, 0x4ec0e14cUL, 0x4e50e09dUL, 0x4fe0e2eeUL, 0x4f70e33fUL,
+		0x4100f590UL, 0x4190f441UL, 0x4020f632UL, 0x40b0f7e3UL, 0x4340f2d4UL, 0x43d0f305UL,
+		0x4260f176UL, 0x42f0f0a7UL, 0x4580fb18UL, 0x4510fac9UL, 0x44a0f8baUL, 0x4430f96bUL,
+		0x47c0fc5cUL, 0x4750fd8dUL, 0x46e0fffeUL, 0x4670fe2fUL, 0x5a00d2a0UL, 0x5a90d371UL,
+		0x5b20d102UL, 0x5bb0d0d3UL, 0x5840d5e4UL, 0x58d0d435UL, 0x5960d646UL, 0x59f0d797UL,
+		0x5e80dc28UL, 0x5e10ddf9UL, 0x5fa0df8aUL, 0x5f30de5bUL, 0x5cc0db6cUL, 0x5c50dabdUL,
+		0x5de0d8ceUL, 0x5d70d91fUL, 0x5300cfb0UL, 0x5390ce61UL, 0x5220cc12UL, 0x52b0cdc3UL,
+		0x5140c8f4UL, 0x51d0c925UL, 0x5060cb56UL, 0x50f0ca87UL, 0x5780c138UL, 0x5710c0e9UL,
+		0x56a0c29aUL, 0x5630c34bUL, 0x55c0c67cUL, 0x5550c7adUL, 0x54e0c5deUL, 0x5470c40fUL,
+		0x6c009cc0UL, 0x6c909d11UL, 0x6d209f62UL, 0x6db09eb3UL, 0x6e409b84UL, 0x6ed09a55UL,
+		0x6f609826UL, 0x6ff099f7UL, 0x68809248UL, 0x68109399UL, 0x69a091eaUL, 0x6930903bUL,
+		0x6ac0950cUL, 0x6a5094ddUL, 0x6be096aeUL, 0x6b70977fUL, 0x650081d0UL, 0x65908001UL,
+		0x64208272UL, 0x64b083a3UL, 0x67408694UL, 0x67d08745UL, 0x66608536UL, 0x66f084e7UL,
+		0x61808f58UL, 0x61108e89UL, 0x60a08cfaUL, 0x60308d2bUL, 0x63c0881cUL, 0x635089cdUL,
+		0x62e08bbeUL, 0x62708a6fUL, 0x7e00a6e0UL, 0x7e90a731UL, 0x7f20a542UL, 0x7fb0a493UL,
+		0x7c40a1a4UL, 0x7cd0a075UL, 0x7d60a206UL, 0x7df0a3d7UL, 0x7a80a868UL, 0x7a10a9b9UL,
+		0x7ba0abcaUL, 0x7b30aa1bUL, 0x78c0af2cUL, 0x7850aefdUL, 0x79e0ac8eUL, 0x7970ad5fUL,
+		0x7700bbf0UL, 0x7790ba21UL, 0x7620b852UL, 0x76b0b983UL, 0x7540bcb4UL, 0x75d0bd65UL,
+		0x7460bf16UL, 0x74f0bec7UL, 0x7380b578UL, 0x7310b4a9UL, 0x72a0b6daUL, 0x7230b70bUL,
+		0x71c0b23cUL, 0x7150b3edUL, 0x70e0b19eUL, 0x7070b04fUL
+	},
+	{
+		0x00000000UL, 0x65904101UL, 0xcb208202UL, 0xaeb0c303UL, 0x26420407UL, 0x43d24506UL,
+		0xed628605UL, 0x88f2c704UL, 0x4c84080eUL, 0x2914490fUL, 0x87a48a0cUL, 0xe234cb0dUL,
+		0x6ac60c09UL, 0x0f564d08UL, 0xa1e68e0bUL, 0xc476cf0aUL, 0x9908101cUL, 0xfc98511dUL,
+		0x5228921eUL, 0x37b8d31fUL, 0xbf4a141bUL, 0xdada551aUL, 0x746a9619UL, 0x11fad718UL,
+		0xd58c1812UL, 0xb01c5913UL, 0x1eac9a10UL, 0x7b3cdb11UL, 0xf3ce1c15UL, 0x965e5d14UL,
+		0x38ee9e17UL, 0x5d7edf16UL, 0x8213203bUL, 0xe783613aUL, 0x4933a239UL, 0x2ca3e338UL,
+		0xa451243cUL, 0xc1c1653dUL, 0x6f71a63eUL, 0x0ae1e73fUL, 0xce972835UL, 0xab076934UL,
+		0x05b7aa37UL, 0x6027eb36UL, 0xe8d52c32UL, 0x8d456d33UL, 0x23f5ae30UL, 0x4665ef31UL,
+		0x1b1b3027UL, 0x7e8b7126UL, 0xd03bb225UL, 0xb5abf324UL, 0x3d593420UL, 0x58c97521UL,
+		0xf679b622UL, 0x93e9f723UL, 0x579f3829UL, 0x320f7928UL, 0x9cbfba2bUL, 0xf92ffb2aUL,
+		0x71dd3c2eUL, 0x144d7d2fUL, 0xbafdbe2cUL, 0xdf6dff2dUL, 0xb4254075UL, 0xd1b50174UL,
+		0x7f05c277UL, 0x1a958376UL, 0x92674472UL, 0xf7f70573UL, 0x5947c670UL, 0x3cd78771UL,
+		0xf8a1487bUL, 0x9d31097aUL, 0x3381ca79UL, 0x56118b78UL, 0xdee34c7cUL, 0xbb730d7dUL,
+		0x15c3ce7eUL, 0x70538f7fUL, 0x2d2d5069UL, 0x48bd1168UL, 0xe60dd26bUL, 0x839d936aUL,
+		0x0b6f546eUL, 0x6eff156fUL, 0xc04fd66cUL, 0xa5df976dUL, 0x61a95867UL, 0x04391966UL,
+		0xaa89da65UL, 0xcf199b64UL, 0x47eb5c60UL, 0x227b1d61UL, 0x8ccbde62UL, 0xe95b9f63UL,
+		0x3636604eUL, 0x53a6214fUL, 0xfd16e24cUL, 0x9886a34dUL, 0x10746449UL, 0x75e42548UL,
+		0xdb54e64bUL, 0xbec4a74aUL, 0x7ab26840UL, 0x1f222941UL, 0xb192ea42UL, 0xd402ab43UL,
+		0x5cf06c47UL, 0x39602d46UL, 0x97d0ee45UL, 0xf240af44UL, 0xaf3e7052UL, 0xcaae3153UL,
+		0x641ef250UL, 0x018eb351UL, 0x897c7455UL, 0xecec3554UL, 0x425cf657UL, 0x27ccb756UL,
+		0xe3ba785cUL, 0x862a395dUL, 0x289afa5eUL, 0x4d0abb5fUL, 0xc5f87c5bUL, 0xa0683d5aUL,
+		0x0ed8fe59UL, 0x6b48bf58UL, 0xd84980e9UL, 0xbdd9c1e8UL, 0x136902ebUL, 0x76f943eaUL,
+		0xfe0b84eeUL, 0x9b9bc5efUL, 0x352b06ecUL, 0x50bb47edUL, 0x94cd88e7UL, 0xf15dc9e6UL,
+		0x5fed0ae5UL, 0x3a7d4be4UL, 0xb28f8ce0UL, 0xd71fcde1UL, 0x79af0ee2UL, 0x1c3f4fe3UL,
+		0x414190f5UL, 0x24d1d1f4UL, 0x8a6112f7UL, 0xeff153f6UL, 0x670394f2UL, 0x0293d5f3UL,
+		0xac2316f0UL, 0xc9b357f1UL, 0x0dc598fbUL, 0x6855d9faUL, 0xc6e51af9UL, 0xa3755bf8UL,
+		0x2b879cfcUL, 0x4e17ddfdUL, 0xe0a71efeUL, 0x85375fffUL, 0x5a5aa0d2UL, 0x3fcae1d3UL,
+		0x917a22d0UL, 0xf4ea63d1UL, 0x7c18a4d5UL, 0x1988e5d4UL, 0xb73826d7UL, 0xd2a867d6UL,
+		0x16dea8dcUL, 0x734ee9ddUL, 0xddfe2adeUL, 0xb86e6bdfUL, 0x309cacdbUL, 0x550ceddaUL,
+		0xfbbc2ed9UL, 0x9e2c6fd8UL, 0xc352b0ceUL, 0xa6c2f1cfUL, 0x087232ccUL, 0x6de273cdUL,
+		0xe510b4c9UL, 0x8080f5c8UL, 0x2e3036cbUL, 0x4ba077caUL, 0x8fd6b8c0UL, 0xea46f9c1UL,
+		0x44f63ac2UL, 0x21667bc3UL, 0xa994bcc7UL, 0xcc04fdc6UL, 0x62b43ec5UL, 0x07247fc4UL,
+		0x6c6cc09cUL, 0x09fc819dUL, 0xa74c429eUL, 0xc2dc039fUL, 0x4a2ec49bUL, 0x2fbe859aUL,
+		0x810e4699UL, 0xe49e0798UL, 0x20e8c892UL, 0x45788993UL, 0xebc84a90UL, 0x8e580b91UL,
+		0x06aacc95UL, 0x633a8d94UL, 0xcd8a4e97UL, 0xa81a0f96UL, 0xf564d080UL, 0x90f49181UL,
+		0x3e445282UL, 0x5bd41383UL, 0xd326d487UL, 0xb6b69586UL, 0x18065685UL, 0x7d961784UL,
+		0xb9e0d88eUL, 0xdc70998fUL, 0x72c05a8cUL, 0x17501b8dUL, 0x9fa2dc89UL, 0xfa329d88UL,
+		0x54825e8bUL, 0x31121f8aUL, 0xee7fe0a7UL, 0x8befa1a6UL, 0x255f62a5UL, 0x40cf23a4UL,
+		0xc83de4a0UL, 0xadada5a1UL, 0x031d66a2UL, 0x668d27a3UL, 0xa2fbe8a9UL, 0xc76ba9a8UL,
+		0x69db6aabUL, 0x0c4b2baaUL, 0x84b9ecaeUL, 0xe129adafUL, 0x4f996eacUL, 0x2a092fadUL,
+		0x7777f0bbUL, 0x12e7b1baUL, 0xbc5772b9UL, 0xd9c733b8UL, 0x5135f4bcUL, 0x34a5b5bdUL,
+		0x9a1576beUL, 0xff8537bfUL, 0x3bf3f8b5UL, 0x5e63b9b4UL, 0xf0d37ab7UL, 0x95433bb6UL,
+		0x1db1fcb2UL, 0x7821bdb3UL, 0xd6917eb0UL, 0xb3013fb1UL
+	}
+};
+
+/* The GF(2^8) multiply by 2 (alpha) table, with the primitive polynomial x^8 + x^4 + x^3 + x^2 + 1
+ */
+static const uint8_t libodraw_checksum_ecc_f_table[ 256 ] = {
+	0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16,
+	0x18, 0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e,
+	0x30, 0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3e, 0x40, 0x42, 0x44, 0x46,
+	0x48, 0x4a, 0x4c, 0x4e, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5a, 0x5c, 0x5e,
+	0x60, 0x62, 0x64, 0x66, 0x68, 0x6a, 0x6c, 0x6e, 0x70, 0x72, 0x74, 0x76,
+	0x78, 0x7a, 0x7c, 0x7e, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8e,
+	0x90, 0x92, 0x94, 0x96, 0x98, 0x9a, 0x9c, 0x9e, 0xa0, 0xa2, 0xa4, 0xa6,
+	0xa8, 0xaa, 0xac, 0xae, 0xb0, 0xb2, 0xb4, 0xb6, 0xb8, 0xba, 0xbc, 0xbe,
+	0xc0, 0xc2, 0xc4, 0xc6, 0xc8, 0xca, 0xcc, 0xce, 0xd0, 0xd2, 0xd4, 0xd6,
+	0xd8, 0xda, 0xdc, 0xde, 0xe0, 0xe2, 0xe4, 0xe6, 0xe8, 0xea, 0xec, 0xee,
+	0xf0, 0xf2, 0xf4, 0xf6, 0xf8, 0xfa, 0xfc, 0xfe, 0x1d, 0x1f, 0x19, 0x1b,
+	0x15, 0x17, 0x11, 0x13, 0x0d, 0x0f, 0x09, 0x0b, 0x05, 0x07, 0x01, 0x03,
+	0x3d, 0x3f, 0x39, 0x3b, 0x35, 0x37, 0x31, 0x33, 0x2d, 0x2f, 0x29, 0x2b,
+	0x25, 0x27, 0x21, 0x23, 0x5d, 0x5f, 0x59, 0x5b, 0x55, 0x57, 0x51, 0x53,
+	0x4d, 0x4f, 0x49, 0x4b, 0x45, 0x47, 0x41, 0x43, 0x7d, 0x7f, 0x79, 0x7b,
+	0x75, 0x77, 0x71, 0x73, 0x6d, 0x6f, 0x69, 0x6b, 0x65, 0x67, 0x61, 0x63,
+	0x9d, 0x9f, 0x99, 0x9b, 0x95, 0x97, 0x91, 0x93, 0x8d, 0x8f, 0x89, 0x8b,
+	0x85, 0x87, 0x81, 0x83, 0xbd, 0xbf, 0xb9, 0xbb, 0xb5, 0xb7, 0xb1, 0xb3,
+	0xad, 0xaf, 0xa9, 0xab, 0xa5, 0xa7, 0xa1, 0xa3, 0xdd, 0xdf, 0xd9, 0xdb,
+	0xd5, 0xd7, 0xd1, 0xd3, 0xcd, 0xcf, 0xc9, 0xcb, 0xc5, 0xc7, 0xc1, 0xc3,
+	0xfd, 0xff, 0xf9, 0xfb, 0xf5, 0xf7, 0xf1, 0xf3, 0xed, 0xef, 0xe9, 0xeb,
+	0xe5, 0xe7, 0xe1, 0xe3
+};
+
+/* The GF(2^8) divide by 3 (alpha + 1) table
+ */
+static const uint8_t libodraw_checksum_ecc_b_table[ 256 ] = {
+	0x00, 0xf4, 0xf5, 0x01, 0xf7, 0x03, 0x02, 0xf6, 0xf3, 0x07, 0x06, 0xf2,
+	0x04, 0xf0, 0xf1, 0x05, 0xfb, 0x0f, 0x0e, 0xfa, 0x0c, 0xf8, 0xf9, 0x0d,
+	0x08, 0xfc, 0xfd, 0x09, 0xff, 0x0b, 0x0a, 0xfe, 0xeb, 0x1f, 0x1e, 0xea,
+	0x1c, 0xe8, 0xe9, 0x1d, 0x18, 0xec, 0xed, 0x19, 0xef, 0x1b, 0x1a, 0xee,
+	0x10, 0xe4, 0xe5, 0x11, 0xe7, 0x13, 0x12, 0xe6, 0xe3, 0x17, 0x16, 0xe2,
+	0x14, 0xe0, 0xe1, 0x15, 0xcb, 0x3f, 0x3e, 0xca, 0x3c, 0xc8, 0xc9, 0x3d,
+	0x38, 0xcc, 0xcd, 0x39, 0xcf, 0x3b, 0x3a, 0xce, 0x30, 0xc4, 0xc5, 0x31,
+	0xc7, 0x33, 0x32, 0xc6, 0xc3, 0x37, 0x36, 0xc2, 0x34, 0xc0, 0xc1, 0x35,
+	0x20, 0xd4, 0xd5, 0x21, 0xd7, 0x23, 0x22, 0xd6, 0xd3, 0x27, 0x26, 0xd2,
+	0x24, 0xd0, 0xd1, 0x25, 0xdb, 0x2f, 0x2e, 0xda, 0x2c, 0xd8, 0xd9, 0x2d,
+	0x28, 0xdc, 0xdd, 0x29, 0xdf, 0x2b, 0x2a, 0xde, 0x8b, 0x7f, 0x7e, 0x8a,
+	0x7c, 0x88, 0x89, 0x7d, 0x78, 0x8c, 0x8d, 0x79, 0x8f, 0x7b, 0x7a, 0x8e,
+	0x70, 0x84, 0x85, 0x71, 0x87, 0x73, 0x72, 0x86, 0x83, 0x77, 0x76, 0x82,
+	0x74, 0x80, 0x81, 0x75, 0x60, 0x94, 0x95, 0x61, 0x97, 0x63, 0x62, 0x96,
+	0x93, 0x67, 0x66, 0x92, 0x64, 0x90, 0x91, 0x65, 0x9b, 0x6f, 0x6e, 0x9a,
+	0x6c, 0x98, 0x99, 0x6d, 0x68, 0x9c, 0x9d, 0x69, 0x9f, 0x6b, 0x6a, 0x9e,
+	0x40, 0xb4, 0xb5, 0x41, 0xb7, 0x43, 0x42, 0xb6, 0xb3, 0x47, 0x46, 0xb2,
+	0x44, 0xb0, 0xb1, 0x45, 0xbb, 0x4f, 0x4e, 0xba, 0x4c, 0xb8, 0xb9, 0x4d,
+	0x48, 0xbc, 0xbd, 0x49, 0xbf, 0x4b, 0x4a, 0xbe, 0xab, 0x5f, 0x5e, 0xaa,
+	0x5c, 0xa8, 0xa9, 0x5d, 0x58, 0xac, 0xad, 0x59, 0xaf, 0x5b, 0x5a, 0xae,
+	0x50, 0xa4, 0xa5, 0x51, 0xa7, 0x53, 0x52, 0xa6, 0xa3, 0x57, 0x56, 0xa2,
+	0x54, 0xa0, 0xa1, 0x55
+};
+
+/* Calculates the EDC (CRC-32) of a buffer
+ * Use a previous EDC value to calculate the EDC of successive buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_edc(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_checksum_calculate_edc";
+	uint32_t safe_checksum = 0;
+	uint32_t value_32bit   = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_checksum = initial_value;
+
+	/* Process 8 bytes per iteration using the slice-by-8 tables
+	 */
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 buffer,
+		 value_32bit );
+
+		safe_checksum ^= value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 4 ] ),
+		 value_32bit );
+
+		safe_checksum = libodraw_checksum_edc_table[ 7 ][ safe_checksum & 0xff ]
+		              ^ libodraw_checksum_edc_table[ 6 ][ ( safe_checksum >> 8 ) & 0xff ]
+		              ^ libodraw_checksum_edc_table[ 5 ][ ( safe_checksum >> 16 ) & 0xff ]
+		              ^ libodraw_checksum_edc_table[ 4 ][ safe_checksum >> 24 ]
+		              ^ libodraw_checksum_edc_table[ 3 ][ value_32bit & 0xff ]
+		              ^ libodraw_checksum_edc_table[ 2 ][ ( value_32bit >> 8 ) & 0xff ]
+		              ^ libodraw_checksum_edc_table[ 1 ][ ( value_32bit >> 16 ) & 0xff ]
+		              ^ libodraw_checksum_edc_table[ 0 ][ value_32bit >> 24 ];
+
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		safe_checksum = libodraw_checksum_edc_table[ 0 ][ ( safe_checksum ^ *buffer ) & 0xff ] ^ ( safe_checksum >> 8 );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	*checksum_value = safe_checksum;
+
+	return( 1 );
+}
+
+/* Calculates a set of ECC (Reed-Solomon product code) parity vectors
+ * This function calculates both parity bytes of each of the major vectors
+ */
+static void libodraw_checksum_calculate_ecc_vectors(
+      const uint8_t *data,
+      uint16_t number_of_major_vectors,
+      uint16_t number_of_minor_vectors,
+      uint16_t major_multiplier,
+      uint16_t minor_increment,
+      uint8_t *parity )
+{
+	uint32_t data_index   = 0;
+	uint32_t data_size    = 0;
+	uint16_t major_vector = 0;
+	uint16_t minor_vector = 0;
+	uint8_t parity_a      = 0;
+	uint8_t parity_b      = 0;
+	uint8_t value_8bit    = 0;
+
+	data_size = (uint32_t) number_of_major_vectors * (uint32_t) number_of_minor_vectors;
+
+	for( major_vector = 0;
+	     major_vector < number_of_major_vectors;
+	     major_vector++ )
+	{
+		data_index = ( (uint32_t) ( major_vector >> 1 ) * major_multiplier ) + ( major_vector & 1 );
+		parity_a   = 0;
+		parity_b   = 0;
+
+		for( minor_vector = 0;
+		     minor_vector < number_of_minor_vectors;
+		     minor_vector++ )
+		{
+			value_8bit  = data[ data_index ];
+			data_index += minor_increment;
+
+			if( data_index >= data_size )
+			{
+				data_index -= data_size;
+			}
+			parity_a ^= value_8bit;
+			parity_b ^= value_8bit;
+			parity_a  = libodraw_checksum_ecc_f_table[ parity_a ];
+		}
+		parity_a = libodraw_checksum_ecc_b_table[ libodraw_checksum_ecc_f_table[ parity_a ] ^ parity_b ];
+
+		parity[ major_vector ]                           = parity_a;
+		parity[ major_vector + number_of_major_vectors ] = parity_a ^ parity_b;
+	}
+}
+
+/* Calculates the ECC P parity
+ * The data starts with the 4 byte sector header and must contain 2064 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_ecc_p(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *parity,
+     size_t parity_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_checksum_calculate_ecc_p";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( parity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parity.",
+		 function );
+
+		return( -1 );
+	}
+	if( parity_size < LIBODRAW_CHECKSUM_ECC_P_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid parity size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The P parity consists of 86 vectors of 24 bytes
+	 */
+	libodraw_checksum_calculate_ecc_vectors(
+	 data,
+	 86,
+	 24,
+	 2,
+	 86,
+	 parity );
+
+	return( 1 );
+}
+
+/* Calculates the ECC Q parity
+ * The data starts with the 4 byte sector header and must contain 2236 bytes,
+ * which includes the P parity
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_ecc_q(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *parity,
+     size_t parity_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_checksum_calculate_ecc_q";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( parity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parity.",
+		 function );
+
+		return( -1 );
+	}
+	if( parity_size < LIBODRAW_CHECKSUM_ECC_Q_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid parity size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The Q parity consists of 52 diagonal vectors of 43 bytes
+	 */
+	libodraw_checksum_calculate_ecc_vectors(
+	 data,
+	 52,
+	 43,
+	 86,
+	 88,
+	 parity );
+
+	return( 1 );
+}
+
@@ -0,0 +1,76 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_CHECKSUM_H )
+#define _LIBODRAW_CHECKSUM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the data covered by the P parity
+ */
+#define LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE		2064
+
+/* The size of the data covered by the Q parity, which includes the P parity
+ */
+#define LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE		2236
+
+/* The size of the P parity
+ */
+#define LIBODRAW_CHECKSUM_ECC_P_SIZE			172
+
+/* The size of the Q parity
+ */
+#define LIBODRAW_CHECKSUM_ECC_Q_SIZE			104
+
+int libodraw_checksum_calculate_edc(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int libodraw_checksum_calculate_ecc_p(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *parity,
+     size_t parity_size,
+     libcerror_error_t **error );
+
+int libodraw_checksum_calculate_ecc_q(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *parity,
+     size_t parity_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_CHECKSUM_H ) */
+
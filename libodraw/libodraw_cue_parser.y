@@ -21,6 +21,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 
@@ -34,12 +35,9 @@
 #include "libodraw_libcnotify.h"
 #include "libodraw_types.h"
 
-#define YYMALLOC	libodraw_cue_scanner_alloc
-#define YYREALLOC	libodraw_cue_scanner_realloc
-#define YYFREE		libodraw_cue_scanner_free
-
-#define YYLEX_PARAM	NULL
-#define YYPARSE_PARAM	parser_state
+#define YYMALLOC	memory_allocate
+#define YYREALLOC	memory_reallocate
+#define YYFREE		memory_free
 
 #if defined( HAVE_DEBUG_OUTPUT )
 #define libodraw_cue_parser_rule_print( string ) \
@@ -63,34 +61,21 @@
 /* %name-prefix="libodraw_cue_scanner_" replaced by -p libodraw_cue_scanner_ */
 /* %no-lines replaced by -l */
 
-%lex-param { (void *) NULL }
+%define api.pure
+%lex-param { void *scanner }
 %parse-param { void *parser_state }
+%parse-param { void *scanner }
 
-%start cue_main
-
-%union
+%code requires
 {
-        /* The numeric value
-         */
-        uint32_t numeric_value;
-
-        /* The string value
-         */
-	struct cue_string_value
-	{
-		/* The string data
-		 */
-	        const char *data;
-
-		/* The string length
-		 */
-		size_t length;
-
-	} string_value;
-}
+#include <common.h>
+#include <types.h>
 
-%{
+#include "libodraw_libcerror.h"
+#include "libodraw_types.h"
 
+/* The parser state is shared by the reentrant parser and scanner
+ */
 typedef struct libodraw_cue_parser_state libodraw_cue_parser_state_t;
 
 struct libodraw_cue_parser_state
@@ -194,51 +179,79 @@ struct libodraw_cue_parser_state
 	/* The current index
 	 */
 	int current_index;
+
+	/* The scanner buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* Value to indicate the scanner should suppress error output
+	 */
+	int suppress_error;
 };
+}
 
-typedef size_t yy_size_t;
-typedef struct yy_buffer_state* YY_BUFFER_STATE;
+%start cue_main
 
-extern \
-int libodraw_cue_scanner_suppress_error;
+%union
+{
+        /* The numeric value
+         */
+        uint32_t numeric_value;
 
-extern \
-int libodraw_cue_scanner_lex_destroy(
-     void );
+        /* The string value
+         */
+	struct cue_string_value
+	{
+		/* The string data
+		 */
+	        const char *data;
 
-extern \
-void *libodraw_cue_scanner_alloc(
-       yy_size_t size );
+		/* The string length
+		 */
+		size_t length;
+
+	} string_value;
+}
+
+%{
+
+typedef size_t yy_size_t;
+typedef struct yy_buffer_state* YY_BUFFER_STATE;
 
 extern \
-void *libodraw_cue_scanner_realloc(
-       void *buffer,
-       yy_size_t size );
+int libodraw_cue_scanner_lex_init_extra(
+     libodraw_cue_parser_state_t *parser_state,
+     void **scanner );
 
 extern \
-void libodraw_cue_scanner_free(
-      void *buffer );
+int libodraw_cue_scanner_lex_destroy(
+     void *scanner );
 
 extern \
 int libodraw_cue_scanner_lex(
-     void *user_data );
+     YYSTYPE *value,
+     void *scanner );
 
 extern \
 void libodraw_cue_scanner_error(
       void *parser_state,
+      void *scanner,
       const char *error_string );
 
 extern \
 YY_BUFFER_STATE libodraw_cue_scanner__scan_buffer(
                  char *buffer,
-                 yy_size_t buffer_size );
+                 yy_size_t buffer_size,
+                 void *scanner );
 
 extern \
 void libodraw_cue_scanner__delete_buffer(
-      YY_BUFFER_STATE buffer_state );
+      YY_BUFFER_STATE buffer_state,
+      void *scanner );
 
 extern \
-size_t libodraw_cue_scanner_buffer_offset;
+void libodraw_cue_scanner_restore_buffer(
+      void *scanner );
 
 static char *libodraw_cue_parser_function = "libodraw_cue_parser";
 
@@ -266,6 +279,12 @@ int libodraw_cue_parser_parse_buffer(
      size_t buffer_size,
      libcerror_error_t **error );
 
+int libodraw_cue_parser_parse_terminated_buffer(
+     libodraw_handle_t *handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 %}
 
 /* Associativity rules
@@ -1020,7 +1039,7 @@ cue_remark
 		libodraw_cue_parser_rule_print(
 		 "cue_remark" );
 
-		libodraw_cue_scanner_suppress_error = 0;
+		( (libodraw_cue_parser_state_t *) parser_state )->suppress_error = 0;
 	}
 	;
 
@@ -1030,7 +1049,7 @@ cue_remark_start
 		/* The build-in rule error will gobble up all the tokens until the end-of-line
 		 * because these are no syntax errors suppress the error output
 		 */
-		libodraw_cue_scanner_suppress_error = 1;
+		( (libodraw_cue_parser_state_t *) parser_state )->suppress_error = 1;
 	}
 	;
 
@@ -1549,6 +1568,7 @@ int libodraw_cue_parser_parse_track_type(
 }
 
 /* Parses a CUE file
+ * The buffer does not need to be terminated, a terminated copy of the buffer is parsed
  * Returns 1 if successful or -1 on error
  */
 int libodraw_cue_parser_parse_buffer(
@@ -1556,11 +1576,103 @@ int libodraw_cue_parser_parse_buffer(
      const uint8_t *buffer,
      size_t buffer_size,
      libcerror_error_t **error )
+{
+	uint8_t *terminated_buffer = NULL;
+	static char *function      = "libodraw_cue_parser_parse_buffer";
+	int result                 = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) ( SSIZE_MAX - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	terminated_buffer = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ( buffer_size + 2 ) );
+
+	if( terminated_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create terminated buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > 0 )
+	{
+		if( memory_copy(
+		     terminated_buffer,
+		     buffer,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	terminated_buffer[ buffer_size ]     = 0;
+	terminated_buffer[ buffer_size + 1 ] = 0;
+
+	result = libodraw_cue_parser_parse_terminated_buffer(
+	          handle,
+	          terminated_buffer,
+	          buffer_size + 2,
+	          error );
+
+	memory_free(
+	 terminated_buffer );
+
+	return( result );
+
+on_error:
+	if( terminated_buffer != NULL )
+	{
+		memory_free(
+		 terminated_buffer );
+	}
+	return( -1 );
+}
+
+/* Parses a CUE file from a buffer that ends with 2 zero bytes
+ * The buffer is scanned in place, hence it must be writable memory owned by the library,
+ * the scanner restores the bytes it temporarily overwrites before returning
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_parser_parse_terminated_buffer(
+     libodraw_handle_t *handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
 {
 	libodraw_cue_parser_state_t parser_state;
-	
-	static char *function        = "libodraw_cue_parser_parse_buffer";
+
+	static char *function        = "libodraw_cue_parser_parse_terminated_buffer";
 	YY_BUFFER_STATE buffer_state = NULL;
+	void *scanner                = NULL;
 	size_t buffer_offset         = 0;
 	int result                   = -1;
 
@@ -1575,7 +1687,31 @@ int libodraw_cue_parser_parse_buffer(
 
 		return( -1 );
 	}
-	if( buffer_size >= 3 )
+	if( ( buffer_size < 2 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer[ buffer_size - 2 ] != 0 )
+	 || ( buffer[ buffer_size - 1 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid buffer - missing terminating zero bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size >= 5 )
 	{
 		if( ( buffer[ 0 ] == 0x0ef )
 		 && ( buffer[ 1 ] == 0x0bb )
@@ -1584,13 +1720,50 @@ int libodraw_cue_parser_parse_buffer(
 			buffer_offset = 3;
 		}
 	}
+	if( memory_set(
+	     &parser_state,
+	     0,
+	     sizeof( libodraw_cue_parser_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parser state.",
+		 function );
+
+		goto on_error;
+	}
+	parser_state.buffer_offset = buffer_offset;
+
+	if( libodraw_cue_scanner_lex_init_extra(
+	     &parser_state,
+	     &scanner ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize scanner.",
+		 function );
+
+		goto on_error;
+	}
 	buffer_state = libodraw_cue_scanner__scan_buffer(
 	                (char *) &( buffer[ buffer_offset ] ),
-	                buffer_size - buffer_offset );
+	                buffer_size - buffer_offset,
+	                scanner );
 
-	libodraw_cue_scanner_buffer_offset = (size_t) buffer_offset;
-
-	if( buffer_state != NULL )
+	if( buffer_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scanner buffer.",
+		 function );
+	}
+	else
 	{
 		parser_state.handle                         = handle;
 		parser_state.error                          = error;
@@ -1618,12 +1791,20 @@ int libodraw_cue_parser_parse_buffer(
 		parser_state.current_index                  = 0;
 
 		if( libodraw_cue_scanner_parse(
-		     &parser_state ) == 0 )
+		     &parser_state,
+		     scanner ) == 0 )
 		{
 			result = 1;
 		}
+		/* The scanner temporarily replaces the character following a token
+		 * by a zero byte, which remains replaced if parsing was aborted
+		 */
+		libodraw_cue_scanner_restore_buffer(
+		 scanner );
+
 		libodraw_cue_scanner__delete_buffer(
-		 buffer_state );
+		 buffer_state,
+		 scanner );
 
 		if( parser_state.current_session > 0 )
 		{
@@ -1692,8 +1873,12 @@ int libodraw_cue_parser_parse_buffer(
 			}
 		}
 	}
-	libodraw_cue_scanner_lex_destroy();
+	libodraw_cue_scanner_lex_destroy(
+	 scanner );
 
 	return( result );
+
+on_error:
+	return( -1 );
 }
 
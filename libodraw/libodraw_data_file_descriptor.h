@@ -50,6 +50,20 @@ struct libodraw_data_file_descriptor
 	/* The type
 	 */
 	uint8_t type;
+
+	/* The offset of the sector data relative to the start of the data file
+	 * contains the size of the header for WAVE and AIFF data files
+	 */
+	off64_t data_offset;
+
+	/* The size of the sector data
+	 * contains 0 if the sector data extends to the end of the data file
+	 */
+	size64_t data_size;
+
+	/* The byte order of the audio samples
+	 */
+	uint8_t byte_order;
 };
 
 int libodraw_data_file_descriptor_initialize(
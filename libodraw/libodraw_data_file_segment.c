@@ -0,0 +1,197 @@
+/*
+ * Data file segment functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_data_file_segment.h"
+#include "libodraw_libcerror.h"
+
+/* Compares two data file segments by data file index and data file offset
+ * Returns a negative value if the first segment is stored before the second,
+ * 0 if both are stored at the same offset or a positive value otherwise
+ */
+static int libodraw_data_file_segment_compare(
+            const void *first_segment,
+            const void *second_segment )
+{
+	const libodraw_data_file_segment_t *first  = (const libodraw_data_file_segment_t *) first_segment;
+	const libodraw_data_file_segment_t *second = (const libodraw_data_file_segment_t *) second_segment;
+
+	if( first->data_file_index < second->data_file_index )
+	{
+		return( -1 );
+	}
+	if( first->data_file_index > second->data_file_index )
+	{
+		return( 1 );
+	}
+	if( first->data_file_offset < second->data_file_offset )
+	{
+		return( -1 );
+	}
+	if( first->data_file_offset > second->data_file_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts data file segments by data file index and data file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_segments_sort(
+     libodraw_data_file_segment_t *segments,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_data_file_segments_sort";
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of segments value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments > 1 )
+	{
+		qsort(
+		 segments,
+		 (size_t) number_of_segments,
+		 sizeof( libodraw_data_file_segment_t ),
+		 &libodraw_data_file_segment_compare );
+	}
+	return( 1 );
+}
+
+/* Determines the run of sorted data file segments starting at a specific index
+ * that are stored contiguously in the same data file and can be read at once
+ * The run contains at least the segment at the index, additional segments are only
+ * added if the run size does not exceed the maximum run size
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_segments_get_run(
+     libodraw_data_file_segment_t *segments,
+     int number_of_segments,
+     int segment_index,
+     size_t maximum_run_size,
+     int *number_of_run_segments,
+     size_t *run_size,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_segment_t *last_segment = NULL;
+	libodraw_data_file_segment_t *next_segment = NULL;
+	static char *function                      = "libodraw_data_file_segments_get_run";
+	size_t safe_run_size                       = 0;
+	int run_segment_index                      = 0;
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_run_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of run segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run size.",
+		 function );
+
+		return( -1 );
+	}
+	last_segment  = &( segments[ segment_index ] );
+	safe_run_size = last_segment->size;
+
+	for( run_segment_index = segment_index + 1;
+	     run_segment_index < number_of_segments;
+	     run_segment_index++ )
+	{
+		next_segment = &( segments[ run_segment_index ] );
+
+		if( ( next_segment->data_file_index != last_segment->data_file_index )
+		 || ( next_segment->data_file_offset != ( last_segment->data_file_offset + (off64_t) last_segment->size ) ) )
+		{
+			break;
+		}
+		/* The first segment is always part of the run even if it exceeds the maximum run size
+		 */
+		if( ( safe_run_size >= maximum_run_size )
+		 || ( next_segment->size > ( maximum_run_size - safe_run_size ) ) )
+		{
+			break;
+		}
+		safe_run_size += next_segment->size;
+		last_segment   = next_segment;
+	}
+	*number_of_run_segments = run_segment_index - segment_index;
+	*run_size               = safe_run_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,74 @@
+/*
+ * Data file segment functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_DATA_FILE_SEGMENT_H )
+#define _LIBODRAW_DATA_FILE_SEGMENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_data_file_segment libodraw_data_file_segment_t;
+
+struct libodraw_data_file_segment
+{
+	/* The data file index
+	 */
+	int data_file_index;
+
+	/* The data file offset
+	 */
+	off64_t data_file_offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The buffer the data is read into
+	 */
+	uint8_t *buffer;
+};
+
+int libodraw_data_file_segments_sort(
+     libodraw_data_file_segment_t *segments,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int libodraw_data_file_segments_get_run(
+     libodraw_data_file_segment_t *segments,
+     int number_of_segments,
+     int segment_index,
+     size_t maximum_run_size,
+     int *number_of_run_segments,
+     size_t *run_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_DATA_FILE_SEGMENT_H ) */
+
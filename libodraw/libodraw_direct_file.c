@@ -0,0 +1,707 @@
+/*
+ * Direct (unbuffered) file IO functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by the GNU C library if _GNU_SOURCE is defined
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libodraw_direct_file.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+/* Direct IO is O_DIRECT on Linux and the BSDs and F_NOCACHE on Mac OS X
+ */
+#if defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_PREAD ) && !defined( WINAPI )
+#if defined( O_DIRECT ) || defined( F_NOCACHE )
+#define LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO
+#endif
+#endif
+
+/* Creates a direct file
+ * Make sure the value direct_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_initialize(
+     libodraw_direct_file_t **direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_initialize";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_file = memory_allocate_structure(
+	                libodraw_direct_file_t );
+
+	if( *direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *direct_file,
+	     0,
+	     sizeof( libodraw_direct_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear direct file.",
+		 function );
+
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+
+		return( -1 );
+	}
+	( *direct_file )->file_descriptor = -1;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *direct_file )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *direct_file != NULL )
+	{
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct file
+ * Closes the file if still open
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_free(
+     libodraw_direct_file_t **direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_free";
+	int result            = 1;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file != NULL )
+	{
+		if( libodraw_direct_file_close(
+		     *direct_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close direct file.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *direct_file )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a direct file
+ * Returns 1 if successful, 0 if direct IO is not supported for the file or -1 on error
+ */
+int libodraw_direct_file_open(
+     libodraw_direct_file_t *direct_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_open";
+
+#if defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO )
+	intptr_t misalignment = 0;
+	int file_descriptor   = -1;
+#endif
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO )
+#if defined( O_DIRECT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY | O_DIRECT );
+
+	if( ( file_descriptor == -1 )
+	 && ( errno == EINVAL ) )
+	{
+		/* The file system does not support direct IO
+		 */
+		return( 0 );
+	}
+#else
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+#endif
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if !defined( O_DIRECT )
+	if( fcntl(
+	     file_descriptor,
+	     F_NOCACHE,
+	     1 ) == -1 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+#endif
+	/* The window is aligned within an allocation that is one alignment larger
+	 */
+	direct_file->window_allocation = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * ( LIBODRAW_DIRECT_FILE_WINDOW_SIZE + LIBODRAW_DIRECT_FILE_ALIGNMENT ) );
+
+	if( direct_file->window_allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create window.",
+		 function );
+
+		goto on_error;
+	}
+	misalignment = (intptr_t) direct_file->window_allocation % LIBODRAW_DIRECT_FILE_ALIGNMENT;
+
+	if( misalignment == 0 )
+	{
+		direct_file->window_data = direct_file->window_allocation;
+	}
+	else
+	{
+		direct_file->window_data = &( direct_file->window_allocation[ LIBODRAW_DIRECT_FILE_ALIGNMENT - misalignment ] );
+	}
+	direct_file->file_descriptor  = file_descriptor;
+	direct_file->is_direct        = 1;
+	direct_file->window_data_size = 0;
+	direct_file->window_offset    = 0;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO ) */
+}
+
+/* Closes a direct file
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_direct_file_close(
+     libodraw_direct_file_t *direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_close";
+	int result            = 0;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO )
+	if( direct_file->file_descriptor != -1 )
+	{
+		if( close(
+		     direct_file->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( direct_file->window_allocation != NULL )
+	{
+		memory_free(
+		 direct_file->window_allocation );
+	}
+	direct_file->file_descriptor   = -1;
+	direct_file->is_direct         = 0;
+	direct_file->window_allocation = NULL;
+	direct_file->window_data       = NULL;
+	direct_file->window_data_size  = 0;
+	direct_file->window_offset     = 0;
+
+	return( result );
+}
+
+#if defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO )
+
+/* Reads data at a specific offset
+ * A short read is only continued if it ended on an alignment boundary,
+ * otherwise it is considered the end of the file.
+ * If the direct read is rejected, for example since the file system requires
+ * a larger alignment, the file falls back to buffered reads
+ * Returns the number of bytes read or -1 on error
+ */
+static ssize_t libodraw_direct_file_read_at_offset(
+                libodraw_direct_file_t *direct_file,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_read_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+	int file_flags        = 0;
+
+	while( buffer_offset < size )
+	{
+		read_count = pread(
+		              direct_file->file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset,
+		              (off_t) ( offset + buffer_offset ) );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+#if defined( O_DIRECT )
+			if( ( errno == EINVAL )
+			 && ( direct_file->is_direct != 0 ) )
+			{
+				file_flags = fcntl(
+				              direct_file->file_descriptor,
+				              F_GETFL );
+
+				if( ( file_flags != -1 )
+				 && ( fcntl(
+				       direct_file->file_descriptor,
+				       F_SETFL,
+				       file_flags & ~O_DIRECT ) != -1 ) )
+				{
+					direct_file->is_direct = 0;
+
+					continue;
+				}
+			}
+#endif
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 (int64_t) ( offset + buffer_offset ),
+			 (int64_t) ( offset + buffer_offset ) );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) read_count;
+
+		if( ( read_count == 0 )
+		 || ( ( buffer_offset % LIBODRAW_DIRECT_FILE_ALIGNMENT ) != 0 ) )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+#endif /* defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO ) */
+
+/* Reads a buffer at a specific offset
+ * Reads of at least the window size at an aligned offset into an aligned buffer are read
+ * directly into the buffer, other reads, such as unaligned heads and tails, are copied
+ * from an aligned window that is read from the file
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_direct_file_read_buffer_at_offset(
+         libodraw_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_read_buffer_at_offset";
+
+#if defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO )
+	off64_t current_offset = 0;
+	size_t buffer_offset   = 0;
+	size_t copy_size       = 0;
+	size_t read_size       = 0;
+	size_t remaining_size  = 0;
+	size_t window_offset   = 0;
+	ssize_t read_count     = 0;
+	int result             = 1;
+#endif
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO )
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     direct_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		current_offset = offset + (off64_t) buffer_offset;
+		remaining_size = size - buffer_offset;
+
+		if( ( remaining_size >= LIBODRAW_DIRECT_FILE_WINDOW_SIZE )
+		 && ( ( current_offset % LIBODRAW_DIRECT_FILE_ALIGNMENT ) == 0 )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % LIBODRAW_DIRECT_FILE_ALIGNMENT ) == 0 ) )
+		{
+			read_size = remaining_size - ( remaining_size % LIBODRAW_DIRECT_FILE_ALIGNMENT );
+
+			read_count = libodraw_direct_file_read_at_offset(
+			              direct_file,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              current_offset,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data into buffer.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			buffer_offset += (size_t) read_count;
+
+			if( (size_t) read_count < read_size )
+			{
+				break;
+			}
+			continue;
+		}
+		if( ( direct_file->window_data_size == 0 )
+		 || ( current_offset < direct_file->window_offset )
+		 || ( current_offset >= ( direct_file->window_offset + (off64_t) direct_file->window_data_size ) ) )
+		{
+			direct_file->window_offset    = current_offset - ( current_offset % LIBODRAW_DIRECT_FILE_ALIGNMENT );
+			direct_file->window_data_size = 0;
+
+			read_count = libodraw_direct_file_read_at_offset(
+			              direct_file,
+			              direct_file->window_data,
+			              LIBODRAW_DIRECT_FILE_WINDOW_SIZE,
+			              direct_file->window_offset,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read window.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			direct_file->window_data_size = (size_t) read_count;
+
+			if( current_offset >= ( direct_file->window_offset + (off64_t) direct_file->window_data_size ) )
+			{
+				break;
+			}
+		}
+		window_offset = (size_t) ( current_offset - direct_file->window_offset );
+		copy_size     = direct_file->window_data_size - window_offset;
+
+		if( copy_size > remaining_size )
+		{
+			copy_size = remaining_size;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( direct_file->window_data[ window_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window data to buffer.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		buffer_offset += copy_size;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     direct_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBODRAW_DIRECT_FILE_HAVE_DIRECT_IO ) */
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Direct (unbuffered) file IO functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_DIRECT_FILE_H )
+#define _LIBODRAW_DIRECT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the offset, size and buffer of a direct read
+ * which is a multitude of the logical block size of common storage devices
+ */
+#define LIBODRAW_DIRECT_FILE_ALIGNMENT		4096
+
+/* The size of the window
+ * reads that are smaller than the window are served from the window,
+ * since the operating system does not read ahead for direct reads
+ */
+#define LIBODRAW_DIRECT_FILE_WINDOW_SIZE	( 1024 * 1024 )
+
+typedef struct libodraw_direct_file libodraw_direct_file_t;
+
+struct libodraw_direct_file
+{
+	/* The file descriptor
+	 * contains -1 if the file is not open
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file is read bypassing the page cache
+	 * contains 0 if the reads fell back to buffered reads
+	 */
+	uint8_t is_direct;
+
+	/* The window allocation
+	 */
+	uint8_t *window_allocation;
+
+	/* The window data
+	 * which is aligned within the window allocation
+	 */
+	uint8_t *window_data;
+
+	/* The window data size
+	 * contains the number of bytes in the window, which is less than the window size at the end of the file
+	 */
+	size_t window_data_size;
+
+	/* The offset of the window data in the file
+	 */
+	off64_t window_offset;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * the window is used by one read at a time
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_direct_file_initialize(
+     libodraw_direct_file_t **direct_file,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_free(
+     libodraw_direct_file_t **direct_file,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_open(
+     libodraw_direct_file_t *direct_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_close(
+     libodraw_direct_file_t *direct_file,
+     libcerror_error_t **error );
+
+ssize_t libodraw_direct_file_read_buffer_at_offset(
+         libodraw_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_DIRECT_FILE_H ) */
+
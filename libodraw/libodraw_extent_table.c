@@ -0,0 +1,819 @@
+/*
+ * Extent table functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_extent_table.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_range.h"
+#include "libodraw_track_value.h"
+
+/* Creates an extent table
+ * Make sure the value extent_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_table_initialize(
+     libodraw_extent_table_t **extent_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_table_initialize";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_table = memory_allocate_structure(
+	                 libodraw_extent_table_t );
+
+	if( *extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_table,
+	     0,
+	     sizeof( libodraw_extent_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_table != NULL )
+	{
+		memory_free(
+		 *extent_table );
+
+		*extent_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent table
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_table_free(
+     libodraw_extent_table_t **extent_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_table_free";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_table != NULL )
+	{
+		if( ( *extent_table )->extents != NULL )
+		{
+			memory_free(
+			 ( *extent_table )->extents );
+		}
+		memory_free(
+		 *extent_table );
+
+		*extent_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties an extent table
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_table_empty(
+     libodraw_extent_table_t *extent_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_table_empty";
+	int extent_type       = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_type = 0;
+	     extent_type < LIBODRAW_NUMBER_OF_EXTENT_TYPES;
+	     extent_type++ )
+	{
+		extent_table->first_extent_index[ extent_type ]         = 0;
+		extent_table->number_of_extents_per_type[ extent_type ] = 0;
+	}
+	extent_table->number_of_extents = 0;
+
+	return( 1 );
+}
+
+/* Builds the extent table from the tracks, run-outs and lead-outs arrays
+ * The extents of each type are sorted by start sector
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_table_build(
+     libodraw_extent_table_t *extent_table,
+     libcdata_array_t *tracks_array,
+     libcdata_array_t *run_outs_array,
+     libcdata_array_t *lead_outs_array,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *arrays[ LIBODRAW_NUMBER_OF_EXTENT_TYPES ];
+	libodraw_extent_t sort_extent;
+
+	libodraw_extent_t *extent             = NULL;
+	libodraw_extent_t *extents            = NULL;
+	libodraw_sector_range_t *sector_range = NULL;
+	libodraw_track_value_t *track_value   = NULL;
+	intptr_t *value                       = NULL;
+	static char *function                 = "libodraw_extent_table_build";
+	int array_index                       = 0;
+	int extent_type                       = 0;
+	int first_extent_index                = 0;
+	int number_of_entries                 = 0;
+	int number_of_extents                 = 0;
+	int sort_index                        = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	arrays[ LIBODRAW_EXTENT_TYPE_TRACK ]    = tracks_array;
+	arrays[ LIBODRAW_EXTENT_TYPE_RUN_OUT ]  = run_outs_array;
+	arrays[ LIBODRAW_EXTENT_TYPE_LEAD_OUT ] = lead_outs_array;
+
+	for( extent_type = 0;
+	     extent_type < LIBODRAW_NUMBER_OF_EXTENT_TYPES;
+	     extent_type++ )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     arrays[ extent_type ],
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of array: %d.",
+			 function,
+			 extent_type );
+
+			return( -1 );
+		}
+		extent_table->first_extent_index[ extent_type ]         = number_of_extents;
+		extent_table->number_of_extents_per_type[ extent_type ] = number_of_entries;
+
+		number_of_extents += number_of_entries;
+	}
+	if( (size_t) number_of_extents > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_extent_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of extents value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_extents > extent_table->number_of_allocated_extents )
+	{
+		extents = (libodraw_extent_t *) memory_reallocate(
+		                                 extent_table->extents,
+		                                 sizeof( libodraw_extent_t ) * number_of_extents );
+
+		if( extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			goto on_error;
+		}
+		extent_table->extents                     = extents;
+		extent_table->number_of_allocated_extents = number_of_extents;
+	}
+	for( extent_type = 0;
+	     extent_type < LIBODRAW_NUMBER_OF_EXTENT_TYPES;
+	     extent_type++ )
+	{
+		first_extent_index = extent_table->first_extent_index[ extent_type ];
+
+		for( array_index = 0;
+		     array_index < extent_table->number_of_extents_per_type[ extent_type ];
+		     array_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     arrays[ extent_type ],
+			     array_index,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d of array: %d.",
+				 function,
+				 array_index,
+				 extent_type );
+
+				goto on_error;
+			}
+			if( value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing entry: %d of array: %d.",
+				 function,
+				 array_index,
+				 extent_type );
+
+				goto on_error;
+			}
+			extent = &( extent_table->extents[ first_extent_index + array_index ] );
+
+			if( extent_type == LIBODRAW_EXTENT_TYPE_TRACK )
+			{
+				track_value = (libodraw_track_value_t *) value;
+
+				extent->start_sector     = track_value->start_sector;
+				extent->end_sector       = track_value->end_sector;
+				extent->data_file_offset = track_value->data_file_offset;
+				extent->data_file_index  = track_value->data_file_index;
+			}
+			else
+			{
+				sector_range = (libodraw_sector_range_t *) value;
+
+				extent->start_sector     = sector_range->start_sector;
+				extent->end_sector       = sector_range->end_sector;
+				extent->data_file_offset = 0;
+				extent->data_file_index  = -1;
+			}
+			extent->index = array_index;
+			extent->type  = (uint8_t) extent_type;
+			extent->value = value;
+
+			/* The entries are expected to be stored in order
+			 * so an insertion sort is used
+			 */
+			for( sort_index = first_extent_index + array_index;
+			     sort_index > first_extent_index;
+			     sort_index-- )
+			{
+				if( extent_table->extents[ sort_index - 1 ].start_sector <= extent_table->extents[ sort_index ].start_sector )
+				{
+					break;
+				}
+				sort_extent                             = extent_table->extents[ sort_index - 1 ];
+				extent_table->extents[ sort_index - 1 ] = extent_table->extents[ sort_index ];
+				extent_table->extents[ sort_index ]     = sort_extent;
+			}
+		}
+	}
+	extent_table->number_of_extents = number_of_extents;
+
+	return( 1 );
+
+on_error:
+	libodraw_extent_table_empty(
+	 extent_table,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of extents of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_table_get_number_of_extents_by_type(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_table_get_number_of_extents_by_type";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_type >= LIBODRAW_NUMBER_OF_EXTENT_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extent type.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = extent_table->number_of_extents_per_type[ extent_type ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific extent of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_table_get_extent_by_type_and_index(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     int extent_index,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_table_get_extent_by_type_and_index";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_type >= LIBODRAW_NUMBER_OF_EXTENT_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extent type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= extent_table->number_of_extents_per_type[ extent_type ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	*extent = &( extent_table->extents[ extent_table->first_extent_index[ extent_type ] + extent_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the extent of a specific type that contains a specific sector
+ * The extent index is set to the array index of the value of the extent that contains
+ * the sector or, if no such extent exists, to the array index of the value of the first
+ * extent that follows the sector, which is the number of extents of the type if there is none
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libodraw_extent_table_get_extent_by_type_and_sector(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     uint64_t sector,
+     int *extent_index,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extents = NULL;
+	static char *function      = "libodraw_extent_table_get_extent_by_type_and_sector";
+	int lower_index            = 0;
+	int middle_index           = 0;
+	int upper_index            = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_type >= LIBODRAW_NUMBER_OF_EXTENT_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extent type.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	extents     = &( extent_table->extents[ extent_table->first_extent_index[ extent_type ] ] );
+	upper_index = extent_table->number_of_extents_per_type[ extent_type ];
+
+	/* Determine the first extent that ends after the sector
+	 */
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( sector >= extents[ middle_index ].end_sector )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index >= extent_table->number_of_extents_per_type[ extent_type ] )
+	{
+		*extent_index = extent_table->number_of_extents_per_type[ extent_type ];
+		*extent       = NULL;
+
+		return( 0 );
+	}
+	*extent_index = extents[ lower_index ].index;
+
+	if( sector >= extents[ lower_index ].start_sector )
+	{
+		*extent = &( extents[ lower_index ] );
+
+		return( 1 );
+	}
+	*extent = NULL;
+
+	return( 0 );
+}
+
+/* Retrieves the last extent of a specific type that ends at or before a specific sector
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libodraw_extent_table_get_previous_extent_by_type_and_sector(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     uint64_t sector,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extents = NULL;
+	static char *function      = "libodraw_extent_table_get_previous_extent_by_type_and_sector";
+	int lower_index            = 0;
+	int middle_index           = 0;
+	int upper_index            = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_type >= LIBODRAW_NUMBER_OF_EXTENT_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extent type.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	extents     = &( extent_table->extents[ extent_table->first_extent_index[ extent_type ] ] );
+	upper_index = extent_table->number_of_extents_per_type[ extent_type ];
+
+	/* Determine the first extent that ends after the sector
+	 */
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( sector >= extents[ middle_index ].end_sector )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		*extent = NULL;
+
+		return( 0 );
+	}
+	*extent = &( extents[ lower_index - 1 ] );
+
+	return( 1 );
+}
+
+/* Retrieves the first extent of a specific type that starts after a specific sector
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libodraw_extent_table_get_next_extent_by_type_and_sector(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     uint64_t sector,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extents = NULL;
+	static char *function      = "libodraw_extent_table_get_next_extent_by_type_and_sector";
+	int lower_index            = 0;
+	int middle_index           = 0;
+	int upper_index            = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_type >= LIBODRAW_NUMBER_OF_EXTENT_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extent type.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	extents     = &( extent_table->extents[ extent_table->first_extent_index[ extent_type ] ] );
+	upper_index = extent_table->number_of_extents_per_type[ extent_type ];
+
+	/* Determine the first extent that starts after the sector
+	 */
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( sector >= extents[ middle_index ].start_sector )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index >= extent_table->number_of_extents_per_type[ extent_type ] )
+	{
+		*extent = NULL;
+
+		return( 0 );
+	}
+	*extent = &( extents[ lower_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the first sector at or after a specific sector that is covered by an extent of any type
+ * This is the end of a range of sectors that is not covered by the extents
+ * Returns 1 if successful, 0 if no such sector or -1 on error
+ */
+int libodraw_extent_table_get_next_extent_start_sector(
+     libodraw_extent_table_t *extent_table,
+     uint64_t sector,
+     uint64_t *start_sector,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extents = NULL;
+	static char *function      = "libodraw_extent_table_get_next_extent_start_sector";
+	uint64_t next_start_sector = 0;
+	uint8_t extent_type        = 0;
+	int lower_index            = 0;
+	int middle_index           = 0;
+	int result                 = 0;
+	int upper_index            = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start sector.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_type = 0;
+	     extent_type < LIBODRAW_NUMBER_OF_EXTENT_TYPES;
+	     extent_type++ )
+	{
+		extents     = &( extent_table->extents[ extent_table->first_extent_index[ extent_type ] ] );
+		lower_index = 0;
+		upper_index = extent_table->number_of_extents_per_type[ extent_type ];
+
+		/* Determine the first extent that ends after the sector
+		 */
+		while( lower_index < upper_index )
+		{
+			middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+			if( sector >= extents[ middle_index ].end_sector )
+			{
+				lower_index = middle_index + 1;
+			}
+			else
+			{
+				upper_index = middle_index;
+			}
+		}
+		if( lower_index >= extent_table->number_of_extents_per_type[ extent_type ] )
+		{
+			continue;
+		}
+		if( extents[ lower_index ].start_sector <= sector )
+		{
+			*start_sector = sector;
+
+			return( 1 );
+		}
+		if( ( result == 0 )
+		 || ( extents[ lower_index ].start_sector < next_start_sector ) )
+		{
+			next_start_sector = extents[ lower_index ].start_sector;
+			result            = 1;
+		}
+	}
+	if( result != 0 )
+	{
+		*start_sector = next_start_sector;
+	}
+	return( result );
+}
+
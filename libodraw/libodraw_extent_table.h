@@ -0,0 +1,173 @@
+/*
+ * Extent table functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_EXTENT_TABLE_H )
+#define _LIBODRAW_EXTENT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The extent types
+ */
+enum LIBODRAW_EXTENT_TYPES
+{
+	LIBODRAW_EXTENT_TYPE_TRACK			= 0,
+	LIBODRAW_EXTENT_TYPE_RUN_OUT			= 1,
+	LIBODRAW_EXTENT_TYPE_LEAD_OUT			= 2
+};
+
+#define LIBODRAW_NUMBER_OF_EXTENT_TYPES			3
+
+typedef struct libodraw_extent libodraw_extent_t;
+
+struct libodraw_extent
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The end sector
+	 */
+	uint64_t end_sector;
+
+	/* The data file offset
+	 * only set for tracks
+	 */
+	off64_t data_file_offset;
+
+	/* The data file index
+	 * only set for tracks, -1 otherwise
+	 */
+	int data_file_index;
+
+	/* The index of the value in the array of its type
+	 */
+	int index;
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The value, either a track value or a sector range
+	 * the value is not managed by the extent table
+	 */
+	intptr_t *value;
+};
+
+typedef struct libodraw_extent_table libodraw_extent_table_t;
+
+struct libodraw_extent_table
+{
+	/* The extents
+	 * the extents are grouped by type and sorted by start sector
+	 */
+	libodraw_extent_t *extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The index of the first extent per type
+	 */
+	int first_extent_index[ LIBODRAW_NUMBER_OF_EXTENT_TYPES ];
+
+	/* The number of extents per type
+	 */
+	int number_of_extents_per_type[ LIBODRAW_NUMBER_OF_EXTENT_TYPES ];
+};
+
+int libodraw_extent_table_initialize(
+     libodraw_extent_table_t **extent_table,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_free(
+     libodraw_extent_table_t **extent_table,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_empty(
+     libodraw_extent_table_t *extent_table,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_build(
+     libodraw_extent_table_t *extent_table,
+     libcdata_array_t *tracks_array,
+     libcdata_array_t *run_outs_array,
+     libcdata_array_t *lead_outs_array,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_get_number_of_extents_by_type(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_get_extent_by_type_and_index(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     int extent_index,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_get_extent_by_type_and_sector(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     uint64_t sector,
+     int *extent_index,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_get_previous_extent_by_type_and_sector(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     uint64_t sector,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_get_next_extent_by_type_and_sector(
+     libodraw_extent_table_t *extent_table,
+     uint8_t extent_type,
+     uint64_t sector,
+     libodraw_extent_t **extent,
+     libcerror_error_t **error );
+
+int libodraw_extent_table_get_next_extent_start_sector(
+     libodraw_extent_table_t *extent_table,
+     uint64_t sector,
+     uint64_t *start_sector,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_EXTENT_TABLE_H ) */
+
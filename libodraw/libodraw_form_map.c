@@ -0,0 +1,491 @@
+/*
+ * Mode 2 sector form map functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_form_map.h"
+#include "libodraw_libcerror.h"
+
+/* Creates a form map
+ * Make sure the value form_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_form_map_initialize(
+     libodraw_form_map_t **form_map,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_form_map_initialize";
+	size_t blocks_size    = 0;
+	size_t forms_size     = 0;
+	uint64_t blocks_bits  = 0;
+
+	if( form_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *form_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid form map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sectors == 0 )
+	 || ( number_of_sectors > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE * 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	blocks_bits = number_of_sectors / LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS;
+
+	if( ( number_of_sectors % LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS ) != 0 )
+	{
+		blocks_bits += 1;
+	}
+	forms_size  = (size_t) ( ( number_of_sectors + 7 ) / 8 );
+	blocks_size = (size_t) ( ( blocks_bits + 7 ) / 8 );
+
+	*form_map = memory_allocate_structure(
+	             libodraw_form_map_t );
+
+	if( *form_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create form map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *form_map,
+	     0,
+	     sizeof( libodraw_form_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear form map.",
+		 function );
+
+		memory_free(
+		 *form_map );
+
+		*form_map = NULL;
+
+		return( -1 );
+	}
+	( *form_map )->forms = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * forms_size );
+
+	if( ( *form_map )->forms == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create forms bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	( *form_map )->blocks = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * blocks_size );
+
+	if( ( *form_map )->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *form_map )->forms,
+	     0,
+	     forms_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear forms bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *form_map )->blocks,
+	     0,
+	     blocks_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	( *form_map )->number_of_sectors = number_of_sectors;
+	( *form_map )->number_of_blocks  = blocks_bits;
+
+	return( 1 );
+
+on_error:
+	if( *form_map != NULL )
+	{
+		if( ( *form_map )->blocks != NULL )
+		{
+			memory_free(
+			 ( *form_map )->blocks );
+		}
+		if( ( *form_map )->forms != NULL )
+		{
+			memory_free(
+			 ( *form_map )->forms );
+		}
+		memory_free(
+		 *form_map );
+
+		*form_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a form map
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_form_map_free(
+     libodraw_form_map_t **form_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_form_map_free";
+
+	if( form_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *form_map != NULL )
+	{
+		memory_free(
+		 ( *form_map )->blocks );
+
+		memory_free(
+		 ( *form_map )->forms );
+
+		memory_free(
+		 *form_map );
+
+		*form_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the form of a specific sector
+ * The sector index is relative to the start of the track
+ * Returns 1 if successful, 0 if the form of the sector is not known or -1 on error
+ */
+int libodraw_form_map_get_form(
+     libodraw_form_map_t *form_map,
+     uint64_t sector_index,
+     uint8_t *form,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_form_map_get_form";
+	uint64_t block_index  = 0;
+
+	if( form_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form map.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_index >= form_map->number_of_sectors )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( form == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form.",
+		 function );
+
+		return( -1 );
+	}
+	block_index = sector_index / LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS;
+
+	if( ( form_map->blocks[ block_index / 8 ] & ( 1 << ( block_index % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( form_map->forms[ sector_index / 8 ] & ( 1 << ( sector_index % 8 ) ) ) != 0 )
+	{
+		*form = 2;
+	}
+	else
+	{
+		*form = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the range of the block that contains a specific sector
+ * The sector indexes are relative to the start of the track
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_form_map_get_block_range(
+     libodraw_form_map_t *form_map,
+     uint64_t sector_index,
+     uint64_t *block_start_sector_index,
+     uint64_t *block_number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function           = "libodraw_form_map_get_block_range";
+	uint64_t safe_number_of_sectors = 0;
+	uint64_t safe_start_sector      = 0;
+
+	if( form_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form map.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_index >= form_map->number_of_sectors )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_start_sector_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block start sector index.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number_of_sectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	safe_start_sector      = sector_index - ( sector_index % LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS );
+	safe_number_of_sectors = form_map->number_of_sectors - safe_start_sector;
+
+	if( safe_number_of_sectors > LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS )
+	{
+		safe_number_of_sectors = LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS;
+	}
+	*block_start_sector_index = safe_start_sector;
+	*block_number_of_sectors  = safe_number_of_sectors;
+
+	return( 1 );
+}
+
+/* Sets the forms of sectors from the Mode 2 XA sub-header sub-mode flags in the sector data
+ * The sector index is relative to the start of the track
+ * The sector data contains whole sectors of 2336 or 2352 bytes per sector
+ * Blocks of which the forms of all sectors are set are marked as known
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_form_map_set_forms(
+     libodraw_form_map_t *form_map,
+     uint64_t sector_index,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function      = "libodraw_form_map_set_forms";
+	size_t sector_data_offset  = 0;
+	size_t sub_mode_offset     = 0;
+	uint64_t block_index       = 0;
+	uint64_t end_sector_index  = 0;
+	uint64_t number_of_sectors = 0;
+
+	if( form_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form map.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sub-mode flags are stored in the third byte of the XA sub-header
+	 * which directly follows the synchronisation data and header of a raw sector
+	 */
+	if( bytes_per_sector == 2352 )
+	{
+		sub_mode_offset = 16 + 2;
+	}
+	else if( bytes_per_sector == 2336 )
+	{
+		sub_mode_offset = 2;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sectors = (uint64_t) ( sector_data_size / bytes_per_sector );
+
+	if( ( sector_index > form_map->number_of_sectors )
+	 || ( number_of_sectors > ( form_map->number_of_sectors - sector_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	end_sector_index = sector_index + number_of_sectors;
+
+	/* Blocks are only marked as known if their first sector is part of the sector data
+	 */
+	block_index = sector_index / LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS;
+
+	if( ( sector_index % LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS ) != 0 )
+	{
+		block_index += 1;
+	}
+	while( sector_index < end_sector_index )
+	{
+		if( ( sector_data[ sector_data_offset + sub_mode_offset ] & 0x20 ) != 0 )
+		{
+			form_map->forms[ sector_index / 8 ] |= (uint8_t) ( 1 << ( sector_index % 8 ) );
+		}
+		else
+		{
+			form_map->forms[ sector_index / 8 ] &= (uint8_t) ~( 1 << ( sector_index % 8 ) );
+		}
+		sector_data_offset += bytes_per_sector;
+		sector_index       += 1;
+	}
+	while( block_index < form_map->number_of_blocks )
+	{
+		if( ( ( block_index + 1 ) * LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS ) > end_sector_index )
+		{
+			/* The last block of the track can contain less sectors
+			 */
+			if( end_sector_index != form_map->number_of_sectors )
+			{
+				break;
+			}
+		}
+		form_map->blocks[ block_index / 8 ] |= (uint8_t) ( 1 << ( block_index % 8 ) );
+
+		block_index += 1;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Mode 2 sector form map functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_FORM_MAP_H )
+#define _LIBODRAW_FORM_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of sectors in a block of the form map
+ * the forms are known per block, which is the unit in which the forms are read
+ */
+#define LIBODRAW_FORM_MAP_BLOCK_NUMBER_OF_SECTORS	1024
+
+typedef struct libodraw_form_map libodraw_form_map_t;
+
+struct libodraw_form_map
+{
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+
+	/* The forms bitmap
+	 * contains a bit per sector that is set if the sector is a Mode 2 Form 2 sector
+	 */
+	uint8_t *forms;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The blocks bitmap
+	 * contains a bit per block that is set if the forms of the sectors in the block are known
+	 */
+	uint8_t *blocks;
+};
+
+int libodraw_form_map_initialize(
+     libodraw_form_map_t **form_map,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libodraw_form_map_free(
+     libodraw_form_map_t **form_map,
+     libcerror_error_t **error );
+
+int libodraw_form_map_get_form(
+     libodraw_form_map_t *form_map,
+     uint64_t sector_index,
+     uint8_t *form,
+     libcerror_error_t **error );
+
+int libodraw_form_map_get_block_range(
+     libodraw_form_map_t *form_map,
+     uint64_t sector_index,
+     uint64_t *block_start_sector_index,
+     uint64_t *block_number_of_sectors,
+     libcerror_error_t **error );
+
+int libodraw_form_map_set_forms(
+     libodraw_form_map_t *form_map,
+     uint64_t sector_index,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_FORM_MAP_H ) */
+
@@ -26,12 +26,18 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libodraw_audio_file_header.h"
+#include "libodraw_byte_swap.h"
 #include "libodraw_codepage.h"
 #include "libodraw_cue_parser.h"
 #include "libodraw_data_file.h"
+#include "libodraw_data_file_segment.h"
 #include "libodraw_data_file_descriptor.h"
 #include "libodraw_debug.h"
 #include "libodraw_definitions.h"
+#include "libodraw_direct_file.h"
+#include "libodraw_extent_table.h"
+#include "libodraw_form_map.h"
 #include "libodraw_io_handle.h"
 #include "libodraw_handle.h"
 #include "libodraw_libbfio.h"
@@ -41,6 +47,10 @@
 #include "libodraw_libcnotify.h"
 #include "libodraw_libcpath.h"
 #include "libodraw_libuna.h"
+#include "libodraw_mapped_file.h"
+#include "libodraw_sector_cache.h"
+#include "libodraw_sector_copy.h"
+#include "libodraw_sector_data_buffer.h"
 #include "libodraw_sector_range.h"
 #include "libodraw_track_value.h"
 #include "libodraw_types.h"
@@ -52,6 +62,13 @@ int libodraw_cue_parser_parse_buffer(
      size_t buffer_size,
      libcerror_error_t **error );
 
+extern \
+int libodraw_cue_parser_parse_terminated_buffer(
+     libodraw_handle_t *handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 /* Creates a handle
  * Make sure the value handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -186,6 +203,34 @@ int libodraw_handle_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->mapped_files_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped files array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->direct_files_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct files array.",
+		 function );
+
+		goto on_error;
+	}
 	if( libodraw_io_handle_initialize(
 	     &( internal_handle->io_handle ),
 	     error ) != 1 )
@@ -199,7 +244,115 @@ int libodraw_handle_initialize(
 
 		goto on_error;
 	}
+	if( libodraw_sector_data_buffer_initialize(
+	     &( internal_handle->sector_data_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->sector_data_buffers_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data buffers array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_extent_table_initialize(
+	     &( internal_handle->extent_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_handle->error_sectors ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create error sectors range list.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_handle->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle->error_sectors_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize error sectors mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle->form_maps_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize form maps mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_handle->sector_data_buffers_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sector data buffers mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	internal_handle->maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	internal_handle->readahead_window_size          = LIBODRAW_READAHEAD_DEFAULT_WINDOW_SIZE;
 
 	*handle = (libodraw_handle_t *) internal_handle;
 
@@ -208,6 +361,72 @@ int libodraw_handle_initialize(
 on_error:
 	if( internal_handle != NULL )
 	{
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		if( internal_handle->form_maps_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_handle->form_maps_mutex ),
+			 NULL );
+		}
+		if( internal_handle->error_sectors_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_handle->error_sectors_mutex ),
+			 NULL );
+		}
+		if( internal_handle->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_handle->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_handle->error_sectors != NULL )
+		{
+			libcdata_range_list_free(
+			 &( internal_handle->error_sectors ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->extent_table != NULL )
+		{
+			libodraw_extent_table_free(
+			 &( internal_handle->extent_table ),
+			 NULL );
+		}
+		if( internal_handle->io_handle != NULL )
+		{
+			libodraw_io_handle_free(
+			 &( internal_handle->io_handle ),
+			 NULL );
+		}
+		if( internal_handle->sector_data_buffers_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_handle->sector_data_buffers_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->sector_data_buffer != NULL )
+		{
+			libodraw_sector_data_buffer_free(
+			 &( internal_handle->sector_data_buffer ),
+			 NULL );
+		}
+		if( internal_handle->direct_files_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_handle->direct_files_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->mapped_files_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_handle->mapped_files_array ),
+			 NULL,
+			 NULL );
+		}
 		if( internal_handle->tracks_array != NULL )
 		{
 			libcdata_array_free(
@@ -364,6 +583,34 @@ int libodraw_handle_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( internal_handle->mapped_files_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_mapped_file_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped files array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_handle->direct_files_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_direct_file_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free direct files array.",
+			 function );
+
+			result = -1;
+		}
 		if( libodraw_io_handle_free(
 		     &( internal_handle->io_handle ),
 		     error ) != 1 )
@@ -377,49 +624,196 @@ int libodraw_handle_free(
 
 			result = -1;
 		}
-		memory_free(
-		 internal_handle );
-	}
-	return( result );
-}
-
-/* Signals the handle to abort its current activity
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_signal_abort(
-     libodraw_handle_t *handle,
-     libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_signal_abort";
+		if( libodraw_sector_data_buffer_free(
+		     &( internal_handle->sector_data_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector data buffer.",
+			 function );
 
-	if( handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_handle->sector_data_buffers_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_data_buffer_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector data buffers array.",
+			 function );
 
-		return( -1 );
-	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
+			result = -1;
+		}
+		if( libodraw_sector_cache_free(
+		     &( internal_handle->sector_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector cache.",
+			 function );
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+			result = -1;
+		}
+		if( libodraw_readahead_free(
+		     &( internal_handle->readahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free readahead.",
+			 function );
 
-		return( -1 );
-	}
-	internal_handle->io_handle->abort = 1;
+			result = -1;
+		}
+		if( libodraw_io_uring_free(
+		     &( internal_handle->io_uring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free io_uring.",
+			 function );
 
-	return( 1 );
+			result = -1;
+		}
+		if( libodraw_extent_table_free(
+		     &( internal_handle->extent_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent table.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_range_list_free(
+		     &( internal_handle->error_sectors ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free error sectors range list.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_handle->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_handle->error_sectors_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free error sectors mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_handle->form_maps_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free form maps mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_handle->sector_data_buffers_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector data buffers mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_handle );
+	}
+	return( result );
+}
+
+/* Signals the handle to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_signal_abort(
+     libodraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_signal_abort";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->io_handle->abort = 1;
+
+	return( 1 );
 }
 
 /* Opens a handle using a table of contents (TOC) file
@@ -432,11 +826,16 @@ int libodraw_handle_open(
      libcerror_error_t **error )
 {
 	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *mapped_file_error        = NULL;
 	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_mapped_file_t *mapped_file         = NULL;
+	uint8_t *toc_data                           = NULL;
 	char *basename_end                          = NULL;
 	static char *function                       = "libodraw_handle_open";
 	size_t basename_length                      = 0;
 	size_t filename_length                      = 0;
+	size_t toc_data_size                        = 0;
+	int result                                  = 0;
 
 	if( handle == NULL )
 	{
@@ -570,9 +969,51 @@ int libodraw_handle_open(
 
 		goto on_error;
 	}
-	if( libodraw_handle_open_file_io_handle(
-	     handle,
+	if( libodraw_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The TOC file is mapped copy-on-write so that the scanner can parse it in place,
+	 * if the file cannot be mapped it is read into a buffer instead
+	 */
+	result = libodraw_mapped_file_open(
+	          mapped_file,
+	          filename,
+	          LIBODRAW_MAPPED_FILE_FLAG_COPY_ON_WRITE,
+	          &mapped_file_error );
+
+	if( result == -1 )
+	{
+		libcerror_error_free(
+		 &mapped_file_error );
+	}
+	else if( ( result != 0 )
+	      && ( mapped_file->data_size <= (size64_t) ( SSIZE_MAX - 2 ) ) )
+	{
+		toc_data      = mapped_file->data;
+		toc_data_size = (size_t) mapped_file->data_size;
+
+		/* Include the zero filled remainder of the last page as terminator
+		 */
+		if( mapped_file->padding_size >= 2 )
+		{
+			toc_data_size += 2;
+		}
+	}
+	if( libodraw_internal_handle_open_file_io_handle(
+	     internal_handle,
 	     file_io_handle,
+	     toc_data,
+	     toc_data_size,
 	     access_flags,
 	     error ) != 1 )
 	{
@@ -588,9 +1029,30 @@ int libodraw_handle_open(
 	}
 	internal_handle->toc_file_io_handle_created_in_library = 1;
 
+	file_io_handle = NULL;
+
+	if( libodraw_mapped_file_free(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mapped file.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( mapped_file != NULL )
+	{
+		libodraw_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -811,11 +1273,7 @@ int libodraw_handle_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_open_file_io_handle";
-	int bfio_access_flags                       = 0;
-	int file_io_handle_is_open                  = 0;
-	int file_io_handle_opened_in_library        = 0;
+	static char *function = "libodraw_handle_open_file_io_handle";
 
 	if( handle == NULL )
 	{
@@ -828,128 +1286,302 @@ int libodraw_handle_open_file_io_handle(
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
-	if( internal_handle->toc_file_io_handle != NULL )
+	if( libodraw_internal_handle_open_file_io_handle(
+	     (libodraw_internal_handle_t *) handle,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     access_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - file IO handle already set.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle using file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	return( 1 );
+}
+
+/* Opens a handle using a table of contents (TOC) data buffer
+ * The buffer does not need to be terminated and is not modified, the TOC data is copied
+ * into a terminated buffer owned by the library before it is parsed, hence the buffer
+ * does not need to remain valid after this function returns
+ * Since there is no TOC filename the data filenames are used as-is
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_open_buffer(
+     libodraw_handle_t *handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_open_buffer";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 ) )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
-	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	/* The memory range file IO handle represents the TOC file of the handle
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		goto on_error;
 	}
-	if( libodraw_handle_open_read(
+	if( libodraw_internal_handle_open_file_io_handle(
 	     internal_handle,
 	     file_io_handle,
+	     NULL,
+	     0,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from handle.",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle using buffer.",
 		 function );
 
 		goto on_error;
 	}
-	internal_handle->access_flags                         = access_flags;
-	internal_handle->toc_file_io_handle                   = file_io_handle;
-	internal_handle->toc_file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_handle->toc_file_io_handle_created_in_library = 1;
 
 	return( 1 );
 
 on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( file_io_handle_opened_in_library != 0 ) )
+	if( file_io_handle != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Opens the data files
- * If the data filenames were not set explicitly this function assumes the data files
- * are in the same location as the table of contents (TOC) file
+/* Opens a handle using a Basic File IO (bfio) handle of a table of contents (TOC) file
+ * If TOC data is provided it is parsed instead of the data read from the file IO handle,
+ * the TOC data must be writable memory owned by the library
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_open_data_files(
-     libodraw_handle_t *handle,
+int libodraw_internal_handle_open_file_io_handle(
+     libodraw_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *toc_data,
+     size_t toc_data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function                = "libodraw_internal_handle_open_file_io_handle";
+	int bfio_access_flags                = 0;
+	int file_io_handle_is_open           = 0;
+	int file_io_handle_opened_in_library = 0;
+	int result                           = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->toc_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( toc_data != NULL )
+	{
+		result = libodraw_handle_open_read_buffer(
+		          internal_handle,
+		          toc_data,
+		          toc_data_size,
+		          error );
+	}
+	else
+	{
+		result = libodraw_handle_open_read(
+		          internal_handle,
+		          file_io_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_handle->access_flags                         = access_flags;
+	internal_handle->toc_file_io_handle                   = file_io_handle;
+	internal_handle->toc_file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens the data files
+ * If the data filenames were not set explicitly this function assumes the data files
+ * are in the same location as the table of contents (TOC) file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_open_data_files(
+     libodraw_handle_t *handle,
      libcerror_error_t **error )
 {
 	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
@@ -1182,6 +1814,7 @@ int libodraw_handle_open_data_files_file_io_pool(
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
 	static char *function                       = "libodraw_handle_open_data_files_file_io_pool";
+	int result                                  = 1;
 
 	if( handle == NULL )
 	{
@@ -1229,6 +1862,21 @@ int libodraw_handle_open_data_files_file_io_pool(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	internal_handle->data_file_io_pool = file_io_pool;
 
 	if( libodraw_handle_set_media_values(
@@ -1242,9 +1890,24 @@ int libodraw_handle_open_data_files_file_io_pool(
 		 "%s: unable to set media values.",
 		 function );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Opens a specific data file
@@ -1258,6 +1921,7 @@ int libodraw_handle_open_data_file(
 {
 	libbfio_handle_t *file_io_handle = NULL;
 	static char *function            = "libodraw_handle_open_data_file";
+	int result                       = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -1353,6 +2017,75 @@ int libodraw_handle_open_data_file(
 
 		goto on_error;
 	}
+	file_io_handle = NULL;
+
+	if( internal_handle->memory_map_data_files != 0 )
+	{
+		result = libodraw_internal_handle_map_data_file(
+		          internal_handle,
+		          data_file_index,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map data file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	/* Data files that are memory mapped are not read using direct IO
+	 */
+	if( ( internal_handle->use_direct_io != 0 )
+	 && ( result == 0 ) )
+	{
+		result = libodraw_internal_handle_open_direct_data_file(
+		          internal_handle,
+		          data_file_index,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open data file: %s for direct IO.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	/* Data files that are memory mapped or read using direct IO are not read using io_uring
+	 */
+	if( ( internal_handle->use_io_uring != 0 )
+	 && ( result == 0 ) )
+	{
+		if( libodraw_internal_handle_set_io_uring_data_file(
+		     internal_handle,
+		     data_file_index,
+		     filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open data file: %s for io_uring.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -1664,6 +2397,21 @@ int libodraw_handle_close(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1721,28 +2469,85 @@ int libodraw_handle_close(
 	}
 	internal_handle->toc_file_io_handle = NULL;
 
-	if( internal_handle->data_file_io_pool != 0 )
+	if( libcdata_array_empty(
+	     internal_handle->mapped_files_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_mapped_file_free,
+	     error ) != 1 )
 	{
-		if( internal_handle->data_file_io_pool != NULL )
-		{
-			if( libbfio_pool_close_all(
-			     internal_handle->data_file_io_pool,
-			     error ) != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_GENERIC,
-				 "%s: unable close data files IO pool.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty mapped files array.",
+		 function );
 
-				result = -1;
-			}
-			if( libbfio_pool_free(
-			     &( internal_handle->data_file_io_pool ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_handle->direct_files_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_direct_file_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty direct files array.",
+		 function );
+
+		result = -1;
+	}
+	/* The readahead is freed before the data files are closed
+	 * since its worker thread reads from the data file IO pool
+	 */
+	if( libodraw_readahead_free(
+	     &( internal_handle->readahead ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free readahead.",
+		 function );
+
+		result = -1;
+	}
+	if( libodraw_io_uring_free(
+	     &( internal_handle->io_uring ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free io_uring.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_handle->data_file_io_pool != 0 )
+	{
+		if( internal_handle->data_file_io_pool != NULL )
+		{
+			if( libbfio_pool_close_all(
+			     internal_handle->data_file_io_pool,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable close data files IO pool.",
+				 function );
+
+				result = -1;
+			}
+			if( libbfio_pool_free(
+			     &( internal_handle->data_file_io_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
@@ -1757,9 +2562,6 @@ int libodraw_handle_close(
 	internal_handle->data_file_io_pool = NULL;
 
 	internal_handle->current_offset    = 0;
-	internal_handle->current_run_out   = 0;
-	internal_handle->current_lead_out  = 0;
-	internal_handle->current_track     = 0;
 	internal_handle->media_size        = 0;
 	internal_handle->number_of_sectors = 0;
 
@@ -1776,6 +2578,76 @@ int libodraw_handle_close(
 
 		result = -1;
 	}
+	if( libodraw_sector_data_buffer_clear(
+	     internal_handle->sector_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear sector data buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     internal_handle->sector_data_buffers_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_data_buffer_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty sector data buffers array.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_handle->sector_cache != NULL )
+	{
+		if( libodraw_sector_cache_empty(
+		     internal_handle->sector_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty sector cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libodraw_extent_table_empty(
+	     internal_handle->extent_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty extent table.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_range_list_empty(
+	     internal_handle->error_sectors,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty error sectors range list.",
+		 function );
+
+		result = -1;
+	}
 	if( libcdata_array_empty(
 	     internal_handle->data_file_descriptors_array,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
@@ -1855,6 +2727,21 @@ int libodraw_handle_close(
 	}
 	internal_handle->basename_size = 0;
 
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( result );
 }
 
@@ -1895,80 +2782,6 @@ int libodraw_handle_open_read(
 
 		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_handle->data_file_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty data file descriptors array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->sessions_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty sessions array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->run_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty run-outs array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->lead_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty lead-outs array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->tracks_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty tracks array.",
-		 function );
-
-		goto on_error;
-	}
-	if( internal_handle->io_handle->abort != 0 )
-	{
-		internal_handle->io_handle->abort = 0;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -2001,7 +2814,7 @@ int libodraw_handle_open_read(
 
 		goto on_error;
 	}
-	/* Lex wants 2 zero bytes at the end of the buffer
+	/* Lex wants 2 zero bytes at the end of the buffer, which allows the buffer to be scanned in place
 	 */
 	buffer_size = (size_t) file_size + 2;
 
@@ -2062,8 +2875,8 @@ int libodraw_handle_open_read(
 	buffer[ buffer_size - 2 ] = 0;
 	buffer[ buffer_size - 1 ] = 0;
 
-	result = libodraw_cue_parser_parse_buffer(
-	          (libodraw_handle_t *) internal_handle,
+	result = libodraw_handle_open_read_buffer(
+	          internal_handle,
 	          buffer,
 	          buffer_size,
 	          error );
@@ -2074,7 +2887,7 @@ int libodraw_handle_open_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to parse file data.",
+		 "%s: unable to read TOC data.",
 		 function );
 
 		goto on_error;
@@ -2082,12 +2895,6 @@ int libodraw_handle_open_read(
 	memory_free(
 	 buffer );
 
-	buffer = NULL;
-
-	if( internal_handle->io_handle->abort != 0 )
-	{
-		internal_handle->io_handle->abort = 0;
-	}
 	return( result );
 
 on_error:
@@ -2099,27 +2906,20 @@ on_error:
 	return( -1 );
 }
 
-/* Reads a buffer
- * Returns the number of bytes read or -1 on error
+/* Opens a handle for reading from a buffer containing the TOC data
+ * The buffer must be writable memory owned by the library
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libodraw_handle_read_buffer(
-         libodraw_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libodraw_handle_open_read_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_sector_range_t *sector_range       = NULL;
-	libodraw_track_value_t *track_value         = NULL;
-	static char *function                       = "libodraw_handle_read_buffer";
-	size_t buffer_offset                        = 0;
-	ssize_t read_count                          = 0;
-	uint64_t current_sector                     = 0;
-	int in_known_range                          = 0;
-	int number_of_lead_outs                     = 0;
-	int number_of_run_outs                      = 0;
+	static char *function = "libodraw_handle_open_read_buffer";
+	int result            = 1;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2130,8 +2930,6 @@ ssize_t libodraw_handle_read_buffer(
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
 	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -2143,61 +2941,190 @@ ssize_t libodraw_handle_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	if( libcdata_array_empty(
+	     internal_handle->data_file_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty data file descriptors array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->current_offset < 0 )
+	if( libcdata_array_empty(
+	     internal_handle->sessions_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty sessions array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libcdata_array_empty(
 	     internal_handle->run_outs_array,
-	     &number_of_run_outs,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in run-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty run-outs array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libcdata_array_empty(
 	     internal_handle->lead_outs_array,
-	     &number_of_lead_outs,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in lead-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty lead-outs array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_empty(
+	     internal_handle->tracks_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty tracks array.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->io_handle->abort != 0 )
+	{
+		internal_handle->io_handle->abort = 0;
+	}
+	/* A buffer that ends with 2 zero bytes is scanned in place
+	 */
+	if( ( buffer_size >= 2 )
+	 && ( buffer[ buffer_size - 2 ] == 0 )
+	 && ( buffer[ buffer_size - 1 ] == 0 ) )
+	{
+		result = libodraw_cue_parser_parse_terminated_buffer(
+		          (libodraw_handle_t *) internal_handle,
+		          buffer,
+		          buffer_size,
+		          error );
+	}
+	else
+	{
+		result = libodraw_cue_parser_parse_buffer(
+		          (libodraw_handle_t *) internal_handle,
+		          buffer,
+		          buffer_size,
+		          error );
+	}
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to parse file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->io_handle->abort != 0 )
+	{
+		internal_handle->io_handle->abort = 0;
+	}
+	return( result );
+
+on_error:
+	return( -1 );
+}
+
+/* Reads a buffer from the extent that contains a specific offset
+ * Run-outs, lead-outs and unspecified sectors are read from the data file
+ * of the track that precedes them
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_buffer_from_extent(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         libodraw_sector_cache_t *sector_cache,
+         libodraw_readahead_t *readahead,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_extent_t *extent = NULL;
+	static char *function     = "libodraw_internal_handle_read_buffer_from_extent";
+	ssize_t read_count        = 0;
+	uint64_t current_sector   = 0;
+	int extent_index          = 0;
+	int previous_track_index  = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+	if( internal_handle->io_handle == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	current_sector = (uint64_t) ( offset / internal_handle->io_handle->bytes_per_sector );
 
 	if( current_sector > (uint64_t) UINT32_MAX )
 	{
@@ -2210,343 +3137,208 @@ ssize_t libodraw_handle_read_buffer(
 
 		return( -1 );
 	}
-	while( buffer_offset < buffer_size )
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          current_sector,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
+
+		return( -1 );
+	}
+	else if( result != 0 )
 	{
-		in_known_range = 0;
+		read_count = libodraw_handle_read_buffer_from_track(
+		              internal_handle,
+		              sector_data_buffer,
+		              sector_cache,
+		              readahead,
+		              offset,
+		              extent_index,
+		              buffer,
+		              buffer_size,
+		              error );
 
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->tracks_array,
-		     internal_handle->current_track,
-		     (intptr_t **) &track_value,
-		     error ) != 1 )
+		if( read_count == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve track value: %d from array.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from track: %d.",
 			 function,
-			 internal_handle->current_track );
+			 extent_index );
 
 			return( -1 );
 		}
-		if( track_value == NULL )
+		return( read_count );
+	}
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          current_sector,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous track extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		previous_track_index = extent->index;
+	}
+	else
+	{
+		previous_track_index = -1;
+	}
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_RUN_OUT,
+	          current_sector,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run-out extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		read_count = libodraw_handle_read_buffer_from_run_out(
+		              internal_handle,
+		              sector_data_buffer,
+		              offset,
+		              extent_index,
+		              previous_track_index,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing track value: %d.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from run-out: %d.",
 			 function,
-			 internal_handle->current_track );
+			 extent_index );
 
 			return( -1 );
 		}
-		/* TODO currently assumes that current track start sector is always relative to the start of the media */
-		if( ( current_sector >= track_value->start_sector )
-		 && ( current_sector < track_value->end_sector ) )
-		{
-			in_known_range = 1;
+		return( read_count );
+	}
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_LEAD_OUT,
+	          current_sector,
+	          &extent_index,
+	          &extent,
+	          error );
 
-			read_count = libodraw_handle_read_buffer_from_track(
-			              internal_handle,
-			              (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-			              buffer_size - buffer_offset,
-			              error );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lead-out extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
 
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer from track: %d.",
-				 function,
-				 internal_handle->current_track );
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		read_count = libodraw_handle_read_buffer_from_lead_out(
+		              internal_handle,
+		              sector_data_buffer,
+		              offset,
+		              extent_index,
+		              previous_track_index,
+		              buffer,
+		              buffer_size,
+		              error );
 
-				return( -1 );
-			}
-			buffer_offset += read_count;
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from lead-out: %d.",
+			 function,
+			 extent_index );
 
-			internal_handle->current_offset += (off64_t) read_count;
+			return( -1 );
+		}
+		return( read_count );
+	}
+	read_count = libodraw_handle_read_buffer_from_unspecified_sector(
+	              internal_handle,
+	              sector_data_buffer,
+	              readahead,
+	              offset,
+	              previous_track_index,
+	              buffer,
+	              buffer_size,
+	              error );
 
-			current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from unspecified.",
+		 function );
 
-			if( current_sector > (uint64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: current sector value out of bounds.",
-				 function );
+		return( -1 );
+	}
+	return( read_count );
+}
 
-				return( -1 );
-			}
-			if( current_sector >= track_value->end_sector )
-			{
-				internal_handle->current_track += 1;
-			}
-		}
-		if( buffer_offset >= buffer_size )
-		{
-			break;
-		}
-		if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-		{
-			break;
-		}
-		if( internal_handle->current_run_out < number_of_run_outs )
-		{
-			if( libcdata_array_get_entry_by_index(
-			     internal_handle->run_outs_array,
-			     internal_handle->current_run_out,
-			     (intptr_t **) &sector_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve run-out sector range: %d from array.",
-				 function,
-				 internal_handle->current_run_out );
-
-				return( -1 );
-			}
-			if( sector_range == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing run-out sector range: %d.",
-				 function,
-				 internal_handle->current_run_out );
-
-				return( -1 );
-			}
-			/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
-			if( ( current_sector >= sector_range->start_sector )
-			 && ( current_sector < sector_range->end_sector ) )
-			{
-				in_known_range = 1;
-
-				read_count = libodraw_handle_read_buffer_from_run_out(
-					      internal_handle,
-					      (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-					      buffer_size - buffer_offset,
-					      error );
-
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer from run-out: %d.",
-					 function,
-					 internal_handle->current_run_out );
-
-					return( -1 );
-				}
-				buffer_offset += read_count;
-
-				internal_handle->current_offset += (off64_t) read_count;
-
-				current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
-
-				if( current_sector > (uint64_t) UINT32_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: current sector value out of bounds.",
-					 function );
-
-					return( -1 );
-				}
-				if( current_sector >= sector_range->end_sector )
-				{
-					internal_handle->current_run_out += 1;
-				}
-			}
-			if( buffer_offset >= buffer_size )
-			{
-				break;
-			}
-			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-			{
-				break;
-			}
-		}
-		if( internal_handle->current_lead_out < number_of_lead_outs )
-		{
-			if( libcdata_array_get_entry_by_index(
-			     internal_handle->lead_outs_array,
-			     internal_handle->current_lead_out,
-			     (intptr_t **) &sector_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve lead-out sector range: %d from array.",
-				 function,
-				 internal_handle->current_lead_out );
-
-				return( -1 );
-			}
-			if( sector_range == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing lead-out sector range: %d.",
-				 function,
-				 internal_handle->current_lead_out );
-
-				return( -1 );
-			}
-			/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
-			if( ( current_sector >= sector_range->start_sector )
-			 && ( current_sector < sector_range->end_sector ) )
-			{
-				in_known_range = 1;
-
-				read_count = libodraw_handle_read_buffer_from_lead_out(
-					      internal_handle,
-					      (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-					      buffer_size - buffer_offset,
-					      error );
-
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer from lead-out: %d.",
-					 function,
-					 internal_handle->current_lead_out );
-
-					return( -1 );
-				}
-				buffer_offset += read_count;
-
-				internal_handle->current_offset += (off64_t) read_count;
-
-				current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
-
-				if( current_sector > (uint64_t) UINT32_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: current sector value out of bounds.",
-					 function );
-
-					return( -1 );
-				}
-				if( current_sector >= sector_range->end_sector )
-				{
-					internal_handle->current_lead_out += 1;
-				}
-			}
-			if( buffer_offset >= buffer_size )
-			{
-				break;
-			}
-			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-			{
-				break;
-			}
-		}
-		if( in_known_range == 0 )
-		{
-			read_count = libodraw_handle_read_buffer_from_unspecified_sector(
-			              internal_handle,
-			              (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-			              buffer_size - buffer_offset,
-			              error );
-
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer from unspecified.",
-				 function );
-
-				return( -1 );
-			}
-			buffer_offset += read_count;
-
-			internal_handle->current_offset += (off64_t) read_count;
-
-			current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
-
-			if( current_sector > (uint64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: current sector value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( current_sector >= track_value->end_sector )
-			{
-				internal_handle->current_track += 1;
-			}
-			if( buffer_offset >= buffer_size )
-			{
-				break;
-			}
-			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-			{
-				break;
-			}
-		}
-		if( internal_handle->io_handle->abort != 0 )
-		{
-			break;
-		}
-	}
-	return( (size_t) buffer_offset );
-}
-
-/* Reads a buffer from run-out
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libodraw_handle_read_buffer_from_run_out(
-         libodraw_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
-{
-	libodraw_track_value_t *track_value   = NULL;
-	libodraw_sector_range_t *sector_range = NULL;
-	uint8_t *read_buffer                  = NULL;
-	uint8_t *sector_data                  = NULL;
-	static char *function                 = "libodraw_handle_read_buffer_from_run_out";
-	off64_t current_sector_offset         = 0;
-	off64_t run_out_data_offset           = 0;
-	size64_t data_file_number_of_sectors  = 0;
-	size64_t data_file_size               = 0;
-	size64_t required_number_of_sectors   = 0;
-	uint64_t current_sector               = 0;
-	uint64_t run_out_data_start_sector    = 0;
-	size_t read_number_of_sectors         = 0;
-	size_t read_size                      = 0;
-	ssize_t read_count                    = 0;
+/* Reads a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_read_buffer";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -2581,314 +3373,224 @@ ssize_t libodraw_handle_read_buffer_from_run_out(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->run_outs_array,
-	     internal_handle->current_run_out,
-	     (intptr_t **) &sector_range,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve run-out sector range: %d from array.",
-		 function,
-		 internal_handle->current_run_out );
-
-		goto on_error;
-	}
-	if( sector_range == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing run-out sector range: %d.",
-		 function,
-		 internal_handle->current_run_out );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
-	if( ( current_sector < sector_range->start_sector )
-	 || ( current_sector >= sector_range->end_sector ) )
+	if( internal_handle->current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
 	{
-		libcnotify_printf(
-		 "%s: reading data from run-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
-		 function,
-		 internal_handle->current_run_out,
-		 sector_range->start_sector,
-		 sector_range->end_sector );
+		return( 0 );
 	}
-#endif
-	/* Retrieves the track that corresponds to the run-out
-	 */
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     internal_handle->current_track - 1,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+	if( ( internal_handle->sector_cache == NULL )
+	 && ( internal_handle->sector_cache_size >= (size_t) internal_handle->io_handle->bytes_per_sector ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 internal_handle->current_track - 1 );
+		if( libodraw_sector_cache_initialize(
+		     &( internal_handle->sector_cache ),
+		     (int) ( internal_handle->sector_cache_size / internal_handle->io_handle->bytes_per_sector ),
+		     (size_t) internal_handle->io_handle->bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sector cache.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	if( track_value == NULL )
+	if( ( internal_handle->readahead == NULL )
+	 && ( internal_handle->readahead_window_size > 0 )
+	 && ( internal_handle->memory_map_data_files == 0 )
+	 && ( internal_handle->data_file_io_pool != NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track value: %d.",
-		 function,
-		 internal_handle->current_track - 1 );
+		if( libodraw_readahead_initialize(
+		     &( internal_handle->readahead ),
+		     internal_handle->data_file_io_pool,
+		     internal_handle->readahead_window_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create readahead.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	if( track_value->end_sector != sector_range->start_sector )
+	while( buffer_offset < buffer_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: sector range start sector value out of bounds.",
-		 function );
+		read_count = libodraw_internal_handle_read_buffer_from_extent(
+		              internal_handle,
+		              internal_handle->sector_data_buffer,
+		              internal_handle->sector_cache,
+		              internal_handle->readahead,
+		              internal_handle->current_offset,
+		              &( buffer[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              error );
 
-		goto on_error;
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_handle->current_offset,
+			 internal_handle->current_offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+
+		internal_handle->current_offset += (off64_t) read_count;
+
+		if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+		{
+			break;
+		}
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
 	}
-	current_sector_offset = internal_handle->current_offset
-	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+	return( (ssize_t) buffer_offset );
+}
 
-	if( ( current_sector_offset < 0 )
-	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+/* Reads a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer(
+         libodraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_read_buffer";
+	ssize_t read_count                          = 0;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current sector offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
-	{
-		read_number_of_sectors += 1;
-	}
-	if( ( (uint64_t) read_number_of_sectors + current_sector ) > sector_range->end_sector )
+	if( internal_handle->data_file_io_pool == NULL )
 	{
-		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
-	     track_value->data_file_index,
-	     &data_file_size,
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
-		 function,
-		 track_value->data_file_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
-
-	/* Determine if the required number of sectors are available in the data file
-	 */
-	required_number_of_sectors = track_value->data_file_start_sector
-	                           + track_value->number_of_sectors
-	                           + sector_range->number_of_sectors;
+#endif
+	read_count = libodraw_internal_handle_read_buffer(
+	              internal_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              error );
 
-	if( required_number_of_sectors > data_file_number_of_sectors )
+	if( read_count == -1 )
 	{
-		read_size = ( read_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
-		          - (size_t) current_sector_offset;
-
-		if( read_size > buffer_size )
-		{
-			read_size = buffer_size;
-		}
-		/* Fill the buffer with 0 byte values if the run-out data is
-		 * not available in the data file
-		 */
-		if( memory_set(
-		     buffer,
-		     0,
-		     read_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy run-out data to buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
 
-			goto on_error;
-		}
-		read_count = (ssize_t) read_size;
+		read_count = -1;
 	}
-	else
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
-		run_out_data_start_sector = current_sector
-		                          - sector_range->start_sector
-		                          + track_value->number_of_sectors;
-
-		run_out_data_offset = track_value->data_file_offset
-		                    + ( run_out_data_start_sector * track_value->bytes_per_sector );
-
-		read_size = read_number_of_sectors * track_value->bytes_per_sector;
-
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-/* TODO use sector data cache ? */
-			sector_data = (uint8_t *) memory_allocate(
-			                           sizeof( uint8_t ) * read_size );
-
-			if( sector_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create sector data.",
-				 function );
-
-				goto on_error;
-			}
-			read_buffer = sector_data;
-		}
-		else
-		{
-			read_buffer          = buffer;
-			read_size           -= (size_t) current_sector_offset;
-			run_out_data_offset += current_sector_offset;
-
-			if( read_size > buffer_size )
-			{
-				read_size = buffer_size;
-			}
-		}
-		if( libbfio_pool_seek_offset(
-		     internal_handle->data_file_io_pool,
-		     track_value->data_file_index,
-		     run_out_data_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-			 function,
-			 track_value->data_file_index,
-			 run_out_data_offset );
-
-			goto on_error;
-		}
-		read_count = libbfio_pool_read_buffer(
-			      internal_handle->data_file_io_pool,
-			      track_value->data_file_index,
-			      read_buffer,
-			      read_size,
-			      error );
-
-		if( read_count != (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data file: %d.",
-			 function,
-			 track_value->data_file_index );
-
-			goto on_error;
-		}
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-			read_count = libodraw_io_handle_copy_sector_data_to_buffer(
-				      internal_handle->io_handle,
-				      sector_data,
-				      read_size,
-			              track_value->bytes_per_sector,
-				      LIBODRAW_TRACK_TYPE_UNKNOWN,
-				      buffer,
-				      buffer_size,
-				      (uint32_t) current_sector,
-				      (uint32_t) current_sector_offset,
-				      error );
-
-			if( read_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy sector data to buffer.",
-				 function );
-
-				goto on_error;
-			}
-			memory_free(
-			 sector_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			sector_data = NULL;
-		}
+		return( -1 );
 	}
+#endif
 	return( read_count );
-
-on_error:
-	if( sector_data != NULL )
-	{
-		memory_free(
-		 sector_data );
-	}
-	return( -1 );
 }
 
-/* Reads a buffer from lead-out
+/* Reads a buffer from run-out
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_lead_out(
+ssize_t libodraw_handle_read_buffer_from_run_out(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         off64_t offset,
+         int run_out_index,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error )
@@ -2897,14 +3599,14 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 	libodraw_sector_range_t *sector_range = NULL;
 	uint8_t *read_buffer                  = NULL;
 	uint8_t *sector_data                  = NULL;
-	static char *function                 = "libodraw_handle_read_buffer_from_lead_out";
+	static char *function                 = "libodraw_handle_read_buffer_from_run_out";
 	off64_t current_sector_offset         = 0;
-	off64_t lead_out_data_offset          = 0;
+	off64_t run_out_data_offset           = 0;
 	size64_t data_file_number_of_sectors  = 0;
 	size64_t data_file_size               = 0;
 	size64_t required_number_of_sectors   = 0;
 	uint64_t current_sector               = 0;
-	uint64_t lead_out_data_start_sector   = 0;
+	uint64_t run_out_data_start_sector    = 0;
 	size_t read_number_of_sectors         = 0;
 	size_t read_size                      = 0;
 	ssize_t read_count                    = 0;
@@ -2943,8 +3645,8 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		return( -1 );
 	}
 	if( libcdata_array_get_entry_by_index(
-	     internal_handle->lead_outs_array,
-	     internal_handle->current_lead_out,
+	     internal_handle->run_outs_array,
+	     run_out_index,
 	     (intptr_t **) &sector_range,
 	     error ) != 1 )
 	{
@@ -2952,9 +3654,9 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve lead-out sector range: %d from array.",
+		 "%s: unable to retrieve run-out sector range: %d from array.",
 		 function,
-		 internal_handle->current_lead_out );
+		 run_out_index );
 
 		goto on_error;
 	}
@@ -2964,13 +3666,13 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing lead-out sector range: %d.",
+		 "%s: missing run-out sector range: %d.",
 		 function,
-		 internal_handle->current_lead_out );
+		 run_out_index );
 
 		goto on_error;
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	current_sector = (uint64_t) ( offset / internal_handle->io_handle->bytes_per_sector );
 
 	if( current_sector > (uint64_t) UINT32_MAX )
 	{
@@ -2983,7 +3685,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 
 		return( -1 );
 	}
-	/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
+	/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
 	if( ( current_sector < sector_range->start_sector )
 	 || ( current_sector >= sector_range->end_sector ) )
 	{
@@ -3000,18 +3702,18 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: reading data from lead-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
+		 "%s: reading data from run-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
 		 function,
-		 internal_handle->current_lead_out,
+		 run_out_index,
 		 sector_range->start_sector,
 		 sector_range->end_sector );
 	}
 #endif
-	/* Retrieves the track that corresponds to the lead-out
+	/* Retrieves the track that corresponds to the run-out
 	 */
 	if( libcdata_array_get_entry_by_index(
 	     internal_handle->tracks_array,
-	     internal_handle->current_track - 1,
+	     track_index,
 	     (intptr_t **) &track_value,
 	     error ) != 1 )
 	{
@@ -3021,7 +3723,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve track value: %d from array.",
 		 function,
-		 internal_handle->current_track - 1 );
+		 track_index );
 
 		goto on_error;
 	}
@@ -3033,7 +3735,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: missing track value: %d.",
 		 function,
-		 internal_handle->current_track - 1 );
+		 track_index );
 
 		goto on_error;
 	}
@@ -3048,7 +3750,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 
 		goto on_error;
 	}
-	current_sector_offset = internal_handle->current_offset
+	current_sector_offset = offset
 	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
 
 	if( ( current_sector_offset < 0 )
@@ -3073,8 +3775,8 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 	{
 		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
+	if( libodraw_internal_handle_get_data_file_sector_data_size(
+	     internal_handle,
 	     track_value->data_file_index,
 	     &data_file_size,
 	     error ) != 1 )
@@ -3083,7 +3785,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
+		 "%s: unable to retrieve data file: %d sector data size.",
 		 function,
 		 track_value->data_file_index );
 
@@ -3106,7 +3808,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		{
 			read_size = buffer_size;
 		}
-		/* Fill the buffer with 0 byte values if the lead-out data is
+		/* Fill the buffer with 0 byte values if the run-out data is
 		 * not available in the data file
 		 */
 		if( memory_set(
@@ -3118,7 +3820,7 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy lead-out data to buffer.",
+			 "%s: unable to copy run-out data to buffer.",
 			 function );
 
 			goto on_error;
@@ -3127,28 +3829,34 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 	}
 	else
 	{
-		lead_out_data_start_sector = current_sector
-		                           - sector_range->start_sector
-		                           + track_value->number_of_sectors;
+		run_out_data_start_sector = current_sector
+		                          - sector_range->start_sector
+		                          + track_value->number_of_sectors;
 
-		lead_out_data_offset = track_value->data_file_offset
-		                     + ( lead_out_data_start_sector * track_value->bytes_per_sector );
+		run_out_data_offset = track_value->data_file_offset
+		                    + ( run_out_data_start_sector * track_value->bytes_per_sector );
 
 		read_size = read_number_of_sectors * track_value->bytes_per_sector;
 
 		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
 		{
-/* TODO use sector data cache ? */
-			sector_data = (uint8_t *) memory_allocate(
-			                           sizeof( uint8_t ) * read_size );
-
-			if( sector_data == NULL )
+			if( read_size > (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE )
+			{
+				read_number_of_sectors = (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector;
+				read_size              = read_number_of_sectors * track_value->bytes_per_sector;
+			}
+			if( libodraw_sector_data_buffer_get_data(
+			     sector_data_buffer,
+			     run_out_data_offset,
+			     read_size,
+			     &sector_data,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create sector data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector data.",
 				 function );
 
 				goto on_error;
@@ -3157,39 +3865,22 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 		}
 		else
 		{
-			read_buffer           = buffer;
-			read_size            -= (size_t) current_sector_offset;
-			lead_out_data_offset += current_sector_offset;
+			read_buffer          = buffer;
+			read_size           -= (size_t) current_sector_offset;
+			run_out_data_offset += current_sector_offset;
 
 			if( read_size > buffer_size )
 			{
 				read_size = buffer_size;
 			}
 		}
-		if( libbfio_pool_seek_offset(
-		     internal_handle->data_file_io_pool,
-		     track_value->data_file_index,
-		     lead_out_data_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-			 function,
-			 track_value->data_file_index,
-			 lead_out_data_offset );
-
-			goto on_error;
-		}
-		read_count = libbfio_pool_read_buffer(
-			      internal_handle->data_file_io_pool,
-			      track_value->data_file_index,
-			      read_buffer,
-			      read_size,
-			      error );
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              internal_handle->data_file_io_pool,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              run_out_data_offset,
+		              error );
 
 		if( read_count != (ssize_t) read_size )
 		{
@@ -3228,45 +3919,42 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 
 				goto on_error;
 			}
-			memory_free(
-			 sector_data );
-
-			sector_data = NULL;
 		}
 	}
 	return( read_count );
 
 on_error:
-	if( sector_data != NULL )
-	{
-		memory_free(
-		 sector_data );
-	}
 	return( -1 );
 }
 
-/* Reads a buffer from a sector in an unspecified range
+/* Reads a buffer from lead-out
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
+ssize_t libodraw_handle_read_buffer_from_lead_out(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         off64_t offset,
+         int lead_out_index,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error )
 {
-	libodraw_track_value_t *track_value    = NULL;
-	uint8_t *read_buffer                   = NULL;
-	uint8_t *sector_data                   = NULL;
-	static char *function                  = "libodraw_handle_read_buffer_from_unspecified_sector";
-	off64_t current_sector_offset          = 0;
-	off64_t unspecified_data_offset        = 0;
-	size64_t data_file_number_of_sectors   = 0;
-	size64_t data_file_size                = 0;
-	size64_t required_number_of_sectors    = 0;
-	uint64_t current_sector                = 0;
-	uint64_t unspecified_data_start_sector = 0;
-	size_t read_size                       = 0;
-	ssize_t read_count                     = 0;
+	libodraw_track_value_t *track_value   = NULL;
+	libodraw_sector_range_t *sector_range = NULL;
+	uint8_t *read_buffer                  = NULL;
+	uint8_t *sector_data                  = NULL;
+	static char *function                 = "libodraw_handle_read_buffer_from_lead_out";
+	off64_t current_sector_offset         = 0;
+	off64_t lead_out_data_offset          = 0;
+	size64_t data_file_number_of_sectors  = 0;
+	size64_t data_file_size               = 0;
+	size64_t required_number_of_sectors   = 0;
+	uint64_t current_sector               = 0;
+	uint64_t lead_out_data_start_sector   = 0;
+	size_t read_number_of_sectors         = 0;
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -3301,7 +3989,35 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 
 		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->lead_outs_array,
+	     lead_out_index,
+	     (intptr_t **) &sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lead-out sector range: %d from array.",
+		 function,
+		 lead_out_index );
+
+		goto on_error;
+	}
+	if( sector_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing lead-out sector range: %d.",
+		 function,
+		 lead_out_index );
+
+		goto on_error;
+	}
+	current_sector = (uint64_t) ( offset / internal_handle->io_handle->bytes_per_sector );
 
 	if( current_sector > (uint64_t) UINT32_MAX )
 	{
@@ -3314,19 +4030,35 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 
 		return( -1 );
 	}
+	/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
+	if( ( current_sector < sector_range->start_sector )
+	 || ( current_sector >= sector_range->end_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: reading data from unspecified range.\n",
-		 function );
+		 "%s: reading data from lead-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
+		 function,
+		 lead_out_index,
+		 sector_range->start_sector,
+		 sector_range->end_sector );
 	}
 #endif
-	/* Retrieves the track that corresponds to the unspecified range
+	/* Retrieves the track that corresponds to the lead-out
 	 */
 	if( libcdata_array_get_entry_by_index(
 	     internal_handle->tracks_array,
-	     internal_handle->current_track - 1,
+	     track_index,
 	     (intptr_t **) &track_value,
 	     error ) != 1 )
 	{
@@ -3336,7 +4068,7 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve track value: %d from array.",
 		 function,
-		 internal_handle->current_track - 1 );
+		 track_index );
 
 		goto on_error;
 	}
@@ -3348,11 +4080,22 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: missing track value: %d.",
 		 function,
-		 internal_handle->current_track - 1 );
+		 track_index );
+
+		goto on_error;
+	}
+	if( track_value->end_sector != sector_range->start_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: sector range start sector value out of bounds.",
+		 function );
 
 		goto on_error;
 	}
-	current_sector_offset = internal_handle->current_offset
+	current_sector_offset = offset
 	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
 
 	if( ( current_sector_offset < 0 )
@@ -3367,8 +4110,18 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 
 		goto on_error;
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
+	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+
+	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	{
+		read_number_of_sectors += 1;
+	}
+	if( ( (uint64_t) read_number_of_sectors + current_sector ) > sector_range->end_sector )
+	{
+		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
+	}
+	if( libodraw_internal_handle_get_data_file_sector_data_size(
+	     internal_handle,
 	     track_value->data_file_index,
 	     &data_file_size,
 	     error ) != 1 )
@@ -3377,7 +4130,7 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
+		 "%s: unable to retrieve data file: %d sector data size.",
 		 function,
 		 track_value->data_file_index );
 
@@ -3385,26 +4138,22 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 	}
 	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
 
-	unspecified_data_start_sector = current_sector
-	                              - track_value->end_sector;
-
 	/* Determine if the required number of sectors are available in the data file
 	 */
 	required_number_of_sectors = track_value->data_file_start_sector
 	                           + track_value->number_of_sectors
-	                           + unspecified_data_start_sector
-	                           + 1;
+	                           + sector_range->number_of_sectors;
 
 	if( required_number_of_sectors > data_file_number_of_sectors )
 	{
-		read_size = internal_handle->io_handle->bytes_per_sector
+		read_size = ( read_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
 		          - (size_t) current_sector_offset;
 
 		if( read_size > buffer_size )
 		{
 			read_size = buffer_size;
 		}
-		/* Fill the buffer with 0 byte values if the unspecified data is
+		/* Fill the buffer with 0 byte values if the lead-out data is
 		 * not available in the data file
 		 */
 		if( memory_set(
@@ -3416,7 +4165,7 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy unspecified data to buffer.",
+			 "%s: unable to copy lead-out data to buffer.",
 			 function );
 
 			goto on_error;
@@ -3425,24 +4174,34 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 	}
 	else
 	{
-		unspecified_data_offset = track_value->data_file_offset
-		                        + ( unspecified_data_start_sector * track_value->bytes_per_sector );
+		lead_out_data_start_sector = current_sector
+		                           - sector_range->start_sector
+		                           + track_value->number_of_sectors;
+
+		lead_out_data_offset = track_value->data_file_offset
+		                     + ( lead_out_data_start_sector * track_value->bytes_per_sector );
 
-		read_size = track_value->bytes_per_sector;
+		read_size = read_number_of_sectors * track_value->bytes_per_sector;
 
 		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
 		{
-/* TODO use sector data cache ? */
-			sector_data = (uint8_t *) memory_allocate(
-			                           sizeof( uint8_t ) * read_size );
-
-			if( sector_data == NULL )
+			if( read_size > (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE )
+			{
+				read_number_of_sectors = (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector;
+				read_size              = read_number_of_sectors * track_value->bytes_per_sector;
+			}
+			if( libodraw_sector_data_buffer_get_data(
+			     sector_data_buffer,
+			     lead_out_data_offset,
+			     read_size,
+			     &sector_data,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create sector data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector data.",
 				 function );
 
 				goto on_error;
@@ -3451,39 +4210,22 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 		}
 		else
 		{
-			read_buffer              = buffer;
-			read_size               -= (size_t) current_sector_offset;
-			unspecified_data_offset += current_sector_offset;
+			read_buffer           = buffer;
+			read_size            -= (size_t) current_sector_offset;
+			lead_out_data_offset += current_sector_offset;
 
 			if( read_size > buffer_size )
 			{
 				read_size = buffer_size;
 			}
 		}
-		if( libbfio_pool_seek_offset(
-		     internal_handle->data_file_io_pool,
-		     track_value->data_file_index,
-		     unspecified_data_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-			 function,
-			 track_value->data_file_index,
-			 unspecified_data_offset );
-
-			goto on_error;
-		}
-		read_count = libbfio_pool_read_buffer(
-			      internal_handle->data_file_io_pool,
-			      track_value->data_file_index,
-			      read_buffer,
-			      read_size,
-			      error );
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              internal_handle->data_file_io_pool,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              lead_out_data_offset,
+		              error );
 
 		if( read_count != (ssize_t) read_size )
 		{
@@ -3522,43 +4264,49 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 
 				goto on_error;
 			}
-			memory_free(
-			 sector_data );
-
-			sector_data = NULL;
 		}
 	}
 	return( read_count );
 
 on_error:
-	if( sector_data != NULL )
-	{
-		memory_free(
-		 sector_data );
-	}
 	return( -1 );
 }
 
-/* Reads a buffer from track
+/* Reads a buffer from sectors in an unspecified range
+ * The sectors up to the next extent are read as a run, from the data file
+ * as far as it contains them, otherwise they are filled with 0 byte values
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_track(
+ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         libodraw_readahead_t *readahead,
+         off64_t offset,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error )
 {
-	libodraw_track_value_t *track_value = NULL;
-	uint8_t *read_buffer                = NULL;
-	uint8_t *sector_data                = NULL;
-	static char *function               = "libodraw_handle_read_buffer_from_track";
-	off64_t current_sector_offset       = 0;
-	off64_t track_data_offset           = 0;
-	uint64_t current_sector             = 0;
-	uint64_t track_data_start_sector    = 0;
-	size_t read_number_of_sectors       = 0;
-	size_t read_size                    = 0;
-	ssize_t read_count                  = 0;
+	libodraw_track_value_t *track_value    = NULL;
+	uint8_t *read_buffer                   = NULL;
+	uint8_t *sector_data                   = NULL;
+	static char *function                  = "libodraw_handle_read_buffer_from_unspecified_sector";
+	off64_t current_sector_offset          = 0;
+	off64_t unspecified_data_offset        = 0;
+	size64_t data_file_number_of_sectors   = 0;
+	size64_t data_file_size                = 0;
+	size64_t run_size                      = 0;
+	uint64_t available_number_of_sectors   = 0;
+	uint64_t current_sector                = 0;
+	uint64_t media_number_of_sectors       = 0;
+	uint64_t run_end_sector                = 0;
+	uint64_t run_number_of_sectors         = 0;
+	uint64_t unspecified_data_start_sector = 0;
+	uint64_t unspecified_data_first_sector = 0;
+	size_t read_number_of_sectors          = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	int result                             = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -3593,9 +4341,32 @@ ssize_t libodraw_handle_read_buffer_from_track(
 
 		return( -1 );
 	}
+	current_sector = (uint64_t) ( offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data from unspecified range.\n",
+		 function );
+	}
+#endif
+	/* Retrieves the track that corresponds to the unspecified range
+	 */
 	if( libcdata_array_get_entry_by_index(
 	     internal_handle->tracks_array,
-	     internal_handle->current_track,
+	     track_index,
 	     (intptr_t **) &track_value,
 	     error ) != 1 )
 	{
@@ -3605,7 +4376,7 @@ ssize_t libodraw_handle_read_buffer_from_track(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve track value: %d from array.",
 		 function,
-		 internal_handle->current_track );
+		 track_index );
 
 		goto on_error;
 	}
@@ -3617,272 +4388,272 @@ ssize_t libodraw_handle_read_buffer_from_track(
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: missing track value: %d.",
 		 function,
-		 internal_handle->current_track );
+		 track_index );
 
 		goto on_error;
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	current_sector_offset = offset
+	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
 
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( ( current_sector_offset < 0 )
+	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current sector offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	/* TODO currently assumes that current track start sector is always relative to the start of the media */
-	if( ( current_sector < track_value->start_sector )
-	 || ( current_sector >= track_value->end_sector ) )
+	/* Determine the end of the run of unspecified sectors, which is the start
+	 * of the next track, run-out or lead-out or otherwise the end of the media
+	 */
+	media_number_of_sectors = internal_handle->media_size / internal_handle->io_handle->bytes_per_sector;
+
+	if( ( internal_handle->media_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	{
+		media_number_of_sectors += 1;
+	}
+	run_end_sector = media_number_of_sectors;
+
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          internal_handle->extent_table,
+	          current_sector,
+	          &run_end_sector,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next extent start sector.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	else if( ( result == 0 )
+	      || ( run_end_sector > media_number_of_sectors ) )
 	{
-		libcnotify_printf(
-		 "%s: reading data from track: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
-		 function,
-		 internal_handle->current_track,
-		 track_value->start_sector,
-		 track_value->end_sector );
+		run_end_sector = media_number_of_sectors;
 	}
-#endif
-	current_sector_offset = internal_handle->current_offset
-	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+	/* Always read at least the current sector
+	 */
+	if( run_end_sector <= current_sector )
+	{
+		run_end_sector = current_sector + 1;
+	}
+	run_number_of_sectors = run_end_sector - current_sector;
 
-	if( ( current_sector_offset < 0 )
-	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	if( libodraw_internal_handle_get_data_file_sector_data_size(
+	     internal_handle,
+	     track_value->data_file_index,
+	     &data_file_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current sector offset value out of bounds.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d sector data size.",
+		 function,
+		 track_value->data_file_index );
 
 		goto on_error;
 	}
-	track_data_start_sector = current_sector - track_value->start_sector;
+	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
 
-	track_data_offset = track_value->data_file_offset
-	                  + ( track_data_start_sector * track_value->bytes_per_sector );
+	unspecified_data_start_sector = current_sector
+	                              - track_value->end_sector;
 
-	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+	/* Determine how many of the unspecified sectors of the run are available in the data file
+	 */
+	unspecified_data_first_sector = track_value->data_file_start_sector
+	                              + track_value->number_of_sectors
+	                              + unspecified_data_start_sector;
 
-	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	if( unspecified_data_first_sector < data_file_number_of_sectors )
 	{
-		read_number_of_sectors += 1;
+		available_number_of_sectors = data_file_number_of_sectors - unspecified_data_first_sector;
 	}
-	if( ( (uint64_t) read_number_of_sectors + current_sector ) > track_value->end_sector )
+	if( available_number_of_sectors == 0 )
 	{
-		read_number_of_sectors = (size_t) ( track_value->end_sector - current_sector );
-	}
-	read_size = read_number_of_sectors * track_value->bytes_per_sector;
+		run_size = ( run_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
+		         - (size64_t) current_sector_offset;
 
-	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-	{
-/* TODO handle more track types */
-		if( ( track_value->type != LIBODRAW_TRACK_TYPE_AUDIO )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2048 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2352 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2048 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2336 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+		if( run_size > (size64_t) buffer_size )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported track type.",
-			 function );
-
-			goto on_error;
+			read_size = buffer_size;
 		}
-/* TODO use sector data cache ? */
-		sector_data = (uint8_t *) memory_allocate(
-		                           sizeof( uint8_t ) * read_size );
-
-		if( sector_data == NULL )
+		else
+		{
+			read_size = (size_t) run_size;
+		}
+		/* Fill the buffer with 0 byte values if the unspecified data is
+		 * not available in the data file, for the entire run at once
+		 */
+		if( memory_set(
+		     buffer,
+		     0,
+		     read_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sector data.",
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set unspecified data in buffer.",
 			 function );
 
 			goto on_error;
 		}
-		read_buffer = sector_data;
+		read_count = (ssize_t) read_size;
 	}
 	else
 	{
-		read_buffer        = buffer;
-		read_size         -= (size_t) current_sector_offset;
-		track_data_offset += current_sector_offset;
+		if( run_number_of_sectors > available_number_of_sectors )
+		{
+			run_number_of_sectors = available_number_of_sectors;
+		}
+		read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
 
-		if( read_size > buffer_size )
+		if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
 		{
-			read_size = buffer_size;
+			read_number_of_sectors += 1;
 		}
-	}
-	if( libbfio_pool_seek_offset(
-	     internal_handle->data_file_io_pool,
-	     track_value->data_file_index,
-	     track_data_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-		 function,
-		 track_value->data_file_index,
-		 track_data_offset );
+		if( (uint64_t) read_number_of_sectors > run_number_of_sectors )
+		{
+			read_number_of_sectors = (size_t) run_number_of_sectors;
+		}
+		unspecified_data_offset = track_value->data_file_offset
+		                        + ( unspecified_data_start_sector * track_value->bytes_per_sector );
 
-		goto on_error;
-	}
-	read_count = libbfio_pool_read_buffer(
-		      internal_handle->data_file_io_pool,
-		      track_value->data_file_index,
-		      read_buffer,
-		      read_size,
-		      error );
+		read_size = read_number_of_sectors * track_value->bytes_per_sector;
 
-	if( read_count != (ssize_t) read_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer from data file: %d.",
-		 function,
-		 track_value->data_file_index );
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+			if( read_size > (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE )
+			{
+				read_number_of_sectors = (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector;
+				read_size              = read_number_of_sectors * track_value->bytes_per_sector;
+			}
+			if( libodraw_sector_data_buffer_get_data(
+			     sector_data_buffer,
+			     unspecified_data_offset,
+			     read_size,
+			     &sector_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector data.",
+				 function );
 
-		goto on_error;
-	}
-	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-	{
-		read_count = libodraw_io_handle_copy_sector_data_to_buffer(
-		              internal_handle->io_handle,
-		              sector_data,
+				goto on_error;
+			}
+			read_buffer = sector_data;
+		}
+		else
+		{
+			read_buffer              = buffer;
+			read_size               -= (size_t) current_sector_offset;
+			unspecified_data_offset += current_sector_offset;
+
+			if( read_size > buffer_size )
+			{
+				read_size = buffer_size;
+			}
+		}
+		read_count = libodraw_internal_handle_read_data_file_buffer(
+		              internal_handle,
+		              readahead,
+		              track_value->data_file_index,
+		              read_buffer,
 		              read_size,
-		              track_value->bytes_per_sector,
-		              track_value->type,
-		              buffer,
-		              buffer_size,
-			      (uint32_t) current_sector,
-		              (uint32_t) current_sector_offset,
+		              unspecified_data_offset,
 		              error );
 
-		if( read_count < 0 )
+		if( read_count != (ssize_t) read_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy sector data to buffer.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 track_value->data_file_index );
 
 			goto on_error;
 		}
-		memory_free(
-		 sector_data );
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+			read_count = libodraw_io_handle_copy_sector_data_to_buffer(
+				      internal_handle->io_handle,
+				      sector_data,
+				      read_size,
+			              track_value->bytes_per_sector,
+				      LIBODRAW_TRACK_TYPE_UNKNOWN,
+				      buffer,
+				      buffer_size,
+				      (uint32_t) current_sector,
+				      (uint32_t) current_sector_offset,
+				      error );
 
-		sector_data = NULL;
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 	return( read_count );
 
 on_error:
-	if( sector_data != NULL )
-	{
-		memory_free(
-		 sector_data );
-	}
 	return( -1 );
 }
 
-/* Reads (media) data at a specific offset
+/* Reads a buffer from track
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_at_offset(
-         libodraw_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libodraw_handle_read_buffer_at_offset";
-	ssize_t read_count    = 0;
-
-	if( libodraw_handle_seek_offset(
-	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
-
-		return( -1 );
-	}
-	read_count = libodraw_handle_read_buffer(
-	              handle,
-	              buffer,
-	              buffer_size,
-	              error );
-
-	if( read_count <= -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
-
-		return( -1 );
-	}
-	return( read_count );
-}
-
-/* Seeks a certain offset of the (media) data
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
- */
-off64_t libodraw_internal_handle_seek_offset(
+ssize_t libodraw_handle_read_buffer_from_track(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         libodraw_sector_cache_t *sector_cache,
+         libodraw_readahead_t *readahead,
          off64_t offset,
-         int whence,
+         int track_index,
+         uint8_t *buffer,
+         size_t buffer_size,
          libcerror_error_t **error )
 {
-	libodraw_sector_range_t *lead_out_sector_range = NULL;
-	libodraw_sector_range_t *run_out_sector_range  = NULL;
-	libodraw_track_value_t *track_value            = NULL;
-	static char *function                          = "libodraw_internal_handle_seek_offset";
-	off64_t lead_out_offset                        = 0;
-	off64_t run_out_offset                         = 0;
-	off64_t track_offset                           = 0;
-	int current_lead_out                           = 0;
-	int current_run_out                            = 0;
-	int current_track                              = 0;
+	libodraw_track_value_t *track_value = NULL;
+	uint8_t *cached_sector_data         = NULL;
+	uint8_t *read_buffer                = NULL;
+	uint8_t *sector_data                = NULL;
+	static char *function               = "libodraw_handle_read_buffer_from_track";
+	off64_t current_sector_offset       = 0;
+	off64_t track_data_offset           = 0;
+	uint64_t cache_sector               = 0;
+	uint64_t current_sector             = 0;
+	uint64_t track_data_start_sector    = 0;
+	uint64_t verify_sector              = 0;
+	size_t cache_buffer_offset          = 0;
+	size_t read_number_of_sectors       = 0;
+	size_t read_size                    = 0;
+	size_t verify_buffer_offset         = 0;
+	ssize_t read_count                  = 0;
+	uint8_t read_sector_data            = 0;
+	int result                          = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -3906,159 +4677,406 @@ off64_t libodraw_internal_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->tracks_array,
+	     track_index,
+	     (intptr_t **) &track_value,
+	     error ) != 1 )
 	{
-		offset += internal_handle->current_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d from array.",
+		 function,
+		 track_index );
+
+		goto on_error;
 	}
-	else if( whence == SEEK_END )
+	if( track_value == NULL )
 	{
-		offset += (off64_t) internal_handle->media_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 track_index );
+
+		goto on_error;
 	}
-	if( offset < 0 )
+	current_sector = (uint64_t) ( offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* TODO currently assumes that current track start sector is always relative to the start of the media */
+	if( ( current_sector < track_value->start_sector )
+	 || ( current_sector >= track_value->end_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data from track: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
+		 function,
+		 track_index,
+		 track_value->start_sector,
+		 track_value->end_sector );
+	}
+#endif
+	current_sector_offset = offset
+	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+
+	if( ( current_sector_offset < 0 )
+	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 "%s: invalid current sector offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( offset < (off64_t) internal_handle->media_size )
+	if( sector_cache != NULL )
 	{
-		if( libodraw_handle_get_run_out_at_offset(
-		     internal_handle,
-		     offset,
-		     &current_run_out,
-		     &run_out_sector_range,
-		     &run_out_offset,
-		     error ) == -1 )
+		result = libodraw_sector_cache_get_sector_data(
+		          sector_cache,
+		          track_value->data_file_index,
+		          current_sector,
+		          &cached_sector_data,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve run-out at offset: %" PRIi64 ".",
+			 "%s: unable to retrieve sector: %" PRIu64 " data from cache.",
 			 function,
-			 offset );
+			 current_sector );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( libodraw_handle_get_lead_out_at_offset(
-		     internal_handle,
-		     offset,
-		     &current_lead_out,
-		     &lead_out_sector_range,
-		     &lead_out_offset,
-		     error ) == -1 )
+		else if( result != 0 )
+		{
+			read_size = (size_t) ( internal_handle->io_handle->bytes_per_sector - current_sector_offset );
+
+			if( read_size > buffer_size )
+			{
+				read_size = buffer_size;
+			}
+			if( memory_copy(
+			     buffer,
+			     &( cached_sector_data[ current_sector_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy cached sector data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+			return( (ssize_t) read_size );
+		}
+	}
+	track_data_start_sector = current_sector - track_value->start_sector;
+
+	track_data_offset = track_value->data_file_offset
+	                  + ( track_data_start_sector * track_value->bytes_per_sector );
+
+	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+
+	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	{
+		read_number_of_sectors += 1;
+	}
+	if( ( (uint64_t) read_number_of_sectors + current_sector ) > track_value->end_sector )
+	{
+		read_number_of_sectors = (size_t) ( track_value->end_sector - current_sector );
+	}
+	read_size = read_number_of_sectors * track_value->bytes_per_sector;
+
+	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+	{
+		read_sector_data = 1;
+	}
+	/* Audio samples that need to be byte swapped are read directly into the buffer
+	 * unless the buffer starts or ends in the middle of a sample
+	 */
+	else if( ( track_value->swap_samples != 0 )
+	      && ( ( ( current_sector_offset % 2 ) != 0 )
+	       ||  ( ( buffer_size % 2 ) != 0 ) ) )
+	{
+		read_sector_data = 1;
+	}
+	if( read_sector_data != 0 )
+	{
+		if( ( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_AUDIO )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2048 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2352 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2048 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2324 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2336 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2352 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_CDI_2336 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_CDI_2352 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve lead-out at offset: %" PRIi64 ".",
-			 function,
-			 offset );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track type.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( libodraw_handle_get_track_at_offset(
-		     internal_handle,
-		     offset,
-		     &current_track,
-		     &track_value,
-		     &track_offset,
-		     error ) == -1 )
+		if( read_size > (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE )
+		{
+			read_number_of_sectors = (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector;
+			read_size              = read_number_of_sectors * track_value->bytes_per_sector;
+		}
+		if( libodraw_sector_data_buffer_get_data(
+		     sector_data_buffer,
+		     track_data_offset,
+		     read_size,
+		     &sector_data,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve track at offset: %" PRIi64 ".",
-			 function,
-			 offset );
+			 "%s: unable to retrieve sector data.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
+		read_buffer = sector_data;
 	}
 	else
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_handle->run_outs_array,
-		     &current_run_out,
+		read_buffer        = buffer;
+		read_size         -= (size_t) current_sector_offset;
+		track_data_offset += current_sector_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+	}
+	read_count = libodraw_internal_handle_read_data_file_buffer(
+	              internal_handle,
+	              readahead,
+	              track_value->data_file_index,
+	              read_buffer,
+	              read_size,
+	              track_data_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from data file: %d.",
+		 function,
+		 track_value->data_file_index );
+
+		goto on_error;
+	}
+	if( internal_handle->sector_verification_flags != 0 )
+	{
+		/* Only sectors that were read in their entirety are verified
+		 */
+		verify_sector = current_sector;
+
+		if( read_buffer == sector_data )
+		{
+			verify_buffer_offset = 0;
+		}
+		else if( current_sector_offset != 0 )
+		{
+			verify_buffer_offset = (size_t) ( track_value->bytes_per_sector - current_sector_offset );
+			verify_sector       += 1;
+		}
+		if( verify_buffer_offset < read_size )
+		{
+			if( libodraw_internal_handle_verify_sector_data(
+			     internal_handle,
+			     track_value,
+			     verify_sector,
+			     &( read_buffer[ verify_buffer_offset ] ),
+			     read_size - verify_buffer_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify sector data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( track_value->swap_samples != 0 )
+	{
+		if( libodraw_byte_swap_16bit(
+		     read_buffer,
+		     read_size - ( read_size % 2 ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements in run-outs array.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to byte swap audio samples.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_handle->lead_outs_array,
-		     &current_lead_out,
-		     error ) != 1 )
+	}
+	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+	{
+		read_count = libodraw_internal_handle_copy_sector_data_to_buffer(
+		              internal_handle,
+		              track_value,
+		              sector_data,
+		              read_size,
+		              internal_handle->io_handle->bytes_per_sector,
+		              buffer,
+		              buffer_size,
+			      (uint32_t) current_sector,
+		              (uint32_t) current_sector_offset,
+		              error );
+
+		if( read_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements in lead-outs array.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to buffer.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_handle->tracks_array,
-		     &current_track,
-		     error ) != 1 )
+	}
+	else if( read_sector_data != 0 )
+	{
+		read_count = (ssize_t) ( read_size - (size_t) current_sector_offset );
+
+		if( (size_t) read_count > buffer_size )
+		{
+			read_count = (ssize_t) buffer_size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( sector_data[ current_sector_offset ] ),
+		     (size_t) read_count ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements in tracks array.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to buffer.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	internal_handle->current_offset   = offset;
-	internal_handle->current_run_out  = current_run_out;
-	internal_handle->current_lead_out = current_lead_out;
-	internal_handle->current_track    = current_track;
+	if( sector_cache != NULL )
+	{
+		/* Only sectors that were read in their entirety are added to the cache
+		 */
+		cache_sector = current_sector;
 
-	return( offset );
+		if( current_sector_offset != 0 )
+		{
+			cache_buffer_offset = (size_t) ( internal_handle->io_handle->bytes_per_sector - current_sector_offset );
+			cache_sector       += 1;
+		}
+		while( ( cache_buffer_offset + internal_handle->io_handle->bytes_per_sector ) <= (size_t) read_count )
+		{
+			if( libodraw_sector_cache_set_sector_data(
+			     sector_cache,
+			     track_value->data_file_index,
+			     cache_sector,
+			     &( buffer[ cache_buffer_offset ] ),
+			     (size_t) internal_handle->io_handle->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sector: %" PRIu64 " data in cache.",
+				 function,
+				 cache_sector );
+
+				goto on_error;
+			}
+			cache_buffer_offset += internal_handle->io_handle->bytes_per_sector;
+			cache_sector        += 1;
+		}
+	}
+	return( read_count );
+
+on_error:
+	return( -1 );
 }
 
-/* Seeks a certain offset of the (media) data
- * Returns the offset if seek is successful or -1 on error
+/* Reads (media) data at a specific offset
+ * Returns the number of bytes read or -1 on error
  */
-off64_t libodraw_handle_seek_offset(
+ssize_t libodraw_handle_read_buffer_at_offset(
          libodraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
          off64_t offset,
-         int whence,
          libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_seek_offset";
+	static char *function                       = "libodraw_handle_read_buffer_at_offset";
+	ssize_t read_count                          = 0;
 
 	if( handle == NULL )
 	{
@@ -4099,13 +5117,11 @@ off64_t libodraw_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libodraw_internal_handle_seek_offset(
-	          internal_handle,
-	          offset,
-	          whence,
-	          error );
-
-	if( offset == -1 )
+	if( libodraw_internal_handle_seek_offset(
+	     internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4114,7 +5130,27 @@ off64_t libodraw_handle_seek_offset(
 		 "%s: unable to seek offset.",
 		 function );
 
-		offset = -1;
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libodraw_internal_handle_read_buffer(
+		              internal_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			read_count = -1;
+		}
 	}
 #if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -4131,24 +5167,21 @@ off64_t libodraw_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( read_count );
 }
 
-/* Retrieves a run-out sector range for the specified offset
- * When no matching run-out was found the run_out_index value contains the next run-out index on return
- * Returns 1 if successful, 0 if no matching run-out was found or -1 on error
+/* Grabs a sector data buffer from the pool of the handle
+ * A new sector data buffer is created if the pool is empty
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_run_out_at_offset(
+int libodraw_internal_handle_grab_sector_data_buffer(
      libodraw_internal_handle_t *internal_handle,
-     off64_t offset,
-     int *run_out_index,
-     libodraw_sector_range_t **run_out_sector_range,
-     off64_t *run_out_offset,
+     libodraw_sector_data_buffer_t **sector_data_buffer,
      libcerror_error_t **error )
 {
-	static char *function   = "libodraw_handle_get_run_out_at_offset";
-	uint64_t current_sector = 0;
-	int number_of_run_outs  = 0;
+	static char *function             = "libodraw_internal_handle_grab_sector_data_buffer";
+	int number_of_sector_data_buffers = 0;
+	int result                        = 1;
 
 	if( internal_handle == NULL )
 	{
@@ -4161,153 +5194,321 @@ int libodraw_handle_get_run_out_at_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data_buffer != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector data buffer value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle->sector_data_buffers_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab sector data buffers mutex.",
 		 function );
 
 		return( -1 );
 	}
-	if( run_out_index == NULL )
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->sector_data_buffers_array,
+	     &number_of_sector_data_buffers,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run-out index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector data buffers.",
+		 function );
+
+		result = -1;
+	}
+	else if( number_of_sector_data_buffers > 0 )
+	{
+		number_of_sector_data_buffers -= 1;
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->sector_data_buffers_array,
+		     number_of_sector_data_buffers,
+		     (intptr_t **) sector_data_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data buffer: %d from array.",
+			 function,
+			 number_of_sector_data_buffers );
+
+			result = -1;
+		}
+		/* The entry is unset before the array is resized so it is not freed
+		 */
+		else if( libcdata_array_set_entry_by_index(
+		          internal_handle->sector_data_buffers_array,
+		          number_of_sector_data_buffers,
+		          NULL,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sector data buffer: %d in array.",
+			 function,
+			 number_of_sector_data_buffers );
+
+			result = -1;
+		}
+		else if( libcdata_array_resize(
+		          internal_handle->sector_data_buffers_array,
+		          number_of_sector_data_buffers,
+		          (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_data_buffer_free,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize sector data buffers array.",
+			 function );
+
+			/* The sector data buffer is no longer referenced by the array
+			 */
+			libodraw_sector_data_buffer_free(
+			 sector_data_buffer,
+			 NULL );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			*sector_data_buffer = NULL;
+		}
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->sector_data_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release sector data buffers mutex.",
 		 function );
 
+		if( *sector_data_buffer != NULL )
+		{
+			libodraw_sector_data_buffer_free(
+			 sector_data_buffer,
+			 NULL );
+		}
 		return( -1 );
 	}
-	if( run_out_sector_range == NULL )
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( *sector_data_buffer == NULL )
+	{
+		if( libodraw_sector_data_buffer_initialize(
+		     sector_data_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sector data buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a sector data buffer to the pool of the handle
+ * The sector data buffer is freed if the pool is full
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_release_sector_data_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function             = "libodraw_internal_handle_release_sector_data_buffer";
+	int entry_index                   = 0;
+	int number_of_sector_data_buffers = 0;
+	int result                        = 1;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run-out sector range.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( run_out_offset == NULL )
+	if( sector_data_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run-out offset.",
+		 "%s: invalid sector data buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->run_outs_array,
-	     &number_of_run_outs,
-	     error ) != 1 )
+	if( *sector_data_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in run-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing sector data buffer.",
 		 function );
 
 		return( -1 );
 	}
-	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle->sector_data_buffers_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab sector data buffers mutex.",
 		 function );
 
+		libodraw_sector_data_buffer_free(
+		 sector_data_buffer,
+		 NULL );
+
 		return( -1 );
 	}
-	for( *run_out_index = 0;
-	     *run_out_index < number_of_run_outs;
-	     *run_out_index += 1 )
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->sector_data_buffers_array,
+	     &number_of_sector_data_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector data buffers.",
+		 function );
+
+		result = -1;
+	}
+	else if( number_of_sector_data_buffers < LIBODRAW_HANDLE_MAXIMUM_NUMBER_OF_POOLED_SECTOR_DATA_BUFFERS )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->run_outs_array,
-		     *run_out_index,
-		     (intptr_t **) run_out_sector_range,
+		if( libcdata_array_append_entry(
+		     internal_handle->sector_data_buffers_array,
+		     &entry_index,
+		     (intptr_t *) *sector_data_buffer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve run-out sector range: %d from array.",
-			 function,
-			 number_of_run_outs - 1 );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sector data buffer to array.",
+			 function );
 
-			return( -1 );
+			result = -1;
+		}
+		else
+		{
+			*sector_data_buffer = NULL;
 		}
-		if( *run_out_sector_range == NULL )
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->sector_data_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release sector data buffers mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	/* The sector data buffer was not added to the pool
+	 */
+	if( *sector_data_buffer != NULL )
+	{
+		if( libodraw_sector_data_buffer_free(
+		     sector_data_buffer,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing run-out sector range: %d.",
-			 function,
-			 *run_out_index );
-
-			return( -1 );
-		}
-		if( ( current_sector >= ( *run_out_sector_range )->start_sector )
-		 && ( current_sector < ( *run_out_sector_range )->end_sector ) )
-		{
-			*run_out_offset = offset - ( ( *run_out_sector_range )->start_sector * internal_handle->io_handle->bytes_per_sector );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector data buffer.",
+			 function );
 
-			return( 1 );
-		}
-		if( current_sector < ( *run_out_sector_range )->start_sector )
-		{
-			break;
+			result = -1;
 		}
 	}
-	*run_out_sector_range = NULL;
-	*run_out_offset       = 0;
-
-	return( 0 );
+	return( result );
 }
 
-/* Retrieves a lead-out sector range for the specified offset
- * When no matching lead-out was found the lead_out_index value contains the next lead-out index on return
- * Returns 1 if successful, 0 if no matching lead-out was found or -1 on error
+/* Reads (media) data at a specific offset without using the current offset
+ * The extents are resolved from the extent table, which is not changed after
+ * the handle was opened, and the sector data is converted in a buffer that is
+ * grabbed from the pool of the handle for the duration of the call. The current offset and the sector cache are neither used
+ * nor changed, so multiple threads can call this function concurrently
+ * Returns the number of bytes read or -1 on error
  */
-int libodraw_handle_get_lead_out_at_offset(
-     libodraw_internal_handle_t *internal_handle,
-     off64_t offset,
-     int *lead_out_index,
-     libodraw_sector_range_t **lead_out_sector_range,
-     off64_t *lead_out_offset,
-     libcerror_error_t **error )
+ssize_t libodraw_internal_handle_pread_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	static char *function   = "libodraw_handle_get_lead_out_at_offset";
-	uint64_t current_sector = 0;
-	int number_of_lead_outs = 0;
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	static char *function                             = "libodraw_internal_handle_pread_buffer";
+	size_t buffer_offset                              = 0;
+	ssize_t read_count                                = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -4342,133 +5543,142 @@ int libodraw_handle_get_lead_out_at_offset(
 
 		return( -1 );
 	}
-	if( lead_out_index == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lead-out index.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( lead_out_sector_range == NULL )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lead-out sector range.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( lead_out_offset == NULL )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lead-out offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->lead_outs_array,
-	     &number_of_lead_outs,
-	     error ) != 1 )
+	if( (size64_t) offset >= internal_handle->media_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in lead-outs array.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( libodraw_internal_handle_grab_sector_data_buffer(
+	     internal_handle,
+	     &sector_data_buffer,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data buffer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( *lead_out_index = 0;
-	     *lead_out_index < number_of_lead_outs;
-	     *lead_out_index += 1 )
+	while( buffer_offset < buffer_size )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->lead_outs_array,
-		     *lead_out_index,
-		     (intptr_t **) lead_out_sector_range,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve lead-out sector range: %d from array.",
-			 function,
-			 number_of_lead_outs - 1 );
+		read_count = libodraw_internal_handle_read_buffer_from_extent(
+		              internal_handle,
+		              sector_data_buffer,
+		              NULL,
+		              NULL,
+		              offset,
+		              &( buffer[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              error );
 
-			return( -1 );
-		}
-		if( *lead_out_sector_range == NULL )
+		if( read_count == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing lead-out sector range: %d.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
-			 *lead_out_index );
+			 offset,
+			 offset );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( current_sector >= ( *lead_out_sector_range )->start_sector )
-		 && ( current_sector < ( *lead_out_sector_range )->end_sector ) )
+		if( read_count == 0 )
 		{
-			*lead_out_offset = offset - ( ( *lead_out_sector_range )->start_sector * internal_handle->io_handle->bytes_per_sector );
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+		offset        += (off64_t) read_count;
 
-			return( 1 );
+		if( (size64_t) offset >= internal_handle->media_size )
+		{
+			break;
 		}
-		if( current_sector < ( *lead_out_sector_range )->start_sector )
+		if( internal_handle->io_handle->abort != 0 )
 		{
 			break;
 		}
 	}
-	*lead_out_sector_range = NULL;
-	*lead_out_offset       = 0;
+	if( libodraw_internal_handle_release_sector_data_buffer(
+	     internal_handle,
+	     &sector_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release sector data buffer.",
+		 function );
 
-	return( 0 );
+		goto on_error;
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_internal_handle_release_sector_data_buffer(
+		 internal_handle,
+		 &sector_data_buffer,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a track value for the specified offset
- * When no matching track was found the track_index value contains the next track index on return
- * Returns 1 if successful, 0 if no matching track was found or -1 on error
+/* Reads (media) data at a specific offset without using the current offset
+ * This function does not change the current offset and can be called
+ * concurrently from multiple threads on the same handle
+ * Returns the number of bytes read or -1 on error
  */
-int libodraw_handle_get_track_at_offset(
-     libodraw_internal_handle_t *internal_handle,
-     off64_t offset,
-     int *track_index,
-     libodraw_track_value_t **track_value,
-     off64_t *track_offset,
-     libcerror_error_t **error )
+ssize_t libodraw_handle_pread_buffer(
+         libodraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	static char *function   = "libodraw_handle_get_track_at_offset";
-	uint64_t current_sector = 0;
-	int number_of_tracks    = 0;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_pread_buffer";
+	ssize_t read_count                          = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4479,301 +5689,420 @@ int libodraw_handle_get_track_at_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 "%s: invalid handle - missing data file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( track_index == NULL )
+#endif
+	read_count = libodraw_internal_handle_pread_buffer(
+	              internal_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid track index.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( track_value == NULL )
+#endif
+	return( read_count );
+}
+
+/* Reads data file segments
+ * The segments are sorted by data file index and data file offset. Segments that
+ * are stored contiguously in the same data file are read at once.
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_read_data_file_segments(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_data_file_segment_t *segments,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	libodraw_io_uring_request_t *io_uring_requests    = NULL;
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint8_t *run_data                                 = NULL;
+	static char *function                             = "libodraw_internal_handle_read_data_file_segments";
+	size_t run_offset                                 = 0;
+	size_t run_size                                   = 0;
+	ssize_t read_count                                = 0;
+	uint8_t scatter_run_data                          = 0;
+	int number_of_run_segments                        = 0;
+	int result                                        = 0;
+	int run_segment_index                             = 0;
+	int segment_index                                 = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid track value.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( track_offset == NULL )
+	if( segments == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid track offset.",
+		 "%s: invalid segments.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->tracks_array,
-	     &number_of_tracks,
-	     error ) != 1 )
+	if( ( number_of_segments < 0 )
+	 || ( (size_t) number_of_segments > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_io_uring_request_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in tracks array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( number_of_segments == 0 )
+	{
+		return( 1 );
+	}
+	if( libodraw_data_file_segments_sort(
+	     segments,
+	     number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort segments.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( *track_index = 0;
-	     *track_index < number_of_tracks;
-	     *track_index += 1 )
+	/* If all data files were opened for io_uring the segments are read in a single batch
+	 * otherwise the segments are read per run
+	 */
+	if( internal_handle->io_uring != NULL )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->tracks_array,
-		     *track_index,
-		     (intptr_t **) track_value,
-		     error ) != 1 )
+		io_uring_requests = (libodraw_io_uring_request_t *) memory_allocate(
+		                                                     sizeof( libodraw_io_uring_request_t ) * number_of_segments );
+
+		if( io_uring_requests == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve track value: %d from array.",
-			 function,
-			 number_of_tracks - 1 );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create io_uring requests.",
+			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			io_uring_requests[ segment_index ].file_index = segments[ segment_index ].data_file_index;
+			io_uring_requests[ segment_index ].buffer     = segments[ segment_index ].buffer;
+			io_uring_requests[ segment_index ].size       = segments[ segment_index ].size;
+			io_uring_requests[ segment_index ].offset     = segments[ segment_index ].data_file_offset;
+			io_uring_requests[ segment_index ].read_size  = 0;
 		}
-		if( *track_value == NULL )
+		result = libodraw_io_uring_read_requests(
+		          internal_handle->io_uring,
+		          io_uring_requests,
+		          number_of_segments,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing track value: %d.",
-			 function,
-			 *track_index );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segments using io_uring.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( current_sector >= ( *track_value )->start_sector )
-		 && ( current_sector < ( *track_value )->end_sector ) )
+		else if( result != 0 )
 		{
-			*track_offset = offset - ( ( *track_value )->start_sector * internal_handle->io_handle->bytes_per_sector );
+			for( segment_index = 0;
+			     segment_index < number_of_segments;
+			     segment_index++ )
+			{
+				if( io_uring_requests[ segment_index ].read_size != segments[ segment_index ].size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read segment: %d from data file: %d.",
+					 function,
+					 segment_index,
+					 segments[ segment_index ].data_file_index );
 
-			return( 1 );
-		}
-		if( current_sector < ( *track_value )->start_sector )
-		{
-			break;
+					goto on_error;
+				}
+			}
 		}
-	}
-	*track_value  = NULL;
-	*track_offset = 0;
-
-	return( 0 );
-}
-
-/* Retrieves the current offset of the (media) data
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_get_offset(
-     libodraw_handle_t *handle,
-     off64_t *offset,
-     libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_offset";
+		memory_free(
+		 io_uring_requests );
 
-	if( handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		io_uring_requests = NULL;
 
-		return( -1 );
+		if( result != 0 )
+		{
+			return( 1 );
+		}
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
+	segment_index = 0;
 
-	if( internal_handle->io_handle == NULL )
+	while( segment_index < number_of_segments )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+		if( libodraw_data_file_segments_get_run(
+		     segments,
+		     number_of_segments,
+		     segment_index,
+		     (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE,
+		     &number_of_run_segments,
+		     &run_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run of segments: %d.",
+			 function,
+			 segment_index );
 
-		return( -1 );
-	}
-	if( offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
-		 function );
+			goto on_error;
+		}
+		/* The run is read directly into the buffer of its first segment
+		 * if the buffers of the segments in the run are contiguous
+		 */
+		scatter_run_data = 0;
+		run_data         = segments[ segment_index ].buffer;
+		run_offset       = 0;
 
-		return( -1 );
-	}
-	*offset = internal_handle->current_offset;
+		for( run_segment_index = segment_index;
+		     run_segment_index < ( segment_index + number_of_run_segments );
+		     run_segment_index++ )
+		{
+			if( segments[ run_segment_index ].buffer != &( run_data[ run_offset ] ) )
+			{
+				scatter_run_data = 1;
 
-	return( 1 );
-}
+				break;
+			}
+			run_offset += segments[ run_segment_index ].size;
+		}
+		if( scatter_run_data != 0 )
+		{
+			if( sector_data_buffer == NULL )
+			{
+				if( libodraw_internal_handle_grab_sector_data_buffer(
+				     internal_handle,
+				     &sector_data_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create sector data buffer.",
+					 function );
 
-/* Retrieves the size of the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libodraw_internal_handle_get_basename_size(
-     libodraw_internal_handle_t *internal_handle,
-     size_t *basename_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libodraw_internal_handle_get_basename_size";
+					goto on_error;
+				}
+			}
+			if( libodraw_sector_data_buffer_get_data(
+			     sector_data_buffer,
+			     segments[ segment_index ].data_file_offset,
+			     run_size,
+			     &run_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector data.",
+				 function );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+				goto on_error;
+			}
+		}
+		read_count = libodraw_internal_handle_read_data_file_buffer(
+		              internal_handle,
+		              NULL,
+		              segments[ segment_index ].data_file_index,
+		              run_data,
+		              run_size,
+		              segments[ segment_index ].data_file_offset,
+		              error );
 
-	if( internal_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		if( read_count != (ssize_t) run_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read run of segments: %d from data file: %d.",
+			 function,
+			 segment_index,
+			 segments[ segment_index ].data_file_index );
 
-		return( -1 );
-	}
-	if( basename_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename size.",
-		 function );
+			goto on_error;
+		}
+		if( scatter_run_data != 0 )
+		{
+			run_offset = 0;
 
-		return( -1 );
-	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
+			for( run_segment_index = segment_index;
+			     run_segment_index < ( segment_index + number_of_run_segments );
+			     run_segment_index++ )
+			{
+				if( memory_copy(
+				     segments[ run_segment_index ].buffer,
+				     &( run_data[ run_offset ] ),
+				     segments[ run_segment_index ].size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy run data to segment: %d.",
+					 function,
+					 run_segment_index );
+
+					goto on_error;
+				}
+				run_offset += segments[ run_segment_index ].size;
+			}
+		}
+		segment_index += number_of_run_segments;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	if( sector_data_buffer != NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		if( libodraw_internal_handle_release_sector_data_buffer(
+		     internal_handle,
+		     &sector_data_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sector data buffer.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	else
+	return( 1 );
+
+on_error:
+	if( sector_data_buffer != NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libodraw_internal_handle_release_sector_data_buffer(
+		 internal_handle,
+		 &sector_data_buffer,
+		 NULL );
 	}
-	if( result != 1 )
+	if( io_uring_requests != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
-		 function );
-
-		return( -1 );
+		memory_free(
+		 io_uring_requests );
 	}
-#else
-	*basename_size = internal_handle->basename_size;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-	return( 1 );
+	return( -1 );
 }
 
-/* Retrieves the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Reads multiple ranges of sectors
+ * Sectors of tracks that store sectors of the same size as the media are read
+ * directly from the data files, the other sectors are read using pread buffer
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_get_basename(
+int libodraw_internal_handle_read_sectors_vectored(
      libodraw_internal_handle_t *internal_handle,
-     char *basename,
-     size_t basename_size,
+     libodraw_sector_vector_t *vectors,
+     int number_of_vectors,
      libcerror_error_t **error )
 {
-	static char *function       = "libodraw_internal_handle_get_basename";
-	size_t narrow_basename_size = 0;
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                  = 0;
-#endif
+	libodraw_data_file_segment_t *segments = NULL;
+	libodraw_data_file_segment_t *segment  = NULL;
+	libodraw_extent_t *extent              = NULL;
+	libodraw_sector_vector_t *vector       = NULL;
+	libodraw_track_value_t *track_value    = NULL;
+	void *reallocation                     = NULL;
+	static char *function                  = "libodraw_internal_handle_read_sectors_vectored";
+	size_t buffer_offset                   = 0;
+	size_t range_size                      = 0;
+	ssize_t read_count                     = 0;
+	uint64_t current_sector                = 0;
+	uint64_t end_sector                    = 0;
+	uint64_t media_number_of_sectors       = 0;
+	uint64_t range_end_sector              = 0;
+	int number_of_allocated_segments       = 0;
+	int number_of_segments                 = 0;
+	int result                             = 0;
+	int track_index                        = 0;
+	int vector_index                       = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -4786,177 +6115,346 @@ int libodraw_internal_handle_get_basename(
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &narrow_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &narrow_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &narrow_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &narrow_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	narrow_basename_size = internal_handle->basename_size;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-	if( basename_size < narrow_basename_size )
+	if( vectors == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: basename too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vectors.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	if( number_of_vectors < 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) basename,
-		          basename_size,
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) basename,
-		          basename_size,
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of vectors value less than zero.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	media_number_of_sectors = internal_handle->media_size / internal_handle->io_handle->bytes_per_sector;
+
+	/* All the vectors are validated before any data is read
+	 */
+	for( vector_index = 0;
+	     vector_index < number_of_vectors;
+	     vector_index++ )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) basename,
-		          basename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) basename,
-		          basename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		vector = &( vectors[ vector_index ] );
+
+		if( vector->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid vector: %d - missing buffer.",
+			 function,
+			 vector_index );
+
+			return( -1 );
+		}
+		if( ( vector->start_sector > media_number_of_sectors )
+		 || ( vector->number_of_sectors > ( media_number_of_sectors - vector->start_sector ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid vector: %d - sectors value out of bounds.",
+			 function,
+			 vector_index );
+
+			return( -1 );
+		}
+		if( vector->number_of_sectors > ( (uint64_t) SSIZE_MAX / internal_handle->io_handle->bytes_per_sector ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid vector: %d - number of sectors value exceeds maximum.",
+			 function,
+			 vector_index );
+
+			return( -1 );
+		}
+		if( vector->buffer_size < (size_t) ( vector->number_of_sectors * internal_handle->io_handle->bytes_per_sector ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid vector: %d - buffer size value too small.",
+			 function,
+			 vector_index );
+
+			return( -1 );
+		}
 	}
-	if( result != 1 )
+	for( vector_index = 0;
+	     vector_index < number_of_vectors;
+	     vector_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
-		 function );
+		vector         = &( vectors[ vector_index ] );
+		current_sector = vector->start_sector;
+		end_sector     = vector->start_sector + vector->number_of_sectors;
+		buffer_offset  = 0;
 
-		return( -1 );
+		while( current_sector < end_sector )
+		{
+			result = libodraw_extent_table_get_extent_by_type_and_sector(
+			          internal_handle->extent_table,
+			          LIBODRAW_EXTENT_TYPE_TRACK,
+			          current_sector,
+			          &track_index,
+			          &extent,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve track extent for sector: %" PRIu64 ".",
+				 function,
+				 current_sector );
+
+				goto on_error;
+			}
+			track_value = NULL;
+
+			if( result != 0 )
+			{
+				track_value = (libodraw_track_value_t *) extent->value;
+
+				if( track_value == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing track value: %d.",
+					 function,
+					 extent->index );
+
+					goto on_error;
+				}
+				range_end_sector = extent->end_sector;
+			}
+			else
+			{
+				/* The sectors up to the next track are not part of a track
+				 */
+				result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+				          internal_handle->extent_table,
+				          LIBODRAW_EXTENT_TYPE_TRACK,
+				          current_sector,
+				          &extent,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve next track extent for sector: %" PRIu64 ".",
+					 function,
+					 current_sector );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					range_end_sector = extent->start_sector;
+				}
+				else
+				{
+					range_end_sector = end_sector;
+				}
+			}
+			if( range_end_sector > end_sector )
+			{
+				range_end_sector = end_sector;
+			}
+			range_size = (size_t) ( ( range_end_sector - current_sector ) * internal_handle->io_handle->bytes_per_sector );
+
+			/* Sectors that need to be converted, byte swapped or verified are read using pread buffer
+			 */
+			if( ( track_value != NULL )
+			 && ( track_value->bytes_per_sector == internal_handle->io_handle->bytes_per_sector )
+			 && ( track_value->swap_samples == 0 )
+			 && ( internal_handle->sector_verification_flags == 0 ) )
+			{
+				if( number_of_segments >= number_of_allocated_segments )
+				{
+					if( number_of_allocated_segments == 0 )
+					{
+						number_of_allocated_segments = 16;
+					}
+					else if( number_of_allocated_segments < ( INT_MAX / 2 ) )
+					{
+						number_of_allocated_segments *= 2;
+					}
+					else
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid number of segments value exceeds maximum.",
+						 function );
+
+						goto on_error;
+					}
+					if( (size_t) number_of_allocated_segments > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_data_file_segment_t ) ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid number of segments value exceeds maximum.",
+						 function );
+
+						goto on_error;
+					}
+					reallocation = memory_reallocate(
+					                segments,
+					                sizeof( libodraw_data_file_segment_t ) * number_of_allocated_segments );
+
+					if( reallocation == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to resize segments.",
+						 function );
+
+						goto on_error;
+					}
+					segments = (libodraw_data_file_segment_t *) reallocation;
+				}
+				segment = &( segments[ number_of_segments ] );
+
+				segment->data_file_index  = extent->data_file_index;
+				segment->data_file_offset = extent->data_file_offset
+				                          + (off64_t) ( ( current_sector - extent->start_sector ) * internal_handle->io_handle->bytes_per_sector );
+				segment->size             = range_size;
+				segment->buffer           = &( vector->buffer[ buffer_offset ] );
+
+				number_of_segments++;
+			}
+			else
+			{
+				read_count = libodraw_internal_handle_pread_buffer(
+				              internal_handle,
+				              &( vector->buffer[ buffer_offset ] ),
+				              range_size,
+				              (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector ),
+				              error );
+
+				if( read_count != (ssize_t) range_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sector(s): %" PRIu64 " - %" PRIu64 ".",
+					 function,
+					 current_sector,
+					 range_end_sector );
+
+					goto on_error;
+				}
+			}
+			buffer_offset += range_size;
+			current_sector = range_end_sector;
+		}
 	}
-#else
-	if( system_string_copy(
-	     basename,
-	     internal_handle->basename,
-	     internal_handle->basename_size ) == NULL )
+	if( number_of_segments > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
-		 function );
+		if( libodraw_internal_handle_read_data_file_segments(
+		     internal_handle,
+		     segments,
+		     number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data file segments.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
 	}
-	basename[ internal_handle->basename_size - 1 ] = 0;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
 	return( 1 );
+
+on_error:
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	return( -1 );
 }
 
-/* Sets the basename
+/* Reads multiple ranges of sectors
+ * Every vector contains a range of sectors and the buffer the sectors are read into,
+ * which must be large enough to contain the sectors in the media bytes per sector.
+ * The ranges are sorted and coalesced by their location in the data files
+ * so that sectors are read with the minimum number of reads.
+ * This function does not change the current offset and can be called
+ * concurrently from multiple threads on the same handle
  * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_set_basename(
-     libodraw_internal_handle_t *internal_handle,
-     const char *basename,
-     size_t basename_length,
+int libodraw_handle_read_sectors_vectored(
+     libodraw_handle_t *handle,
+     libodraw_sector_vector_t *vectors,
+     int number_of_vectors,
      libcerror_error_t **error )
 {
-	static char *function = "libodraw_internal_handle_set_basename";
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_read_sectors_vectored";
+	int result                                  = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4967,196 +6465,97 @@ int libodraw_internal_handle_set_basename(
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename != NULL )
-	{
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	internal_handle->basename_size = basename_length + 1;
 #endif
-	internal_handle->basename = system_string_allocate(
-	                             internal_handle->basename_size );
+	result = libodraw_internal_handle_read_sectors_vectored(
+	          internal_handle,
+	          vectors,
+	          number_of_vectors,
+	          error );
 
-	if( internal_handle->basename == NULL )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create basename.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sectors.",
 		 function );
 
-		internal_handle->basename_size = 0;
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
-		 function );
-
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-
-		return( -1 );
-	}
-#else
-	if( system_string_copy(
-	     internal_handle->basename,
-	     basename,
-	     basename_length ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
-		 function );
-
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-
-		return( -1 );
-	}
-	internal_handle->basename[ basename_length ] = 0;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
-	return( 1 );
+#endif
+	return( result );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the size of the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Reads sectors of a track
+ * The sectors are read from the data file of the track and converted into
+ * the output bytes per sector, where 0 represents the bytes per sector of the track
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns the number of bytes read or -1 on error
  */
-int libodraw_internal_handle_get_basename_size_wide(
-     libodraw_internal_handle_t *internal_handle,
-     size_t *basename_size,
-     libcerror_error_t **error )
+ssize_t libodraw_internal_handle_read_track_sectors(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_track_value_t *track_value,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint32_t output_bytes_per_sector,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
 {
-	static char *function = "libodraw_internal_handle_get_basename_size_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint8_t *read_buffer                              = NULL;
+	uint8_t *sector_data                              = NULL;
+	static char *function                             = "libodraw_internal_handle_read_track_sectors";
+	off64_t track_data_offset                         = 0;
+	size_t buffer_offset                              = 0;
+	size_t read_number_of_sectors                     = 0;
+	size_t read_size                                  = 0;
+	ssize_t copy_count                                = 0;
+	ssize_t read_count                                = 0;
+	uint64_t current_sector                           = 0;
+	uint64_t end_sector                               = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -5169,271 +6568,296 @@ int libodraw_internal_handle_get_basename_size_wide(
 
 		return( -1 );
 	}
-	if( basename_size == NULL )
+	if( track_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename size.",
+		 "%s: invalid track value.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	*basename_size = internal_handle->basename_size;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( track_value->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid track value - missing bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	return( 1 );
-}
-
-/* Retrieves the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libodraw_internal_handle_get_basename_wide(
-     libodraw_internal_handle_t *internal_handle,
-     wchar_t *basename,
-     size_t basename_size,
-     libcerror_error_t **error )
-{
-	static char *function     = "libodraw_internal_handle_get_basename_wide";
-	size_t wide_basename_size = 0;
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                = 0;
-#endif
-
-	if( internal_handle == NULL )
+	if( ( start_sector < track_value->start_sector )
+	 || ( start_sector > track_value->end_sector )
+	 || ( number_of_sectors > ( track_value->end_sector - start_sector ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sectors value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	wide_basename_size = internal_handle->basename_size;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &wide_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &wide_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	if( output_bytes_per_sector == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &wide_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &wide_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		output_bytes_per_sector = track_value->bytes_per_sector;
 	}
-	if( result != 1 )
+	if( ( buffer_size > (size_t) SSIZE_MAX )
+	 || ( number_of_sectors > ( (uint64_t) buffer_size / output_bytes_per_sector ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	if( basename_size < wide_basename_size )
+	if( ( output_bytes_per_sector != track_value->bytes_per_sector )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_AUDIO )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2048 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2352 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2048 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2324 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2336 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_CDI_2336 )
+	 && ( track_value->type != LIBODRAW_TRACK_TYPE_CDI_2352 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: basename too small.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported track type.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     basename,
-	     internal_handle->basename,
-	     internal_handle->basename_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
-		 function );
+	current_sector = start_sector;
+	end_sector     = start_sector + number_of_sectors;
 
-		return( -1 );
-	}
-	basename[ internal_handle->basename_size - 1 ] = 0;
-#else
-	if( libclocale_codepage == 0 )
+	while( current_sector < end_sector )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) basename,
-		          basename_size,
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) basename,
-		          basename_size,
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		/* The data file offset is determined directly from the sector
+		 * and the sectors are read in their native size
+		 */
+		track_data_offset = track_value->data_file_offset
+		                  + (off64_t) ( ( current_sector - track_value->start_sector ) * track_value->bytes_per_sector );
+
+		read_number_of_sectors = (size_t) ( end_sector - current_sector );
+
+		if( output_bytes_per_sector == track_value->bytes_per_sector )
+		{
+			read_buffer = &( buffer[ buffer_offset ] );
+		}
+		else
+		{
+			if( read_number_of_sectors > ( (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector ) )
+			{
+				read_number_of_sectors = (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector;
+			}
+			if( sector_data_buffer == NULL )
+			{
+				if( libodraw_internal_handle_grab_sector_data_buffer(
+				     internal_handle,
+				     &sector_data_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create sector data buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libodraw_sector_data_buffer_get_data(
+			     sector_data_buffer,
+			     track_data_offset,
+			     read_number_of_sectors * track_value->bytes_per_sector,
+			     &sector_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector data.",
+				 function );
+
+				goto on_error;
+			}
+			read_buffer = sector_data;
+		}
+		read_size = read_number_of_sectors * track_value->bytes_per_sector;
+
+		read_count = libodraw_internal_handle_read_data_file_buffer(
+		              internal_handle,
+		              NULL,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              track_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			goto on_error;
+		}
+		if( internal_handle->sector_verification_flags != 0 )
+		{
+			if( libodraw_internal_handle_verify_sector_data(
+			     internal_handle,
+			     track_value,
+			     current_sector,
+			     read_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify sector data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libodraw_internal_handle_set_track_sector_forms(
+		     internal_handle,
+		     track_value,
+		     current_sector,
+		     read_buffer,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sector forms.",
+			 function );
+
+			goto on_error;
+		}
+		if( track_value->swap_samples != 0 )
+		{
+			if( libodraw_byte_swap_16bit(
+			     read_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to byte swap audio samples.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( output_bytes_per_sector != track_value->bytes_per_sector )
+		{
+			copy_count = libodraw_internal_handle_copy_sector_data_to_buffer(
+			              internal_handle,
+			              track_value,
+			              sector_data,
+			              read_size,
+			              output_bytes_per_sector,
+			              &( buffer[ buffer_offset ] ),
+			              read_number_of_sectors * output_bytes_per_sector,
+			              (uint32_t) current_sector,
+			              0,
+			              error );
+
+			if( copy_count != (ssize_t) ( read_number_of_sectors * output_bytes_per_sector ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		buffer_offset  += read_number_of_sectors * output_bytes_per_sector;
+		current_sector += read_number_of_sectors;
 	}
-	else
+	if( sector_data_buffer != NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) basename,
-		          basename_size,
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) basename,
-		          basename_size,
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		if( libodraw_internal_handle_release_sector_data_buffer(
+		     internal_handle,
+		     &sector_data_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sector data buffer.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
-		 function );
+	return( (ssize_t) buffer_offset );
 
-		return( -1 );
+on_error:
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_internal_handle_release_sector_data_buffer(
+		 internal_handle,
+		 &sector_data_buffer,
+		 NULL );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	return( 1 );
+	return( -1 );
 }
 
-/* Sets the basename
+/* Sets the forms of sectors of a track in the form map of the track
+ * The sector data contains whole sectors in the bytes per sector of the track
  * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_set_basename_wide(
+int libodraw_internal_handle_set_track_sector_forms(
      libodraw_internal_handle_t *internal_handle,
-     const wchar_t *basename,
-     size_t basename_length,
+     libodraw_track_value_t *track_value,
+     uint64_t start_sector,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libodraw_internal_handle_set_basename_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+	static char *function = "libodraw_internal_handle_set_track_sector_forms";
+	int result            = 1;
 
 	if( internal_handle == NULL )
 	{
@@ -5446,192 +6870,5651 @@ int libodraw_internal_handle_set_basename_wide(
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	if( track_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 "%s: invalid track value.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename != NULL )
-	{
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	internal_handle->basename_size = basename_length + 1;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	if( track_value->form_map == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		return( 1 );
 	}
-	if( result != 1 )
+	if( start_sector < track_value->start_sector )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start sector value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	internal_handle->basename = system_string_allocate(
-	                             internal_handle->basename_size );
-
-	if( internal_handle->basename == NULL )
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle->form_maps_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab form maps mutex.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     internal_handle->basename,
-	     basename,
-	     basename_length ) == NULL )
+#endif
+	if( libodraw_form_map_set_forms(
+	     track_value->form_map,
+	     start_sector - track_value->start_sector,
+	     sector_data,
+	     sector_data_size,
+	     track_value->bytes_per_sector,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
-		 function );
-
-		memory_free(
-		 internal_handle->basename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set forms of sector: %" PRIu64 ".",
+		 function,
+		 start_sector );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->form_maps_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release form maps mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the form of a sector of a track from the form map of the track
+ * If the number of sectors value is set, it receives the number of subsequent sectors,
+ * including the sector, that have the same form and are known in the form map
+ * Returns 1 if successful, 0 if the form of the sector is not known or -1 on error
+ */
+int libodraw_internal_handle_get_track_sector_form_from_map(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t sector,
+     uint64_t maximum_number_of_sectors,
+     uint8_t *form,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function     = "libodraw_internal_handle_get_track_sector_form_from_map";
+	uint64_t run_sector_index = 0;
+	uint64_t sector_index     = 0;
+	uint8_t run_form          = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value->form_map == NULL )
+	{
+		return( 0 );
+	}
+	if( ( sector < track_value->start_sector )
+	 || ( sector >= track_value->end_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sector_index = sector - track_value->start_sector;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle->form_maps_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab form maps mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libodraw_form_map_get_form(
+	          track_value->form_map,
+	          sector_index,
+	          form,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve form of sector: %" PRIu64 ".",
+		 function,
+		 sector );
+	}
+	else if( ( result == 1 )
+	      && ( number_of_sectors != NULL ) )
+	{
+		if( maximum_number_of_sectors > ( track_value->end_sector - sector ) )
+		{
+			maximum_number_of_sectors = track_value->end_sector - sector;
+		}
+		for( run_sector_index = 1;
+		     run_sector_index < maximum_number_of_sectors;
+		     run_sector_index++ )
+		{
+			if( libodraw_form_map_get_form(
+			     track_value->form_map,
+			     sector_index + run_sector_index,
+			     &run_form,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			if( run_form != *form )
+			{
+				break;
+			}
+		}
+		*number_of_sectors = run_sector_index;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->form_maps_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release form maps mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the form of a sector of a track
+ * The form map of the track is built on demand, one block of sectors at a time
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful, 0 if the sector is not a Mode 2 XA sector or -1 on error
+ */
+int libodraw_internal_handle_get_track_sector_form(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t sector,
+     uint8_t *form,
+     libcerror_error_t **error )
+{
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint8_t *sector_data                              = NULL;
+	static char *function                             = "libodraw_internal_handle_get_track_sector_form";
+	size_t sector_data_size                           = 0;
+	ssize_t read_count                                = 0;
+	off64_t track_data_offset                         = 0;
+	uint64_t block_number_of_sectors                  = 0;
+	uint64_t block_start_sector_index                 = 0;
+	int result                                        = 0;
+
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( form == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form.",
+		 function );
+
+		return( -1 );
+	}
+	/* Mode 2 tracks without XA sub-headers contain sectors of a single form
+	 */
+	if( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2048 )
+	{
+		*form = 1;
+
+		return( 1 );
+	}
+	else if( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2324 )
+	{
+		*form = 2;
+
+		return( 1 );
+	}
+	if( track_value->form_map == NULL )
+	{
+		return( 0 );
+	}
+	result = libodraw_internal_handle_get_track_sector_form_from_map(
+	          internal_handle,
+	          track_value,
+	          sector,
+	          1,
+	          form,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve form of sector: %" PRIu64 " from map.",
+		 function,
+		 sector );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	/* Read the block of sectors that contains the sector, which sets the forms
+	 * of the sectors in the form map
+	 */
+	if( libodraw_form_map_get_block_range(
+	     track_value->form_map,
+	     sector - track_value->start_sector,
+	     &block_start_sector_index,
+	     &block_number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve form map block range of sector: %" PRIu64 ".",
+		 function,
+		 sector );
+
+		goto on_error;
+	}
+	sector_data_size = (size_t) ( block_number_of_sectors * track_value->bytes_per_sector );
+
+	track_data_offset = track_value->data_file_offset
+	                  + (off64_t) ( block_start_sector_index * track_value->bytes_per_sector );
+
+	if( libodraw_internal_handle_grab_sector_data_buffer(
+	     internal_handle,
+	     &sector_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_sector_data_buffer_get_data(
+	     sector_data_buffer,
+	     track_data_offset,
+	     sector_data_size,
+	     &sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libodraw_internal_handle_read_track_sectors(
+	              internal_handle,
+	              track_value,
+	              track_value->start_sector + block_start_sector_index,
+	              block_number_of_sectors,
+	              0,
+	              sector_data,
+	              sector_data_size,
+	              error );
+
+	if( read_count != (ssize_t) sector_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read form map block of sector: %" PRIu64 ".",
+		 function,
+		 sector );
+
+		goto on_error;
+	}
+	if( libodraw_internal_handle_release_sector_data_buffer(
+	     internal_handle,
+	     &sector_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release sector data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	result = libodraw_internal_handle_get_track_sector_form_from_map(
+	          internal_handle,
+	          track_value,
+	          sector,
+	          1,
+	          form,
+	          NULL,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve form of sector: %" PRIu64 " from map.",
+		 function,
+		 sector );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_internal_handle_release_sector_data_buffer(
+		 internal_handle,
+		 &sector_data_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads sectors of a track in a read mode that depends on the form of the sectors
+ * LIBODRAW_SECTOR_READ_MODE_XA reads 2324 bytes for Mode 2 Form 2 sectors and 2048 bytes for other sectors
+ * LIBODRAW_SECTOR_READ_MODE_FORM1 reads 2048 bytes for sectors other than Mode 2 Form 2 sectors
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_track_sectors_by_form(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_track_value_t *track_value,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint8_t read_mode,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint8_t *sector_data                              = NULL;
+	static char *function                             = "libodraw_internal_handle_read_track_sectors_by_form";
+	size_t buffer_offset                              = 0;
+	size_t copy_size                                  = 0;
+	size_t read_number_of_sectors                     = 0;
+	size_t sector_data_offset                         = 0;
+	size_t user_data_offset                           = 0;
+	ssize_t read_count                                = 0;
+	off64_t track_data_offset                         = 0;
+	uint64_t current_sector                           = 0;
+	uint64_t end_sector                               = 0;
+	uint64_t run_number_of_sectors                    = 0;
+	uint8_t form                                      = 0;
+	int result                                        = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_mode != LIBODRAW_SECTOR_READ_MODE_XA )
+	 && ( read_mode != LIBODRAW_SECTOR_READ_MODE_FORM1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( start_sector < track_value->start_sector )
+	 || ( start_sector > track_value->end_sector )
+	 || ( number_of_sectors > ( track_value->end_sector - start_sector ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value->form_map == NULL )
+	{
+		/* The sectors of a Mode 2 (2324) track are Form 2 sectors without XA sub-header
+		 */
+		if( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2324 )
+		{
+			if( read_mode == LIBODRAW_SECTOR_READ_MODE_FORM1 )
+			{
+				return( 0 );
+			}
+			return( libodraw_internal_handle_read_track_sectors(
+			         internal_handle,
+			         track_value,
+			         start_sector,
+			         number_of_sectors,
+			         0,
+			         buffer,
+			         buffer_size,
+			         error ) );
+		}
+		return( libodraw_internal_handle_read_track_sectors(
+		         internal_handle,
+		         track_value,
+		         start_sector,
+		         number_of_sectors,
+		         2048,
+		         buffer,
+		         buffer_size,
+		         error ) );
+	}
+	/* The user data directly follows the XA sub-header
+	 */
+	if( track_value->bytes_per_sector == 2352 )
+	{
+		user_data_offset = 24;
+	}
+	else
+	{
+		user_data_offset = 8;
+	}
+	current_sector = start_sector;
+	end_sector     = start_sector + number_of_sectors;
+
+	while( current_sector < end_sector )
+	{
+		if( read_mode == LIBODRAW_SECTOR_READ_MODE_FORM1 )
+		{
+			/* Sectors of which the form is known do not need to be read to be skipped
+			 */
+			result = libodraw_internal_handle_get_track_sector_form_from_map(
+			          internal_handle,
+			          track_value,
+			          current_sector,
+			          end_sector - current_sector,
+			          &form,
+			          &run_number_of_sectors,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve form of sector: %" PRIu64 " from map.",
+				 function,
+				 current_sector );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( form == 1 )
+				{
+					read_count = libodraw_internal_handle_read_track_sectors(
+					              internal_handle,
+					              track_value,
+					              current_sector,
+					              run_number_of_sectors,
+					              2048,
+					              &( buffer[ buffer_offset ] ),
+					              buffer_size - buffer_offset,
+					              error );
+
+					if( read_count == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read Form 1 sectors.",
+						 function );
+
+						goto on_error;
+					}
+					buffer_offset += (size_t) read_count;
+				}
+				current_sector += run_number_of_sectors;
+
+				continue;
+			}
+		}
+		read_number_of_sectors = (size_t) ( end_sector - current_sector );
+
+		if( read_number_of_sectors > ( (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector ) )
+		{
+			read_number_of_sectors = (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE / track_value->bytes_per_sector;
+		}
+		track_data_offset = track_value->data_file_offset
+		                  + (off64_t) ( ( current_sector - track_value->start_sector ) * track_value->bytes_per_sector );
+
+		if( sector_data_buffer == NULL )
+		{
+			if( libodraw_internal_handle_grab_sector_data_buffer(
+			     internal_handle,
+			     &sector_data_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sector data buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libodraw_sector_data_buffer_get_data(
+		     sector_data_buffer,
+		     track_data_offset,
+		     read_number_of_sectors * track_value->bytes_per_sector,
+		     &sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data.",
+			 function );
+
+			goto on_error;
+		}
+		/* Reading the sectors in the bytes per sector of the track sets their forms in the form map
+		 */
+		read_count = libodraw_internal_handle_read_track_sectors(
+		              internal_handle,
+		              track_value,
+		              current_sector,
+		              (uint64_t) read_number_of_sectors,
+		              0,
+		              sector_data,
+		              read_number_of_sectors * track_value->bytes_per_sector,
+		              error );
+
+		if( read_count != (ssize_t) ( read_number_of_sectors * track_value->bytes_per_sector ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sectors.",
+			 function );
+
+			goto on_error;
+		}
+		for( sector_data_offset = 0;
+		     sector_data_offset < (size_t) read_count;
+		     sector_data_offset += track_value->bytes_per_sector )
+		{
+			/* The Form 2 flag is stored in the sub-mode flags of the XA sub-header
+			 */
+			if( ( sector_data[ sector_data_offset + user_data_offset - 6 ] & 0x20 ) != 0 )
+			{
+				if( read_mode == LIBODRAW_SECTOR_READ_MODE_FORM1 )
+				{
+					continue;
+				}
+				copy_size = 2324;
+			}
+			else
+			{
+				copy_size = 2048;
+			}
+			if( copy_size > ( buffer_size - buffer_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid buffer size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( sector_data[ sector_data_offset + user_data_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy user data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset += copy_size;
+		}
+		current_sector += read_number_of_sectors;
+	}
+	if( sector_data_buffer != NULL )
+	{
+		if( libodraw_internal_handle_release_sector_data_buffer(
+		     internal_handle,
+		     &sector_data_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sector data buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_internal_handle_release_sector_data_buffer(
+		 internal_handle,
+		 &sector_data_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads sectors in a specific read mode
+ * Sectors outside the tracks can only be read in the bytes per sector of the media
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_sectors(
+         libodraw_internal_handle_t *internal_handle,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint8_t read_mode,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_extent_t *extent           = NULL;
+	libodraw_track_value_t *track_value = NULL;
+	static char *function               = "libodraw_internal_handle_read_sectors";
+	size_t buffer_offset                = 0;
+	size_t range_size                   = 0;
+	ssize_t read_count                  = 0;
+	uint64_t current_sector             = 0;
+	uint64_t end_sector                 = 0;
+	uint64_t range_end_sector           = 0;
+	uint32_t maximum_bytes_per_sector   = 0;
+	uint32_t output_bytes_per_sector    = 0;
+	int result                          = 0;
+	int track_index                     = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	switch( read_mode )
+	{
+		case LIBODRAW_SECTOR_READ_MODE_RAW:
+			output_bytes_per_sector = 2352;
+			break;
+
+		case LIBODRAW_SECTOR_READ_MODE_COOKED:
+			output_bytes_per_sector = 2048;
+			break;
+
+		case LIBODRAW_SECTOR_READ_MODE_NATIVE:
+			output_bytes_per_sector = 0;
+			break;
+
+		case LIBODRAW_SECTOR_READ_MODE_XA:
+			output_bytes_per_sector  = 2048;
+			maximum_bytes_per_sector = 2324;
+			break;
+
+		case LIBODRAW_SECTOR_READ_MODE_FORM1:
+			output_bytes_per_sector = 2048;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported read mode.",
+			 function );
+
+			return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_sector >= internal_handle->number_of_sectors )
+	{
+		return( 0 );
+	}
+	if( number_of_sectors > ( internal_handle->number_of_sectors - start_sector ) )
+	{
+		number_of_sectors = internal_handle->number_of_sectors - start_sector;
+	}
+	if( maximum_bytes_per_sector == 0 )
+	{
+		maximum_bytes_per_sector = output_bytes_per_sector;
+	}
+	if( ( maximum_bytes_per_sector != 0 )
+	 && ( number_of_sectors > ( (uint64_t) buffer_size / maximum_bytes_per_sector ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	current_sector = start_sector;
+	end_sector     = start_sector + number_of_sectors;
+
+	while( current_sector < end_sector )
+	{
+		result = libodraw_extent_table_get_extent_by_type_and_sector(
+		          internal_handle->extent_table,
+		          LIBODRAW_EXTENT_TYPE_TRACK,
+		          current_sector,
+		          &track_index,
+		          &extent,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track extent for sector: %" PRIu64 ".",
+			 function,
+			 current_sector );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			track_value = (libodraw_track_value_t *) extent->value;
+
+			if( track_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing track value: %d.",
+				 function,
+				 extent->index );
+
+				return( -1 );
+			}
+			range_end_sector = extent->end_sector;
+
+			if( range_end_sector > end_sector )
+			{
+				range_end_sector = end_sector;
+			}
+			if( ( read_mode == LIBODRAW_SECTOR_READ_MODE_XA )
+			 || ( read_mode == LIBODRAW_SECTOR_READ_MODE_FORM1 ) )
+			{
+				read_count = libodraw_internal_handle_read_track_sectors_by_form(
+				              internal_handle,
+				              track_value,
+				              current_sector,
+				              range_end_sector - current_sector,
+				              read_mode,
+				              &( buffer[ buffer_offset ] ),
+				              buffer_size - buffer_offset,
+				              error );
+			}
+			else
+			{
+				read_count = libodraw_internal_handle_read_track_sectors(
+				              internal_handle,
+				              track_value,
+				              current_sector,
+				              range_end_sector - current_sector,
+				              output_bytes_per_sector,
+				              &( buffer[ buffer_offset ] ),
+				              buffer_size - buffer_offset,
+				              error );
+			}
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sectors from track: %d.",
+				 function,
+				 extent->index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( ( output_bytes_per_sector != 0 )
+			 && ( output_bytes_per_sector != internal_handle->io_handle->bytes_per_sector ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported read mode for sector: %" PRIu64 " outside a track.",
+				 function,
+				 current_sector );
+
+				return( -1 );
+			}
+			range_end_sector = end_sector;
+
+			result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+			          internal_handle->extent_table,
+			          LIBODRAW_EXTENT_TYPE_TRACK,
+			          current_sector,
+			          &extent,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next track extent for sector: %" PRIu64 ".",
+				 function,
+				 current_sector );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( extent->start_sector < range_end_sector )
+				{
+					range_end_sector = extent->start_sector;
+				}
+			}
+			range_size = (size_t) ( ( range_end_sector - current_sector ) * internal_handle->io_handle->bytes_per_sector );
+
+			if( range_size > ( buffer_size - buffer_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid buffer size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = libodraw_internal_handle_pread_buffer(
+			              internal_handle,
+			              &( buffer[ buffer_offset ] ),
+			              range_size,
+			              (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector ),
+			              error );
+
+			if( read_count != (ssize_t) range_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sector(s): %" PRIu64 " - %" PRIu64 ".",
+				 function,
+				 current_sector,
+				 range_end_sector );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += (size_t) read_count;
+		current_sector = range_end_sector;
+
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads sectors in a specific read mode
+ * The read mode determines the bytes per sector of the data in the buffer:
+ * LIBODRAW_SECTOR_READ_MODE_RAW reads raw sectors of 2352 bytes,
+ * LIBODRAW_SECTOR_READ_MODE_COOKED reads the 2048 bytes of user data,
+ * LIBODRAW_SECTOR_READ_MODE_NATIVE reads the sectors as stored in the data files,
+ * LIBODRAW_SECTOR_READ_MODE_XA reads 2324 bytes of user data for Mode 2 Form 2 sectors
+ * and 2048 bytes for other sectors, the buffer must be able to hold 2324 bytes per sector, and
+ * LIBODRAW_SECTOR_READ_MODE_FORM1 reads 2048 bytes of user data and skips Mode 2 Form 2 sectors.
+ * The read mode is independent of the bytes per sector of the handle,
+ * sectors outside the tracks can only be read in the bytes per sector of the handle.
+ * This function does not change the current offset and can be called
+ * concurrently from multiple threads on the same handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_sectors(
+         libodraw_handle_t *handle,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint8_t read_mode,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_read_sectors";
+	ssize_t read_count                          = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libodraw_internal_handle_read_sectors(
+	              internal_handle,
+	              start_sector,
+	              number_of_sectors,
+	              read_mode,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector(s): %" PRIu64 " - %" PRIu64 ".",
+		 function,
+		 start_sector,
+		 start_sector + number_of_sectors );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Retrieves the form of a Mode 2 XA sector
+ * The form is 1 for a Mode 2 Form 1 sector or 2 for a Mode 2 Form 2 sector
+ * The forms are determined from the XA sub-headers when the sectors are read and are
+ * retained per track, a sector that has not been read before is read to determine its form
+ * Returns 1 if successful, 0 if the sector is not a Mode 2 XA sector or -1 on error
+ */
+int libodraw_handle_get_sector_form(
+     libodraw_handle_t *handle,
+     uint64_t sector,
+     uint8_t *form,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extent                   = NULL;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_track_value_t *track_value         = NULL;
+	static char *function                       = "libodraw_handle_get_sector_form";
+	int result                                  = 0;
+	int track_index                             = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( form == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid form.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          sector,
+	          &track_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track extent for sector: %" PRIu64 ".",
+		 function,
+		 sector );
+	}
+	else if( result != 0 )
+	{
+		track_value = (libodraw_track_value_t *) extent->value;
+
+		result = libodraw_internal_handle_get_track_sector_form(
+		          internal_handle,
+		          track_value,
+		          sector,
+		          form,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve form of sector: %" PRIu64 ".",
+			 function,
+			 sector );
+		}
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks a certain offset of the (media) data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libodraw_internal_handle_seek_offset(
+         libodraw_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_seek_offset";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_handle->media_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset of the (media) data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libodraw_handle_seek_offset(
+         libodraw_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libodraw_internal_handle_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves a run-out sector range for the specified offset
+ * When no matching run-out was found the run_out_index value contains the next run-out index on return
+ * Returns 1 if successful, 0 if no matching run-out was found or -1 on error
+ */
+int libodraw_handle_get_run_out_at_offset(
+     libodraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     int *run_out_index,
+     libodraw_sector_range_t **run_out_sector_range,
+     off64_t *run_out_offset,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extent = NULL;
+	static char *function     = "libodraw_handle_get_run_out_at_offset";
+	uint64_t current_sector   = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_out_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run-out index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_out_sector_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run-out sector range.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_out_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run-out offset.",
+		 function );
+
+		return( -1 );
+	}
+	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_RUN_OUT,
+	          current_sector,
+	          run_out_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run-out extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*run_out_sector_range = (libodraw_sector_range_t *) extent->value;
+		*run_out_offset       = offset - (off64_t) ( extent->start_sector * internal_handle->io_handle->bytes_per_sector );
+
+		return( 1 );
+	}
+	*run_out_sector_range = NULL;
+	*run_out_offset       = 0;
+
+	return( 0 );
+}
+
+/* Retrieves a lead-out sector range for the specified offset
+ * When no matching lead-out was found the lead_out_index value contains the next lead-out index on return
+ * Returns 1 if successful, 0 if no matching lead-out was found or -1 on error
+ */
+int libodraw_handle_get_lead_out_at_offset(
+     libodraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     int *lead_out_index,
+     libodraw_sector_range_t **lead_out_sector_range,
+     off64_t *lead_out_offset,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extent = NULL;
+	static char *function     = "libodraw_handle_get_lead_out_at_offset";
+	uint64_t current_sector   = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( lead_out_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out index.",
+		 function );
+
+		return( -1 );
+	}
+	if( lead_out_sector_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out sector range.",
+		 function );
+
+		return( -1 );
+	}
+	if( lead_out_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out offset.",
+		 function );
+
+		return( -1 );
+	}
+	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_LEAD_OUT,
+	          current_sector,
+	          lead_out_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lead-out extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*lead_out_sector_range = (libodraw_sector_range_t *) extent->value;
+		*lead_out_offset       = offset - (off64_t) ( extent->start_sector * internal_handle->io_handle->bytes_per_sector );
+
+		return( 1 );
+	}
+	*lead_out_sector_range = NULL;
+	*lead_out_offset       = 0;
+
+	return( 0 );
+}
+
+/* Retrieves a track value for the specified offset
+ * When no matching track was found the track_index value contains the next track index on return
+ * Returns 1 if successful, 0 if no matching track was found or -1 on error
+ */
+int libodraw_handle_get_track_at_offset(
+     libodraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     int *track_index,
+     libodraw_track_value_t **track_value,
+     off64_t *track_offset,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extent = NULL;
+	static char *function     = "libodraw_handle_get_track_at_offset";
+	uint64_t current_sector   = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track index.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track offset.",
+		 function );
+
+		return( -1 );
+	}
+	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          current_sector,
+	          track_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track extent for sector: %" PRIu64 ".",
+		 function,
+		 current_sector );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*track_value = (libodraw_track_value_t *) extent->value;
+		*track_offset = offset - (off64_t) ( extent->start_sector * internal_handle->io_handle->bytes_per_sector );
+
+		return( 1 );
+	}
+	*track_value  = NULL;
+	*track_offset = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_offset(
+     libodraw_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_handle->current_offset;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename_size(
+     libodraw_internal_handle_t *internal_handle,
+     size_t *basename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_get_basename_size";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	*basename_size = internal_handle->basename_size;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Retrieves the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename(
+     libodraw_internal_handle_t *internal_handle,
+     char *basename,
+     size_t basename_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libodraw_internal_handle_get_basename";
+	size_t narrow_basename_size = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                  = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &narrow_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &narrow_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &narrow_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &narrow_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow basename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	narrow_basename_size = internal_handle->basename_size;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	if( basename_size < narrow_basename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: basename too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) basename,
+		          basename_size,
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) basename,
+		          basename_size,
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) basename,
+		          basename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) basename,
+		          basename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( system_string_copy(
+	     basename,
+	     internal_handle->basename,
+	     internal_handle->basename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+	basename[ internal_handle->basename_size - 1 ] = 0;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Sets the basename
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_set_basename(
+     libodraw_internal_handle_t *internal_handle,
+     const char *basename,
+     size_t basename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_set_basename";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->basename != NULL )
+	{
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	internal_handle->basename_size = basename_length + 1;
+#endif
+	internal_handle->basename = system_string_allocate(
+	                             internal_handle->basename_size );
+
+	if( internal_handle->basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
+		 function );
+
+		internal_handle->basename_size = 0;
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+
+		return( -1 );
+	}
+#else
+	if( system_string_copy(
+	     internal_handle->basename,
+	     basename,
+	     basename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+
+		return( -1 );
+	}
+	internal_handle->basename[ basename_length ] = 0;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the size of the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename_size_wide(
+     libodraw_internal_handle_t *internal_handle,
+     size_t *basename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_get_basename_size_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	*basename_size = internal_handle->basename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+/* Retrieves the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename_wide(
+     libodraw_internal_handle_t *internal_handle,
+     wchar_t *basename,
+     size_t basename_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libodraw_internal_handle_get_basename_wide";
+	size_t wide_basename_size = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wide_basename_size = internal_handle->basename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &wide_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &wide_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &wide_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &wide_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	if( basename_size < wide_basename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: basename too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     basename,
+	     internal_handle->basename,
+	     internal_handle->basename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+	basename[ internal_handle->basename_size - 1 ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) basename,
+		          basename_size,
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) basename,
+		          basename_size,
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) basename,
+		          basename_size,
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) basename,
+		          basename_size,
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+/* Sets the basename
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_set_basename_wide(
+     libodraw_internal_handle_t *internal_handle,
+     const wchar_t *basename,
+     size_t basename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_set_basename_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->basename != NULL )
+	{
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	internal_handle->basename_size = basename_length + 1;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	internal_handle->basename = system_string_allocate(
+	                             internal_handle->basename_size );
+
+	if( internal_handle->basename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     internal_handle->basename,
+	     basename,
+	     basename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+
+		return( -1 );
+	}
+	internal_handle->basename[ basename_length ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
+
+		memory_free(
+		 internal_handle->basename );
 
 		internal_handle->basename      = NULL;
 		internal_handle->basename_size = 0;
 
 		return( -1 );
 	}
-	internal_handle->basename[ basename_length ] = 0;
-#else
-	if( libclocale_codepage == 0 )
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the maximum number of (concurrent) open file handles
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_maximum_number_of_open_handles(
+     libodraw_handle_t *handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_maximum_number_of_open_handles";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool != NULL )
+	{
+		if( libbfio_pool_set_maximum_number_of_open_handles(
+		     internal_handle->data_file_io_pool,
+		     maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles in data files IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	return( 1 );
+}
+
+/* Retrieves the sector cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_cache_size(
+     libodraw_handle_t *handle,
+     size_t *cache_size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_cache_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_size = internal_handle->sector_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the sector cache size
+ * The cache contains the sector data as returned by the read functions and
+ * is created on demand. Its size is rounded down to a multiple of the bytes
+ * per sector, a size of 0 disables the cache. Changing the cache size discards
+ * the currently cached sectors and the hit and miss statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_cache_size(
+     libodraw_handle_t *handle,
+     size_t cache_size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_cache_size";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( cache_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libodraw_sector_cache_free(
+	     &( internal_handle->sector_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sector cache.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->sector_cache_size = cache_size;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the sector cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_cache_statistics(
+     libodraw_handle_t *handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_cache_statistics";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->sector_cache == NULL )
+	{
+		*number_of_hits   = 0;
+		*number_of_misses = 0;
+	}
+	else if( libodraw_sector_cache_get_statistics(
+	          internal_handle->sector_cache,
+	          number_of_hits,
+	          number_of_misses,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector cache statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the readahead window size
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_readahead_window_size(
+     libodraw_handle_t *handle,
+     size_t *window_size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_readahead_window_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( window_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window size.",
+		 function );
+
+		return( -1 );
+	}
+	*window_size = internal_handle->readahead_window_size;
+
+	return( 1 );
+}
+
+/* Sets the readahead window size
+ * After consecutive sequential reads from a data file the data that follows is read
+ * into 2 windows of this size, by a worker thread if multi-threading is supported.
+ * The readahead is created on demand and not used for memory mapped data files,
+ * a size of 0 disables the readahead. Changing the window size discards the data
+ * read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_readahead_window_size(
+     libodraw_handle_t *handle,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_readahead_window_size";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( window_size > (size_t) LIBODRAW_READAHEAD_MAXIMUM_WINDOW_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid window size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libodraw_readahead_free(
+	     &( internal_handle->readahead ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free readahead.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->readahead_window_size = window_size;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the sector verification flags
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_sector_verification_flags(
+     libodraw_handle_t *handle,
+     uint8_t *verification_flags,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_sector_verification_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( verification_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*verification_flags = internal_handle->sector_verification_flags;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the sector verification flags
+ * The sector cache is emptied so that sectors read afterwards are verified
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_sector_verification_flags(
+     libodraw_handle_t *handle,
+     uint8_t verification_flags,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_sector_verification_flags";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( ( verification_flags & ~( LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC | LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported verification flags: 0x%02" PRIx8 ".",
+		 function,
+		 verification_flags );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->sector_cache != NULL )
+	{
+		if( libodraw_sector_cache_empty(
+		     internal_handle->sector_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty sector cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->sector_verification_flags = verification_flags;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Verifies the sectors in the sector data
+ * Sectors that fail verification are appended to the error sectors
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_verify_sector_data(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t start_sector,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libodraw_internal_handle_verify_sector_data";
+	size_t sector_data_offset = 0;
+	uint64_t sector           = 0;
+	int result                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid track value - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	sector = start_sector;
+
+	while( ( sector_data_offset + track_value->bytes_per_sector ) <= sector_data_size )
+	{
+		result = libodraw_io_handle_verify_sector_data(
+		          internal_handle->io_handle,
+		          &( sector_data[ sector_data_offset ] ),
+		          (size_t) track_value->bytes_per_sector,
+		          track_value->type,
+		          internal_handle->sector_verification_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify sector: %" PRIu64 ".",
+			 function,
+			 sector );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libodraw_internal_handle_append_error_sector(
+			     internal_handle,
+			     sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append error sector: %" PRIu64 ".",
+				 function,
+				 sector );
+
+				return( -1 );
+			}
+		}
+		sector_data_offset += track_value->bytes_per_sector;
+		sector             += 1;
+	}
+	return( 1 );
+}
+
+/* Copies sector data of a track to a buffer with a specific output bytes per sector
+ * Whole sectors are copied using the sector copy function selected for the track,
+ * a partial first or last sector using the generic copy function
+ * Returns the number of bytes copied or -1 on error
+ */
+ssize_t libodraw_internal_handle_copy_sector_data_to_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_track_value_t *track_value,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t output_bytes_per_sector,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t sector_index,
+         uint32_t sector_offset,
+         libcerror_error_t **error )
+{
+	libodraw_sector_copy_function_t copy_function = NULL;
+	static char *function                         = "libodraw_internal_handle_copy_sector_data_to_buffer";
+	size_t buffer_offset                          = 0;
+	size_t number_of_sectors                      = 0;
+	size_t sector_data_offset                     = 0;
+	ssize_t copy_count                            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid track value - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_bytes_per_sector == 2048 )
+	{
+		copy_function = track_value->copy_to_2048_function;
+	}
+	else if( output_bytes_per_sector == 2352 )
+	{
+		copy_function = track_value->copy_to_2352_function;
+	}
+	if( copy_function != NULL )
+	{
+		/* A partial first sector is copied using the generic copy function
+		 */
+		if( sector_offset != 0 )
+		{
+			copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+			              internal_handle->io_handle,
+			              sector_data,
+			              ( sector_data_size < track_value->bytes_per_sector ) ? sector_data_size : track_value->bytes_per_sector,
+			              track_value->bytes_per_sector,
+			              track_value->type,
+			              output_bytes_per_sector,
+			              buffer,
+			              buffer_size,
+			              sector_index,
+			              sector_offset,
+			              error );
+
+			if( copy_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy partial sector data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset      = (size_t) copy_count;
+			sector_data_offset = track_value->bytes_per_sector;
+			sector_index      += 1;
+			sector_offset      = 0;
+
+			if( ( buffer_offset >= buffer_size )
+			 || ( sector_data_offset >= sector_data_size ) )
+			{
+				return( (ssize_t) buffer_offset );
+			}
+		}
+		number_of_sectors = ( sector_data_size - sector_data_offset ) / track_value->bytes_per_sector;
+
+		if( number_of_sectors > ( ( buffer_size - buffer_offset ) / output_bytes_per_sector ) )
+		{
+			number_of_sectors = ( buffer_size - buffer_offset ) / output_bytes_per_sector;
+		}
+		if( number_of_sectors > 0 )
+		{
+			if( copy_function(
+			     internal_handle->io_handle,
+			     &( sector_data[ sector_data_offset ] ),
+			     number_of_sectors,
+			     track_value->type,
+			     sector_index,
+			     &( buffer[ buffer_offset ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset      += number_of_sectors * output_bytes_per_sector;
+			sector_data_offset += number_of_sectors * track_value->bytes_per_sector;
+			sector_index       += (uint32_t) number_of_sectors;
+		}
+		if( ( buffer_offset >= buffer_size )
+		 || ( sector_data_offset >= sector_data_size ) )
+		{
+			return( (ssize_t) buffer_offset );
+		}
+	}
+	/* The remaining partial sector or a track without a sector copy function
+	 * is copied using the generic copy function
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              internal_handle->io_handle,
+	              &( sector_data[ sector_data_offset ] ),
+	              sector_data_size - sector_data_offset,
+	              track_value->bytes_per_sector,
+	              track_value->type,
+	              output_bytes_per_sector,
+	              &( buffer[ buffer_offset ] ),
+	              buffer_size - buffer_offset,
+	              sector_index,
+	              sector_offset,
+	              error );
+
+	if( copy_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) ( buffer_offset + (size_t) copy_count ) );
+}
+
+/* Appends a sector that failed verification to the error sectors
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_append_error_sector(
+     libodraw_internal_handle_t *internal_handle,
+     uint64_t sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_append_error_sector";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_handle->error_sectors_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab error sectors mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Adjacent and overlapping ranges are merged by the range list
+	 */
+	if( libcdata_range_list_insert_range(
+	     internal_handle->error_sectors,
+	     sector,
+	     1,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert sector: %" PRIu64 " into error sectors range list.",
+		 function,
+		 sector );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->error_sectors_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release error sectors mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of error sectors
+ * An error sector is a range of sectors that failed verification
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_number_of_error_sectors(
+     libodraw_handle_t *handle,
+     int *number_of_error_sectors,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_number_of_error_sectors";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->error_sectors_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab error sectors mutex.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_handle->error_sectors,
+	     number_of_error_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from error sectors range list.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->error_sectors_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release error sectors mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves an error sector
+ * An error sector is a range of sectors that failed verification
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_error_sector(
+     libodraw_handle_t *handle,
+     int error_sector_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	intptr_t *value                             = NULL;
+	static char *function                       = "libodraw_handle_get_error_sector";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_handle->error_sectors_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab error sectors mutex.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_range_list_get_range_by_index(
+	     internal_handle->error_sectors,
+	     error_sector_index,
+	     start_sector,
+	     number_of_sectors,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve error sector: %d from range list.",
+		 function,
+		 error_sector_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_handle->error_sectors_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release error sectors mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the value to indicate if data files are memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_memory_map_data_files(
+     libodraw_handle_t *handle,
+     uint8_t *memory_map_data_files,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_memory_map_data_files";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( memory_map_data_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map data files.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*memory_map_data_files = internal_handle->memory_map_data_files;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate if data files should be memory mapped
+ * The value only applies to data files that are opened by name afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_memory_map_data_files(
+     libodraw_handle_t *handle,
+     uint8_t memory_map_data_files,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_memory_map_data_files";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_map_data_files != 0 )
+	{
+		internal_handle->memory_map_data_files = 1;
+	}
+	else
+	{
+		internal_handle->memory_map_data_files = 0;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Memory maps a specific data file
+ * Returns 1 if successful, 0 if memory mapping is not supported or -1 on error
+ */
+int libodraw_internal_handle_map_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libodraw_mapped_file_t *mapped_file = NULL;
+	static char *function               = "libodraw_internal_handle_map_data_file";
+	int number_of_data_file_descriptors = 0;
+	int number_of_mapped_files          = 0;
+	int result                          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_descriptors_array,
+	     &number_of_data_file_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_file_index < 0 )
+	 || ( data_file_index >= number_of_data_file_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data file index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->mapped_files_array,
+	     &number_of_mapped_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of mapped files.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_mapped_files < number_of_data_file_descriptors )
+	{
+		if( libcdata_array_resize(
+		     internal_handle->mapped_files_array,
+		     number_of_data_file_descriptors,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_mapped_file_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize mapped files array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libodraw_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libodraw_mapped_file_open(
+	          mapped_file,
+	          filename,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* Reads of the data file fall back to the file IO pool
+		 */
+		if( libodraw_mapped_file_free(
+		     &mapped_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_handle->mapped_files_array,
+	     data_file_index,
+	     (intptr_t *) mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set mapped file: %d in array.",
+		 function,
+		 data_file_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( mapped_file != NULL )
+	{
+		libodraw_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the memory mapped file of a specific data file
+ * Returns 1 if successful, 0 if the data file is not memory mapped or -1 on error
+ */
+int libodraw_internal_handle_get_mapped_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     libodraw_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function      = "libodraw_internal_handle_get_mapped_file";
+	int number_of_mapped_files = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->mapped_files_array,
+	     &number_of_mapped_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of mapped files.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_file_index < 0 )
+	 || ( data_file_index >= number_of_mapped_files ) )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->mapped_files_array,
+	     data_file_index,
+	     (intptr_t **) mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped file: %d from array.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	if( *mapped_file == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if data files are read using io_uring
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_use_io_uring(
+     libodraw_handle_t *handle,
+     uint8_t *use_io_uring,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_use_io_uring";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( use_io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid use io_uring.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*use_io_uring = internal_handle->use_io_uring;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate if data files should be read using io_uring
+ * The value only applies to data files that are opened by name afterwards and are not memory mapped,
+ * if io_uring is not supported the data files are read as usual
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_use_io_uring(
+     libodraw_handle_t *handle,
+     uint8_t use_io_uring,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_use_io_uring";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( use_io_uring != 0 )
+	{
+		internal_handle->use_io_uring = 1;
+	}
+	else
+	{
+		internal_handle->use_io_uring = 0;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets a specific data file to be read using io_uring
+ * The io_uring is created on demand when the first data file is set
+ * Returns 1 if successful, 0 if io_uring is not supported or -1 on error
+ */
+int libodraw_internal_handle_set_io_uring_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_set_io_uring_data_file";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_uring == NULL )
+	{
+		if( libodraw_io_uring_initialize(
+		     &( internal_handle->io_uring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create io_uring.",
+			 function );
+
+			return( -1 );
+		}
+		/* If io_uring is not supported the io_uring remains closed,
+		 * hence opening it is not retried for every data file
+		 */
+		if( libodraw_io_uring_open(
+		     internal_handle->io_uring,
+		     LIBODRAW_IO_URING_DEFAULT_QUEUE_DEPTH,
+		     LIBODRAW_IO_URING_DEFAULT_BUFFER_SIZE,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open io_uring.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libodraw_io_uring_set_file(
+	          internal_handle->io_uring,
+	          data_file_index,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set io_uring data file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the value to indicate if data files are read using direct IO
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_use_direct_io(
+     libodraw_handle_t *handle,
+     uint8_t *use_direct_io,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_use_direct_io";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( use_direct_io == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid use direct IO.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*use_direct_io = internal_handle->use_direct_io;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate if data files should be read using direct IO
+ * Direct IO bypasses the page cache of the operating system, which prevents reading
+ * large images from evicting data that other processes rely on
+ * The value only applies to data files that are opened by name afterwards and are not memory mapped,
+ * data files on a file system that does not support direct IO are read as usual
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_use_direct_io(
+     libodraw_handle_t *handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_use_direct_io";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( use_direct_io != 0 )
+	{
+		internal_handle->use_direct_io = 1;
+	}
+	else
+	{
+		internal_handle->use_direct_io = 0;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a specific data file for direct IO
+ * Returns 1 if successful, 0 if direct IO is not supported or -1 on error
+ */
+int libodraw_internal_handle_open_direct_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libodraw_direct_file_t *direct_file = NULL;
+	static char *function               = "libodraw_internal_handle_open_direct_data_file";
+	int number_of_data_file_descriptors = 0;
+	int number_of_direct_files          = 0;
+	int result                          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_descriptors_array,
+	     &number_of_data_file_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_file_index < 0 )
+	 || ( data_file_index >= number_of_data_file_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data file index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->direct_files_array,
+	     &number_of_direct_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of direct files.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_direct_files < number_of_data_file_descriptors )
+	{
+		if( libcdata_array_resize(
+		     internal_handle->direct_files_array,
+		     number_of_data_file_descriptors,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_direct_file_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize direct files array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libodraw_direct_file_initialize(
+	     &direct_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libodraw_direct_file_open(
+	          direct_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open direct file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* Reads of the data file fall back to the file IO pool
+		 */
+		if( libodraw_direct_file_free(
+		     &direct_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free direct file.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_handle->direct_files_array,
+	     data_file_index,
+	     (intptr_t *) direct_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set direct file: %d in array.",
+		 function,
+		 data_file_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( direct_file != NULL )
+	{
+		libodraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the direct file of a specific data file
+ * Returns 1 if successful, 0 if the data file is not read using direct IO or -1 on error
+ */
+int libodraw_internal_handle_get_direct_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     libodraw_direct_file_t **direct_file,
+     libcerror_error_t **error )
+{
+	static char *function      = "libodraw_internal_handle_get_direct_file";
+	int number_of_direct_files = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_file = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->direct_files_array,
+	     &number_of_direct_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of direct files.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_file_index < 0 )
+	 || ( data_file_index >= number_of_direct_files ) )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->direct_files_array,
+	     data_file_index,
+	     (intptr_t **) direct_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve direct file: %d from array.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	if( *direct_file == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from a specific data file
+ * The data is copied from the memory mapped file if available otherwise it is read using
+ * direct IO or io_uring, if the data file was opened for it, the readahead, if provided,
+ * or the file IO pool
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_data_file_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_readahead_t *readahead,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libodraw_io_uring_request_t io_uring_request;
+
+	libodraw_direct_file_t *direct_file = NULL;
+	libodraw_mapped_file_t *mapped_file = NULL;
+	const uint8_t *mapped_data          = NULL;
+	static char *function               = "libodraw_internal_handle_read_data_file_buffer";
+	size_t mapped_data_size             = 0;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libodraw_internal_handle_get_mapped_file(
+	          internal_handle,
+	          data_file_index,
+	          &mapped_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libodraw_mapped_file_get_data(
+		          mapped_file,
+		          offset,
+		          &mapped_data,
+		          &mapped_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( mapped_data_size > size )
+		{
+			mapped_data_size = size;
+		}
+		if( memory_copy(
+		     buffer,
+		     mapped_data,
+		     mapped_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) mapped_data_size );
+	}
+	result = libodraw_internal_handle_get_direct_file(
+	          internal_handle,
+	          data_file_index,
+	          &direct_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve direct file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d using direct IO.",
+			 function,
+			 data_file_index );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( internal_handle->io_uring != NULL )
+	{
+		io_uring_request.file_index = data_file_index;
+		io_uring_request.buffer     = buffer;
+		io_uring_request.size       = size;
+		io_uring_request.offset     = offset;
+		io_uring_request.read_size  = 0;
+
+		result = libodraw_io_uring_read_requests(
+		          internal_handle->io_uring,
+		          &io_uring_request,
+		          1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d using io_uring.",
+			 function,
+			 data_file_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( (ssize_t) io_uring_request.read_size );
+		}
+	}
+	if( readahead != NULL )
+	{
+		read_count = libodraw_readahead_read_buffer(
+		              readahead,
+		              data_file_index,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              internal_handle->data_file_io_pool,
+		              data_file_index,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+	}
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from data file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves a pointer to the data of a specific sector
+ * This requires the data file containing the sector to be memory mapped and the
+ * track to store sectors of the same size as the media, in which case the sector
+ * data can be used as-is. No pointer is available for audio tracks of big-endian
+ * data files since their samples are byte swapped when read. The sector data is not verified and not added to the cache.
+ * The sector data size contains the number of bytes of contiguous track data,
+ * starting at the sector, that can be accessed using the pointer.
+ * The pointer remains valid until the handle is closed.
+ * Returns 1 if successful, 0 if no sector pointer is available or -1 on error
+ */
+int libodraw_handle_get_sector_pointer(
+     libodraw_handle_t *handle,
+     uint64_t sector,
+     const uint8_t **sector_data,
+     size_t *sector_data_size,
+     libcerror_error_t **error )
+{
+	libodraw_extent_t *extent                   = NULL;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_mapped_file_t *mapped_file         = NULL;
+	libodraw_track_value_t *track_value         = NULL;
+	const uint8_t *mapped_data                  = NULL;
+	static char *function                       = "libodraw_handle_get_sector_pointer";
+	size64_t track_data_size                    = 0;
+	size_t mapped_data_size                     = 0;
+	off64_t track_data_offset                   = 0;
+	int extent_index                            = 0;
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( sector_data == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          internal_handle->extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          sector,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track extent for sector: %" PRIu64 ".",
+		 function,
+		 sector );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		track_value = (libodraw_track_value_t *) extent->value;
+
+		if( track_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
+			 function,
+			 extent->index );
+
+			goto on_error;
+		}
+		if( ( internal_handle->io_handle->bytes_per_sector == 0 )
+		 || ( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		 || ( track_value->swap_samples != 0 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libodraw_internal_handle_get_mapped_file(
+		          internal_handle,
+		          extent->data_file_index,
+		          &mapped_file,
 		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped file: %d.",
+			 function,
+			 extent->data_file_index );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		track_data_offset = extent->data_file_offset
+		                  + (off64_t) ( ( sector - extent->start_sector ) * internal_handle->io_handle->bytes_per_sector );
+
+		track_data_size = ( extent->end_sector - sector ) * internal_handle->io_handle->bytes_per_sector;
+
+		result = libodraw_mapped_file_get_data(
+		          mapped_file,
+		          track_data_offset,
+		          &mapped_data,
+		          &mapped_data_size,
 		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 track_data_offset,
+			 track_data_offset );
+
+			goto on_error;
+		}
 	}
-	if( result != 1 )
+	if( result != 0 )
+	{
+		if( (size64_t) mapped_data_size > track_data_size )
+		{
+			mapped_data_size = (size_t) track_data_size;
+		}
+		/* A data file that is too small to contain the entire sector is handled by the read functions
+		 */
+		if( mapped_data_size < (size_t) internal_handle->io_handle->bytes_per_sector )
+		{
+			result = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		*sector_data      = mapped_data;
+		*sector_data_size = mapped_data_size;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads the headers of the data files
+ * This determines the offset, size and byte order of the sector data of WAVE and AIFF data files
+ * so that audio tracks can be read directly from these files
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_read_data_file_headers(
+     libodraw_internal_handle_t *internal_handle,
+     int number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	libodraw_audio_file_header_t *audio_file_header       = NULL;
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	static char *function                                 = "libodraw_internal_handle_read_data_file_headers";
+	int data_file_descriptor_index                        = 0;
+	int number_of_data_file_descriptors                   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		memory_free(
-		 internal_handle->basename );
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_descriptors_array,
+	     &number_of_data_file_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data file descriptors are in the same order as the file IO handles in the pool
+	 */
+	for( data_file_descriptor_index = 0;
+	     data_file_descriptor_index < number_of_data_file_descriptors;
+	     data_file_descriptor_index++ )
+	{
+		if( data_file_descriptor_index >= number_of_file_io_handles )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->data_file_descriptors_array,
+		     data_file_descriptor_index,
+		     (intptr_t **) &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file descriptor: %d.",
+			 function,
+			 data_file_descriptor_index );
+
+			goto on_error;
+		}
+		if( data_file_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data file descriptor: %d.",
+			 function,
+			 data_file_descriptor_index );
+
+			goto on_error;
+		}
+		data_file_descriptor->data_offset = 0;
+		data_file_descriptor->data_size   = 0;
+
+		if( data_file_descriptor->type == LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN )
+		{
+			data_file_descriptor->byte_order = LIBODRAW_ENDIAN_BIG;
+		}
+		else
+		{
+			data_file_descriptor->byte_order = LIBODRAW_ENDIAN_LITTLE;
+		}
+		if( ( data_file_descriptor->type != LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+		 && ( data_file_descriptor->type != LIBODRAW_FILE_TYPE_AUDIO_AIFF ) )
+		{
+			continue;
+		}
+		if( libodraw_audio_file_header_initialize(
+		     &audio_file_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create audio file header.",
+			 function );
+
+			goto on_error;
+		}
+		if( libodraw_audio_file_header_read_file_io_pool(
+		     audio_file_header,
+		     internal_handle->data_file_io_pool,
+		     data_file_descriptor_index,
+		     data_file_descriptor->type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read audio file header of data file: %d.",
+			 function,
+			 data_file_descriptor_index );
 
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
+			goto on_error;
+		}
+		data_file_descriptor->data_offset = audio_file_header->data_offset;
+		data_file_descriptor->data_size   = audio_file_header->data_size;
+		data_file_descriptor->byte_order  = audio_file_header->byte_order;
 
-		return( -1 );
+		if( libodraw_audio_file_header_free(
+		     &audio_file_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free audio file header.",
+			 function );
+
+			goto on_error;
+		}
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 	return( 1 );
-}
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+on_error:
+	if( audio_file_header != NULL )
+	{
+		libodraw_audio_file_header_free(
+		 &audio_file_header,
+		 NULL );
+	}
+	return( -1 );
+}
 
-/* Sets the maximum number of (concurrent) open file handles
+/* Retrieves the size of the sector data of a specific data file
+ * The sector data of WAVE and AIFF data files ends at the data offset plus data size
+ * of the audio file header, any trailing chunks are not part of the sector data
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_set_maximum_number_of_open_handles(
-     libodraw_handle_t *handle,
-     int maximum_number_of_open_handles,
+int libodraw_internal_handle_get_data_file_sector_data_size(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     size64_t *sector_data_size,
      libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_set_maximum_number_of_open_handles";
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	static char *function                                 = "libodraw_internal_handle_get_data_file_sector_data_size";
+	size64_t data_file_size                               = 0;
+	int result                                            = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -5642,26 +12525,58 @@ int libodraw_handle_set_maximum_number_of_open_handles(
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
+	if( sector_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data size.",
+		 function );
 
-	if( internal_handle->data_file_io_pool != NULL )
+		return( -1 );
+	}
+	if( libbfio_pool_get_size(
+	     internal_handle->data_file_io_pool,
+	     data_file_index,
+	     &data_file_size,
+	     error ) != 1 )
 	{
-		if( libbfio_pool_set_maximum_number_of_open_handles(
-		     internal_handle->data_file_io_pool,
-		     maximum_number_of_open_handles,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d size.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	result = libcdata_array_get_entry_by_index(
+	          internal_handle->data_file_descriptors_array,
+	          data_file_index,
+	          (intptr_t **) &data_file_descriptor,
+	          NULL );
+
+	if( ( result == 1 )
+	 && ( data_file_descriptor != NULL ) )
+	{
+		if( (size64_t) data_file_descriptor->data_offset >= data_file_size )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set maximum number of open handles in data files IO handle.",
-			 function );
+			data_file_size = 0;
+		}
+		else
+		{
+			data_file_size -= data_file_descriptor->data_offset;
 
-			return( -1 );
+			if( ( data_file_descriptor->data_size != 0 )
+			 && ( data_file_descriptor->data_size < data_file_size ) )
+			{
+				data_file_size = data_file_descriptor->data_size;
+			}
 		}
 	}
-	internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	*sector_data_size = data_file_size;
 
 	return( 1 );
 }
@@ -5673,14 +12588,16 @@ int libodraw_handle_set_media_values(
      libodraw_internal_handle_t *internal_handle,
      libcerror_error_t **error )
 {
-	static char *function                 = "libodraw_handle_set_media_values";
-	libodraw_sector_range_t *sector_range = NULL;
-	libodraw_track_value_t *track_value   = NULL;
-	size64_t data_file_size               = 0;
-	uint64_t number_of_sectors            = 0;
-	int number_of_file_io_handles         = 0;
-	int number_of_sessions                = 0;
-	int number_of_tracks                  = 0;
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_sector_range_t *sector_range                 = NULL;
+	libodraw_track_value_t *track_value                   = NULL;
+	static char *function                                 = "libodraw_handle_set_media_values";
+	size64_t data_file_size                               = 0;
+	uint64_t number_of_sectors                            = 0;
+	int number_of_file_io_handles                         = 0;
+	int number_of_sessions                                = 0;
+	int number_of_tracks                                  = 0;
+	int track_index                                       = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -5740,8 +12657,24 @@ int libodraw_handle_set_media_values(
 
 		return( -1 );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
+	if( libodraw_internal_handle_read_data_file_headers(
+	     internal_handle,
+	     number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data file headers.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the sector data of the last data file contributes to the media size
+	 */
+	if( libodraw_internal_handle_get_data_file_sector_data_size(
+	     internal_handle,
 	     number_of_file_io_handles - 1,
 	     &data_file_size,
 	     error ) != 1 )
@@ -5750,7 +12683,7 @@ int libodraw_handle_set_media_values(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
+		 "%s: unable to retrieve data file: %d sector data size.",
 		 function,
 		 number_of_file_io_handles - 1 );
 
@@ -5945,6 +12878,144 @@ int libodraw_handle_set_media_values(
 			}
 		}
 	}
+	/* Select the sector copy functions once per track so that reads do not
+	 * need to determine how to convert the sectors of the track
+	 */
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->tracks_array,
+		     track_index,
+		     (intptr_t **) &track_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track value: %d from array.",
+			 function,
+			 track_index );
+
+			return( -1 );
+		}
+		if( track_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
+			 function,
+			 track_index );
+
+			return( -1 );
+		}
+		/* The data file offset is relative to the start of the sector data
+		 * in the data file, which follows the header of WAVE and AIFF data files
+		 */
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->data_file_descriptors_array,
+		     track_value->data_file_index,
+		     (intptr_t **) &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file descriptor: %d of track: %d from array.",
+			 function,
+			 track_value->data_file_index,
+			 track_index );
+
+			return( -1 );
+		}
+		if( data_file_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data file descriptor: %d of track: %d.",
+			 function,
+			 track_value->data_file_index,
+			 track_index );
+
+			return( -1 );
+		}
+		track_value->data_file_offset = data_file_descriptor->data_offset
+		                              + (off64_t) ( track_value->data_file_start_sector * track_value->bytes_per_sector );
+		track_value->byte_order       = LIBODRAW_ENDIAN_LITTLE;
+
+		if( data_file_descriptor->byte_order != 0 )
+		{
+			track_value->byte_order = data_file_descriptor->byte_order;
+		}
+		if( ( track_value->type == LIBODRAW_TRACK_TYPE_AUDIO )
+		 && ( track_value->byte_order == LIBODRAW_ENDIAN_BIG ) )
+		{
+			track_value->swap_samples = 1;
+		}
+		else
+		{
+			track_value->swap_samples = 0;
+		}
+		track_value->copy_to_2048_function = libodraw_sector_copy_get_function(
+		                                      track_value->type,
+		                                      track_value->bytes_per_sector,
+		                                      2048 );
+
+		track_value->copy_to_2352_function = libodraw_sector_copy_get_function(
+		                                      track_value->type,
+		                                      track_value->bytes_per_sector,
+		                                      2352 );
+
+		/* The forms of the sectors of tracks with XA sub-headers are determined
+		 * when the sectors are read
+		 */
+		if( ( track_value->form_map == NULL )
+		 && ( track_value->number_of_sectors > 0 )
+		 && ( ( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
+		  ||  ( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+		  ||  ( track_value->type == LIBODRAW_TRACK_TYPE_CDI_2336 )
+		  ||  ( track_value->type == LIBODRAW_TRACK_TYPE_CDI_2352 ) ) )
+		{
+			if( libodraw_form_map_initialize(
+			     &( track_value->form_map ),
+			     track_value->number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create form map of track: %d.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libodraw_extent_table_build(
+	     internal_handle->extent_table,
+	     internal_handle->tracks_array,
+	     internal_handle->run_outs_array,
+	     internal_handle->lead_outs_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build extent table.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -6485,6 +13556,9 @@ int libodraw_handle_get_bytes_per_sector(
 }
 
 /* Sets the number of bytes per sector
+ * Supported values are 2048, which contains the user data of each sector, and 2352,
+ * which contains raw sectors where the synchronisation data, header, EDC and ECC
+ * are generated for tracks that do not store them
  * Returns 1 if successful or -1 on error
  */
 int libodraw_handle_set_bytes_per_sector(
@@ -6494,6 +13568,7 @@ int libodraw_handle_set_bytes_per_sector(
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
 	static char *function                       = "libodraw_handle_set_bytes_per_sector";
+	int result                                  = 1;
 
 	if( handle == NULL )
 	{
@@ -6519,8 +13594,8 @@ int libodraw_handle_set_bytes_per_sector(
 
 		return( -1 );
 	}
-/* TODO add support for 2352 */
-	if( bytes_per_sector != 2048 )
+	if( ( bytes_per_sector != 2048 )
+	 && ( bytes_per_sector != 2352 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -6531,9 +13606,63 @@ int libodraw_handle_set_bytes_per_sector(
 
 		return( -1 );
 	}
-	internal_handle->io_handle->bytes_per_sector = bytes_per_sector;
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#endif
+	if( internal_handle->io_handle->bytes_per_sector != bytes_per_sector )
+	{
+		/* The cached sector data is stored in the previous bytes per sector
+		 */
+		if( libodraw_sector_cache_free(
+		     &( internal_handle->sector_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->io_handle->bytes_per_sector = bytes_per_sector;
+
+		/* The media size is expressed in the number of bytes per sector
+		 */
+		internal_handle->media_size = internal_handle->number_of_sectors * bytes_per_sector;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
 /* Retrieves the number of sectors
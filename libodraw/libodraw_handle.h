@@ -25,11 +25,20 @@
 #include <common.h>
 #include <types.h>
 
+#include "libodraw_data_file_segment.h"
+#include "libodraw_direct_file.h"
+#include "libodraw_extent_table.h"
 #include "libodraw_extern.h"
 #include "libodraw_io_handle.h"
+#include "libodraw_io_uring.h"
 #include "libodraw_libbfio.h"
 #include "libodraw_libcdata.h"
 #include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+#include "libodraw_mapped_file.h"
+#include "libodraw_readahead.h"
+#include "libodraw_sector_cache.h"
+#include "libodraw_sector_data_buffer.h"
 #include "libodraw_sector_range.h"
 #include "libodraw_track_value.h"
 #include "libodraw_types.h"
@@ -38,6 +47,10 @@
 extern "C" {
 #endif
 
+/* The maximum number of sector data buffers retained in the pool of the handle
+ */
+#define LIBODRAW_HANDLE_MAXIMUM_NUMBER_OF_POOLED_SECTOR_DATA_BUFFERS	8
+
 typedef struct libodraw_internal_handle libodraw_internal_handle_t;
 
 struct libodraw_internal_handle
@@ -46,18 +59,6 @@ struct libodraw_internal_handle
 	 */
 	off64_t current_offset;
 
-	/* The current run-out
-	 */
-	int current_run_out;
-
-	/* The current lead-out
-	 */
-	int current_lead_out;
-
-	/* The current track
-	 */
-	int current_track;
-
 	/* The (storage) media size
 	 */
 	size64_t media_size;
@@ -106,6 +107,93 @@ struct libodraw_internal_handle
 	 */
 	libodraw_io_handle_t *io_handle;
 
+	/* The sector data buffer
+	 */
+	libodraw_sector_data_buffer_t *sector_data_buffer;
+
+	/* The sector data buffers array
+	 * the pool of sector data buffers used by positional reads
+	 */
+	libcdata_array_t *sector_data_buffers_array;
+
+	/* The sector cache size
+	 */
+	size_t sector_cache_size;
+
+	/* The sector cache
+	 */
+	libodraw_sector_cache_t *sector_cache;
+
+	/* The readahead window size
+	 */
+	size_t readahead_window_size;
+
+	/* The readahead
+	 * used by sequential reads from data files that are not memory mapped
+	 */
+	libodraw_readahead_t *readahead;
+
+	/* The extent table
+	 */
+	libodraw_extent_table_t *extent_table;
+
+	/* The sector verification flags
+	 */
+	uint8_t sector_verification_flags;
+
+	/* The error sectors
+	 * sectors that failed verification
+	 */
+	libcdata_range_list_t *error_sectors;
+
+	/* Value to indicate if data files should be memory mapped
+	 */
+	uint8_t memory_map_data_files;
+
+	/* The mapped files array
+	 * contains an entry per data file, which is NULL if the data file is not memory mapped
+	 */
+	libcdata_array_t *mapped_files_array;
+
+	/* Value to indicate if data files should be read using io_uring
+	 */
+	uint8_t use_io_uring;
+
+	/* The io_uring
+	 * used to read data files that are not memory mapped, created on demand
+	 */
+	libodraw_io_uring_t *io_uring;
+
+	/* Value to indicate if data files should be read using direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The direct files array
+	 * contains an entry per data file, which is NULL if the data file is not read using direct IO
+	 */
+	libcdata_array_t *direct_files_array;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The error sectors mutex
+	 * the error sectors can be appended to by concurrent positional reads
+	 */
+	libcthreads_mutex_t *error_sectors_mutex;
+
+	/* The form maps mutex
+	 * the form maps of the tracks are set by concurrent positional reads
+	 */
+	libcthreads_mutex_t *form_maps_mutex;
+
+	/* The sector data buffers mutex
+	 * the pool of sector data buffers is used by concurrent positional reads
+	 */
+	libcthreads_mutex_t *sector_data_buffers_mutex;
+#endif
+
 	/* The table of contents (TOC) file IO handle
 	 */
 	libbfio_handle_t *toc_file_io_handle;
@@ -167,6 +255,22 @@ int libodraw_handle_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_handle_open_buffer(
+     libodraw_handle_t *handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_open_file_io_handle(
+     libodraw_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *toc_data,
+     size_t toc_data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 int libodraw_handle_open_data_files(
      libodraw_handle_t *handle,
@@ -208,6 +312,12 @@ int libodraw_handle_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libodraw_handle_open_read_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 ssize_t libodraw_handle_read_buffer(
          libodraw_handle_t *handle,
@@ -215,26 +325,59 @@ ssize_t libodraw_handle_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+ssize_t libodraw_internal_handle_read_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_buffer_from_extent(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         libodraw_sector_cache_t *sector_cache,
+         libodraw_readahead_t *readahead,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 ssize_t libodraw_handle_read_buffer_from_run_out(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         off64_t offset,
+         int run_out_index,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error );
 
 ssize_t libodraw_handle_read_buffer_from_lead_out(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         off64_t offset,
+         int lead_out_index,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error );
 
 ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         libodraw_readahead_t *readahead,
+         off64_t offset,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error );
 
 ssize_t libodraw_handle_read_buffer_from_track(
          libodraw_internal_handle_t *internal_handle,
+         libodraw_sector_data_buffer_t *sector_data_buffer,
+         libodraw_sector_cache_t *sector_cache,
+         libodraw_readahead_t *readahead,
+         off64_t offset,
+         int track_index,
          uint8_t *buffer,
          size_t buffer_size,
          libcerror_error_t **error );
@@ -247,6 +390,120 @@ ssize_t libodraw_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+int libodraw_internal_handle_grab_sector_data_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_release_sector_data_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_pread_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+ssize_t libodraw_handle_pread_buffer(
+         libodraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libodraw_internal_handle_read_data_file_segments(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_data_file_segment_t *segments,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_read_sectors_vectored(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_sector_vector_t *vectors,
+     int number_of_vectors,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_read_sectors_vectored(
+     libodraw_handle_t *handle,
+     libodraw_sector_vector_t *vectors,
+     int number_of_vectors,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_track_sectors(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_track_value_t *track_value,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint32_t output_bytes_per_sector,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libodraw_internal_handle_set_track_sector_forms(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t start_sector,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_get_track_sector_form_from_map(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t sector,
+     uint64_t maximum_number_of_sectors,
+     uint8_t *form,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_get_track_sector_form(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t sector,
+     uint8_t *form,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_track_sectors_by_form(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_track_value_t *track_value,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint8_t read_mode,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_sectors(
+         libodraw_internal_handle_t *internal_handle,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint8_t read_mode,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+ssize_t libodraw_handle_read_sectors(
+         libodraw_handle_t *handle,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         uint8_t read_mode,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_sector_form(
+     libodraw_handle_t *handle,
+     uint64_t sector,
+     uint8_t *form,
+     libcerror_error_t **error );
+
 off64_t libodraw_internal_handle_seek_offset(
          libodraw_internal_handle_t *internal_handle,
          off64_t offset,
@@ -334,6 +591,182 @@ int libodraw_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_handle_get_cache_size(
+     libodraw_handle_t *handle,
+     size_t *cache_size,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_cache_size(
+     libodraw_handle_t *handle,
+     size_t cache_size,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_cache_statistics(
+     libodraw_handle_t *handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_readahead_window_size(
+     libodraw_handle_t *handle,
+     size_t *window_size,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_readahead_window_size(
+     libodraw_handle_t *handle,
+     size_t window_size,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_sector_verification_flags(
+     libodraw_handle_t *handle,
+     uint8_t *verification_flags,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_sector_verification_flags(
+     libodraw_handle_t *handle,
+     uint8_t verification_flags,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_verify_sector_data(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t start_sector,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_copy_sector_data_to_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_track_value_t *track_value,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t output_bytes_per_sector,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t sector_index,
+         uint32_t sector_offset,
+         libcerror_error_t **error );
+
+int libodraw_internal_handle_append_error_sector(
+     libodraw_internal_handle_t *internal_handle,
+     uint64_t sector,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_number_of_error_sectors(
+     libodraw_handle_t *handle,
+     int *number_of_error_sectors,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_error_sector(
+     libodraw_handle_t *handle,
+     int error_sector_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_memory_map_data_files(
+     libodraw_handle_t *handle,
+     uint8_t *memory_map_data_files,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_memory_map_data_files(
+     libodraw_handle_t *handle,
+     uint8_t memory_map_data_files,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_map_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_get_mapped_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     libodraw_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_use_io_uring(
+     libodraw_handle_t *handle,
+     uint8_t *use_io_uring,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_use_io_uring(
+     libodraw_handle_t *handle,
+     uint8_t use_io_uring,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_set_io_uring_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_use_direct_io(
+     libodraw_handle_t *handle,
+     uint8_t *use_direct_io,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_use_direct_io(
+     libodraw_handle_t *handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_open_direct_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_get_direct_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     libodraw_direct_file_t **direct_file,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_data_file_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         libodraw_readahead_t *readahead,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_sector_pointer(
+     libodraw_handle_t *handle,
+     uint64_t sector,
+     const uint8_t **sector_data,
+     size_t *sector_data_size,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_read_data_file_headers(
+     libodraw_internal_handle_t *internal_handle,
+     int number_of_file_io_handles,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_get_data_file_sector_data_size(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     size64_t *sector_data_size,
+     libcerror_error_t **error );
+
 int libodraw_handle_set_media_values(
      libodraw_internal_handle_t *internal_handle,
      libcerror_error_t **error );
@@ -20,14 +20,17 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libodraw_checksum.h"
 #include "libodraw_definitions.h"
 #include "libodraw_codepage.h"
 #include "libodraw_io_handle.h"
 #include "libodraw_libcerror.h"
 #include "libodraw_libcnotify.h"
+#include "libodraw_sector_extract.h"
 
 #define libodraw_optical_disk_copy_msf_to_lba( minutes, seconds, frames, lba ) \
 	lba  = minutes; \
@@ -201,7 +204,67 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
          uint32_t sector_offset,
          libcerror_error_t **error )
 {
-	static char *function     = "libodraw_io_handle_copy_sector_data_to_buffer";
+	static char *function = "libodraw_io_handle_copy_sector_data_to_buffer";
+	ssize_t copy_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              io_handle,
+	              sector_data,
+	              sector_data_size,
+	              bytes_per_sector,
+	              track_type,
+	              io_handle->bytes_per_sector,
+	              buffer,
+	              buffer_size,
+	              sector_index,
+	              sector_offset,
+	              error );
+
+	if( copy_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( copy_count );
+}
+
+/* Copies the sector data to the buffer in a specific number of bytes per sector
+ * The output bytes per sector of 2352 encodes raw sectors and 2048 extracts the user data
+ * Returns the number of bytes copied if successful or -1 on error
+ */
+ssize_t libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+         libodraw_io_handle_t *io_handle,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t bytes_per_sector,
+         uint8_t track_type,
+         uint32_t output_bytes_per_sector,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t sector_index,
+         uint32_t sector_offset,
+         libcerror_error_t **error )
+{
+	uint8_t raw_sector[ 2352 ];
+
+	static char *function     = "libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size";
 	size_t buffer_offset      = 0;
 	size_t read_size          = 0;
 	size_t sector_data_offset = 0;
@@ -209,6 +272,8 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 
 #if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
 	uint8_t sector_mode       = 0;
+#else
+	size_t number_of_sectors  = 0;
 #endif
 
 	if( io_handle == NULL )
@@ -266,8 +331,19 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 
 		return( -1 );
 	}
+	if( output_bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( (size_t) sector_offset >= sector_data_size )
-	 || ( sector_offset >= io_handle->bytes_per_sector ) )
+	 || ( sector_offset >= output_bytes_per_sector ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -278,12 +354,116 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 
 		return( -1 );
 	}
+#if !defined( HAVE_DEBUG_OUTPUT ) && !defined( HAVE_VERBOSE_OUTPUT )
+	/* Extract whole raw Mode 1 and Mode 2 Form 1 sectors in bulk
+	 * the remaining partial sector is handled by the loop below
+	 */
+	if( ( output_bytes_per_sector == 2048 )
+	 && ( sector_offset == 0 )
+	 && ( ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
+	  ||  ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) ) )
+	{
+		number_of_sectors = sector_data_size / 2352;
+
+		if( number_of_sectors > ( buffer_size / 2048 ) )
+		{
+			number_of_sectors = buffer_size / 2048;
+		}
+		if( number_of_sectors > 0 )
+		{
+			if( libodraw_sector_extract_2352_to_2048(
+			     sector_data,
+			     sector_data_size,
+			     track_type,
+			     buffer,
+			     buffer_size,
+			     number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to extract sector data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset      = number_of_sectors * 2048;
+			sector_data_offset = number_of_sectors * 2352;
+			sector_index      += (uint32_t) number_of_sectors;
+		}
+		if( buffer_offset >= buffer_size )
+		{
+			return( (ssize_t) buffer_offset );
+		}
+	}
+#endif
+	if( output_bytes_per_sector == 2352 )
+	{
+		/* Encode the raw sectors including the synchronisation data, header, EDC and ECC
+		 */
+		while( ( sector_data_offset + bytes_per_sector ) <= sector_data_size )
+		{
+			if( libodraw_io_handle_encode_raw_sector(
+			     io_handle,
+			     &( sector_data[ sector_data_offset ] ),
+			     (size_t) bytes_per_sector,
+			     track_type,
+			     sector_index,
+			     raw_sector,
+			     2352,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to encode raw sector: %" PRIu32 ".",
+				 function,
+				 sector_index );
+
+				return( -1 );
+			}
+			read_size = 2352 - (size_t) sector_offset;
+
+			if( ( read_size + buffer_offset ) > buffer_size )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( raw_sector[ sector_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy raw sector to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset      += read_size;
+			sector_data_offset += bytes_per_sector;
+			sector_offset       = 0;
+
+			if( buffer_offset >= buffer_size )
+			{
+				break;
+			}
+			sector_index++;
+		}
+		return( (ssize_t) buffer_offset );
+	}
 	while( sector_data_offset < sector_data_size )
 	{
-		if( io_handle->bytes_per_sector == 2048 )
+		if( output_bytes_per_sector == 2048 )
 		{
 			if( ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
-			 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2352 ) )
 			{
 				if( ( sector_data_offset + 16 ) >= sector_data_size )
 				{
@@ -375,7 +555,8 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 				}
 				if( ( ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
 				  &&  ( sector_mode != 1 ) )
-				 || ( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+				 || ( ( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+				    ||  ( track_type == LIBODRAW_TRACK_TYPE_CDI_2352 ) )
 				  &&  ( sector_mode != 2 ) ) )
 				{
 					libcnotify_printf(
@@ -390,7 +571,9 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 				sector_data_offset += 16;
 			}
 			if( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
-			 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2336 )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2352 ) )
 			{
 				if( ( sector_data[ sector_data_offset     ] != sector_data[ sector_data_offset + 4 ] )
 				 || ( sector_data[ sector_data_offset + 1 ] != sector_data[ sector_data_offset + 5 ] )
@@ -445,108 +628,7 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 				sector_data_offset += 8;
 			}
 		}
-		else if( io_handle->bytes_per_sector == 2352 )
-		{
-			if( sector_offset == 0 )
-			{
-/* TODO what about run-out and lead-out data (have argument indicate non-track data) */
-				if( ( io_handle->mode == 1 )
-				 || ( io_handle->mode == 2 ) )
-				{
-					read_size = 12;
-
-					if( ( read_size + buffer_offset ) > buffer_size )
-					{
-						read_size = buffer_size - buffer_offset;
-					}
-					if( memory_copy(
-					     &( buffer[ buffer_offset ] ),
-					     libodraw_sector_synchronisation_data,
-					     read_size ) != 0 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-						 "%s: unsupported copy sector synchronisation data to buffer.",
-						 function );
-
-						return( -1 );
-					}
-					buffer_offset += read_size;
-
-					if( buffer_offset >= buffer_size )
-					{
-						break;
-					}
-/* TODO set MSF requires current sector */
-					buffer[ buffer_offset++ ] = 0;
-
-					if( buffer_offset >= buffer_size )
-					{
-						break;
-					}
-					buffer[ buffer_offset++ ] = 0;
-
-					if( buffer_offset >= buffer_size )
-					{
-						break;
-					}
-					buffer[ buffer_offset++ ] = 0;
-
-					if( buffer_offset >= buffer_size )
-					{
-						break;
-					}
-					if( io_handle->mode == 1 )
-					{
-						buffer[ buffer_offset++ ] = 1;
-					}
-					else if ( io_handle->mode == 2 )
-					{
-						buffer[ buffer_offset++ ] = 2;
-					}
-					if( buffer_offset >= buffer_size )
-					{
-						break;
-					}
-				}
-				else
-				{
-					read_size = 16;
-
-					if( ( read_size + buffer_offset ) > buffer_size )
-					{
-						read_size = buffer_size - buffer_offset;
-					}
-					if( memory_set(
-					     &( buffer[ buffer_offset ] ),
-					     0,
-					     read_size ) == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-						 "%s: unable to set sector data in buffer.",
-						 function );
-
-						return( -1 );
-					}
-					buffer_offset += read_size;
-
-					if( buffer_offset >= buffer_size )
-					{
-						break;
-					}
-				}
-				if( io_handle->mode == 2 )
-				{
-/* TODO what about XA sub-header */
-				}
-			}
-		}
-		read_size = io_handle->bytes_per_sector;
+		read_size = output_bytes_per_sector;
 
 		if( sector_offset != 0 )
 		{
@@ -558,8 +640,7 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 		{
 			read_size = buffer_size - buffer_offset;
 		}
-		if( ( track_type == LIBODRAW_TRACK_TYPE_AUDIO )
-		 && ( io_handle->bytes_per_sector != 2352 ) )
+		if( track_type == LIBODRAW_TRACK_TYPE_AUDIO )
 		{
 			/* If the sector size is not 2352 just return 0 bytes
 			 * for audio data
@@ -603,7 +684,7 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 		{
 			break;
 		}
-		if( io_handle->bytes_per_sector == 2048 )
+		if( output_bytes_per_sector == 2048 )
 		{
 			if( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
 			{
@@ -617,7 +698,9 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 				sector_data_offset += 276;
 			}
 			else if( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
-			      || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+			      || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+			      || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2336 )
+			      || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2352 ) )
 			{
 /* TODO calculate checksum, what about read errors ?*/
 				sector_data_offset += 4;
@@ -629,133 +712,711 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 			{
 				sector_data_offset += 288;
 			}
+			else if( bytes_per_sector > 2048 )
+			{
+				/* Skip the remainder of the sector, such as the 276 bytes of Form 2 user data
+				 * of a Mode 2 (2324) sector that follow the first 2048 bytes
+				 */
+				sector_data_offset += bytes_per_sector - 2048;
+			}
 		}
-		else if( io_handle->bytes_per_sector == 2352 )
+		sector_index++;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+
+/* Verifies the error detection code (EDC) and error correction code (ECC) of a raw sector
+ * Only Mode 1 and Mode 2 sectors with 2352 or 2336 bytes per sector contain an EDC and ECC,
+ * other track types are considered valid
+ * Returns 1 if the sector data is valid, 0 if not or -1 on error
+ */
+int libodraw_io_handle_verify_sector_data(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint8_t track_type,
+     uint8_t verification_flags,
+     libcerror_error_t **error )
+{
+	uint8_t ecc_data[ 4 + 2336 ];
+	uint8_t parity[ LIBODRAW_CHECKSUM_ECC_P_SIZE ];
+
+	const uint8_t *sub_header_data = NULL;
+	static char *function          = "libodraw_io_handle_verify_sector_data";
+	size_t edc_data_size           = 0;
+	size_t required_data_size      = 0;
+	uint32_t calculated_edc        = 0;
+	uint32_t stored_edc            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_MODE1_2352:
+		case LIBODRAW_TRACK_TYPE_MODE2_2352:
+		case LIBODRAW_TRACK_TYPE_CDI_2352:
+			required_data_size = 2352;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+			required_data_size = 2336;
+			break;
+
+		default:
+			return( 1 );
+	}
+	if( sector_data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sector data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
+	{
+		if( ( verification_flags & LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC ) != 0 )
 		{
-/* TODO what about run-out and lead-out data (have argument indicate non-track data) */
-			if( ( io_handle->mode == 1 )
-			 || ( io_handle->mode == 2 ) )
+			/* The EDC covers the synchronisation data, header and user data
+			 */
+			if( libodraw_checksum_calculate_edc(
+			     &calculated_edc,
+			     sector_data,
+			     2064,
+			     0,
+			     error ) != 1 )
 			{
-				read_size = 4;
-
-				if( ( read_size + buffer_offset ) > buffer_size )
-				{
-					read_size = buffer_size - buffer_offset;
-				}
-/* TODO determine missing data instead of 0 fill */
-				if( memory_set(
-				     &( buffer[ buffer_offset ] ),
-				     0,
-				     read_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set sector checksum in buffer.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate EDC.",
+				 function );
 
-					return( -1 );
-				}
-				buffer_offset += read_size;
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( sector_data[ 2064 ] ),
+			 stored_edc );
 
-				if( buffer_offset >= buffer_size )
-				{
-					break;
-				}
+			if( stored_edc != calculated_edc )
+			{
+				return( 0 );
 			}
-			if( io_handle->mode == 1 )
+		}
+		if( ( verification_flags & LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC ) != 0 )
+		{
+			/* The ECC covers the header, user data, EDC and intermediate data
+			 */
+			if( libodraw_checksum_calculate_ecc_p(
+			     &( sector_data[ 12 ] ),
+			     LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+			     parity,
+			     LIBODRAW_CHECKSUM_ECC_P_SIZE,
+			     error ) != 1 )
 			{
-				read_size = 8;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate ECC P parity.",
+				 function );
 
-				if( ( read_size + buffer_offset ) > buffer_size )
-				{
-					read_size = buffer_size - buffer_offset;
-				}
-				if( memory_set(
-				     &( buffer[ buffer_offset ] ),
-				     0,
-				     read_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set sector reserved in buffer.",
-					 function );
+				return( -1 );
+			}
+			if( memory_compare(
+			     parity,
+			     &( sector_data[ 12 + LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE ] ),
+			     LIBODRAW_CHECKSUM_ECC_P_SIZE ) != 0 )
+			{
+				return( 0 );
+			}
+			if( libodraw_checksum_calculate_ecc_q(
+			     &( sector_data[ 12 ] ),
+			     LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE,
+			     parity,
+			     LIBODRAW_CHECKSUM_ECC_Q_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate ECC Q parity.",
+				 function );
 
-					return( -1 );
-				}
-				buffer_offset += read_size;
+				return( -1 );
+			}
+			if( memory_compare(
+			     parity,
+			     &( sector_data[ 12 + LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE ] ),
+			     LIBODRAW_CHECKSUM_ECC_Q_SIZE ) != 0 )
+			{
+				return( 0 );
+			}
+		}
+		return( 1 );
+	}
+	if( required_data_size == 2352 )
+	{
+		sub_header_data = &( sector_data[ 16 ] );
+	}
+	else
+	{
+		sub_header_data = sector_data;
+	}
+	/* Form 2 sectors have 2324 bytes of user data and no ECC
+	 */
+	if( ( sub_header_data[ 2 ] & 0x20 ) != 0 )
+	{
+		edc_data_size = 8 + 2324;
+	}
+	else
+	{
+		edc_data_size = 8 + 2048;
+	}
+	if( ( verification_flags & LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( sub_header_data[ edc_data_size ] ),
+		 stored_edc );
+
+		/* The EDC of a Form 2 sector is optional and 0 if not set
+		 */
+		if( ( edc_data_size == ( 8 + 2048 ) )
+		 || ( stored_edc != 0 ) )
+		{
+			/* The EDC covers the XA sub-header and user data
+			 */
+			if( libodraw_checksum_calculate_edc(
+			     &calculated_edc,
+			     sub_header_data,
+			     edc_data_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate EDC.",
+				 function );
 
-				if( buffer_offset >= buffer_size )
-				{
-					break;
-				}
+				return( -1 );
 			}
-			if( ( io_handle->mode == 1 )
-			 || ( io_handle->mode == 2 ) )
+			if( stored_edc != calculated_edc )
 			{
-				read_size = 276;
+				return( 0 );
+			}
+		}
+	}
+	if( ( ( verification_flags & LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC ) != 0 )
+	 && ( edc_data_size == ( 8 + 2048 ) ) )
+	{
+		/* The ECC of a Mode 2 sector is calculated with the header set to 0
+		 */
+		if( memory_set(
+		     ecc_data,
+		     0,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear ECC data header.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( ecc_data[ 4 ] ),
+		     sub_header_data,
+		     2336 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy ECC data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libodraw_checksum_calculate_ecc_p(
+		     ecc_data,
+		     LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+		     parity,
+		     LIBODRAW_CHECKSUM_ECC_P_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate ECC P parity.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     parity,
+		     &( ecc_data[ LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE ] ),
+		     LIBODRAW_CHECKSUM_ECC_P_SIZE ) != 0 )
+		{
+			return( 0 );
+		}
+		if( libodraw_checksum_calculate_ecc_q(
+		     ecc_data,
+		     LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE,
+		     parity,
+		     LIBODRAW_CHECKSUM_ECC_Q_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate ECC Q parity.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     parity,
+		     &( ecc_data[ LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE ] ),
+		     LIBODRAW_CHECKSUM_ECC_Q_SIZE ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
 
-				if( ( read_size + buffer_offset ) > buffer_size )
-				{
-					read_size = buffer_size - buffer_offset;
-				}
-/* TODO determine missing data instead of 0 fill */
-				if( memory_set(
-				     &( buffer[ buffer_offset ] ),
-				     0,
-				     read_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set sector error correction data in buffer.",
-					 function );
+/* Encodes a raw sector of 2352 bytes from the sector data of a track
+ * The synchronisation data, header, XA sub-header, EDC and ECC are generated for
+ * Mode 1 and Mode 2 tracks with 2048 or 2324 bytes per sector, a Mode 2 track with 2336
+ * bytes per sector already contains the XA sub-header, EDC and ECC.
+ * The sector data of other track types is stored after a zero filled header
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_io_handle_encode_raw_sector(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *raw_sector,
+     size_t raw_sector_size,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 4 ];
 
-					return( -1 );
-				}
-				buffer_offset += read_size;
+	static char *function   = "libodraw_io_handle_encode_raw_sector";
+	size_t user_data_size   = 0;
+	uint32_t calculated_edc = 0;
+	uint32_t frames         = 0;
+	uint8_t sector_mode     = 0;
+	uint8_t sub_mode        = 0;
 
-				if( buffer_offset >= buffer_size )
-				{
-					break;
-				}
-			}
-			else
-			{
-				read_size = 288;
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-				if( ( read_size + buffer_offset ) > buffer_size )
-				{
-					read_size = buffer_size - buffer_offset;
-				}
-				if( memory_set(
-				     &( buffer[ buffer_offset ] ),
-				     0,
-				     read_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to set sector data in buffer.",
-					 function );
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
 
-					return( -1 );
-				}
-				buffer_offset += read_size;
+		return( -1 );
+	}
+	if( raw_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw sector.",
+		 function );
 
-				if( buffer_offset >= buffer_size )
-				{
-					break;
-				}
+		return( -1 );
+	}
+	if( raw_sector_size < 2352 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid raw sector size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_MODE1_2048:
+			sector_mode    = 1;
+			user_data_size = 2048;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2048:
+			sector_mode    = 2;
+			sub_mode       = 0x08;
+			user_data_size = 2048;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2324:
+			sector_mode    = 2;
+			sub_mode       = 0x20;
+			user_data_size = 2324;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+			sector_mode    = 2;
+			user_data_size = 2336;
+			break;
+
+		default:
+			break;
+	}
+	if( sector_data_size < user_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sector data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_mode == 0 )
+	{
+		/* A sector of 2352 bytes or more, such as a sector with sub-channel data, already is a raw sector
+		 */
+		if( sector_data_size >= 2352 )
+		{
+			if( memory_copy(
+			     raw_sector,
+			     sector_data,
+			     2352 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to raw sector.",
+				 function );
+
+				return( -1 );
 			}
+			return( 1 );
 		}
-		sector_index++;
+		if( memory_set(
+		     raw_sector,
+		     0,
+		     2352 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear raw sector.",
+			 function );
+
+			return( -1 );
+		}
+		if( sector_data_size > ( 2352 - 16 ) )
+		{
+			sector_data_size = 2352 - 16;
+		}
+		if( memory_copy(
+		     &( raw_sector[ 16 ] ),
+		     sector_data,
+		     sector_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to raw sector.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
-	return( (ssize_t) buffer_offset );
+	if( memory_copy(
+	     raw_sector,
+	     libodraw_sector_synchronisation_data,
+	     12 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy synchronisation data to raw sector.",
+		 function );
+
+		return( -1 );
+	}
+	/* The header contains the address as binary coded decimal MSF
+	 * where the first sector of the media is at 00:02:00
+	 */
+	frames = sector_index + 150;
+
+	raw_sector[ 12 ] = (uint8_t) ( ( ( ( frames / 4500 ) / 10 ) << 4 ) | ( ( frames / 4500 ) % 10 ) );
+	raw_sector[ 13 ] = (uint8_t) ( ( ( ( ( frames / 75 ) % 60 ) / 10 ) << 4 ) | ( ( ( frames / 75 ) % 60 ) % 10 ) );
+	raw_sector[ 14 ] = (uint8_t) ( ( ( ( frames % 75 ) / 10 ) << 4 ) | ( ( frames % 75 ) % 10 ) );
+	raw_sector[ 15 ] = sector_mode;
+
+	if( sector_mode == 1 )
+	{
+		if( memory_copy(
+		     &( raw_sector[ 16 ] ),
+		     sector_data,
+		     2048 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to raw sector.",
+			 function );
+
+			return( -1 );
+		}
+		/* The EDC covers the synchronisation data, header and user data
+		 */
+		if( libodraw_checksum_calculate_edc(
+		     &calculated_edc,
+		     raw_sector,
+		     2064,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate EDC.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( raw_sector[ 2064 ] ),
+		 calculated_edc );
+
+		if( memory_set(
+		     &( raw_sector[ 2068 ] ),
+		     0,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear intermediate data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( user_data_size == 2336 )
+	{
+		if( memory_copy(
+		     &( raw_sector[ 16 ] ),
+		     sector_data,
+		     2336 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to raw sector.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	else
+	{
+		/* The XA sub-header contains the file number, channel number, sub-mode and coding
+		 * information, which are stored twice
+		 */
+		raw_sector[ 16 ] = 0;
+		raw_sector[ 17 ] = 0;
+		raw_sector[ 18 ] = sub_mode;
+		raw_sector[ 19 ] = 0;
+		raw_sector[ 20 ] = 0;
+		raw_sector[ 21 ] = 0;
+		raw_sector[ 22 ] = sub_mode;
+		raw_sector[ 23 ] = 0;
+
+		if( memory_copy(
+		     &( raw_sector[ 24 ] ),
+		     sector_data,
+		     user_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to raw sector.",
+			 function );
+
+			return( -1 );
+		}
+		/* The EDC covers the XA sub-header and user data
+		 */
+		if( libodraw_checksum_calculate_edc(
+		     &calculated_edc,
+		     &( raw_sector[ 16 ] ),
+		     8 + user_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate EDC.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( raw_sector[ 24 + user_data_size ] ),
+		 calculated_edc );
+
+		/* Form 2 sectors have no ECC
+		 */
+		if( sub_mode == 0x20 )
+		{
+			return( 1 );
+		}
+		/* The ECC of a Mode 2 sector is calculated with the header set to 0
+		 */
+		if( memory_copy(
+		     header_data,
+		     &( raw_sector[ 12 ] ),
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy header data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     &( raw_sector[ 12 ] ),
+		     0,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear header data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The P parity is stored directly after the data it covers and
+	 * the Q parity covers the P parity
+	 */
+	if( libodraw_checksum_calculate_ecc_p(
+	     &( raw_sector[ 12 ] ),
+	     LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+	     &( raw_sector[ 12 + LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE ] ),
+	     LIBODRAW_CHECKSUM_ECC_P_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate ECC P parity.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_checksum_calculate_ecc_q(
+	     &( raw_sector[ 12 ] ),
+	     LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE,
+	     &( raw_sector[ 12 + LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE ] ),
+	     LIBODRAW_CHECKSUM_ECC_Q_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate ECC Q parity.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_mode == 2 )
+	{
+		if( memory_copy(
+		     &( raw_sector[ 12 ] ),
+		     header_data,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to restore header data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
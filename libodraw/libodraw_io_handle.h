@@ -76,6 +76,37 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
          uint32_t sector_offset,
          libcerror_error_t **error );
 
+ssize_t libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+         libodraw_io_handle_t *io_handle,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t bytes_per_sector,
+         uint8_t track_type,
+         uint32_t output_bytes_per_sector,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t sector_index,
+         uint32_t sector_offset,
+         libcerror_error_t **error );
+
+int libodraw_io_handle_encode_raw_sector(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *raw_sector,
+     size_t raw_sector_size,
+     libcerror_error_t **error );
+
+int libodraw_io_handle_verify_sector_data(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint8_t track_type,
+     uint8_t verification_flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1246 @@
+/*
+ * Asynchronous IO using the Linux io_uring interface
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_SYSCALL_H )
+#include <sys/syscall.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
+#if defined( HAVE_LINUX_IO_URING_H )
+#include <linux/io_uring.h>
+#endif
+
+#include "libodraw_io_uring.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+/* The io_uring system calls are used directly, without liburing
+ */
+#if defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYSCALL ) && defined( __NR_io_uring_setup ) && defined( __NR_io_uring_enter ) && defined( __NR_io_uring_register )
+#define LIBODRAW_IO_URING_HAVE_IO_URING
+#endif
+
+/* Creates an io_uring
+ * Make sure the value io_uring is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_io_uring_initialize(
+     libodraw_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_io_uring_initialize";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_uring = memory_allocate_structure(
+	             libodraw_io_uring_t );
+
+	if( *io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_uring,
+	     0,
+	     sizeof( libodraw_io_uring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring.",
+		 function );
+
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+
+		return( -1 );
+	}
+	( *io_uring )->ring_file_descriptor = -1;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_uring )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_uring != NULL )
+	{
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an io_uring
+ * Closes the ring and the files if still open
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_io_uring_free(
+     libodraw_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_io_uring_free";
+	int result            = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		if( libodraw_io_uring_close(
+		     *io_uring,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close io_uring.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *io_uring )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+	}
+	return( result );
+}
+
+/* Opens an io_uring
+ * Sets up a ring of queue depth entries and registers a fixed buffer of buffer size per entry
+ * Returns 1 if successful, 0 if io_uring is not supported or -1 on error
+ */
+int libodraw_io_uring_open(
+     libodraw_io_uring_t *io_uring,
+     int queue_depth,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+#if defined( LIBODRAW_IO_URING_HAVE_IO_URING )
+	struct io_uring_params parameters;
+
+	struct iovec *buffer_vectors = NULL;
+	void *data                   = NULL;
+	int ring_file_descriptor     = -1;
+	int slot_index               = 0;
+	int result                   = 0;
+#endif
+	static char *function        = "libodraw_io_uring_open";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->ring_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring - ring file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth <= 0 )
+	 || ( queue_depth > 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) UINT32_MAX )
+	 || ( buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / (size_t) queue_depth ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_IO_URING_HAVE_IO_URING )
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	ring_file_descriptor = (int) syscall(
+	                              __NR_io_uring_setup,
+	                              (unsigned int) queue_depth,
+	                              &parameters );
+
+	if( ring_file_descriptor < 0 )
+	{
+		/* The kernel does not support io_uring or its use is not permitted,
+		 * for example by a seccomp filter
+		 */
+		if( ( errno == ENOSYS )
+		 || ( errno == EPERM )
+		 || ( errno == EACCES )
+		 || ( errno == EINVAL ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to set up ring.",
+		 function );
+
+		return( -1 );
+	}
+	io_uring->ring_file_descriptor = ring_file_descriptor;
+
+	io_uring->submission_queue_ring_size = (size_t) parameters.sq_off.array
+	                                     + ( (size_t) parameters.sq_entries * sizeof( uint32_t ) );
+
+	io_uring->completion_queue_ring_size = (size_t) parameters.cq_off.cqes
+	                                     + ( (size_t) parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	/* Kernels that map both rings in one use the largest of the two sizes
+	 */
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( io_uring->completion_queue_ring_size > io_uring->submission_queue_ring_size )
+		{
+			io_uring->submission_queue_ring_size = io_uring->completion_queue_ring_size;
+		}
+		io_uring->completion_queue_ring_size = io_uring->submission_queue_ring_size;
+	}
+	data = mmap(
+	        NULL,
+	        io_uring->submission_queue_ring_size,
+	        PROT_READ | PROT_WRITE,
+	        MAP_SHARED | MAP_POPULATE,
+	        ring_file_descriptor,
+	        IORING_OFF_SQ_RING );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		goto on_error;
+	}
+	io_uring->submission_queue_ring = (uint8_t *) data;
+
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		io_uring->completion_queue_ring = io_uring->submission_queue_ring;
+	}
+	else
+	{
+		data = mmap(
+		        NULL,
+		        io_uring->completion_queue_ring_size,
+		        PROT_READ | PROT_WRITE,
+		        MAP_SHARED | MAP_POPULATE,
+		        ring_file_descriptor,
+		        IORING_OFF_CQ_RING );
+
+		if( data == MAP_FAILED )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to map completion queue ring.",
+			 function );
+
+			goto on_error;
+		}
+		io_uring->completion_queue_ring = (uint8_t *) data;
+	}
+	io_uring->submission_queue_entries_size = (size_t) parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	data = mmap(
+	        NULL,
+	        io_uring->submission_queue_entries_size,
+	        PROT_READ | PROT_WRITE,
+	        MAP_SHARED | MAP_POPULATE,
+	        ring_file_descriptor,
+	        IORING_OFF_SQES );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		goto on_error;
+	}
+	io_uring->submission_queue_entries = data;
+
+	io_uring->submission_queue_head      = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.head ] );
+	io_uring->submission_queue_tail      = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.tail ] );
+	io_uring->submission_queue_ring_mask = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.ring_mask ] );
+	io_uring->submission_queue_array     = (uint32_t *) &( io_uring->submission_queue_ring[ parameters.sq_off.array ] );
+
+	io_uring->completion_queue_head      = (uint32_t *) &( io_uring->completion_queue_ring[ parameters.cq_off.head ] );
+	io_uring->completion_queue_tail      = (uint32_t *) &( io_uring->completion_queue_ring[ parameters.cq_off.tail ] );
+	io_uring->completion_queue_ring_mask = (uint32_t *) &( io_uring->completion_queue_ring[ parameters.cq_off.ring_mask ] );
+	io_uring->completion_queue_entries   = (void *) &( io_uring->completion_queue_ring[ parameters.cq_off.cqes ] );
+
+	/* The kernel can round up the number of entries but not down
+	 */
+	if( (unsigned int) queue_depth > parameters.sq_entries )
+	{
+		queue_depth = (int) parameters.sq_entries;
+	}
+	io_uring->queue_depth = queue_depth;
+	io_uring->buffer_size = buffer_size;
+
+	io_uring->buffers = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * buffer_size * (size_t) queue_depth );
+
+	if( io_uring->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	io_uring->slots = (libodraw_io_uring_slot_t *) memory_allocate(
+	                                                sizeof( libodraw_io_uring_slot_t ) * (size_t) queue_depth );
+
+	if( io_uring->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     io_uring->slots,
+	     0,
+	     sizeof( libodraw_io_uring_slot_t ) * (size_t) queue_depth ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	buffer_vectors = (struct iovec *) memory_allocate(
+	                                   sizeof( struct iovec ) * (size_t) queue_depth );
+
+	if( buffer_vectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer vectors.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < queue_depth;
+	     slot_index++ )
+	{
+		buffer_vectors[ slot_index ].iov_base = (void *) &( io_uring->buffers[ (size_t) slot_index * buffer_size ] );
+		buffer_vectors[ slot_index ].iov_len  = buffer_size;
+	}
+	/* Registering the buffers pins them in memory which can fail
+	 * due to the locked memory limit, in which case io_uring is not used
+	 */
+	result = (int) syscall(
+	                __NR_io_uring_register,
+	                ring_file_descriptor,
+	                IORING_REGISTER_BUFFERS,
+	                buffer_vectors,
+	                (unsigned int) queue_depth );
+
+	memory_free(
+	 buffer_vectors );
+
+	buffer_vectors = NULL;
+
+	if( result != 0 )
+	{
+		libodraw_io_uring_close(
+		 io_uring,
+		 NULL );
+
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( buffer_vectors != NULL )
+	{
+		memory_free(
+		 buffer_vectors );
+	}
+	libodraw_io_uring_close(
+	 io_uring,
+	 NULL );
+
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( LIBODRAW_IO_URING_HAVE_IO_URING ) */
+}
+
+/* Closes an io_uring
+ * Closes the files that were set and tears down the ring
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_io_uring_close(
+     libodraw_io_uring_t *io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_io_uring_close";
+	int file_index        = 0;
+	int result            = 0;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->file_descriptors != NULL )
+	{
+		for( file_index = 0;
+		     file_index < io_uring->number_of_file_descriptors;
+		     file_index++ )
+		{
+			if( io_uring->file_descriptors[ file_index ] != -1 )
+			{
+				if( close(
+				     io_uring->file_descriptors[ file_index ] ) != 0 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 (uint32_t) errno,
+					 "%s: unable to close file: %d.",
+					 function,
+					 file_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 io_uring->file_descriptors );
+
+		io_uring->file_descriptors = NULL;
+	}
+	io_uring->number_of_file_descriptors = 0;
+
+#if defined( LIBODRAW_IO_URING_HAVE_IO_URING )
+	if( io_uring->submission_queue_entries != NULL )
+	{
+		munmap(
+		 io_uring->submission_queue_entries,
+		 io_uring->submission_queue_entries_size );
+
+		io_uring->submission_queue_entries = NULL;
+	}
+	if( ( io_uring->completion_queue_ring != NULL )
+	 && ( io_uring->completion_queue_ring != io_uring->submission_queue_ring ) )
+	{
+		munmap(
+		 io_uring->completion_queue_ring,
+		 io_uring->completion_queue_ring_size );
+	}
+	io_uring->completion_queue_ring = NULL;
+
+	if( io_uring->submission_queue_ring != NULL )
+	{
+		munmap(
+		 io_uring->submission_queue_ring,
+		 io_uring->submission_queue_ring_size );
+
+		io_uring->submission_queue_ring = NULL;
+	}
+#endif
+	/* Closing the ring file descriptor also unregisters the buffers
+	 */
+	if( io_uring->ring_file_descriptor != -1 )
+	{
+		if( close(
+		     io_uring->ring_file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to close ring.",
+			 function );
+
+			result = -1;
+		}
+		io_uring->ring_file_descriptor = -1;
+	}
+	if( io_uring->slots != NULL )
+	{
+		memory_free(
+		 io_uring->slots );
+
+		io_uring->slots = NULL;
+	}
+	if( io_uring->buffers != NULL )
+	{
+		memory_free(
+		 io_uring->buffers );
+
+		io_uring->buffers = NULL;
+	}
+	io_uring->queue_depth = 0;
+	io_uring->buffer_size = 0;
+
+	return( result );
+}
+
+/* Determines if the io_uring is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libodraw_io_uring_is_open(
+     libodraw_io_uring_t *io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_io_uring_is_open";
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->ring_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Opens a file to be read using the ring
+ * Returns 1 if successful, 0 if the ring is not open or -1 on error
+ */
+int libodraw_io_uring_set_file(
+     libodraw_io_uring_t *io_uring,
+     int file_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	int *file_descriptors          = NULL;
+	static char *function          = "libodraw_io_uring_set_file";
+	int number_of_file_descriptors = 0;
+	int result                     = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( (size_t) file_index >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_uring->ring_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_uring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( file_index >= io_uring->number_of_file_descriptors )
+	{
+		number_of_file_descriptors = file_index + 1;
+
+		file_descriptors = (int *) memory_reallocate(
+		                            io_uring->file_descriptors,
+		                            sizeof( int ) * (size_t) number_of_file_descriptors );
+
+		if( file_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize file descriptors.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			while( io_uring->number_of_file_descriptors < number_of_file_descriptors )
+			{
+				file_descriptors[ io_uring->number_of_file_descriptors ] = -1;
+
+				io_uring->number_of_file_descriptors += 1;
+			}
+			io_uring->file_descriptors = file_descriptors;
+		}
+	}
+	if( result == 1 )
+	{
+		if( io_uring->file_descriptors[ file_index ] != -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid io_uring - file descriptor: %d value already set.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		io_uring->file_descriptors[ file_index ] = open(
+		                                            filename,
+		                                            O_RDONLY );
+
+		if( io_uring->file_descriptors[ file_index ] == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 filename );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_uring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( LIBODRAW_IO_URING_HAVE_IO_URING )
+
+/* Queues a fixed buffer read of a slot in the submission queue
+ * The caller is responsible for ensuring there is room in the submission queue
+ */
+static void libodraw_io_uring_queue_read(
+             libodraw_io_uring_t *io_uring,
+             int slot_index,
+             int file_descriptor,
+             off64_t offset )
+{
+	struct io_uring_sqe *submission_queue_entry = NULL;
+	uint32_t entry_index                        = 0;
+	uint32_t tail                               = 0;
+
+	tail        = *( io_uring->submission_queue_tail );
+	entry_index = tail & *( io_uring->submission_queue_ring_mask );
+
+	submission_queue_entry = &( ( (struct io_uring_sqe *) io_uring->submission_queue_entries )[ entry_index ] );
+
+	memory_set(
+	 submission_queue_entry,
+	 0,
+	 sizeof( struct io_uring_sqe ) );
+
+	submission_queue_entry->opcode    = IORING_OP_READ_FIXED;
+	submission_queue_entry->fd        = file_descriptor;
+	submission_queue_entry->off       = (uint64_t) offset;
+	submission_queue_entry->addr      = (uint64_t) (uintptr_t) &( io_uring->buffers[ (size_t) slot_index * io_uring->buffer_size ] );
+	submission_queue_entry->len       = (uint32_t) io_uring->slots[ slot_index ].size;
+	submission_queue_entry->buf_index = (uint16_t) slot_index;
+	submission_queue_entry->user_data = (uint64_t) slot_index;
+
+	io_uring->submission_queue_array[ entry_index ] = entry_index;
+
+	/* The entry must be visible to the kernel before the tail is updated
+	 */
+	__atomic_store_n(
+	 io_uring->submission_queue_tail,
+	 tail + 1,
+	 __ATOMIC_RELEASE );
+}
+
+#endif /* defined( LIBODRAW_IO_URING_HAVE_IO_URING ) */
+
+/* Reads requests using the ring
+ * The requests are split into reads of at most the buffer size, up to queue depth reads
+ * are kept in flight at a time, which can be for different files
+ * The read size of each request is set to the number of bytes read
+ * Returns 1 if successful, 0 if the ring is not open or a file is not read using the ring or -1 on error
+ */
+int libodraw_io_uring_read_requests(
+     libodraw_io_uring_t *io_uring,
+     libodraw_io_uring_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error )
+{
+#if defined( LIBODRAW_IO_URING_HAVE_IO_URING )
+	struct io_uring_cqe *completion_queue_entry = NULL;
+	libodraw_io_uring_request_t *request        = NULL;
+	libodraw_io_uring_slot_t *slot              = NULL;
+	size_t read_size                            = 0;
+	size_t request_offset                       = 0;
+	uint32_t head                               = 0;
+	uint32_t tail                               = 0;
+	int completion_result                       = 0;
+	int completion_error                        = 0;
+	int file_descriptor                         = 0;
+	int number_of_reads_in_flight               = 0;
+	int number_of_reads_to_submit               = 0;
+	int request_index                           = 0;
+	int slot_index                              = 0;
+	int submit_result                           = 0;
+#endif
+	static char *function                       = "libodraw_io_uring_read_requests";
+	int result                                  = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of requests value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_IO_URING_HAVE_IO_URING )
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		request = &( requests[ request_index ] );
+
+		if( ( request->buffer == NULL )
+		 && ( request->size > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid request: %d - missing buffer.",
+			 function,
+			 request_index );
+
+			return( -1 );
+		}
+		if( ( request->size > (size_t) SSIZE_MAX )
+		 || ( request->offset < 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid request: %d - size or offset value out of bounds.",
+			 function,
+			 request_index );
+
+			return( -1 );
+		}
+		/* The read size is reduced when the end of the file is reached
+		 */
+		request->read_size = request->size;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_uring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The ring is closed if a previous read left it in an unknown state,
+	 * the caller then reads the data by other means
+	 */
+	if( io_uring->ring_file_descriptor == -1 )
+	{
+		result = 0;
+	}
+	for( request_index = 0;
+	     ( result == 1 ) && ( request_index < number_of_requests );
+	     request_index++ )
+	{
+		request = &( requests[ request_index ] );
+
+		if( ( request->file_index < 0 )
+		 || ( request->file_index >= io_uring->number_of_file_descriptors ) )
+		{
+			result = 0;
+		}
+		else if( io_uring->file_descriptors[ request->file_index ] == -1 )
+		{
+			result = 0;
+		}
+	}
+	request_index  = 0;
+	request_offset = 0;
+
+	do
+	{
+		/* Fill the free slots with the next parts of the requests
+		 */
+		slot_index = 0;
+
+		while( ( result == 1 )
+		    && ( request_index < number_of_requests )
+		    && ( number_of_reads_in_flight < io_uring->queue_depth ) )
+		{
+			request = &( requests[ request_index ] );
+
+			if( ( request_offset >= request->size )
+			 || ( request_offset >= request->read_size ) )
+			{
+				request_index += 1;
+				request_offset = 0;
+
+				continue;
+			}
+			while( io_uring->slots[ slot_index ].in_use != 0 )
+			{
+				slot_index++;
+			}
+			read_size = request->size - request_offset;
+
+			if( read_size > io_uring->buffer_size )
+			{
+				read_size = io_uring->buffer_size;
+			}
+			slot = &( io_uring->slots[ slot_index ] );
+
+			slot->request_index  = request_index;
+			slot->request_offset = request_offset;
+			slot->size           = read_size;
+			slot->in_use         = 1;
+
+			libodraw_io_uring_queue_read(
+			 io_uring,
+			 slot_index,
+			 io_uring->file_descriptors[ request->file_index ],
+			 request->offset + (off64_t) request_offset );
+
+			request_offset += read_size;
+
+			number_of_reads_in_flight++;
+			number_of_reads_to_submit++;
+		}
+		if( number_of_reads_in_flight == 0 )
+		{
+			break;
+		}
+		/* Submit the queued reads and wait for at least one to complete
+		 */
+		do
+		{
+			submit_result = (int) syscall(
+			                       __NR_io_uring_enter,
+			                       io_uring->ring_file_descriptor,
+			                       (unsigned int) number_of_reads_to_submit,
+			                       1,
+			                       IORING_ENTER_GETEVENTS,
+			                       NULL,
+			                       0 );
+		}
+		while( ( submit_result < 0 )
+		    && ( errno == EINTR ) );
+
+		if( submit_result < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to submit reads.",
+			 function );
+
+			/* The state of the reads in flight is unknown hence the ring
+			 * can no longer be used
+			 */
+			result = -1;
+
+			break;
+		}
+		number_of_reads_to_submit -= submit_result;
+
+		/* Process the completed reads
+		 */
+		head = *( io_uring->completion_queue_head );
+		tail = __atomic_load_n(
+		        io_uring->completion_queue_tail,
+		        __ATOMIC_ACQUIRE );
+
+		while( head != tail )
+		{
+			completion_queue_entry = &( ( (struct io_uring_cqe *) io_uring->completion_queue_entries )[ head & *( io_uring->completion_queue_ring_mask ) ] );
+
+			slot_index        = (int) completion_queue_entry->user_data;
+			completion_result = completion_queue_entry->res;
+
+			head++;
+
+			slot    = &( io_uring->slots[ slot_index ] );
+			request = &( requests[ slot->request_index ] );
+
+			if( completion_result < 0 )
+			{
+				if( result == 1 )
+				{
+					completion_error = -completion_result;
+
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 (uint32_t) completion_error,
+					 "%s: unable to read request: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 slot->request_index,
+					 request->offset + (off64_t) slot->request_offset,
+					 request->offset + (off64_t) slot->request_offset );
+
+					result = -1;
+				}
+				slot->in_use = 0;
+
+				number_of_reads_in_flight--;
+			}
+			else if( completion_result == 0 )
+			{
+				/* The end of the file was reached
+				 */
+				if( slot->request_offset < request->read_size )
+				{
+					request->read_size = slot->request_offset;
+				}
+				slot->in_use = 0;
+
+				number_of_reads_in_flight--;
+			}
+			else
+			{
+				read_size = (size_t) completion_result;
+
+				if( read_size > slot->size )
+				{
+					read_size = slot->size;
+				}
+				memory_copy(
+				 &( request->buffer[ slot->request_offset ] ),
+				 &( io_uring->buffers[ (size_t) slot_index * io_uring->buffer_size ] ),
+				 read_size );
+
+				slot->request_offset += read_size;
+				slot->size           -= read_size;
+
+				/* A short read is continued with the remainder
+				 */
+				if( ( result == 1 )
+				 && ( slot->size > 0 ) )
+				{
+					file_descriptor = io_uring->file_descriptors[ request->file_index ];
+
+					libodraw_io_uring_queue_read(
+					 io_uring,
+					 slot_index,
+					 file_descriptor,
+					 request->offset + (off64_t) slot->request_offset );
+
+					number_of_reads_to_submit++;
+				}
+				else
+				{
+					slot->in_use = 0;
+
+					number_of_reads_in_flight--;
+				}
+			}
+		}
+		__atomic_store_n(
+		 io_uring->completion_queue_head,
+		 head,
+		 __ATOMIC_RELEASE );
+	}
+	while( ( number_of_reads_in_flight > 0 )
+	    || ( request_index < number_of_requests ) );
+
+	if( ( result != 1 )
+	 && ( number_of_reads_in_flight > 0 ) )
+	{
+		libodraw_io_uring_close(
+		 io_uring,
+		 NULL );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_uring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#else
+	result = 0;
+
+#endif /* defined( LIBODRAW_IO_URING_HAVE_IO_URING ) */
+
+	return( result );
+}
+
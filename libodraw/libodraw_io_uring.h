@@ -0,0 +1,212 @@
+/*
+ * Asynchronous IO using the Linux io_uring interface
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_IO_URING_H )
+#define _LIBODRAW_IO_URING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of reads that are queued
+ */
+#define LIBODRAW_IO_URING_DEFAULT_QUEUE_DEPTH		8
+
+/* The default size of the fixed buffer of a queued read
+ */
+#define LIBODRAW_IO_URING_DEFAULT_BUFFER_SIZE		( 256 * 1024 )
+
+typedef struct libodraw_io_uring_request libodraw_io_uring_request_t;
+
+struct libodraw_io_uring_request
+{
+	/* The file index
+	 */
+	int file_index;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The file offset
+	 */
+	off64_t offset;
+
+	/* The read size
+	 * contains the number of bytes read, which is less than the size at the end of the file
+	 */
+	size_t read_size;
+};
+
+typedef struct libodraw_io_uring_slot libodraw_io_uring_slot_t;
+
+struct libodraw_io_uring_slot
+{
+	/* The index of the request the slot is used by
+	 */
+	int request_index;
+
+	/* The offset relative to the start of the request
+	 */
+	size_t request_offset;
+
+	/* The size of the read
+	 */
+	size_t size;
+
+	/* Value to indicate the slot is in use
+	 */
+	uint8_t in_use;
+};
+
+typedef struct libodraw_io_uring libodraw_io_uring_t;
+
+struct libodraw_io_uring
+{
+	/* The ring file descriptor
+	 * contains -1 if the ring is not open
+	 */
+	int ring_file_descriptor;
+
+	/* The submission queue ring
+	 */
+	uint8_t *submission_queue_ring;
+
+	/* The submission queue ring size
+	 */
+	size_t submission_queue_ring_size;
+
+	/* The submission queue entries
+	 */
+	void *submission_queue_entries;
+
+	/* The submission queue entries size
+	 */
+	size_t submission_queue_entries_size;
+
+	/* The completion queue ring
+	 * this is the same as the submission queue ring if the kernel maps both in one
+	 */
+	uint8_t *completion_queue_ring;
+
+	/* The completion queue ring size
+	 */
+	size_t completion_queue_ring_size;
+
+	/* The submission queue head, tail, ring mask and array
+	 */
+	uint32_t *submission_queue_head;
+	uint32_t *submission_queue_tail;
+	uint32_t *submission_queue_ring_mask;
+	uint32_t *submission_queue_array;
+
+	/* The completion queue head, tail, ring mask and entries
+	 */
+	uint32_t *completion_queue_head;
+	uint32_t *completion_queue_tail;
+	uint32_t *completion_queue_ring_mask;
+	void *completion_queue_entries;
+
+	/* The queue depth
+	 * contains the maximum number of reads in flight
+	 */
+	int queue_depth;
+
+	/* The fixed buffers
+	 * contains a buffer of buffer size per slot, registered with the kernel
+	 */
+	uint8_t *buffers;
+
+	/* The size of the fixed buffer of a slot
+	 */
+	size_t buffer_size;
+
+	/* The slots
+	 */
+	libodraw_io_uring_slot_t *slots;
+
+	/* The file descriptors
+	 * contains -1 for files that are not read using the ring
+	 */
+	int *file_descriptors;
+
+	/* The number of file descriptors
+	 */
+	int number_of_file_descriptors;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * the ring is used by one read at a time
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_io_uring_initialize(
+     libodraw_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libodraw_io_uring_free(
+     libodraw_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libodraw_io_uring_open(
+     libodraw_io_uring_t *io_uring,
+     int queue_depth,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libodraw_io_uring_close(
+     libodraw_io_uring_t *io_uring,
+     libcerror_error_t **error );
+
+int libodraw_io_uring_is_open(
+     libodraw_io_uring_t *io_uring,
+     libcerror_error_t **error );
+
+int libodraw_io_uring_set_file(
+     libodraw_io_uring_t *io_uring,
+     int file_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libodraw_io_uring_read_requests(
+     libodraw_io_uring_t *io_uring,
+     libodraw_io_uring_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_IO_URING_H ) */
+
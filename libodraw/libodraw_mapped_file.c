@@ -0,0 +1,493 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#include "libodraw_libcerror.h"
+#include "libodraw_mapped_file.h"
+
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define LIBODRAW_MAPPED_FILE_HAVE_MMAP
+#endif
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_mapped_file_initialize(
+     libodraw_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                libodraw_mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( libodraw_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mapped_file != NULL )
+	{
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file
+ * Unmaps the data if the file is still mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_mapped_file_free(
+     libodraw_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( libodraw_mapped_file_close(
+		     *mapped_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close mapped file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a mapped file
+ * Maps the entire file read-only, unless LIBODRAW_MAPPED_FILE_FLAG_COPY_ON_WRITE is set,
+ * the file descriptor is closed once the mapping is established since the mapping
+ * remains valid until it is unmapped
+ * Returns 1 if successful, 0 if memory mapping is not supported or -1 on error
+ */
+int libodraw_mapped_file_open(
+     libodraw_mapped_file_t *mapped_file,
+     const char *filename,
+     uint8_t mapping_flags,
+     libcerror_error_t **error )
+{
+#if defined( LIBODRAW_MAPPED_FILE_HAVE_MMAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	long page_size        = 0;
+	size_t padding_size   = 0;
+	int file_descriptor   = -1;
+	int protection        = PROT_READ;
+	int sharing           = MAP_SHARED;
+#endif
+	static char *function = "libodraw_mapped_file_open";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mapping_flags & ~( LIBODRAW_MAPPED_FILE_FLAG_COPY_ON_WRITE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mapping flags: 0x%02" PRIx8 ".",
+		 function,
+		 mapping_flags );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_MAPPED_FILE_HAVE_MMAP )
+	if( ( mapping_flags & LIBODRAW_MAPPED_FILE_FLAG_COPY_ON_WRITE ) != 0 )
+	{
+		protection = PROT_READ | PROT_WRITE;
+		sharing    = MAP_PRIVATE;
+	}
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only regular files of a size that fits in the address space are mapped,
+	 * empty files cannot be mapped
+	 */
+	if( !S_ISREG( file_statistics.st_mode )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        protection,
+	        sharing,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		file_descriptor = -1;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	file_descriptor = -1;
+
+#if defined( HAVE_POSIX_MADVISE ) && defined( POSIX_MADV_SEQUENTIAL )
+	/* The advice is only a hint, hence failure is ignored
+	 */
+	posix_madvise(
+	 data,
+	 (size_t) file_statistics.st_size,
+	 POSIX_MADV_SEQUENTIAL );
+#endif
+#if defined( HAVE_SYSCONF ) && defined( _SC_PAGESIZE )
+	/* The remainder of the last page is zero filled and can be accessed
+	 */
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size > 0 )
+	{
+		padding_size = (size_t) ( (uint64_t) file_statistics.st_size % (uint64_t) page_size );
+
+		if( padding_size != 0 )
+		{
+			padding_size = (size_t) page_size - padding_size;
+		}
+	}
+#endif
+	mapped_file->data         = (uint8_t *) data;
+	mapped_file->data_size    = (size64_t) file_statistics.st_size;
+	mapped_file->padding_size = padding_size;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		if( data != MAP_FAILED )
+		{
+			munmap(
+			 data,
+			 (size_t) file_statistics.st_size );
+		}
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( LIBODRAW_MAPPED_FILE_HAVE_MMAP ) */
+}
+
+/* Closes a mapped file
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_mapped_file_close(
+     libodraw_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_mapped_file_close";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBODRAW_MAPPED_FILE_HAVE_MMAP )
+	if( mapped_file->data != NULL )
+	{
+		if( munmap(
+		     (void *) mapped_file->data,
+		     (size_t) mapped_file->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	mapped_file->data         = NULL;
+	mapped_file->data_size    = 0;
+	mapped_file->padding_size = 0;
+
+	return( result );
+}
+
+/* Retrieves a pointer to the mapped data at a specific offset
+ * The data remains valid until the mapped file is closed
+ * Returns 1 if successful, 0 if the offset is not mapped or -1 on error
+ */
+int libodraw_mapped_file_get_data(
+     libodraw_mapped_file_t *mapped_file,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_mapped_file_get_data";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mapped_file->data == NULL )
+	 || ( (size64_t) offset >= mapped_file->data_size ) )
+	{
+		return( 0 );
+	}
+	*data      = &( mapped_file->data[ offset ] );
+	*data_size = (size_t) ( mapped_file->data_size - (size64_t) offset );
+
+	return( 1 );
+}
+
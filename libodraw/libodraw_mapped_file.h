@@ -0,0 +1,91 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_MAPPED_FILE_H )
+#define _LIBODRAW_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The mapping flags
+ */
+enum LIBODRAW_MAPPED_FILE_FLAGS
+{
+	/* Map the file writable and private, changes to the data are not written to the file
+	 */
+	LIBODRAW_MAPPED_FILE_FLAG_COPY_ON_WRITE		= 0x01
+};
+
+typedef struct libodraw_mapped_file libodraw_mapped_file_t;
+
+struct libodraw_mapped_file
+{
+	/* The (mapped) data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The padding size
+	 * the number of zero bytes after the data that are part of the last mapped page
+	 */
+	size_t padding_size;
+};
+
+int libodraw_mapped_file_initialize(
+     libodraw_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libodraw_mapped_file_free(
+     libodraw_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libodraw_mapped_file_open(
+     libodraw_mapped_file_t *mapped_file,
+     const char *filename,
+     uint8_t mapping_flags,
+     libcerror_error_t **error );
+
+int libodraw_mapped_file_close(
+     libodraw_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+int libodraw_mapped_file_get_data(
+     libodraw_mapped_file_t *mapped_file,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_MAPPED_FILE_H ) */
+
@@ -0,0 +1,1001 @@
+/*
+ * Data file readahead functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+#include "libodraw_readahead.h"
+
+/* Creates a readahead
+ * Make sure the value readahead is referencing, is set to NULL
+ * If multi-thread support is available the windows are filled by a worker thread
+ * otherwise they are filled when they are scheduled
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_readahead_initialize(
+     libodraw_readahead_t **readahead,
+     libbfio_pool_t *file_io_pool,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_readahead_initialize";
+	int window_index      = 0;
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *readahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid readahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size == 0 )
+	 || ( window_size > (size_t) LIBODRAW_READAHEAD_MAXIMUM_WINDOW_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*readahead = memory_allocate_structure(
+	              libodraw_readahead_t );
+
+	if( *readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create readahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *readahead,
+	     0,
+	     sizeof( libodraw_readahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear readahead.",
+		 function );
+
+		memory_free(
+		 *readahead );
+
+		*readahead = NULL;
+
+		return( -1 );
+	}
+	for( window_index = 0;
+	     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+	     window_index++ )
+	{
+		( *readahead )->windows[ window_index ].data = (uint8_t *) memory_allocate(
+		                                                            sizeof( uint8_t ) * window_size );
+
+		if( ( *readahead )->windows[ window_index ].data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create window: %d data.",
+			 function,
+			 window_index );
+
+			goto on_error;
+		}
+		( *readahead )->windows[ window_index ].data_file_index = -1;
+	}
+	( *readahead )->file_io_pool         = file_io_pool;
+	( *readahead )->window_size          = window_size;
+	( *readahead )->last_data_file_index = -1;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *readahead )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *readahead )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_create(
+	     &( ( *readahead )->worker_thread ),
+	     NULL,
+	     (int (*)(void *)) &libodraw_readahead_worker_thread_callback,
+	     (void *) *readahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create worker thread.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *readahead != NULL )
+	{
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		if( ( *readahead )->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *readahead )->condition ),
+			 NULL );
+		}
+		if( ( *readahead )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *readahead )->mutex ),
+			 NULL );
+		}
+#endif
+		for( window_index = 0;
+		     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+		     window_index++ )
+		{
+			if( ( *readahead )->windows[ window_index ].data != NULL )
+			{
+				memory_free(
+				 ( *readahead )->windows[ window_index ].data );
+			}
+		}
+		memory_free(
+		 *readahead );
+
+		*readahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a readahead
+ * This stops the worker thread and waits for a pending read to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_readahead_free(
+     libodraw_readahead_t **readahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_readahead_free";
+	int result            = 1;
+	int window_index      = 0;
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *readahead != NULL )
+	{
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     ( *readahead )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		( *readahead )->stop = 1;
+
+		if( libcthreads_condition_broadcast(
+		     ( *readahead )->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     ( *readahead )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		if( libcthreads_thread_join(
+		     &( ( *readahead )->worker_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker thread.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *readahead )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *readahead )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( window_index = 0;
+		     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+		     window_index++ )
+		{
+			memory_free(
+			 ( *readahead )->windows[ window_index ].data );
+		}
+		memory_free(
+		 *readahead );
+
+		*readahead = NULL;
+	}
+	return( result );
+}
+
+/* Fills a window by reading its data from the data file
+ * The window size is read, fewer bytes are read at the end of the data file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_readahead_fill_window(
+     libodraw_readahead_t *readahead,
+     libodraw_readahead_window_t *window,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_readahead_fill_window";
+	ssize_t read_count    = 0;
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window.",
+		 function );
+
+		return( -1 );
+	}
+	window->data_size = 0;
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              readahead->file_io_pool,
+	              window->data_file_index,
+	              window->data,
+	              readahead->window_size,
+	              window->offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read window from data file: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 window->data_file_index,
+		 window->offset,
+		 window->offset );
+
+		return( -1 );
+	}
+	window->data_size = (size_t) read_count;
+
+	return( 1 );
+}
+
+/* Schedules the windows that follow a specific offset to be filled
+ * Windows that are being filled or that contain data at or directly after
+ * the offset are kept, the other windows continue after the last kept window
+ * The readahead mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_readahead_schedule_windows(
+     libodraw_readahead_t *readahead,
+     int data_file_index,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libodraw_readahead_window_t *window = NULL;
+	static char *function               = "libodraw_readahead_schedule_windows";
+	off64_t next_offset                 = 0;
+	off64_t range_end_offset            = 0;
+	int number_of_scheduled_windows     = 0;
+	int window_index                    = 0;
+	uint8_t is_kept[ LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS ];
+
+#if !defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *fill_error       = NULL;
+#endif
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	range_end_offset = offset + (off64_t) ( readahead->window_size * LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS );
+
+	for( window_index = 0;
+	     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+	     window_index++ )
+	{
+		window = &( readahead->windows[ window_index ] );
+
+		if( ( window->state == LIBODRAW_READAHEAD_WINDOW_STATE_PENDING )
+		 || ( window->state == LIBODRAW_READAHEAD_WINDOW_STATE_READING ) )
+		{
+			is_kept[ window_index ] = 1;
+		}
+		else if( ( window->state == LIBODRAW_READAHEAD_WINDOW_STATE_FILLED )
+		      && ( window->data_file_index == data_file_index )
+		      && ( ( window->offset + (off64_t) window->data_size ) > offset )
+		      && ( window->offset < range_end_offset ) )
+		{
+			is_kept[ window_index ] = 1;
+		}
+		else
+		{
+			is_kept[ window_index ] = 0;
+		}
+	}
+	/* Follow the kept windows that are contiguous from the offset
+	 */
+	next_offset = offset;
+
+	for( window_index = 0;
+	     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+	     window_index++ )
+	{
+		window = &( readahead->windows[ window_index ] );
+
+		if( ( is_kept[ window_index ] == 0 )
+		 || ( window->data_file_index != data_file_index )
+		 || ( next_offset < window->offset )
+		 || ( next_offset >= ( window->offset + (off64_t) readahead->window_size ) ) )
+		{
+			continue;
+		}
+		/* No data is available after the end of the data file
+		 */
+		if( ( window->state == LIBODRAW_READAHEAD_WINDOW_STATE_FILLED )
+		 && ( window->data_size < readahead->window_size ) )
+		{
+			return( 1 );
+		}
+		next_offset = window->offset + (off64_t) readahead->window_size;
+
+		/* Restart the search since the windows are not necessarily in offset order
+		 */
+		window_index = -1;
+	}
+	for( window_index = 0;
+	     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+	     window_index++ )
+	{
+		if( is_kept[ window_index ] != 0 )
+		{
+			continue;
+		}
+		window = &( readahead->windows[ window_index ] );
+
+		window->data_file_index = data_file_index;
+		window->offset          = next_offset;
+		window->data_size       = 0;
+		window->state           = LIBODRAW_READAHEAD_WINDOW_STATE_PENDING;
+
+		next_offset += (off64_t) readahead->window_size;
+
+		number_of_scheduled_windows++;
+
+#if !defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+		/* A failed read is reported when the data is read synchronously
+		 */
+		if( libodraw_readahead_fill_window(
+		     readahead,
+		     window,
+		     &fill_error ) != 1 )
+		{
+			libcerror_error_free(
+			 &fill_error );
+		}
+		window->state = LIBODRAW_READAHEAD_WINDOW_STATE_FILLED;
+#endif
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( number_of_scheduled_windows > 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     readahead->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads a buffer from a specific data file
+ * The data is copied from the windows if available otherwise it is read from the file IO pool.
+ * After a number of consecutive sequential reads the windows that follow the buffer are scheduled
+ * to be filled
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_readahead_read_buffer(
+         libodraw_readahead_t *readahead,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libodraw_readahead_window_t *window = NULL;
+	static char *function               = "libodraw_readahead_read_buffer";
+	off64_t read_offset                 = 0;
+	off64_t window_end_offset           = 0;
+	size_t buffer_offset                = 0;
+	size_t copy_size                    = 0;
+	size_t window_data_offset           = 0;
+	ssize_t read_count                  = 0;
+	int result                          = 1;
+	int window_index                    = 0;
+
+#if !defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *fill_error       = NULL;
+#endif
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     readahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		read_offset = offset + (off64_t) buffer_offset;
+		window      = NULL;
+
+		for( window_index = 0;
+		     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+		     window_index++ )
+		{
+			if( ( readahead->windows[ window_index ].state == LIBODRAW_READAHEAD_WINDOW_STATE_EMPTY )
+			 || ( readahead->windows[ window_index ].data_file_index != data_file_index )
+			 || ( read_offset < readahead->windows[ window_index ].offset ) )
+			{
+				continue;
+			}
+			window_end_offset = readahead->windows[ window_index ].offset;
+
+			if( readahead->windows[ window_index ].state == LIBODRAW_READAHEAD_WINDOW_STATE_FILLED )
+			{
+				window_end_offset += (off64_t) readahead->windows[ window_index ].data_size;
+			}
+			else
+			{
+				window_end_offset += (off64_t) readahead->window_size;
+			}
+			if( read_offset < window_end_offset )
+			{
+				window = &( readahead->windows[ window_index ] );
+
+				break;
+			}
+		}
+		if( window == NULL )
+		{
+			break;
+		}
+		if( window->state != LIBODRAW_READAHEAD_WINDOW_STATE_FILLED )
+		{
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+			/* Wait for the worker thread to fill the window
+			 */
+			if( libcthreads_condition_wait(
+			     readahead->condition,
+			     readahead->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+#else
+			/* A failed read is reported when the data is read synchronously
+			 */
+			if( libodraw_readahead_fill_window(
+			     readahead,
+			     window,
+			     &fill_error ) != 1 )
+			{
+				libcerror_error_free(
+				 &fill_error );
+			}
+			window->state = LIBODRAW_READAHEAD_WINDOW_STATE_FILLED;
+#endif
+			continue;
+		}
+		window_data_offset = (size_t) ( read_offset - window->offset );
+		copy_size          = window->data_size - window_data_offset;
+
+		if( copy_size > ( size - buffer_offset ) )
+		{
+			copy_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( window->data[ window_data_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window data to buffer.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		buffer_offset += copy_size;
+	}
+	if( result == 1 )
+	{
+		if( ( data_file_index == readahead->last_data_file_index )
+		 && ( offset == readahead->last_end_offset ) )
+		{
+			if( readahead->number_of_sequential_reads < LIBODRAW_READAHEAD_SEQUENTIAL_THRESHOLD )
+			{
+				readahead->number_of_sequential_reads++;
+			}
+		}
+		else
+		{
+			readahead->number_of_sequential_reads = 0;
+		}
+		readahead->last_data_file_index = data_file_index;
+		readahead->last_end_offset      = offset + (off64_t) size;
+
+		/* The windows are scheduled before the remainder of the buffer is read
+		 * so that the worker thread reads ahead while the remainder is read
+		 */
+		if( readahead->number_of_sequential_reads >= LIBODRAW_READAHEAD_SEQUENTIAL_THRESHOLD )
+		{
+			if( libodraw_readahead_schedule_windows(
+			     readahead,
+			     data_file_index,
+			     readahead->last_end_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to schedule windows.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     readahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( buffer_offset < size )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              readahead->file_io_pool,
+		              data_file_index,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset,
+		              offset + (off64_t) buffer_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_file_index,
+			 offset + (off64_t) buffer_offset,
+			 offset + (off64_t) buffer_offset );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+
+/* The worker thread callback function
+ * Fills the pending windows in offset order until the readahead is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_readahead_worker_thread_callback(
+     libodraw_readahead_t *readahead )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_readahead_window_t *window = NULL;
+	static char *function               = "libodraw_readahead_worker_thread_callback";
+	int window_index                    = 0;
+
+	if( readahead == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid readahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     readahead->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	while( readahead->stop == 0 )
+	{
+		window = NULL;
+
+		for( window_index = 0;
+		     window_index < LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS;
+		     window_index++ )
+		{
+			if( ( readahead->windows[ window_index ].state == LIBODRAW_READAHEAD_WINDOW_STATE_PENDING )
+			 && ( ( window == NULL )
+			  || ( readahead->windows[ window_index ].offset < window->offset ) ) )
+			{
+				window = &( readahead->windows[ window_index ] );
+			}
+		}
+		if( window == NULL )
+		{
+			if( libcthreads_condition_wait(
+			     readahead->condition,
+			     readahead->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				break;
+			}
+			continue;
+		}
+		window->state = LIBODRAW_READAHEAD_WINDOW_STATE_READING;
+
+		/* The window is read without holding the mutex, the window is not
+		 * changed by other threads while it is being read
+		 */
+		if( libcthreads_mutex_release(
+		     readahead->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* A failed read is reported when the data is read synchronously
+		 */
+		if( libodraw_readahead_fill_window(
+		     readahead,
+		     window,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     readahead->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		window->state = LIBODRAW_READAHEAD_WINDOW_STATE_FILLED;
+
+		if( libcthreads_condition_broadcast(
+		     readahead->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     readahead->mutex,
+	     NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( error != NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,176 @@
+/*
+ * Data file readahead functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_READAHEAD_H )
+#define _LIBODRAW_READAHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default readahead window size
+ */
+#define LIBODRAW_READAHEAD_DEFAULT_WINDOW_SIZE		( 1024 * 1024 )
+
+/* The maximum readahead window size
+ */
+#define LIBODRAW_READAHEAD_MAXIMUM_WINDOW_SIZE		( 64 * 1024 * 1024 )
+
+/* The number of readahead windows, one is consumed while the other is filled
+ */
+#define LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS		2
+
+/* The number of consecutive sequential reads before readahead is started
+ */
+#define LIBODRAW_READAHEAD_SEQUENTIAL_THRESHOLD		2
+
+enum LIBODRAW_READAHEAD_WINDOW_STATES
+{
+	LIBODRAW_READAHEAD_WINDOW_STATE_EMPTY		= 0,
+	LIBODRAW_READAHEAD_WINDOW_STATE_PENDING		= 1,
+	LIBODRAW_READAHEAD_WINDOW_STATE_READING		= 2,
+	LIBODRAW_READAHEAD_WINDOW_STATE_FILLED		= 3
+};
+
+typedef struct libodraw_readahead_window libodraw_readahead_window_t;
+
+struct libodraw_readahead_window
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 * contains the number of bytes read, which is less than the window size at the end of the data file
+	 */
+	size_t data_size;
+
+	/* The data file index
+	 */
+	int data_file_index;
+
+	/* The data file offset
+	 */
+	off64_t offset;
+
+	/* The state
+	 */
+	uint8_t state;
+};
+
+typedef struct libodraw_readahead libodraw_readahead_t;
+
+struct libodraw_readahead
+{
+	/* The data file pool of file IO handles
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The window size
+	 */
+	size_t window_size;
+
+	/* The windows
+	 */
+	libodraw_readahead_window_t windows[ LIBODRAW_READAHEAD_NUMBER_OF_WINDOWS ];
+
+	/* The data file index of the last read
+	 */
+	int last_data_file_index;
+
+	/* The data file offset directly after the last read
+	 */
+	off64_t last_end_offset;
+
+	/* The number of consecutive sequential reads
+	 */
+	int number_of_sequential_reads;
+
+	/* Value to indicate the worker thread should stop
+	 */
+	uint8_t stop;
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * protects the windows and the stop value
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition
+	 * signalled when a window state changes or the worker thread should stop
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The worker thread
+	 */
+	libcthreads_thread_t *worker_thread;
+#endif
+};
+
+int libodraw_readahead_initialize(
+     libodraw_readahead_t **readahead,
+     libbfio_pool_t *file_io_pool,
+     size_t window_size,
+     libcerror_error_t **error );
+
+int libodraw_readahead_free(
+     libodraw_readahead_t **readahead,
+     libcerror_error_t **error );
+
+int libodraw_readahead_fill_window(
+     libodraw_readahead_t *readahead,
+     libodraw_readahead_window_t *window,
+     libcerror_error_t **error );
+
+int libodraw_readahead_schedule_windows(
+     libodraw_readahead_t *readahead,
+     int data_file_index,
+     off64_t offset,
+     libcerror_error_t **error );
+
+ssize_t libodraw_readahead_read_buffer(
+         libodraw_readahead_t *readahead,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+
+int libodraw_readahead_worker_thread_callback(
+     libodraw_readahead_t *readahead );
+
+#endif
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_READAHEAD_H ) */
+
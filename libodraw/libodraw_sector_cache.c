@@ -0,0 +1,616 @@
+/*
+ * Sector cache functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_cache.h"
+
+/* Determines the hash table index of a data file index and sector
+ * The number of hash table entries must be a power of 2
+ */
+#define libodraw_sector_cache_get_hash_table_index( data_file_index, sector, number_of_hash_table_entries ) \
+	( (int) ( ( ( ( sector ) * 0x9e3779b97f4a7c15ULL ) ^ (uint64_t) ( data_file_index ) ) >> 32 ) & ( ( number_of_hash_table_entries ) - 1 ) )
+
+/* Creates a sector cache
+ * Make sure the value sector_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_cache_initialize(
+     libodraw_sector_cache_t **sector_cache,
+     int maximum_number_of_entries,
+     size_t sector_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libodraw_sector_cache_initialize";
+	int number_of_hash_table_entries = 1;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( (size_t) maximum_number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_sector_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size == 0 )
+	 || ( sector_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / (size_t) maximum_number_of_entries ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_hash_table_entries < maximum_number_of_entries )
+	{
+		number_of_hash_table_entries *= 2;
+	}
+	*sector_cache = memory_allocate_structure(
+	                 libodraw_sector_cache_t );
+
+	if( *sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sector_cache,
+	     0,
+	     sizeof( libodraw_sector_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector cache.",
+		 function );
+
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+
+		return( -1 );
+	}
+	( *sector_cache )->entries = (libodraw_sector_cache_entry_t *) memory_allocate(
+	                                                                sizeof( libodraw_sector_cache_entry_t ) * maximum_number_of_entries );
+
+	if( ( *sector_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *sector_cache )->hash_table = (int *) memory_allocate(
+	                                         sizeof( int ) * number_of_hash_table_entries );
+
+	if( ( *sector_cache )->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	( *sector_cache )->data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * sector_size * maximum_number_of_entries );
+
+	if( ( *sector_cache )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *sector_cache )->number_of_hash_table_entries = number_of_hash_table_entries;
+	( *sector_cache )->sector_size                  = sector_size;
+	( *sector_cache )->maximum_number_of_entries    = maximum_number_of_entries;
+
+	if( libodraw_sector_cache_empty(
+	     *sector_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty sector cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *sector_cache != NULL )
+	{
+		if( ( *sector_cache )->data != NULL )
+		{
+			memory_free(
+			 ( *sector_cache )->data );
+		}
+		if( ( *sector_cache )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *sector_cache )->hash_table );
+		}
+		if( ( *sector_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *sector_cache )->entries );
+		}
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sector cache
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_cache_free(
+     libodraw_sector_cache_t **sector_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_cache_free";
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_cache != NULL )
+	{
+		memory_free(
+		 ( *sector_cache )->data );
+
+		memory_free(
+		 ( *sector_cache )->hash_table );
+
+		memory_free(
+		 ( *sector_cache )->entries );
+
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a sector cache
+ * The hit and miss statistics are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_cache_empty(
+     libodraw_sector_cache_t *sector_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_cache_empty";
+	int hash_table_index  = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing hash table.",
+		 function );
+
+		return( -1 );
+	}
+	for( hash_table_index = 0;
+	     hash_table_index < sector_cache->number_of_hash_table_entries;
+	     hash_table_index++ )
+	{
+		sector_cache->hash_table[ hash_table_index ] = -1;
+	}
+	sector_cache->number_of_entries = 0;
+	sector_cache->first_index       = -1;
+	sector_cache->last_index        = -1;
+
+	return( 1 );
+}
+
+/* Determines the index of the entry of a specific data file index and sector
+ * Returns the entry index or -1 if not available
+ */
+static int libodraw_sector_cache_get_entry_index(
+            libodraw_sector_cache_t *sector_cache,
+            int data_file_index,
+            uint64_t sector )
+{
+	libodraw_sector_cache_entry_t *entry = NULL;
+	int entry_index                      = 0;
+	int hash_table_index                 = 0;
+
+	hash_table_index = libodraw_sector_cache_get_hash_table_index(
+	                    data_file_index,
+	                    sector,
+	                    sector_cache->number_of_hash_table_entries );
+
+	entry_index = sector_cache->hash_table[ hash_table_index ];
+
+	while( entry_index != -1 )
+	{
+		entry = &( sector_cache->entries[ entry_index ] );
+
+		if( ( entry->sector == sector )
+		 && ( entry->data_file_index == data_file_index ) )
+		{
+			break;
+		}
+		entry_index = entry->hash_next_index;
+	}
+	return( entry_index );
+}
+
+/* Moves an entry to the front of the most recently used list
+ */
+static void libodraw_sector_cache_move_entry_to_front(
+             libodraw_sector_cache_t *sector_cache,
+             int entry_index )
+{
+	libodraw_sector_cache_entry_t *entry = NULL;
+
+	if( sector_cache->first_index == entry_index )
+	{
+		return;
+	}
+	entry = &( sector_cache->entries[ entry_index ] );
+
+	/* Unlink the entry if it is part of the list
+	 */
+	if( entry->previous_index != -1 )
+	{
+		sector_cache->entries[ entry->previous_index ].next_index = entry->next_index;
+	}
+	if( entry->next_index != -1 )
+	{
+		sector_cache->entries[ entry->next_index ].previous_index = entry->previous_index;
+	}
+	if( sector_cache->last_index == entry_index )
+	{
+		sector_cache->last_index = entry->previous_index;
+	}
+	entry->previous_index = -1;
+	entry->next_index     = sector_cache->first_index;
+
+	if( sector_cache->first_index != -1 )
+	{
+		sector_cache->entries[ sector_cache->first_index ].previous_index = entry_index;
+	}
+	sector_cache->first_index = entry_index;
+
+	if( sector_cache->last_index == -1 )
+	{
+		sector_cache->last_index = entry_index;
+	}
+}
+
+/* Retrieves the sector data of a specific data file index and sector
+ * The sector data is owned by the cache and only valid until the next call
+ * that modifies the cache
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libodraw_sector_cache_get_sector_data(
+     libodraw_sector_cache_t *sector_cache,
+     int data_file_index,
+     uint64_t sector,
+     uint8_t **sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_cache_get_sector_data";
+	int entry_index       = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libodraw_sector_cache_get_entry_index(
+	               sector_cache,
+	               data_file_index,
+	               sector );
+
+	if( entry_index == -1 )
+	{
+		sector_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	libodraw_sector_cache_move_entry_to_front(
+	 sector_cache,
+	 entry_index );
+
+	sector_cache->number_of_hits += 1;
+
+	*sector_data = &( sector_cache->data[ (size_t) entry_index * sector_cache->sector_size ] );
+
+	return( 1 );
+}
+
+/* Sets the sector data of a specific data file index and sector
+ * If the cache is full the least recently used entry is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_cache_set_sector_data(
+     libodraw_sector_cache_t *sector_cache,
+     int data_file_index,
+     uint64_t sector,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error )
+{
+	libodraw_sector_cache_entry_t *entry = NULL;
+	static char *function                = "libodraw_sector_cache_set_sector_data";
+	int entry_index                      = 0;
+	int hash_table_index                 = 0;
+	int previous_entry_index             = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_size != sector_cache->sector_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libodraw_sector_cache_get_entry_index(
+	               sector_cache,
+	               data_file_index,
+	               sector );
+
+	if( entry_index == -1 )
+	{
+		if( sector_cache->number_of_entries < sector_cache->maximum_number_of_entries )
+		{
+			entry_index = sector_cache->number_of_entries;
+
+			sector_cache->number_of_entries += 1;
+
+			entry = &( sector_cache->entries[ entry_index ] );
+
+			entry->previous_index = -1;
+			entry->next_index     = -1;
+		}
+		else
+		{
+			/* Reuse the least recently used entry
+			 */
+			entry_index = sector_cache->last_index;
+
+			entry = &( sector_cache->entries[ entry_index ] );
+
+			hash_table_index = libodraw_sector_cache_get_hash_table_index(
+			                    entry->data_file_index,
+			                    entry->sector,
+			                    sector_cache->number_of_hash_table_entries );
+
+			if( sector_cache->hash_table[ hash_table_index ] == entry_index )
+			{
+				sector_cache->hash_table[ hash_table_index ] = entry->hash_next_index;
+			}
+			else
+			{
+				previous_entry_index = sector_cache->hash_table[ hash_table_index ];
+
+				while( sector_cache->entries[ previous_entry_index ].hash_next_index != entry_index )
+				{
+					previous_entry_index = sector_cache->entries[ previous_entry_index ].hash_next_index;
+				}
+				sector_cache->entries[ previous_entry_index ].hash_next_index = entry->hash_next_index;
+			}
+		}
+		hash_table_index = libodraw_sector_cache_get_hash_table_index(
+		                    data_file_index,
+		                    sector,
+		                    sector_cache->number_of_hash_table_entries );
+
+		entry->sector          = sector;
+		entry->data_file_index = data_file_index;
+		entry->hash_next_index = sector_cache->hash_table[ hash_table_index ];
+
+		sector_cache->hash_table[ hash_table_index ] = entry_index;
+	}
+	if( memory_copy(
+	     &( sector_cache->data[ (size_t) entry_index * sector_cache->sector_size ] ),
+	     sector_data,
+	     sector_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data.",
+		 function );
+
+		return( -1 );
+	}
+	libodraw_sector_cache_move_entry_to_front(
+	 sector_cache,
+	 entry_index );
+
+	return( 1 );
+}
+
+/* Retrieves the hit and miss statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_cache_get_statistics(
+     libodraw_sector_cache_t *sector_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_cache_get_statistics";
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits   = sector_cache->number_of_hits;
+	*number_of_misses = sector_cache->number_of_misses;
+
+	return( 1 );
+}
+
@@ -0,0 +1,149 @@
+/*
+ * Sector cache functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_SECTOR_CACHE_H )
+#define _LIBODRAW_SECTOR_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_sector_cache_entry libodraw_sector_cache_entry_t;
+
+struct libodraw_sector_cache_entry
+{
+	/* The sector
+	 */
+	uint64_t sector;
+
+	/* The data file index
+	 */
+	int data_file_index;
+
+	/* The index of the next entry with the same hash value
+	 */
+	int hash_next_index;
+
+	/* The index of the previous (more recently used) entry
+	 */
+	int previous_index;
+
+	/* The index of the next (less recently used) entry
+	 */
+	int next_index;
+};
+
+typedef struct libodraw_sector_cache libodraw_sector_cache_t;
+
+struct libodraw_sector_cache
+{
+	/* The entries
+	 */
+	libodraw_sector_cache_entry_t *entries;
+
+	/* The hash table
+	 */
+	int *hash_table;
+
+	/* The number of hash table entries
+	 * this value is a power of 2
+	 */
+	int number_of_hash_table_entries;
+
+	/* The sector data
+	 */
+	uint8_t *data;
+
+	/* The sector size
+	 */
+	size_t sector_size;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The index of the most recently used entry
+	 */
+	int first_index;
+
+	/* The index of the least recently used entry
+	 */
+	int last_index;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+};
+
+int libodraw_sector_cache_initialize(
+     libodraw_sector_cache_t **sector_cache,
+     int maximum_number_of_entries,
+     size_t sector_size,
+     libcerror_error_t **error );
+
+int libodraw_sector_cache_free(
+     libodraw_sector_cache_t **sector_cache,
+     libcerror_error_t **error );
+
+int libodraw_sector_cache_empty(
+     libodraw_sector_cache_t *sector_cache,
+     libcerror_error_t **error );
+
+int libodraw_sector_cache_get_sector_data(
+     libodraw_sector_cache_t *sector_cache,
+     int data_file_index,
+     uint64_t sector,
+     uint8_t **sector_data,
+     libcerror_error_t **error );
+
+int libodraw_sector_cache_set_sector_data(
+     libodraw_sector_cache_t *sector_cache,
+     int data_file_index,
+     uint64_t sector,
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error );
+
+int libodraw_sector_cache_get_statistics(
+     libodraw_sector_cache_t *sector_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_SECTOR_CACHE_H ) */
+
@@ -0,0 +1,321 @@
+/*
+ * Sector copy functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_definitions.h"
+#include "libodraw_io_handle.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_copy.h"
+#include "libodraw_sector_extract.h"
+#include "libodraw_unused.h"
+
+/* Copies the 2048 bytes of user data of raw (2352 bytes per sector) Mode 1, Mode 2 or CD-i sectors
+ * The synchronisation data and for Mode 2 and CD-i the XA sub-header are validated
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_copy_2352_to_2048(
+     libodraw_io_handle_t *io_handle LIBODRAW_ATTRIBUTE_UNUSED,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type,
+     uint32_t sector_index LIBODRAW_ATTRIBUTE_UNUSED,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_copy_2352_to_2048";
+
+	LIBODRAW_UNREFERENCED_PARAMETER( io_handle )
+	LIBODRAW_UNREFERENCED_PARAMETER( sector_index )
+
+	/* CD-i sectors are Mode 2 sectors with an XA sub-header
+	 */
+	if( track_type == LIBODRAW_TRACK_TYPE_CDI_2352 )
+	{
+		track_type = LIBODRAW_TRACK_TYPE_MODE2_2352;
+	}
+	if( libodraw_sector_extract_2352_to_2048(
+	     sector_data,
+	     number_of_sectors * 2352,
+	     track_type,
+	     buffer,
+	     number_of_sectors * 2048,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to extract sector data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the 2048 bytes of user data of Mode 2 or CD-i (2336 bytes per sector) sectors
+ * The XA sub-header is validated
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_copy_mode2_2336_to_2048(
+     libodraw_io_handle_t *io_handle LIBODRAW_ATTRIBUTE_UNUSED,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type LIBODRAW_ATTRIBUTE_UNUSED,
+     uint32_t sector_index,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_copy_mode2_2336_to_2048";
+	size_t sector_number  = 0;
+
+	LIBODRAW_UNREFERENCED_PARAMETER( io_handle )
+	LIBODRAW_UNREFERENCED_PARAMETER( track_type )
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_number = 0;
+	     sector_number < number_of_sectors;
+	     sector_number++ )
+	{
+		if( ( sector_data[ 0 ] != sector_data[ 4 ] )
+		 || ( sector_data[ 1 ] != sector_data[ 5 ] )
+		 || ( sector_data[ 2 ] != sector_data[ 6 ] )
+		 || ( sector_data[ 3 ] != sector_data[ 7 ] )
+		 || ( sector_data[ 1 ] >= 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: unsupported or corrupt XA sub-header in sector: %" PRIu32 ".",
+			 function,
+			 sector_index + (uint32_t) sector_number );
+
+			return( -1 );
+		}
+		memory_copy(
+		 buffer,
+		 &( sector_data[ 8 ] ),
+		 2048 );
+
+		sector_data += 2336;
+		buffer      += 2048;
+	}
+	return( 1 );
+}
+
+/* Copies audio sectors as 2048 bytes of user data
+ * Audio sectors contain no user data, hence the buffer is filled with 0 byte values
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_copy_audio_to_2048(
+     libodraw_io_handle_t *io_handle LIBODRAW_ATTRIBUTE_UNUSED,
+     const uint8_t *sector_data LIBODRAW_ATTRIBUTE_UNUSED,
+     size_t number_of_sectors,
+     uint8_t track_type LIBODRAW_ATTRIBUTE_UNUSED,
+     uint32_t sector_index LIBODRAW_ATTRIBUTE_UNUSED,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_copy_audio_to_2048";
+
+	LIBODRAW_UNREFERENCED_PARAMETER( io_handle )
+	LIBODRAW_UNREFERENCED_PARAMETER( sector_data )
+	LIBODRAW_UNREFERENCED_PARAMETER( track_type )
+	LIBODRAW_UNREFERENCED_PARAMETER( sector_index )
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buffer,
+	     0,
+	     number_of_sectors * 2048 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Encodes raw sectors of 2352 bytes from the sector data of a Mode 1 or Mode 2 track
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_copy_encode_to_2352(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function    = "libodraw_sector_copy_encode_to_2352";
+	size_t bytes_per_sector  = 0;
+	size_t sector_number     = 0;
+
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_MODE1_2048:
+		case LIBODRAW_TRACK_TYPE_MODE2_2048:
+			bytes_per_sector = 2048;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2324:
+			bytes_per_sector = 2324;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+			bytes_per_sector = 2336;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track type.",
+			 function );
+
+			return( -1 );
+	}
+	for( sector_number = 0;
+	     sector_number < number_of_sectors;
+	     sector_number++ )
+	{
+		if( libodraw_io_handle_encode_raw_sector(
+		     io_handle,
+		     sector_data,
+		     bytes_per_sector,
+		     track_type,
+		     sector_index,
+		     buffer,
+		     2352,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to encode raw sector: %" PRIu32 ".",
+			 function,
+			 sector_index );
+
+			return( -1 );
+		}
+		sector_data  += bytes_per_sector;
+		buffer       += 2352;
+		sector_index += 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the sector copy function for a specific track type and output bytes per sector
+ * The debug and verbose builds use the generic copy function for its notify output
+ * Returns the sector copy function or NULL if not available
+ */
+libodraw_sector_copy_function_t libodraw_sector_copy_get_function(
+                                 uint8_t track_type,
+                                 uint32_t bytes_per_sector,
+                                 uint32_t output_bytes_per_sector )
+{
+#if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
+	LIBODRAW_UNREFERENCED_PARAMETER( track_type )
+	LIBODRAW_UNREFERENCED_PARAMETER( bytes_per_sector )
+	LIBODRAW_UNREFERENCED_PARAMETER( output_bytes_per_sector )
+
+	return( NULL );
+#else
+	if( output_bytes_per_sector == 2048 )
+	{
+		if( ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2352 ) )
+		{
+			return( &libodraw_sector_copy_2352_to_2048 );
+		}
+		else if( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
+		      || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2336 ) )
+		{
+			return( &libodraw_sector_copy_mode2_2336_to_2048 );
+		}
+		else if( ( track_type == LIBODRAW_TRACK_TYPE_AUDIO )
+		      && ( bytes_per_sector == 2352 ) )
+		{
+			return( &libodraw_sector_copy_audio_to_2048 );
+		}
+	}
+	else if( output_bytes_per_sector == 2352 )
+	{
+		if( ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2048 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2048 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2324 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_CDI_2336 ) )
+		{
+			return( &libodraw_sector_copy_encode_to_2352 );
+		}
+	}
+	return( NULL );
+#endif
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Sector copy functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBODRAW_SECTOR_COPY_H )
+#define _LIBODRAW_SECTOR_COPY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_io_handle.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A sector copy function
+ * Copies whole sectors of a specific track type to a specific output bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libodraw_sector_copy_function_t)(
+               libodraw_io_handle_t *io_handle,
+               const uint8_t *sector_data,
+               size_t number_of_sectors,
+               uint8_t track_type,
+               uint32_t sector_index,
+               uint8_t *buffer,
+               libcerror_error_t **error );
+
+int libodraw_sector_copy_2352_to_2048(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+int libodraw_sector_copy_mode2_2336_to_2048(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+int libodraw_sector_copy_audio_to_2048(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+int libodraw_sector_copy_encode_to_2352(
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     size_t number_of_sectors,
+     uint8_t track_type,
+     uint32_t sector_index,
+     uint8_t *buffer,
+     libcerror_error_t **error );
+
+libodraw_sector_copy_function_t libodraw_sector_copy_get_function(
+                                 uint8_t track_type,
+                                 uint32_t bytes_per_sector,
+                                 uint32_t output_bytes_per_sector );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_SECTOR_COPY_H ) */
+
@@ -0,0 +1,327 @@
+/*
+ * Sector data buffer functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_data_buffer.h"
+
+/* Creates a sector data buffer
+ * Make sure the value sector_data_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_data_buffer_initialize(
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_data_buffer_initialize";
+
+	if( sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector data buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sector_data_buffer = memory_allocate_structure(
+	                       libodraw_sector_data_buffer_t );
+
+	if( *sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sector_data_buffer,
+	     0,
+	     sizeof( libodraw_sector_data_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *sector_data_buffer != NULL )
+	{
+		memory_free(
+		 *sector_data_buffer );
+
+		*sector_data_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sector data buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_data_buffer_free(
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_data_buffer_free";
+
+	if( sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data_buffer != NULL )
+	{
+		if( ( *sector_data_buffer )->data_allocation != NULL )
+		{
+			memory_free(
+			 ( *sector_data_buffer )->data_allocation );
+		}
+		memory_free(
+		 *sector_data_buffer );
+
+		*sector_data_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a sector data buffer
+ * Releases the data but retains the number of allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_data_buffer_clear(
+     libodraw_sector_data_buffer_t *sector_data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_data_buffer_clear";
+
+	if( sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_buffer->data_allocation != NULL )
+	{
+		memory_free(
+		 sector_data_buffer->data_allocation );
+
+		sector_data_buffer->data_allocation = NULL;
+	}
+	sector_data_buffer->data      = NULL;
+	sector_data_buffer->data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves data of at least a specific size for a read at a specific data file offset
+ * The data is (re)allocated in size classes of a power of 2, starting at
+ * LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE, so it is only grown when a larger
+ * read is encountered. The data remains owned by the sector data buffer and
+ * is valid until the next call to this function or until the buffer is cleared
+ *
+ * The data starts at the same offset relative to LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT
+ * as the data offset, so that once a direct read has reached an aligned file offset
+ * the remainder of the read can bypass the window of the direct file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_data_buffer_get_data(
+     libodraw_sector_data_buffer_t *sector_data_buffer,
+     off64_t data_offset,
+     size_t data_size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	uint8_t *new_data_allocation = NULL;
+	static char *function        = "libodraw_sector_data_buffer_get_data";
+	size_t allocation_data_size  = 0;
+	intptr_t misalignment        = 0;
+
+	if( sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > sector_data_buffer->data_size )
+	{
+		allocation_data_size = LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE;
+
+		while( allocation_data_size < data_size )
+		{
+			allocation_data_size *= 2;
+		}
+		/* The previous data is not preserved so allocate new data
+		 * instead of reallocating. The additional alignment bytes
+		 * are used to align the data and the offset of the read
+		 */
+		new_data_allocation = (uint8_t *) memory_allocate(
+		                                   sizeof( uint8_t ) * ( allocation_data_size + ( 2 * LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT ) ) );
+
+		if( new_data_allocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			return( -1 );
+		}
+		if( sector_data_buffer->data_allocation != NULL )
+		{
+			memory_free(
+			 sector_data_buffer->data_allocation );
+		}
+		sector_data_buffer->data_allocation = new_data_allocation;
+
+		misalignment = (intptr_t) new_data_allocation % LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT;
+
+		if( misalignment == 0 )
+		{
+			sector_data_buffer->data = new_data_allocation;
+		}
+		else
+		{
+			sector_data_buffer->data = &( new_data_allocation[ LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT - misalignment ] );
+		}
+		sector_data_buffer->data_size = allocation_data_size;
+
+		sector_data_buffer->number_of_allocations += 1;
+	}
+	*data = &( ( sector_data_buffer->data )[ data_offset % LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_data_buffer_get_number_of_allocations(
+     libodraw_sector_data_buffer_t *sector_data_buffer,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_data_buffer_get_number_of_allocations";
+
+	if( sector_data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_allocations = sector_data_buffer->number_of_allocations;
+
+	return( 1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Sector data buffer functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_SECTOR_DATA_BUFFER_H )
+#define _LIBODRAW_SECTOR_DATA_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The smallest size class of the sector data buffer
+ */
+#define LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE	( 64 * 1024 )
+
+/* The largest size class of the sector data buffer
+ * reads that require more sector data are split by the caller
+ */
+#define LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE	( 4 * 1024 * 1024 )
+
+/* The alignment of the sector data buffer
+ * this matches the alignment required by direct (unbuffered) IO
+ */
+#define LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT		4096
+
+typedef struct libodraw_sector_data_buffer libodraw_sector_data_buffer_t;
+
+struct libodraw_sector_data_buffer
+{
+	/* The data allocation
+	 */
+	uint8_t *data_allocation;
+
+	/* The data
+	 * this is aligned to LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT within the data allocation
+	 */
+	uint8_t *data;
+
+	/* The (allocated) data size
+	 */
+	size_t data_size;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+};
+
+int libodraw_sector_data_buffer_initialize(
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error );
+
+int libodraw_sector_data_buffer_free(
+     libodraw_sector_data_buffer_t **sector_data_buffer,
+     libcerror_error_t **error );
+
+int libodraw_sector_data_buffer_clear(
+     libodraw_sector_data_buffer_t *sector_data_buffer,
+     libcerror_error_t **error );
+
+int libodraw_sector_data_buffer_get_data(
+     libodraw_sector_data_buffer_t *sector_data_buffer,
+     off64_t data_offset,
+     size_t data_size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+int libodraw_sector_data_buffer_get_number_of_allocations(
+     libodraw_sector_data_buffer_t *sector_data_buffer,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_SECTOR_DATA_BUFFER_H ) */
+
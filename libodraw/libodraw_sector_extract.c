@@ -0,0 +1,309 @@
+/*
+ * Sector extraction functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_definitions.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_extract.h"
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+#include <immintrin.h>
+#endif
+
+/* The sector synchronisation data padded to 16 bytes
+ * only the first 12 bytes are compared
+ */
+static uint8_t libodraw_sector_extract_synchronisation_data[ 16 ] = \
+	{ 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The kernel used by libodraw_sector_extract_2352_to_2048
+ * the kernel is determined on first use, which is safe to race since
+ * every thread will determine the same kernel
+ */
+static libodraw_sector_extract_kernel_t libodraw_sector_extract_kernel = NULL;
+
+/* Extracts the 2048 bytes of user data of raw (2352 bytes per sector) Mode 1 or Mode 2 Form 1 sectors
+ * This function validates the synchronisation data and for Mode 2 the XA sub-header
+ * Returns the number of sectors extracted
+ */
+size_t libodraw_sector_extract_2352_to_2048_scalar(
+        const uint8_t *sector_data,
+        size_t number_of_sectors,
+        uint8_t track_type,
+        uint8_t *buffer )
+{
+	size_t data_offset  = 16;
+	size_t sector_index = 0;
+
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	{
+		data_offset = 24;
+	}
+	for( sector_index = 0;
+	     sector_index < number_of_sectors;
+	     sector_index++ )
+	{
+		if( memory_compare(
+		     sector_data,
+		     libodraw_sector_extract_synchronisation_data,
+		     12 ) != 0 )
+		{
+			break;
+		}
+		if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+		{
+			if( ( sector_data[ 16 ] != sector_data[ 20 ] )
+			 || ( sector_data[ 17 ] != sector_data[ 21 ] )
+			 || ( sector_data[ 18 ] != sector_data[ 22 ] )
+			 || ( sector_data[ 19 ] != sector_data[ 23 ] )
+			 || ( sector_data[ 17 ] >= 32 ) )
+			{
+				break;
+			}
+		}
+		memory_copy(
+		 buffer,
+		 &( sector_data[ data_offset ] ),
+		 2048 );
+
+		sector_data += 2352;
+		buffer      += 2048;
+	}
+	return( sector_index );
+}
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+
+/* Extracts the 2048 bytes of user data of raw (2352 bytes per sector) Mode 1 or Mode 2 Form 1 sectors
+ * This function uses SSE2, which is part of the x86-64 base instruction set
+ * Returns the number of sectors extracted
+ */
+size_t libodraw_sector_extract_2352_to_2048_sse2(
+        const uint8_t *sector_data,
+        size_t number_of_sectors,
+        uint8_t track_type,
+        uint8_t *buffer )
+{
+	const uint8_t *data     = NULL;
+	__m128i synchronisation = _mm_loadu_si128(
+	                           (const __m128i *) libodraw_sector_extract_synchronisation_data );
+	__m128i value0          = _mm_setzero_si128();
+	__m128i value1          = _mm_setzero_si128();
+	__m128i value2          = _mm_setzero_si128();
+	__m128i value3          = _mm_setzero_si128();
+	size_t data_offset      = 16;
+	size_t sector_index     = 0;
+	size_t copy_offset      = 0;
+	int compare_mask        = 0;
+
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	{
+		data_offset = 24;
+	}
+	for( sector_index = 0;
+	     sector_index < number_of_sectors;
+	     sector_index++ )
+	{
+		value0       = _mm_loadu_si128( (const __m128i *) sector_data );
+		compare_mask = _mm_movemask_epi8( _mm_cmpeq_epi8( value0, synchronisation ) );
+
+		if( ( compare_mask & 0x0fff ) != 0x0fff )
+		{
+			break;
+		}
+		if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+		{
+			/* Compare the first 4 bytes of the XA sub-header with its copy
+			 */
+			value0       = _mm_loadl_epi64( (const __m128i *) &( sector_data[ 16 ] ) );
+			compare_mask = _mm_movemask_epi8( _mm_cmpeq_epi8( value0, _mm_srli_si128( value0, 4 ) ) );
+
+			if( ( ( compare_mask & 0x000f ) != 0x000f )
+			 || ( sector_data[ 17 ] >= 32 ) )
+			{
+				break;
+			}
+		}
+		data = &( sector_data[ data_offset ] );
+
+		for( copy_offset = 0;
+		     copy_offset < 2048;
+		     copy_offset += 64 )
+		{
+			value0 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset ] ) );
+			value1 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset + 16 ] ) );
+			value2 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset + 32 ] ) );
+			value3 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset + 48 ] ) );
+
+			_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset ] ), value0 );
+			_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset + 16 ] ), value1 );
+			_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset + 32 ] ), value2 );
+			_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset + 48 ] ), value3 );
+		}
+		sector_data += 2352;
+		buffer      += 2048;
+	}
+	return( sector_index );
+}
+
+#endif /* defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD ) */
+
+/* Retrieves the sector extraction kernel best supported by the CPU
+ * The work is bounded by the 2048 byte copy, hence an AVX2 kernel was measured
+ * to be no faster than the SSE2 kernel, see tests/odraw_bench_sector_extract.c
+ * Returns the kernel
+ */
+libodraw_sector_extract_kernel_t libodraw_sector_extract_get_kernel(
+                                  void )
+{
+	if( libodraw_sector_extract_kernel == NULL )
+	{
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+		/* SSE2 is part of the x86-64 baseline
+		 */
+		libodraw_sector_extract_kernel = &libodraw_sector_extract_2352_to_2048_sse2;
+#else
+		libodraw_sector_extract_kernel = &libodraw_sector_extract_2352_to_2048_scalar;
+#endif
+	}
+	return( libodraw_sector_extract_kernel );
+}
+
+/* Extracts the 2048 bytes of user data of multiple raw (2352 bytes per sector) Mode 1 or Mode 2 Form 1 sectors
+ * The sector data must start at the start of a sector
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_extract_2352_to_2048(
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint8_t track_type,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libodraw_sector_extract_kernel_t kernel = NULL;
+	const uint8_t *failed_sector_data       = NULL;
+	static char *function                   = "libodraw_sector_extract_2352_to_2048";
+	size_t number_of_extracted_sectors      = 0;
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( track_type != LIBODRAW_TRACK_TYPE_MODE1_2352 )
+	 && ( track_type != LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported track type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sectors > ( sector_data_size / 2352 ) )
+	 || ( number_of_sectors > ( buffer_size / 2048 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	kernel = libodraw_sector_extract_get_kernel();
+
+	number_of_extracted_sectors = kernel(
+	                               sector_data,
+	                               number_of_sectors,
+	                               track_type,
+	                               buffer );
+
+	if( number_of_extracted_sectors < number_of_sectors )
+	{
+		failed_sector_data = &( sector_data[ number_of_extracted_sectors * 2352 ] );
+
+		if( memory_compare(
+		     failed_sector_data,
+		     libodraw_sector_extract_synchronisation_data,
+		     12 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: unsupported sector synchronisation data in sector: %" PRIzu ".",
+			 function,
+			 number_of_extracted_sectors );
+		}
+		else if( memory_compare(
+		          &( failed_sector_data[ 16 ] ),
+		          &( failed_sector_data[ 20 ] ),
+		          4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: unsupported or corrupt XA sub-header in sector: %" PRIzu ".",
+			 function,
+			 number_of_extracted_sectors );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: unsupported XA sub-header channel number in sector: %" PRIzu ".",
+			 function,
+			 number_of_extracted_sectors );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,83 @@
+/*
+ * Sector extraction functions
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_SECTOR_EXTRACT_H )
+#define _LIBODRAW_SECTOR_EXTRACT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SSE2 kernel is only built for x86-64 using a GCC compatible compiler
+ */
+#if defined( __GNUC__ ) && defined( __x86_64__ ) && !defined( LIBODRAW_SECTOR_EXTRACT_NO_SIMD )
+#define LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD	1
+#endif
+
+/* A sector extraction kernel
+ * Returns the number of sectors extracted, if this value is smaller than
+ * the number of sectors the sector at that index failed validation
+ */
+typedef size_t (*libodraw_sector_extract_kernel_t)(
+                  const uint8_t *sector_data,
+                  size_t number_of_sectors,
+                  uint8_t track_type,
+                  uint8_t *buffer );
+
+size_t libodraw_sector_extract_2352_to_2048_scalar(
+        const uint8_t *sector_data,
+        size_t number_of_sectors,
+        uint8_t track_type,
+        uint8_t *buffer );
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+
+size_t libodraw_sector_extract_2352_to_2048_sse2(
+        const uint8_t *sector_data,
+        size_t number_of_sectors,
+        uint8_t track_type,
+        uint8_t *buffer );
+
+#endif /* defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD ) */
+
+libodraw_sector_extract_kernel_t libodraw_sector_extract_get_kernel(
+                                  void );
+
+int libodraw_sector_extract_2352_to_2048(
+     const uint8_t *sector_data,
+     size_t sector_data_size,
+     uint8_t track_type,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t number_of_sectors,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_SECTOR_EXTRACT_H ) */
+
@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libodraw_definitions.h"
+#include "libodraw_form_map.h"
 #include "libodraw_libcerror.h"
 #include "libodraw_track_value.h"
 
@@ -108,6 +109,7 @@ int libodraw_track_value_free(
      libcerror_error_t **error )
 {
 	static char *function = "libodraw_track_value_free";
+	int result            = 1;
 
 	if( track_value == NULL )
 	{
@@ -122,12 +124,28 @@ int libodraw_track_value_free(
 	}
 	if( *track_value != NULL )
 	{
+		if( ( *track_value )->form_map != NULL )
+		{
+			if( libodraw_form_map_free(
+			     &( ( *track_value )->form_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free form map.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *track_value );
 
 		*track_value = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves a track value
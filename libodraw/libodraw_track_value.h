@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libodraw_form_map.h"
 #include "libodraw_libcerror.h"
+#include "libodraw_sector_copy.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -64,8 +66,34 @@ struct libodraw_track_value
 	uint64_t data_file_start_sector;
 
 	/* The data file offset
+	 * includes the size of the header of WAVE and AIFF data files
 	 */
 	off64_t data_file_offset;
+
+	/* The byte order of the audio samples in the data file
+	 */
+	uint8_t byte_order;
+
+	/* Value to indicate the 16-bit audio samples need to be byte swapped
+	 * when read, which is the case for audio tracks in big-endian data files
+	 */
+	uint8_t swap_samples;
+
+	/* The function to copy sectors to 2048 bytes per sector
+	 * contains NULL if the generic copy function is used
+	 */
+	libodraw_sector_copy_function_t copy_to_2048_function;
+
+	/* The function to copy sectors to 2352 bytes per sector
+	 * contains NULL if the generic copy function is used
+	 */
+	libodraw_sector_copy_function_t copy_to_2352_function;
+
+	/* The form map
+	 * contains the forms of the sectors of a Mode 2 track with XA sub-headers,
+	 * which are determined when the sectors are read, or NULL for other tracks
+	 */
+	libodraw_form_map_t *form_map;
 };
 
 int libodraw_track_value_initialize(
@@ -43,6 +43,31 @@ typedef intptr_t libodraw_handle_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The sector vector
+ * describes a range of sectors to be read into a buffer
+ */
+typedef struct libodraw_sector_vector libodraw_sector_vector_t;
+
+struct libodraw_sector_vector
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 * must be at least the number of sectors times the bytes per sector
+	 */
+	size_t buffer_size;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBODRAW ) */
 
 #endif /* !defined( _LIBODRAW_INTERNAL_TYPES_H ) */
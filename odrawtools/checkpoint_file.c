@@ -0,0 +1,925 @@
+/*
+ * Verification checkpoint file
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "checkpoint_file.h"
+#include "crc32_hash.h"
+#include "odrawtools_libcerror.h"
+#include "sha256_hash.h"
+#include "tree_hash.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define checkpoint_file_remove_file( filename ) \
+	_wremove( filename )
+
+#define checkpoint_file_rename_file( source_filename, destination_filename ) \
+	_wrename( source_filename, destination_filename )
+
+#else
+#define checkpoint_file_remove_file( filename ) \
+	remove( filename )
+
+#define checkpoint_file_rename_file( source_filename, destination_filename ) \
+	rename( source_filename, destination_filename )
+
+#endif
+
+#define CHECKPOINT_FILE_HEADER_SIZE		32
+#define CHECKPOINT_FILE_FOOTER_SIZE		4
+
+const uint8_t checkpoint_file_signature[ 8 ] = {
+	'O', 'D', 'R', 'A', 'W', 'C', 'K', 'P' };
+
+/* Determines the digest flags and the size of the checkpoint file data
+ * The flags of the SHA256 tree hash and CRC-32 are added to the digest flags
+ * Returns 1 if successful or -1 on error
+ */
+static int checkpoint_file_get_data_size(
+            off64_t offset,
+            tree_hash_t *sha256_tree_hash,
+            crc32_hash_t *crc32_hash,
+            size_t digest_state_size,
+            uint32_t *digest_flags,
+            size_t *data_size,
+            libcerror_error_t **error )
+{
+	static char *function      = "checkpoint_file_get_data_size";
+	uint64_t number_of_chunks  = 0;
+	uint64_t safe_data_size    = 0;
+	uint32_t safe_digest_flags = 0;
+
+	if( ( offset < 0 )
+	 || ( ( offset % CHECKPOINT_FILE_CHUNK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = (uint64_t) offset / CHECKPOINT_FILE_CHUNK_SIZE;
+	safe_data_size   = CHECKPOINT_FILE_HEADER_SIZE + CHECKPOINT_FILE_FOOTER_SIZE;
+
+	if( sha256_tree_hash != NULL )
+	{
+		if( number_of_chunks > sha256_tree_hash->number_of_chunks )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value exceeds SHA256 tree hash data size.",
+			 function );
+
+			return( -1 );
+		}
+		safe_digest_flags |= CHECKPOINT_FILE_DIGEST_FLAG_SHA256_TREE;
+		safe_data_size    += number_of_chunks * SHA256_HASH_SIZE;
+	}
+	if( crc32_hash != NULL )
+	{
+		if( number_of_chunks > crc32_hash->number_of_chunks )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value exceeds CRC-32 data size.",
+			 function );
+
+			return( -1 );
+		}
+		safe_digest_flags |= CHECKPOINT_FILE_DIGEST_FLAG_CRC32;
+		safe_data_size    += number_of_chunks * 4;
+	}
+	if( digest_state_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid digest state size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size += digest_state_size;
+
+	if( safe_data_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_flags |= safe_digest_flags;
+	*data_size     = (size_t) safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes a checkpoint file
+ * The digest flags and digest state contain the flags and the state of the digest hashes
+ * other than the SHA256 tree hash and CRC-32
+ * The checkpoint is written to a temporary file that replaces the checkpoint file
+ * once it was written completely, so that an interrupted write does not leave
+ * a partial checkpoint file behind
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_file_write(
+     const system_character_t *filename,
+     size64_t media_size,
+     off64_t offset,
+     tree_hash_t *sha256_tree_hash,
+     crc32_hash_t *crc32_hash,
+     uint32_t digest_flags,
+     const uint8_t *digest_state,
+     size_t digest_state_size,
+     libcerror_error_t **error )
+{
+	FILE *file_stream                      = NULL;
+	system_character_t *temporary_filename = NULL;
+	uint8_t *data                          = NULL;
+	static char *function                  = "checkpoint_file_write";
+	size_t data_offset                     = 0;
+	size_t data_size                       = 0;
+	size_t filename_length                 = 0;
+	size_t write_count                     = 0;
+	uint64_t chunk_index                   = 0;
+	uint64_t number_of_chunks              = 0;
+	uint32_t calculated_checksum           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset > media_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_state == NULL )
+	 && ( digest_state_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest state.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_file_get_data_size(
+	     offset,
+	     sha256_tree_hash,
+	     crc32_hash,
+	     digest_state_size,
+	     &digest_flags,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_chunks = (uint64_t) offset / CHECKPOINT_FILE_CHUNK_SIZE;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data,
+	     checkpoint_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 CHECKPOINT_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 digest_flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 media_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 (uint64_t) offset );
+
+	data_offset = CHECKPOINT_FILE_HEADER_SIZE;
+
+	if( ( sha256_tree_hash != NULL )
+	 && ( number_of_chunks > 0 ) )
+	{
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     sha256_tree_hash->chunk_hashes,
+		     (size_t) number_of_chunks * SHA256_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 tree chunk hashes.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) number_of_chunks * SHA256_HASH_SIZE;
+	}
+	if( crc32_hash != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 crc32_hash->chunk_values[ chunk_index ] );
+
+			data_offset += 4;
+		}
+	}
+	if( digest_state_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     digest_state,
+		     digest_state_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy digest state.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += digest_state_size;
+	}
+	if( crc32_hash_calculate(
+	     &calculated_checksum,
+	     data,
+	     data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ data_offset ] ),
+	 calculated_checksum );
+
+	filename_length = system_string_length(
+	                   filename );
+
+	temporary_filename = system_string_allocate(
+	                      filename_length + 5 );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".tmp" ),
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy temporary filename extension.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               temporary_filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	file_stream = file_stream_open(
+	               temporary_filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+#if defined( WINAPI )
+	/* On Windows rename fails if the destination file exists
+	 */
+	checkpoint_file_remove_file(
+	 filename );
+#endif
+	if( checkpoint_file_rename_file(
+	     temporary_filename,
+	     filename ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to rename temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( temporary_filename != NULL )
+	{
+		checkpoint_file_remove_file(
+		 temporary_filename );
+
+		memory_free(
+		 temporary_filename );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Reads a checkpoint file
+ * The digest hashes must be initialized for the media size and not yet updated,
+ * the same digest hashes must be calculated as when the checkpoint was written
+ * The digest flags and digest state size must match those of the checkpoint
+ * Returns 1 if successful, 0 if the checkpoint file could not be opened or -1 on error
+ */
+int checkpoint_file_read(
+     const system_character_t *filename,
+     size64_t media_size,
+     off64_t *offset,
+     tree_hash_t *sha256_tree_hash,
+     crc32_hash_t *crc32_hash,
+     uint32_t digest_flags,
+     uint8_t *digest_state,
+     size_t digest_state_size,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ CHECKPOINT_FILE_HEADER_SIZE ];
+
+	FILE *file_stream            = NULL;
+	uint8_t *data                = NULL;
+	static char *function        = "checkpoint_file_read";
+	size_t data_offset           = 0;
+	size_t data_size             = 0;
+	size_t read_count            = 0;
+	uint64_t checkpoint_offset   = 0;
+	uint64_t chunk_index         = 0;
+	uint64_t number_of_chunks    = 0;
+	uint64_t value_64bit         = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+	uint32_t value_32bit         = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_state == NULL )
+	 && ( digest_state_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	read_count = file_stream_read(
+	              file_stream,
+	              header_data,
+	              CHECKPOINT_FILE_HEADER_SIZE );
+
+	if( read_count != CHECKPOINT_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     header_data,
+	     checkpoint_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 value_32bit );
+
+	if( value_32bit != CHECKPOINT_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint format version: %" PRIu32 ".",
+		 function,
+		 value_32bit );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 16 ] ),
+	 value_64bit );
+
+	if( value_64bit != (uint64_t) media_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in checkpoint media size ( %" PRIu64 " != %" PRIu64 " ).",
+		 function,
+		 value_64bit,
+		 (uint64_t) media_size );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 24 ] ),
+	 checkpoint_offset );
+
+	if( ( checkpoint_offset > (uint64_t) media_size )
+	 || ( ( checkpoint_offset % CHECKPOINT_FILE_CHUNK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( checkpoint_file_get_data_size(
+	     (off64_t) checkpoint_offset,
+	     sha256_tree_hash,
+	     crc32_hash,
+	     digest_state_size,
+	     &digest_flags,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 value_32bit );
+
+	if( value_32bit != digest_flags )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in checkpoint digest types ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 value_32bit,
+		 digest_flags );
+
+		goto on_error;
+	}
+	number_of_chunks = checkpoint_offset / CHECKPOINT_FILE_CHUNK_SIZE;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data,
+	     header_data,
+	     CHECKPOINT_FILE_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy checkpoint header.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = file_stream_read(
+	              file_stream,
+	              &( data[ CHECKPOINT_FILE_HEADER_SIZE ] ),
+	              data_size - CHECKPOINT_FILE_HEADER_SIZE );
+
+	if( read_count != ( data_size - CHECKPOINT_FILE_HEADER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_read(
+	     file_stream,
+	     header_data,
+	     1 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported trailing data after checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	data_offset = data_size - CHECKPOINT_FILE_FOOTER_SIZE;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ data_offset ] ),
+	 stored_checksum );
+
+	if( crc32_hash_calculate(
+	     &calculated_checksum,
+	     data,
+	     data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checkpoint checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	data_offset = CHECKPOINT_FILE_HEADER_SIZE;
+
+	if( ( sha256_tree_hash != NULL )
+	 && ( number_of_chunks > 0 ) )
+	{
+		if( memory_copy(
+		     sha256_tree_hash->chunk_hashes,
+		     &( data[ data_offset ] ),
+		     (size_t) number_of_chunks * SHA256_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 tree chunk hashes.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) number_of_chunks * SHA256_HASH_SIZE;
+	}
+	if( crc32_hash != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 crc32_hash->chunk_values[ chunk_index ] );
+
+			data_offset += 4;
+		}
+	}
+	if( digest_state_size > 0 )
+	{
+		if( memory_copy(
+		     digest_state,
+		     &( data[ data_offset ] ),
+		     digest_state_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy digest state.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 data );
+
+	*offset = (off64_t) checkpoint_offset;
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Removes a checkpoint file
+ * Returns 1 if successful, 0 if the checkpoint file could not be removed or -1 on error
+ */
+int checkpoint_file_remove(
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_file_remove";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_file_remove_file(
+	     filename ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
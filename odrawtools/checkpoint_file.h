@@ -0,0 +1,101 @@
+/*
+ * Verification checkpoint file
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHECKPOINT_FILE_H )
+#define _CHECKPOINT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "crc32_hash.h"
+#include "odrawtools_libcerror.h"
+#include "tree_hash.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A checkpoint file contains the state of the digest hashes after the media data
+ * up to the checkpoint offset was verified. The checkpoint offset is a multitude of
+ * the chunk size of the SHA256 tree hash and CRC-32, so that no chunk is partially
+ * hashed and their state consists of the chunk hashes. The state of the digest hashes
+ * that are calculated sequentially, such as MD5 and XXH3, is provided by the caller.
+ *
+ * All values are stored in little-endian:
+ *  signature "ODRAWCKP"                8 bytes
+ *  format version                      4 bytes
+ *  digest flags                        4 bytes
+ *  media size                          8 bytes
+ *  checkpoint offset                   8 bytes
+ *  SHA256 tree chunk hashes            32 bytes per chunk before the checkpoint offset
+ *  CRC-32 chunk values                 4 bytes per chunk before the checkpoint offset
+ *  digest state                        variable
+ *  CRC-32 of the preceding data        4 bytes
+ *
+ * The data of the digest hashes that are not calculated is not stored.
+ */
+#define CHECKPOINT_FILE_CHUNK_SIZE		TREE_HASH_CHUNK_SIZE
+
+#define CHECKPOINT_FILE_FORMAT_VERSION		1
+
+enum CHECKPOINT_FILE_DIGEST_FLAGS
+{
+	CHECKPOINT_FILE_DIGEST_FLAG_SHA256_TREE	= 0x00000001UL,
+	CHECKPOINT_FILE_DIGEST_FLAG_CRC32	= 0x00000002UL,
+	CHECKPOINT_FILE_DIGEST_FLAG_XXH3	= 0x00000004UL,
+	CHECKPOINT_FILE_DIGEST_FLAG_MD5		= 0x00000008UL,
+	CHECKPOINT_FILE_DIGEST_FLAG_SHA1	= 0x00000010UL,
+	CHECKPOINT_FILE_DIGEST_FLAG_SHA256	= 0x00000020UL,
+	CHECKPOINT_FILE_DIGEST_FLAG_TRACKS	= 0x00000040UL
+};
+
+int checkpoint_file_write(
+     const system_character_t *filename,
+     size64_t media_size,
+     off64_t offset,
+     tree_hash_t *sha256_tree_hash,
+     crc32_hash_t *crc32_hash,
+     uint32_t digest_flags,
+     const uint8_t *digest_state,
+     size_t digest_state_size,
+     libcerror_error_t **error );
+
+int checkpoint_file_read(
+     const system_character_t *filename,
+     size64_t media_size,
+     off64_t *offset,
+     tree_hash_t *sha256_tree_hash,
+     crc32_hash_t *crc32_hash,
+     uint32_t digest_flags,
+     uint8_t *digest_state,
+     size_t digest_state_size,
+     libcerror_error_t **error );
+
+int checkpoint_file_remove(
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHECKPOINT_FILE_H ) */
+
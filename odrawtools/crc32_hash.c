@@ -0,0 +1,703 @@
+/*
+ * CRC-32 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "crc32_hash.h"
+#include "odrawtools_libcerror.h"
+
+#define CRC32_HASH_POLYNOMIAL	0xedb88320UL
+
+/* The slice-by-16 tables of the CRC-32 of all 8-bit messages
+ * table 0 contains the regular byte-wise table
+ */
+uint32_t crc32_hash_table[ 16 ][ 256 ];
+
+/* Value to indicate the CRC-32 table been computed
+ */
+int crc32_hash_table_computed = 0;
+
+/* Initializes the internal CRC-32 table
+ * The table is initialized once and used by all CRC-32 calculations
+ */
+void crc32_hash_initialize_table(
+      void )
+{
+	uint32_t crc32_value = 0;
+	uint16_t table_index = 0;
+	uint8_t bit_iterator = 0;
+	uint8_t slice_index  = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		crc32_value = (uint32_t) table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc32_value & 1 ) != 0 )
+			{
+				crc32_value = CRC32_HASH_POLYNOMIAL ^ ( crc32_value >> 1 );
+			}
+			else
+			{
+				crc32_value >>= 1;
+			}
+		}
+		crc32_hash_table[ 0 ][ table_index ] = crc32_value;
+	}
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		crc32_value = crc32_hash_table[ 0 ][ table_index ];
+
+		for( slice_index = 1;
+		     slice_index < 16;
+		     slice_index++ )
+		{
+			crc32_value = crc32_hash_table[ 0 ][ crc32_value & 0xff ] ^ ( crc32_value >> 8 );
+
+			crc32_hash_table[ slice_index ][ table_index ] = crc32_value;
+		}
+	}
+	crc32_hash_table_computed = 1;
+}
+
+/* Calculates the CRC-32 of a buffer
+ * Use a previous CRC-32 value to calculate the CRC-32 of successive buffers
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_hash_calculate(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_hash_calculate";
+	uint32_t safe_crc32   = 0;
+	uint32_t value_32bit1 = 0;
+	uint32_t value_32bit2 = 0;
+	uint32_t value_32bit3 = 0;
+	uint32_t value_32bit4 = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc32_hash_table_computed == 0 )
+	{
+		crc32_hash_initialize_table();
+	}
+	safe_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+
+	/* Process 16 bytes per iteration using the slice-by-16 tables
+	 */
+	while( size >= 16 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 buffer,
+		 value_32bit1 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 4 ] ),
+		 value_32bit2 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 8 ] ),
+		 value_32bit3 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 12 ] ),
+		 value_32bit4 );
+
+		value_32bit1 ^= safe_crc32;
+
+		safe_crc32 = crc32_hash_table[ 15 ][ value_32bit1 & 0xff ]
+		           ^ crc32_hash_table[ 14 ][ ( value_32bit1 >> 8 ) & 0xff ]
+		           ^ crc32_hash_table[ 13 ][ ( value_32bit1 >> 16 ) & 0xff ]
+		           ^ crc32_hash_table[ 12 ][ value_32bit1 >> 24 ]
+		           ^ crc32_hash_table[ 11 ][ value_32bit2 & 0xff ]
+		           ^ crc32_hash_table[ 10 ][ ( value_32bit2 >> 8 ) & 0xff ]
+		           ^ crc32_hash_table[ 9 ][ ( value_32bit2 >> 16 ) & 0xff ]
+		           ^ crc32_hash_table[ 8 ][ value_32bit2 >> 24 ]
+		           ^ crc32_hash_table[ 7 ][ value_32bit3 & 0xff ]
+		           ^ crc32_hash_table[ 6 ][ ( value_32bit3 >> 8 ) & 0xff ]
+		           ^ crc32_hash_table[ 5 ][ ( value_32bit3 >> 16 ) & 0xff ]
+		           ^ crc32_hash_table[ 4 ][ value_32bit3 >> 24 ]
+		           ^ crc32_hash_table[ 3 ][ value_32bit4 & 0xff ]
+		           ^ crc32_hash_table[ 2 ][ ( value_32bit4 >> 8 ) & 0xff ]
+		           ^ crc32_hash_table[ 1 ][ ( value_32bit4 >> 16 ) & 0xff ]
+		           ^ crc32_hash_table[ 0 ][ value_32bit4 >> 24 ];
+
+		buffer += 16;
+		size   -= 16;
+	}
+	while( size > 0 )
+	{
+		safe_crc32 = crc32_hash_table[ 0 ][ ( safe_crc32 ^ *buffer ) & 0xff ] ^ ( safe_crc32 >> 8 );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	*crc32 = safe_crc32 ^ (uint32_t) 0xffffffffUL;
+
+	return( 1 );
+}
+
+/* Multiplies two polynomials modulus the CRC-32 polynomial
+ * The polynomials are stored reflected, where the most significant bit is x^0
+ * Returns the product
+ */
+static uint32_t crc32_hash_multiply(
+                 uint32_t first_polynomial,
+                 uint32_t second_polynomial )
+{
+	uint32_t bit_mask = (uint32_t) 0x80000000UL;
+	uint32_t product  = 0;
+
+	while( bit_mask != 0 )
+	{
+		if( ( first_polynomial & bit_mask ) != 0 )
+		{
+			product ^= second_polynomial;
+		}
+		if( ( second_polynomial & 1 ) != 0 )
+		{
+			second_polynomial = ( second_polynomial >> 1 ) ^ CRC32_HASH_POLYNOMIAL;
+		}
+		else
+		{
+			second_polynomial >>= 1;
+		}
+		bit_mask >>= 1;
+	}
+	return( product );
+}
+
+/* Combines the CRC-32 of two successive buffers into the CRC-32 of both buffers
+ * This requires only the size of the second buffer, not its data, by shifting
+ * the first CRC-32 by x^(8 * size) modulus the CRC-32 polynomial
+ * Returns the combined CRC-32
+ */
+uint32_t crc32_hash_combine(
+          uint32_t first_crc32,
+          uint32_t second_crc32,
+          size64_t second_size )
+{
+	uint32_t power_of_x  = (uint32_t) 0x40000000UL;
+	uint32_t shift_value = (uint32_t) 0x80000000UL;
+
+	/* Since the size is in bytes start with x^8, which is x squared 3 times
+	 */
+	power_of_x = crc32_hash_multiply(
+	              power_of_x,
+	              power_of_x );
+	power_of_x = crc32_hash_multiply(
+	              power_of_x,
+	              power_of_x );
+	power_of_x = crc32_hash_multiply(
+	              power_of_x,
+	              power_of_x );
+
+	/* Calculate x^(8 * size) by square and multiply
+	 */
+	while( second_size != 0 )
+	{
+		if( ( second_size & 1 ) != 0 )
+		{
+			shift_value = crc32_hash_multiply(
+			               power_of_x,
+			               shift_value );
+		}
+		power_of_x = crc32_hash_multiply(
+		              power_of_x,
+		              power_of_x );
+
+		second_size >>= 1;
+	}
+	return( crc32_hash_multiply(
+	         shift_value,
+	         first_crc32 ) ^ second_crc32 );
+}
+
+/* Creates a CRC-32 hash
+ * Make sure the value crc32_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_hash_initialize(
+     crc32_hash_t **crc32_hash,
+     size64_t data_size,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function     = "crc32_hash_initialize";
+	uint64_t number_of_chunks = 0;
+
+	if( crc32_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crc32_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CRC-32 hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_workers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of workers value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = data_size / CRC32_HASH_CHUNK_SIZE;
+
+	if( ( data_size % CRC32_HASH_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( number_of_chunks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the table is computed before the workers are started
+	 */
+	if( crc32_hash_table_computed == 0 )
+	{
+		crc32_hash_initialize_table();
+	}
+	*crc32_hash = memory_allocate_structure(
+	               crc32_hash_t );
+
+	if( *crc32_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create CRC-32 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *crc32_hash,
+	     0,
+	     sizeof( crc32_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear CRC-32 hash.",
+		 function );
+
+		memory_free(
+		 *crc32_hash );
+
+		*crc32_hash = NULL;
+
+		return( -1 );
+	}
+	if( number_of_chunks > 0 )
+	{
+		( *crc32_hash )->chunk_values = (uint32_t *) memory_allocate(
+		                                              sizeof( uint32_t ) * (size_t) number_of_chunks );
+
+		if( ( *crc32_hash )->chunk_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk values.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *crc32_hash )->chunk_values,
+		     0,
+		     sizeof( uint32_t ) * (size_t) number_of_chunks ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *crc32_hash )->data_size         = data_size;
+	( *crc32_hash )->number_of_chunks  = number_of_chunks;
+	( *crc32_hash )->number_of_workers = number_of_workers;
+
+	return( 1 );
+
+on_error:
+	if( *crc32_hash != NULL )
+	{
+		if( ( *crc32_hash )->chunk_values != NULL )
+		{
+			memory_free(
+			 ( *crc32_hash )->chunk_values );
+		}
+		memory_free(
+		 *crc32_hash );
+
+		*crc32_hash = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a CRC-32 hash
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_hash_free(
+     crc32_hash_t **crc32_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_hash_free";
+
+	if( crc32_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crc32_hash != NULL )
+	{
+		if( ( *crc32_hash )->chunk_values != NULL )
+		{
+			memory_free(
+			 ( *crc32_hash )->chunk_values );
+		}
+		memory_free(
+		 *crc32_hash );
+
+		*crc32_hash = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the default number of workers, which is the number of processors
+ * up to the maximum number of CRC-32 workers
+ * Returns the number of workers
+ */
+int crc32_hash_get_default_number_of_workers(
+     void )
+{
+#if defined( WINAPI )
+	SYSTEM_INFO system_info;
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	long number_of_processors = 0;
+#endif
+	int number_of_workers = 1;
+
+#if defined( WINAPI )
+	GetSystemInfo(
+	 &system_info );
+
+	if( system_info.dwNumberOfProcessors > (DWORD) CRC32_HASH_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		number_of_workers = CRC32_HASH_MAXIMUM_NUMBER_OF_WORKERS;
+	}
+	else if( system_info.dwNumberOfProcessors > 0 )
+	{
+		number_of_workers = (int) system_info.dwNumberOfProcessors;
+	}
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_processors = sysconf(
+	                        _SC_NPROCESSORS_ONLN );
+
+	if( number_of_processors > (long) CRC32_HASH_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		number_of_workers = CRC32_HASH_MAXIMUM_NUMBER_OF_WORKERS;
+	}
+	else if( number_of_processors > 0 )
+	{
+		number_of_workers = (int) number_of_processors;
+	}
+#endif
+	return( number_of_workers );
+}
+
+/* Updates the CRC-32 hash with the data of a specific worker
+ * Every worker is passed all the data in order and only calculates the CRC-32
+ * of the chunks that are assigned to it, hence the workers can be run concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_hash_update(
+     crc32_hash_t *crc32_hash,
+     int worker_index,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "crc32_hash_update";
+	uint64_t chunk_end_offset = 0;
+	uint64_t chunk_index      = 0;
+	uint64_t current_offset   = 0;
+	size_t buffer_offset      = 0;
+	size_t update_size        = 0;
+
+	if( crc32_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= crc32_hash->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size > (size_t) SSIZE_MAX )
+	 || ( (size64_t) buffer_size > crc32_hash->data_size )
+	 || ( (size64_t) offset > ( crc32_hash->data_size - buffer_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		current_offset   = (uint64_t) offset + buffer_offset;
+		chunk_index      = current_offset / CRC32_HASH_CHUNK_SIZE;
+		chunk_end_offset = ( chunk_index + 1 ) * CRC32_HASH_CHUNK_SIZE;
+
+		if( chunk_end_offset > crc32_hash->data_size )
+		{
+			chunk_end_offset = crc32_hash->data_size;
+		}
+		update_size = buffer_size - buffer_offset;
+
+		if( (uint64_t) update_size > ( chunk_end_offset - current_offset ) )
+		{
+			update_size = (size_t) ( chunk_end_offset - current_offset );
+		}
+		if( (int) ( chunk_index % crc32_hash->number_of_workers ) == worker_index )
+		{
+			if( crc32_hash_calculate(
+			     &( crc32_hash->chunk_values[ chunk_index ] ),
+			     &( buffer[ buffer_offset ] ),
+			     update_size,
+			     crc32_hash->chunk_values[ chunk_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate chunk: %" PRIu64 " CRC-32.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += update_size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the CRC-32 hash
+ * The CRC-32 of the chunks are combined into the CRC-32 of the data,
+ * which is stored as a 32-bit big-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_hash_finalize(
+     crc32_hash_t *crc32_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_hash_finalize";
+	size64_t chunk_size   = 0;
+	uint64_t chunk_index  = 0;
+	uint32_t crc32        = 0;
+
+	if( crc32_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < CRC32_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < crc32_hash->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_size = CRC32_HASH_CHUNK_SIZE;
+
+		if( ( chunk_index + 1 ) == crc32_hash->number_of_chunks )
+		{
+			chunk_size = crc32_hash->data_size - ( chunk_index * CRC32_HASH_CHUNK_SIZE );
+		}
+		crc32 = crc32_hash_combine(
+		         crc32,
+		         crc32_hash->chunk_values[ chunk_index ],
+		         chunk_size );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 hash,
+	 crc32 );
+
+	return( 1 );
+}
+
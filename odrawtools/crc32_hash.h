@@ -0,0 +1,122 @@
+/*
+ * CRC-32 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CRC32_HASH_H )
+#define _CRC32_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The CRC-32 is the CRC-32 used by Ethernet, zlib and gzip, with the (reversed) polynomial 0xedb88320
+ * which is calculated least significant bit first with pre and post conditioning
+ *
+ * To calculate the CRC-32 concurrently the data is split into chunks of 1 MiB (1048576 bytes),
+ * where only the last chunk can be smaller. The CRC-32 of every chunk is calculated independently
+ * and the CRC-32 of the data is the combination of the CRC-32 of all the chunks.
+ */
+#define CRC32_HASH_CHUNK_SIZE		1048576
+
+/* The size of a CRC-32 hash
+ */
+#define CRC32_HASH_SIZE			4
+
+/* The maximum number of workers that calculate chunk CRC-32 values concurrently
+ * the slice-by-16 calculation of a single worker is several times faster than
+ * SHA256, hence fewer workers are needed to keep up with reading the data
+ */
+#define CRC32_HASH_MAXIMUM_NUMBER_OF_WORKERS	4
+
+typedef struct crc32_hash crc32_hash_t;
+
+struct crc32_hash
+{
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The number of chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The CRC-32 values of the chunks
+	 */
+	uint32_t *chunk_values;
+
+	/* The number of workers
+	 * chunk N is calculated by worker N modulus the number of workers
+	 */
+	int number_of_workers;
+};
+
+void crc32_hash_initialize_table(
+      void );
+
+int crc32_hash_calculate(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+uint32_t crc32_hash_combine(
+          uint32_t first_crc32,
+          uint32_t second_crc32,
+          size64_t second_size );
+
+int crc32_hash_initialize(
+     crc32_hash_t **crc32_hash,
+     size64_t data_size,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int crc32_hash_free(
+     crc32_hash_t **crc32_hash,
+     libcerror_error_t **error );
+
+int crc32_hash_get_default_number_of_workers(
+     void );
+
+int crc32_hash_update(
+     crc32_hash_t *crc32_hash,
+     int worker_index,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int crc32_hash_finalize(
+     crc32_hash_t *crc32_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CRC32_HASH_H ) */
+
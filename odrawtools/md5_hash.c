@@ -0,0 +1,682 @@
+/*
+ * MD5 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "md5_hash.h"
+#include "odrawtools_libcerror.h"
+
+#define md5_hash_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 32 - ( number_of_bits ) ) ) )
+
+#define md5_hash_step( function, value_a, value_b, value_c, value_d, value, constant, number_of_bits ) \
+	value_a += function( value_b, value_c, value_d ) + value + constant; \
+	value_a  = md5_hash_rotate_left( value_a, number_of_bits ) + value_b
+
+#define md5_hash_function_f( value_b, value_c, value_d ) \
+	( value_d ^ ( value_b & ( value_c ^ value_d ) ) )
+
+#define md5_hash_function_g( value_b, value_c, value_d ) \
+	( value_c ^ ( value_d & ( value_b ^ value_c ) ) )
+
+#define md5_hash_function_h( value_b, value_c, value_d ) \
+	( value_b ^ value_c ^ value_d )
+
+#define md5_hash_function_i( value_b, value_c, value_d ) \
+	( value_c ^ ( value_b | ~value_d ) )
+
+/* The MD5 constants, which are the integer parts of the sines of the integers 1 to 64 multiplied by 2^32
+ */
+static const uint32_t md5_hash_constants[ 64 ] = {
+	0xd76aa478UL, 0xe8c7b756UL, 0x242070dbUL, 0xc1bdceeeUL,
+	0xf57c0fafUL, 0x4787c62aUL, 0xa8304613UL, 0xfd469501UL,
+	0x698098d8UL, 0x8b44f7afUL, 0xffff5bb1UL, 0x895cd7beUL,
+	0x6b901122UL, 0xfd987193UL, 0xa679438eUL, 0x49b40821UL,
+	0xf61e2562UL, 0xc040b340UL, 0x265e5a51UL, 0xe9b6c7aaUL,
+	0xd62f105dUL, 0x02441453UL, 0xd8a1e681UL, 0xe7d3fbc8UL,
+	0x21e1cde6UL, 0xc33707d6UL, 0xf4d50d87UL, 0x455a14edUL,
+	0xa9e3e905UL, 0xfcefa3f8UL, 0x676f02d9UL, 0x8d2a4c8aUL,
+	0xfffa3942UL, 0x8771f681UL, 0x6d9d6122UL, 0xfde5380cUL,
+	0xa4beea44UL, 0x4bdecfa9UL, 0xf6bb4b60UL, 0xbebfbc70UL,
+	0x289b7ec6UL, 0xeaa127faUL, 0xd4ef3085UL, 0x04881d05UL,
+	0xd9d4d039UL, 0xe6db99e5UL, 0x1fa27cf8UL, 0xc4ac5665UL,
+	0xf4292244UL, 0x432aff97UL, 0xab9423a7UL, 0xfc93a039UL,
+	0x655b59c3UL, 0x8f0ccc92UL, 0xffeff47dUL, 0x85845dd1UL,
+	0x6fa87e4fUL, 0xfe2ce6e0UL, 0xa3014314UL, 0x4e0811a1UL,
+	0xf7537e82UL, 0xbd3af235UL, 0x2ad7d2bbUL, 0xeb86d391UL
+};
+
+/* Calculates the MD5 hash of a number of 64-byte blocks
+ */
+static void md5_hash_transform(
+             uint32_t *hash_values,
+             const uint8_t *data,
+             size_t number_of_blocks )
+{
+	uint32_t values[ 16 ];
+
+	uint32_t value_a = 0;
+	uint32_t value_b = 0;
+	uint32_t value_c = 0;
+	uint32_t value_d = 0;
+	int round_index  = 0;
+	int value_index  = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( value_index = 0;
+		     value_index < 16;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ value_index * 4 ] ),
+			 values[ value_index ] );
+		}
+		value_a = hash_values[ 0 ];
+		value_b = hash_values[ 1 ];
+		value_c = hash_values[ 2 ];
+		value_d = hash_values[ 3 ];
+
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index += 4 )
+		{
+			md5_hash_step( md5_hash_function_f, value_a, value_b, value_c, value_d, values[ round_index ], md5_hash_constants[ round_index ], 7 );
+			md5_hash_step( md5_hash_function_f, value_d, value_a, value_b, value_c, values[ round_index + 1 ], md5_hash_constants[ round_index + 1 ], 12 );
+			md5_hash_step( md5_hash_function_f, value_c, value_d, value_a, value_b, values[ round_index + 2 ], md5_hash_constants[ round_index + 2 ], 17 );
+			md5_hash_step( md5_hash_function_f, value_b, value_c, value_d, value_a, values[ round_index + 3 ], md5_hash_constants[ round_index + 3 ], 22 );
+		}
+		for( round_index = 16;
+		     round_index < 32;
+		     round_index += 4 )
+		{
+			md5_hash_step( md5_hash_function_g, value_a, value_b, value_c, value_d, values[ ( ( 5 * round_index ) + 1 ) & 0x0f ], md5_hash_constants[ round_index ], 5 );
+			md5_hash_step( md5_hash_function_g, value_d, value_a, value_b, value_c, values[ ( ( 5 * round_index ) + 6 ) & 0x0f ], md5_hash_constants[ round_index + 1 ], 9 );
+			md5_hash_step( md5_hash_function_g, value_c, value_d, value_a, value_b, values[ ( ( 5 * round_index ) + 11 ) & 0x0f ], md5_hash_constants[ round_index + 2 ], 14 );
+			md5_hash_step( md5_hash_function_g, value_b, value_c, value_d, value_a, values[ ( 5 * round_index ) & 0x0f ], md5_hash_constants[ round_index + 3 ], 20 );
+		}
+		for( round_index = 32;
+		     round_index < 48;
+		     round_index += 4 )
+		{
+			md5_hash_step( md5_hash_function_h, value_a, value_b, value_c, value_d, values[ ( ( 3 * round_index ) + 5 ) & 0x0f ], md5_hash_constants[ round_index ], 4 );
+			md5_hash_step( md5_hash_function_h, value_d, value_a, value_b, value_c, values[ ( ( 3 * round_index ) + 8 ) & 0x0f ], md5_hash_constants[ round_index + 1 ], 11 );
+			md5_hash_step( md5_hash_function_h, value_c, value_d, value_a, value_b, values[ ( ( 3 * round_index ) + 11 ) & 0x0f ], md5_hash_constants[ round_index + 2 ], 16 );
+			md5_hash_step( md5_hash_function_h, value_b, value_c, value_d, value_a, values[ ( ( 3 * round_index ) + 14 ) & 0x0f ], md5_hash_constants[ round_index + 3 ], 23 );
+		}
+		for( round_index = 48;
+		     round_index < 64;
+		     round_index += 4 )
+		{
+			md5_hash_step( md5_hash_function_i, value_a, value_b, value_c, value_d, values[ ( 7 * round_index ) & 0x0f ], md5_hash_constants[ round_index ], 6 );
+			md5_hash_step( md5_hash_function_i, value_d, value_a, value_b, value_c, values[ ( ( 7 * round_index ) + 7 ) & 0x0f ], md5_hash_constants[ round_index + 1 ], 10 );
+			md5_hash_step( md5_hash_function_i, value_c, value_d, value_a, value_b, values[ ( ( 7 * round_index ) + 14 ) & 0x0f ], md5_hash_constants[ round_index + 2 ], 15 );
+			md5_hash_step( md5_hash_function_i, value_b, value_c, value_d, value_a, values[ ( ( 7 * round_index ) + 21 ) & 0x0f ], md5_hash_constants[ round_index + 3 ], 21 );
+		}
+		hash_values[ 0 ] += value_a;
+		hash_values[ 1 ] += value_b;
+		hash_values[ 2 ] += value_c;
+		hash_values[ 3 ] += value_d;
+
+		data             += MD5_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+/* Creates a MD5 hash
+ * Make sure the value md5_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int md5_hash_initialize(
+     md5_hash_t **md5_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_hash_initialize";
+
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *md5_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MD5 hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*md5_hash = memory_allocate_structure(
+	            md5_hash_t );
+
+	if( *md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *md5_hash,
+	     0,
+	     sizeof( md5_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MD5 hash.",
+		 function );
+
+		memory_free(
+		 *md5_hash );
+
+		*md5_hash = NULL;
+
+		return( -1 );
+	}
+	( *md5_hash )->hash_values[ 0 ] = 0x67452301UL;
+	( *md5_hash )->hash_values[ 1 ] = 0xefcdab89UL;
+	( *md5_hash )->hash_values[ 2 ] = 0x98badcfeUL;
+	( *md5_hash )->hash_values[ 3 ] = 0x10325476UL;
+
+	return( 1 );
+}
+
+/* Frees a MD5 hash
+ * Returns 1 if successful or -1 on error
+ */
+int md5_hash_free(
+     md5_hash_t **md5_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "md5_hash_free";
+
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *md5_hash != NULL )
+	{
+		memory_free(
+		 *md5_hash );
+
+		*md5_hash = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the MD5 hash
+ * Returns 1 if successful or -1 on error
+ */
+int md5_hash_update(
+     md5_hash_t *md5_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "md5_hash_update";
+	size_t fill_size        = 0;
+	size_t number_of_blocks = 0;
+
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	md5_hash->data_size += size;
+
+	if( md5_hash->buffer_data_size > 0 )
+	{
+		fill_size = MD5_HASH_BLOCK_SIZE - md5_hash->buffer_data_size;
+
+		if( fill_size > size )
+		{
+			fill_size = size;
+		}
+		if( memory_copy(
+		     &( md5_hash->buffer[ md5_hash->buffer_data_size ] ),
+		     buffer,
+		     fill_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		md5_hash->buffer_data_size += fill_size;
+
+		buffer += fill_size;
+		size   -= fill_size;
+
+		if( md5_hash->buffer_data_size < MD5_HASH_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		md5_hash_transform(
+		 md5_hash->hash_values,
+		 md5_hash->buffer,
+		 1 );
+
+		md5_hash->buffer_data_size = 0;
+	}
+	number_of_blocks = size / MD5_HASH_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		md5_hash_transform(
+		 md5_hash->hash_values,
+		 buffer,
+		 number_of_blocks );
+
+		buffer += number_of_blocks * MD5_HASH_BLOCK_SIZE;
+		size   -= number_of_blocks * MD5_HASH_BLOCK_SIZE;
+	}
+	if( size > 0 )
+	{
+		if( memory_copy(
+		     md5_hash->buffer,
+		     buffer,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		md5_hash->buffer_data_size = size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the MD5 hash
+ * The hash values and buffer are not changed so that the hash can be finalized more than once
+ * Returns 1 if successful or -1 on error
+ */
+int md5_hash_finalize(
+     md5_hash_t *md5_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t blocks[ 2 * MD5_HASH_BLOCK_SIZE ];
+	uint32_t hash_values[ 4 ];
+
+	static char *function   = "md5_hash_finalize";
+	size_t blocks_data_size = 0;
+	uint64_t bit_size       = 0;
+	int value_index         = 0;
+
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		hash_values[ value_index ] = md5_hash->hash_values[ value_index ];
+	}
+	/* The padding consists of a 0x80 byte value, 0-byte values and the size of the data in bits
+	 * as a 64-bit little-endian value at the end of the last block
+	 */
+	blocks_data_size = MD5_HASH_BLOCK_SIZE;
+
+	if( md5_hash->buffer_data_size >= ( MD5_HASH_BLOCK_SIZE - 8 ) )
+	{
+		blocks_data_size += MD5_HASH_BLOCK_SIZE;
+	}
+	if( memory_set(
+	     blocks,
+	     0,
+	     2 * MD5_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     blocks,
+	     md5_hash->buffer,
+	     md5_hash->buffer_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	blocks[ md5_hash->buffer_data_size ] = 0x80;
+
+	bit_size = (uint64_t) md5_hash->data_size * 8;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( blocks[ blocks_data_size - 8 ] ),
+	 bit_size );
+
+	md5_hash_transform(
+	 hash_values,
+	 blocks,
+	 blocks_data_size / MD5_HASH_BLOCK_SIZE );
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ value_index * 4 ] ),
+		 hash_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash to a byte stream
+ * The state is stored as:
+ *   the 4 hash values as 32-bit little-endian values
+ *   the block buffer
+ *   the block buffer data size as 32-bit little-endian value
+ *   the total data size as 64-bit little-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int md5_hash_copy_state_to_byte_stream(
+     md5_hash_t *md5_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "md5_hash_copy_state_to_byte_stream";
+	size_t byte_stream_offset = 0;
+	int value_index           = 0;
+
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < MD5_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 md5_hash->hash_values[ value_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( memory_copy(
+	     &( byte_stream[ byte_stream_offset ] ),
+	     md5_hash->buffer,
+	     MD5_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset += MD5_HASH_BLOCK_SIZE;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 (uint32_t) md5_hash->buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 md5_hash->data_size );
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int md5_hash_copy_state_from_byte_stream(
+     md5_hash_t *md5_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "md5_hash_copy_state_from_byte_stream";
+	size_t byte_stream_offset = 0;
+	uint64_t value_64bit      = 0;
+	uint32_t buffer_data_size = 0;
+	int value_index           = 0;
+
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < MD5_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = ( 4 * 4 ) + MD5_HASH_BLOCK_SIZE;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 value_64bit );
+
+	/* A full block is always processed hence the buffer cannot contain a full block
+	 */
+	if( ( buffer_data_size >= MD5_HASH_BLOCK_SIZE )
+	 || ( ( value_64bit % MD5_HASH_BLOCK_SIZE ) != buffer_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = 0;
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 md5_hash->hash_values[ value_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( memory_copy(
+	     md5_hash->buffer,
+	     &( byte_stream[ byte_stream_offset ] ),
+	     MD5_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	md5_hash->buffer_data_size = (size_t) buffer_data_size;
+	md5_hash->data_size        = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
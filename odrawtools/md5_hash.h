@@ -0,0 +1,108 @@
+/*
+ * MD5 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MD5_HASH_H )
+#define _MD5_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The MD5 hash is calculated as specified in RFC 1321
+ * The intermediate state can be stored so that the hash can be continued later
+ */
+
+/* The size of a MD5 hash
+ */
+#define MD5_HASH_SIZE			16
+
+/* The size of a block
+ */
+#define MD5_HASH_BLOCK_SIZE		64
+
+/* The size of the intermediate state of the hash
+ */
+#define MD5_HASH_STATE_SIZE		( ( 4 * 4 ) + MD5_HASH_BLOCK_SIZE + 4 + 8 )
+
+typedef struct md5_hash md5_hash_t;
+
+struct md5_hash
+{
+	/* The hash values
+	 */
+	uint32_t hash_values[ 4 ];
+
+	/* The block buffer
+	 */
+	uint8_t buffer[ MD5_HASH_BLOCK_SIZE ];
+
+	/* The block buffer data size
+	 */
+	size_t buffer_data_size;
+
+	/* The total data size
+	 */
+	size64_t data_size;
+};
+
+int md5_hash_initialize(
+     md5_hash_t **md5_hash,
+     libcerror_error_t **error );
+
+int md5_hash_free(
+     md5_hash_t **md5_hash,
+     libcerror_error_t **error );
+
+int md5_hash_update(
+     md5_hash_t *md5_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int md5_hash_finalize(
+     md5_hash_t *md5_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int md5_hash_copy_state_to_byte_stream(
+     md5_hash_t *md5_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int md5_hash_copy_state_from_byte_stream(
+     md5_hash_t *md5_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MD5_HASH_H ) */
+
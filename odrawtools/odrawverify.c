@@ -60,20 +60,37 @@ void usage_fprint(
 	fprintf( stream, "Use odrawverify to verify data stored in the optical disc (split)\n"
 	                 "RAW image file format.\n\n" );
 
-	fprintf( stream, "Usage: odrawverify [ -d digest_type ] [ -l log_filename ]\n"
-	                 "                   [ -p process_buffer_size ] [ -hqvV ]\n"
-	                 "                   source\n\n" );
+	fprintf( stream, "Usage: odrawverify [ -b bytes_per_sector ] [ -c checkpoint_filename ]\n"
+	                 "                   [ -d digest_type ] [ -l log_filename ]\n"
+	                 "                   [ -p process_buffer_size ] [ -hqrtuvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source table of contents (TOC) file\n"
 	                 "\t        supported TOC file types: CDRWIN CUE\n\n" );
 
+	fprintf( stream, "\t-b:     specify the bytes per sector of the data that is verified,\n"
+	                 "\t        options: 2048 (default), 2352\n" );
+	fprintf( stream, "\t-c:     periodically write a checkpoint of the digest (hash) state\n"
+	                 "\t        to checkpoint_filename, which is removed after verification\n"
+	                 "\t        completes, at most once every 60 seconds. The digests are\n"
+	                 "\t        calculated the same with or without checkpoints, the cost\n"
+	                 "\t        is the time needed to write the checkpoint file\n" );
 	fprintf( stream, "\t-d:     calculate additional digest (hash) types besides md5,\n"
-	                 "\t        options: sha1, sha256\n" );
+	                 "\t        options: sha1, sha256, sha256-tree, crc32, xxh3\n"
+	                 "\t        sha256-tree is the RFC 6962 Merkle tree hash of the SHA256\n"
+	                 "\t        hashes of 1 MiB chunks, which are calculated concurrently\n"
+	                 "\t        crc32 and xxh3 (XXH3 64-bit) are fast non-cryptographic\n"
+	                 "\t        checksums, which are not calculated per track\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-l:     logs verification errors and the digest (hash) to the\n"
 	                 "\t        log_filename\n" );
 	fprintf( stream, "\t-p:     specify the process buffer size (default is the 32768)\n" );
 	fprintf( stream, "\t-q:     quiet shows minimal status information\n" );
+	fprintf( stream, "\t-r:     resume the verification from the checkpoint in\n"
+	                 "\t        checkpoint_filename, if it exists\n" );
+	fprintf( stream, "\t-t:     calculate the digest (hash) of every track as well, using\n"
+	                 "\t        the same read of the data\n" );
+	fprintf( stream, "\t-u:     unbuffered, read the data files using direct IO, which\n"
+	                 "\t        bypasses the page cache of the operating system\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -132,14 +149,19 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error                           = NULL;
 	log_handle_t *log_handle                           = NULL;
+	system_character_t *checkpoint_filename            = NULL;
 	system_character_t *log_filename                   = NULL;
 	system_character_t *option_additional_digest_types = NULL;
+	system_character_t *option_bytes_per_sector        = NULL;
 	system_character_t *option_process_buffer_size     = NULL;
 	system_character_t *program                        = _SYSTEM_STRING( "odrawverify" );
 	system_character_t *source                         = NULL;
 	system_integer_t option                            = 0;
 	uint8_t calculate_md5                              = 1;
+	uint8_t calculate_track_digests                    = 0;
 	uint8_t print_status_information                   = 1;
+	uint8_t resume                                     = 0;
+	uint8_t use_direct_io                              = 0;
 	uint8_t verbose                                    = 0;
 	int result                                         = 0;
 
@@ -176,7 +198,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = odrawtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "d:hl:p:qvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "b:c:d:hl:p:qrtuvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -192,6 +214,16 @@ int main( int argc, char * const argv[] )
 
 				goto on_error;
 
+			case (system_integer_t) 'b':
+				option_bytes_per_sector = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				checkpoint_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'd':
 				option_additional_digest_types = optarg;
 
@@ -218,6 +250,21 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'r':
+				resume = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				calculate_track_digests = 1;
+
+				break;
+
+			case (system_integer_t) 'u':
+				use_direct_io = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -243,6 +290,18 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( resume != 0 )
+	 && ( checkpoint_filename == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing checkpoint file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_verbose_set(
 	 verbose );
 
@@ -290,6 +349,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported process buffer size defaulting to: 32768.\n" );
 		}
 	}
+	if( option_bytes_per_sector != NULL )
+	{
+		result = verification_handle_set_bytes_per_sector(
+			  odrawverify_verification_handle,
+			  option_bytes_per_sector,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set bytes per sector.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported bytes per sector defaulting to: 2048.\n" );
+		}
+	}
 	if( option_additional_digest_types != NULL )
 	{
 		result = verification_handle_set_additional_digest_types(
@@ -306,6 +387,24 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( checkpoint_filename != NULL )
+	{
+		if( verification_handle_set_checkpoint_filename(
+		     odrawverify_verification_handle,
+		     checkpoint_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set checkpoint filename.\n" );
+
+			goto on_error;
+		}
+		odrawverify_verification_handle->resume = resume;
+	}
+	odrawverify_verification_handle->calculate_track_digests = calculate_track_digests;
+	odrawverify_verification_handle->use_direct_io           = use_direct_io;
+
 	if( odrawtools_signal_attach(
 	     odrawverify_signal_handler,
 	     &error ) != 1 )
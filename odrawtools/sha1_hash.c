@@ -0,0 +1,958 @@
+/*
+ * SHA1 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "sha1_hash.h"
+#include "odrawtools_libcerror.h"
+
+#if defined( SHA1_HASH_HAVE_SHA_NI )
+#include <immintrin.h>
+#endif
+
+#define sha1_hash_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 32 - ( number_of_bits ) ) ) )
+
+#define sha1_hash_step( function, value_a, value_b, value_c, value_d, value_e, value ) \
+	value_e += sha1_hash_rotate_left( value_a, 5 ) + function( value_b, value_c, value_d ) + value; \
+	value_b  = sha1_hash_rotate_left( value_b, 30 )
+
+#define sha1_hash_schedule( values, value_index ) \
+	( values[ ( value_index ) & 15 ] = sha1_hash_rotate_left( \
+	   values[ ( ( value_index ) + 13 ) & 15 ] ^ values[ ( ( value_index ) + 8 ) & 15 ] ^ values[ ( ( value_index ) + 2 ) & 15 ] ^ values[ ( value_index ) & 15 ], 1 ) )
+
+#define sha1_hash_function_f( value_b, value_c, value_d ) \
+	( ( value_d ^ ( value_b & ( value_c ^ value_d ) ) ) + 0x5a827999UL )
+
+#define sha1_hash_function_g( value_b, value_c, value_d ) \
+	( ( value_b ^ value_c ^ value_d ) + 0x6ed9eba1UL )
+
+#define sha1_hash_function_h( value_b, value_c, value_d ) \
+	( ( ( value_b & value_c ) | ( value_d & ( value_b | value_c ) ) ) + 0x8f1bbcdcUL )
+
+#define sha1_hash_function_i( value_b, value_c, value_d ) \
+	( ( value_b ^ value_c ^ value_d ) + 0xca62c1d6UL )
+
+/* The transform used by the SHA1 hash
+ * the transform is determined on first use, which is safe to race since
+ * every thread will determine the same transform
+ */
+static sha1_hash_transform_t sha1_hash_transform_function = NULL;
+
+/* Calculates the SHA1 hash of a number of 64-byte blocks
+ * The message schedule is calculated in place in 16 values as the rounds progress
+ */
+void sha1_hash_transform_scalar(
+      uint32_t *hash_values,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+	uint32_t values[ 16 ];
+
+	uint32_t value_a = 0;
+	uint32_t value_b = 0;
+	uint32_t value_c = 0;
+	uint32_t value_d = 0;
+	uint32_t value_e = 0;
+	int value_index  = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( value_index = 0;
+		     value_index < 16;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( data[ value_index * 4 ] ),
+			 values[ value_index ] );
+		}
+		value_a = hash_values[ 0 ];
+		value_b = hash_values[ 1 ];
+		value_c = hash_values[ 2 ];
+		value_d = hash_values[ 3 ];
+		value_e = hash_values[ 4 ];
+
+		for( value_index = 0;
+		     value_index < 15;
+		     value_index += 5 )
+		{
+			sha1_hash_step( sha1_hash_function_f, value_a, value_b, value_c, value_d, value_e, values[ value_index ] );
+			sha1_hash_step( sha1_hash_function_f, value_e, value_a, value_b, value_c, value_d, values[ value_index + 1 ] );
+			sha1_hash_step( sha1_hash_function_f, value_d, value_e, value_a, value_b, value_c, values[ value_index + 2 ] );
+			sha1_hash_step( sha1_hash_function_f, value_c, value_d, value_e, value_a, value_b, values[ value_index + 3 ] );
+			sha1_hash_step( sha1_hash_function_f, value_b, value_c, value_d, value_e, value_a, values[ value_index + 4 ] );
+		}
+		sha1_hash_step( sha1_hash_function_f, value_a, value_b, value_c, value_d, value_e, values[ 15 ] );
+		sha1_hash_step( sha1_hash_function_f, value_e, value_a, value_b, value_c, value_d, sha1_hash_schedule( values, 16 ) );
+		sha1_hash_step( sha1_hash_function_f, value_d, value_e, value_a, value_b, value_c, sha1_hash_schedule( values, 17 ) );
+		sha1_hash_step( sha1_hash_function_f, value_c, value_d, value_e, value_a, value_b, sha1_hash_schedule( values, 18 ) );
+		sha1_hash_step( sha1_hash_function_f, value_b, value_c, value_d, value_e, value_a, sha1_hash_schedule( values, 19 ) );
+
+		for( value_index = 20;
+		     value_index < 40;
+		     value_index += 5 )
+		{
+			sha1_hash_step( sha1_hash_function_g, value_a, value_b, value_c, value_d, value_e, sha1_hash_schedule( values, value_index ) );
+			sha1_hash_step( sha1_hash_function_g, value_e, value_a, value_b, value_c, value_d, sha1_hash_schedule( values, value_index + 1 ) );
+			sha1_hash_step( sha1_hash_function_g, value_d, value_e, value_a, value_b, value_c, sha1_hash_schedule( values, value_index + 2 ) );
+			sha1_hash_step( sha1_hash_function_g, value_c, value_d, value_e, value_a, value_b, sha1_hash_schedule( values, value_index + 3 ) );
+			sha1_hash_step( sha1_hash_function_g, value_b, value_c, value_d, value_e, value_a, sha1_hash_schedule( values, value_index + 4 ) );
+		}
+		for( value_index = 40;
+		     value_index < 60;
+		     value_index += 5 )
+		{
+			sha1_hash_step( sha1_hash_function_h, value_a, value_b, value_c, value_d, value_e, sha1_hash_schedule( values, value_index ) );
+			sha1_hash_step( sha1_hash_function_h, value_e, value_a, value_b, value_c, value_d, sha1_hash_schedule( values, value_index + 1 ) );
+			sha1_hash_step( sha1_hash_function_h, value_d, value_e, value_a, value_b, value_c, sha1_hash_schedule( values, value_index + 2 ) );
+			sha1_hash_step( sha1_hash_function_h, value_c, value_d, value_e, value_a, value_b, sha1_hash_schedule( values, value_index + 3 ) );
+			sha1_hash_step( sha1_hash_function_h, value_b, value_c, value_d, value_e, value_a, sha1_hash_schedule( values, value_index + 4 ) );
+		}
+		for( value_index = 60;
+		     value_index < 80;
+		     value_index += 5 )
+		{
+			sha1_hash_step( sha1_hash_function_i, value_a, value_b, value_c, value_d, value_e, sha1_hash_schedule( values, value_index ) );
+			sha1_hash_step( sha1_hash_function_i, value_e, value_a, value_b, value_c, value_d, sha1_hash_schedule( values, value_index + 1 ) );
+			sha1_hash_step( sha1_hash_function_i, value_d, value_e, value_a, value_b, value_c, sha1_hash_schedule( values, value_index + 2 ) );
+			sha1_hash_step( sha1_hash_function_i, value_c, value_d, value_e, value_a, value_b, sha1_hash_schedule( values, value_index + 3 ) );
+			sha1_hash_step( sha1_hash_function_i, value_b, value_c, value_d, value_e, value_a, sha1_hash_schedule( values, value_index + 4 ) );
+		}
+		hash_values[ 0 ] += value_a;
+		hash_values[ 1 ] += value_b;
+		hash_values[ 2 ] += value_c;
+		hash_values[ 3 ] += value_d;
+		hash_values[ 4 ] += value_e;
+
+		data             += SHA1_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+#if defined( SHA1_HASH_HAVE_SHA_NI )
+
+/* Calculates the SHA1 hash of a number of 64-byte blocks
+ * This function uses the SHA extensions, where every instruction calculates 4 rounds
+ * Only call this function if the CPU supports the SHA extensions and SSE4.1
+ */
+__attribute__((target("sha,sse4.1"))) void sha1_hash_transform_sha_ni(
+                                            uint32_t *hash_values,
+                                            const uint8_t *data,
+                                            size_t number_of_blocks )
+{
+	__m128i byte_order_mask = _mm_set_epi64x( 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL );
+	__m128i message0        = _mm_setzero_si128();
+	__m128i message1        = _mm_setzero_si128();
+	__m128i message2        = _mm_setzero_si128();
+	__m128i message3        = _mm_setzero_si128();
+	__m128i saved_abcd      = _mm_setzero_si128();
+	__m128i saved_e0        = _mm_setzero_si128();
+	__m128i value_abcd      = _mm_setzero_si128();
+	__m128i value_e0        = _mm_setzero_si128();
+	__m128i value_e1        = _mm_setzero_si128();
+
+	/* The SHA extensions expect the hash values A to D in reverse order
+	 * and E in the most significant 32 bits
+	 */
+	value_abcd = _mm_loadu_si128( (const __m128i *) hash_values );
+	value_abcd = _mm_shuffle_epi32( value_abcd, 0x1b );
+	value_e0   = _mm_set_epi32( (int) hash_values[ 4 ], 0, 0, 0 );
+
+	while( number_of_blocks > 0 )
+	{
+		saved_abcd = value_abcd;
+		saved_e0   = value_e0;
+
+		/* Rounds 0-3
+		 */
+		message0 = _mm_loadu_si128( (const __m128i *) &( data[ 0 ] ) );
+		message0 = _mm_shuffle_epi8( message0, byte_order_mask );
+		value_e0 = _mm_add_epi32( value_e0, message0 );
+		value_e1 = value_abcd;
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 0 );
+
+		/* Rounds 4-7
+		 */
+		message1 = _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) );
+		message1 = _mm_shuffle_epi8( message1, byte_order_mask );
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message1 );
+		value_e0 = value_abcd;
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 0 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+
+		/* Rounds 8-11
+		 */
+		message2 = _mm_loadu_si128( (const __m128i *) &( data[ 32 ] ) );
+		message2 = _mm_shuffle_epi8( message2, byte_order_mask );
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message2 );
+		value_e1 = value_abcd;
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 0 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 12-15
+		 */
+		message3 = _mm_loadu_si128( (const __m128i *) &( data[ 48 ] ) );
+		message3 = _mm_shuffle_epi8( message3, byte_order_mask );
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message3 );
+		value_e0 = value_abcd;
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 0 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 16-19
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message0 );
+		value_e1 = value_abcd;
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 0 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 20-23
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message1 );
+		value_e0 = value_abcd;
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 1 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 24-27
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message2 );
+		value_e1 = value_abcd;
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 1 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 28-31
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message3 );
+		value_e0 = value_abcd;
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 1 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 32-35
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message0 );
+		value_e1 = value_abcd;
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 1 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 36-39
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message1 );
+		value_e0 = value_abcd;
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 1 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 40-43
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message2 );
+		value_e1 = value_abcd;
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 2 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 44-47
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message3 );
+		value_e0 = value_abcd;
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 2 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 48-51
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message0 );
+		value_e1 = value_abcd;
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 2 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 52-55
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message1 );
+		value_e0 = value_abcd;
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 2 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 56-59
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message2 );
+		value_e1 = value_abcd;
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 2 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 60-63
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message3 );
+		value_e0 = value_abcd;
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 3 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 64-67
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message0 );
+		value_e1 = value_abcd;
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 3 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 68-71
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message1 );
+		value_e0 = value_abcd;
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 3 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 72-75
+		 */
+		value_e0 = _mm_sha1nexte_epu32( value_e0, message2 );
+		value_e1 = value_abcd;
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e0, 3 );
+
+		/* Rounds 76-79
+		 */
+		value_e1 = _mm_sha1nexte_epu32( value_e1, message3 );
+		value_e0 = value_abcd;
+		value_abcd = _mm_sha1rnds4_epu32( value_abcd, value_e1, 3 );
+
+		value_e0   = _mm_sha1nexte_epu32( value_e0, saved_e0 );
+		value_abcd = _mm_add_epi32( value_abcd, saved_abcd );
+
+		data             += SHA1_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	value_abcd = _mm_shuffle_epi32( value_abcd, 0x1b );
+
+	_mm_storeu_si128( (__m128i *) hash_values, value_abcd );
+
+	hash_values[ 4 ] = (uint32_t) _mm_extract_epi32( value_e0, 3 );
+}
+
+#endif /* defined( SHA1_HASH_HAVE_SHA_NI ) */
+
+/* Retrieves the transform best supported by the CPU
+ * Returns the transform
+ */
+sha1_hash_transform_t sha1_hash_get_transform(
+                       void )
+{
+	if( sha1_hash_transform_function == NULL )
+	{
+#if defined( SHA1_HASH_HAVE_SHA_NI )
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "sha" )
+		 && __builtin_cpu_supports( "sse4.1" ) )
+		{
+			sha1_hash_transform_function = &sha1_hash_transform_sha_ni;
+		}
+		else
+		{
+			sha1_hash_transform_function = &sha1_hash_transform_scalar;
+		}
+#else
+		sha1_hash_transform_function = &sha1_hash_transform_scalar;
+#endif
+	}
+	return( sha1_hash_transform_function );
+}
+
+/* Calculates the SHA1 hash of a number of 64-byte blocks
+ */
+static void sha1_hash_transform(
+             uint32_t *hash_values,
+             const uint8_t *data,
+             size_t number_of_blocks )
+{
+	sha1_hash_transform_t transform = NULL;
+
+	transform = sha1_hash_get_transform();
+
+	transform(
+	 hash_values,
+	 data,
+	 number_of_blocks );
+}
+
+/* Creates a SHA1 hash
+ * Make sure the value sha1_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int sha1_hash_initialize(
+     sha1_hash_t **sha1_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "sha1_hash_initialize";
+
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sha1_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SHA1 hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sha1_hash = memory_allocate_structure(
+	             sha1_hash_t );
+
+	if( *sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *sha1_hash,
+	     0,
+	     sizeof( sha1_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear SHA1 hash.",
+		 function );
+
+		memory_free(
+		 *sha1_hash );
+
+		*sha1_hash = NULL;
+
+		return( -1 );
+	}
+	( *sha1_hash )->hash_values[ 0 ] = 0x67452301UL;
+	( *sha1_hash )->hash_values[ 1 ] = 0xefcdab89UL;
+	( *sha1_hash )->hash_values[ 2 ] = 0x98badcfeUL;
+	( *sha1_hash )->hash_values[ 3 ] = 0x10325476UL;
+	( *sha1_hash )->hash_values[ 4 ] = 0xc3d2e1f0UL;
+
+	return( 1 );
+}
+
+/* Frees a SHA1 hash
+ * Returns 1 if successful or -1 on error
+ */
+int sha1_hash_free(
+     sha1_hash_t **sha1_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "sha1_hash_free";
+
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sha1_hash != NULL )
+	{
+		memory_free(
+		 *sha1_hash );
+
+		*sha1_hash = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the SHA1 hash
+ * Returns 1 if successful or -1 on error
+ */
+int sha1_hash_update(
+     sha1_hash_t *sha1_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "sha1_hash_update";
+	size_t fill_size        = 0;
+	size_t number_of_blocks = 0;
+
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sha1_hash->data_size += size;
+
+	if( sha1_hash->buffer_data_size > 0 )
+	{
+		fill_size = SHA1_HASH_BLOCK_SIZE - sha1_hash->buffer_data_size;
+
+		if( fill_size > size )
+		{
+			fill_size = size;
+		}
+		if( memory_copy(
+		     &( sha1_hash->buffer[ sha1_hash->buffer_data_size ] ),
+		     buffer,
+		     fill_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		sha1_hash->buffer_data_size += fill_size;
+
+		buffer += fill_size;
+		size   -= fill_size;
+
+		if( sha1_hash->buffer_data_size < SHA1_HASH_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		sha1_hash_transform(
+		 sha1_hash->hash_values,
+		 sha1_hash->buffer,
+		 1 );
+
+		sha1_hash->buffer_data_size = 0;
+	}
+	number_of_blocks = size / SHA1_HASH_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		sha1_hash_transform(
+		 sha1_hash->hash_values,
+		 buffer,
+		 number_of_blocks );
+
+		buffer += number_of_blocks * SHA1_HASH_BLOCK_SIZE;
+		size   -= number_of_blocks * SHA1_HASH_BLOCK_SIZE;
+	}
+	if( size > 0 )
+	{
+		if( memory_copy(
+		     sha1_hash->buffer,
+		     buffer,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		sha1_hash->buffer_data_size = size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the SHA1 hash
+ * The hash values and buffer are not changed so that the hash can be finalized more than once
+ * Returns 1 if successful or -1 on error
+ */
+int sha1_hash_finalize(
+     sha1_hash_t *sha1_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t blocks[ 2 * SHA1_HASH_BLOCK_SIZE ];
+	uint32_t hash_values[ 5 ];
+
+	static char *function   = "sha1_hash_finalize";
+	size_t blocks_data_size = 0;
+	uint64_t bit_size       = 0;
+	int value_index         = 0;
+
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < SHA1_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		hash_values[ value_index ] = sha1_hash->hash_values[ value_index ];
+	}
+	/* The padding consists of a 0x80 byte value, 0-byte values and the size of the data in bits
+	 * as a 64-bit big-endian value at the end of the last block
+	 */
+	blocks_data_size = SHA1_HASH_BLOCK_SIZE;
+
+	if( sha1_hash->buffer_data_size >= ( SHA1_HASH_BLOCK_SIZE - 8 ) )
+	{
+		blocks_data_size += SHA1_HASH_BLOCK_SIZE;
+	}
+	if( memory_set(
+	     blocks,
+	     0,
+	     2 * SHA1_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     blocks,
+	     sha1_hash->buffer,
+	     sha1_hash->buffer_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	blocks[ sha1_hash->buffer_data_size ] = 0x80;
+
+	bit_size = (uint64_t) sha1_hash->data_size * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( blocks[ blocks_data_size - 8 ] ),
+	 bit_size );
+
+	sha1_hash_transform(
+	 hash_values,
+	 blocks,
+	 blocks_data_size / SHA1_HASH_BLOCK_SIZE );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 hash_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash to a byte stream
+ * The state is stored as:
+ *   the 5 hash values as 32-bit little-endian values
+ *   the block buffer
+ *   the block buffer data size as 32-bit little-endian value
+ *   the total data size as 64-bit little-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int sha1_hash_copy_state_to_byte_stream(
+     sha1_hash_t *sha1_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "sha1_hash_copy_state_to_byte_stream";
+	size_t byte_stream_offset = 0;
+	int value_index           = 0;
+
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < SHA1_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 sha1_hash->hash_values[ value_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( memory_copy(
+	     &( byte_stream[ byte_stream_offset ] ),
+	     sha1_hash->buffer,
+	     SHA1_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset += SHA1_HASH_BLOCK_SIZE;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 (uint32_t) sha1_hash->buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 sha1_hash->data_size );
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int sha1_hash_copy_state_from_byte_stream(
+     sha1_hash_t *sha1_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "sha1_hash_copy_state_from_byte_stream";
+	size_t byte_stream_offset = 0;
+	uint64_t value_64bit      = 0;
+	uint32_t buffer_data_size = 0;
+	int value_index           = 0;
+
+	if( sha1_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < SHA1_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = ( 5 * 4 ) + SHA1_HASH_BLOCK_SIZE;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 value_64bit );
+
+	/* A full block is always processed hence the buffer cannot contain a full block
+	 */
+	if( ( buffer_data_size >= SHA1_HASH_BLOCK_SIZE )
+	 || ( ( value_64bit % SHA1_HASH_BLOCK_SIZE ) != buffer_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = 0;
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 sha1_hash->hash_values[ value_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( memory_copy(
+	     sha1_hash->buffer,
+	     &( byte_stream[ byte_stream_offset ] ),
+	     SHA1_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	sha1_hash->buffer_data_size = (size_t) buffer_data_size;
+	sha1_hash->data_size        = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
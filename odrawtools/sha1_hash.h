@@ -0,0 +1,138 @@
+/*
+ * SHA1 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SHA1_HASH_H )
+#define _SHA1_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SHA1 hash is calculated as specified in FIPS 180-4
+ * The intermediate state can be stored so that the hash can be continued later
+ */
+
+/* The size of a SHA1 hash
+ */
+#define SHA1_HASH_SIZE			20
+
+/* The size of a block
+ */
+#define SHA1_HASH_BLOCK_SIZE		64
+
+/* The size of the intermediate state of the hash
+ */
+#define SHA1_HASH_STATE_SIZE		( ( 5 * 4 ) + SHA1_HASH_BLOCK_SIZE + 4 + 8 )
+
+/* The SHA extensions (SHA-NI) transform is only built for x86-64 using a GCC compatible compiler
+ */
+#if defined( __GNUC__ ) && defined( __x86_64__ ) && !defined( SHA1_HASH_NO_SIMD )
+#define SHA1_HASH_HAVE_SHA_NI		1
+#endif
+
+/* A transform that calculates the SHA1 hash of a number of 64-byte blocks
+ */
+typedef void (*sha1_hash_transform_t)(
+               uint32_t *hash_values,
+               const uint8_t *data,
+               size_t number_of_blocks );
+
+typedef struct sha1_hash sha1_hash_t;
+
+struct sha1_hash
+{
+	/* The hash values
+	 */
+	uint32_t hash_values[ 5 ];
+
+	/* The block buffer
+	 */
+	uint8_t buffer[ SHA1_HASH_BLOCK_SIZE ];
+
+	/* The block buffer data size
+	 */
+	size_t buffer_data_size;
+
+	/* The total data size
+	 */
+	size64_t data_size;
+};
+
+void sha1_hash_transform_scalar(
+      uint32_t *hash_values,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+#if defined( SHA1_HASH_HAVE_SHA_NI )
+
+void sha1_hash_transform_sha_ni(
+      uint32_t *hash_values,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+#endif /* defined( SHA1_HASH_HAVE_SHA_NI ) */
+
+sha1_hash_transform_t sha1_hash_get_transform(
+                       void );
+
+int sha1_hash_initialize(
+     sha1_hash_t **sha1_hash,
+     libcerror_error_t **error );
+
+int sha1_hash_free(
+     sha1_hash_t **sha1_hash,
+     libcerror_error_t **error );
+
+int sha1_hash_update(
+     sha1_hash_t *sha1_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int sha1_hash_finalize(
+     sha1_hash_t *sha1_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int sha1_hash_copy_state_to_byte_stream(
+     sha1_hash_t *sha1_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int sha1_hash_copy_state_from_byte_stream(
+     sha1_hash_t *sha1_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SHA1_HASH_H ) */
+
@@ -0,0 +1,1048 @@
+/*
+ * SHA256 hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "sha256_hash.h"
+#include "odrawtools_libcerror.h"
+
+#if defined( SHA256_HASH_HAVE_SHA_NI )
+#include <immintrin.h>
+#endif
+
+#define sha256_hash_rotate_right( value, number_of_bits ) \
+	( ( ( value ) >> ( number_of_bits ) ) | ( ( value ) << ( 32 - ( number_of_bits ) ) ) )
+
+/* Calculates a round, the working variables are passed in their order for the round
+ */
+#define sha256_hash_round( value_a, value_b, value_c, value_d, value_e, value_f, value_g, value_h, value_index ) \
+	value_32bit = value_h \
+	            + ( sha256_hash_rotate_right( value_e, 6 ) ^ sha256_hash_rotate_right( value_e, 11 ) ^ sha256_hash_rotate_right( value_e, 25 ) ) \
+	            + ( value_g ^ ( value_e & ( value_f ^ value_g ) ) ) \
+	            + sha256_hash_constants[ value_index ] \
+	            + values[ value_index ]; \
+	value_d += value_32bit; \
+	value_h  = value_32bit \
+	         + ( sha256_hash_rotate_right( value_a, 2 ) ^ sha256_hash_rotate_right( value_a, 13 ) ^ sha256_hash_rotate_right( value_a, 22 ) ) \
+	         + ( ( value_a & value_b ) | ( value_c & ( value_a | value_b ) ) )
+
+/* The SHA256 constants, which are the first 32 bits of the fractional parts of the cube roots of the first 64 primes
+ */
+static const uint32_t sha256_hash_constants[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
+	0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
+	0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL,
+	0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL,
+	0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL,
+	0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL,
+	0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL,
+	0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL,
+	0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
+};
+
+/* The transform used by the SHA256 hash
+ * the transform is determined on first use, which is safe to race since
+ * every thread will determine the same transform
+ */
+static sha256_hash_transform_t sha256_hash_transform_function = NULL;
+
+/* Calculates the SHA256 hash of a number of 64-byte blocks
+ * The rounds are unrolled by 8 so that the working variables rotate by name instead of by value
+ */
+void sha256_hash_transform_scalar(
+      uint32_t *hash_values,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+	uint32_t values[ 64 ];
+
+	uint32_t sigma0      = 0;
+	uint32_t sigma1      = 0;
+	uint32_t value_32bit = 0;
+	uint32_t value_a     = 0;
+	uint32_t value_b     = 0;
+	uint32_t value_c     = 0;
+	uint32_t value_d     = 0;
+	uint32_t value_e     = 0;
+	uint32_t value_f     = 0;
+	uint32_t value_g     = 0;
+	uint32_t value_h     = 0;
+	int value_index      = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( value_index = 0;
+		     value_index < 16;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( data[ value_index * 4 ] ),
+			 values[ value_index ] );
+		}
+		for( value_index = 16;
+		     value_index < 64;
+		     value_index++ )
+		{
+			value_32bit = values[ value_index - 15 ];
+			sigma0      = sha256_hash_rotate_right( value_32bit, 7 )
+			            ^ sha256_hash_rotate_right( value_32bit, 18 )
+			            ^ ( value_32bit >> 3 );
+
+			value_32bit = values[ value_index - 2 ];
+			sigma1      = sha256_hash_rotate_right( value_32bit, 17 )
+			            ^ sha256_hash_rotate_right( value_32bit, 19 )
+			            ^ ( value_32bit >> 10 );
+
+			values[ value_index ] = values[ value_index - 16 ] + sigma0 + values[ value_index - 7 ] + sigma1;
+		}
+		value_a = hash_values[ 0 ];
+		value_b = hash_values[ 1 ];
+		value_c = hash_values[ 2 ];
+		value_d = hash_values[ 3 ];
+		value_e = hash_values[ 4 ];
+		value_f = hash_values[ 5 ];
+		value_g = hash_values[ 6 ];
+		value_h = hash_values[ 7 ];
+
+		for( value_index = 0;
+		     value_index < 64;
+		     value_index += 8 )
+		{
+			sha256_hash_round( value_a, value_b, value_c, value_d, value_e, value_f, value_g, value_h, value_index );
+			sha256_hash_round( value_h, value_a, value_b, value_c, value_d, value_e, value_f, value_g, value_index + 1 );
+			sha256_hash_round( value_g, value_h, value_a, value_b, value_c, value_d, value_e, value_f, value_index + 2 );
+			sha256_hash_round( value_f, value_g, value_h, value_a, value_b, value_c, value_d, value_e, value_index + 3 );
+			sha256_hash_round( value_e, value_f, value_g, value_h, value_a, value_b, value_c, value_d, value_index + 4 );
+			sha256_hash_round( value_d, value_e, value_f, value_g, value_h, value_a, value_b, value_c, value_index + 5 );
+			sha256_hash_round( value_c, value_d, value_e, value_f, value_g, value_h, value_a, value_b, value_index + 6 );
+			sha256_hash_round( value_b, value_c, value_d, value_e, value_f, value_g, value_h, value_a, value_index + 7 );
+		}
+		hash_values[ 0 ] += value_a;
+		hash_values[ 1 ] += value_b;
+		hash_values[ 2 ] += value_c;
+		hash_values[ 3 ] += value_d;
+		hash_values[ 4 ] += value_e;
+		hash_values[ 5 ] += value_f;
+		hash_values[ 6 ] += value_g;
+		hash_values[ 7 ] += value_h;
+
+		data             += SHA256_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+#if defined( SHA256_HASH_HAVE_SHA_NI )
+
+/* Calculates the SHA256 hash of a number of 64-byte blocks
+ * This function uses the SHA extensions, where every instruction calculates 2 rounds
+ * Only call this function if the CPU supports the SHA extensions and SSE4.1
+ */
+__attribute__((target("sha,sse4.1"))) void sha256_hash_transform_sha_ni(
+                                            uint32_t *hash_values,
+                                            const uint8_t *data,
+                                            size_t number_of_blocks )
+{
+	__m128i byte_order_mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+	__m128i message         = _mm_setzero_si128();
+	__m128i message0        = _mm_setzero_si128();
+	__m128i message1        = _mm_setzero_si128();
+	__m128i message2        = _mm_setzero_si128();
+	__m128i message3        = _mm_setzero_si128();
+	__m128i saved_abef      = _mm_setzero_si128();
+	__m128i saved_cdgh      = _mm_setzero_si128();
+	__m128i temporary       = _mm_setzero_si128();
+	__m128i value_abef      = _mm_setzero_si128();
+	__m128i value_cdgh      = _mm_setzero_si128();
+
+	/* The SHA extensions expect the hash values as ABEF and CDGH
+	 */
+	temporary  = _mm_loadu_si128( (const __m128i *) &( hash_values[ 0 ] ) );
+	value_cdgh = _mm_loadu_si128( (const __m128i *) &( hash_values[ 4 ] ) );
+	temporary  = _mm_shuffle_epi32( temporary, 0xb1 );
+	value_cdgh = _mm_shuffle_epi32( value_cdgh, 0x1b );
+	value_abef = _mm_alignr_epi8( temporary, value_cdgh, 8 );
+	value_cdgh = _mm_blend_epi16( value_cdgh, temporary, 0xf0 );
+
+	while( number_of_blocks > 0 )
+	{
+		saved_abef = value_abef;
+		saved_cdgh = value_cdgh;
+
+		/* Rounds 0-3
+		 */
+		message0 = _mm_loadu_si128( (const __m128i *) &( data[ 0 ] ) );
+		message0 = _mm_shuffle_epi8( message0, byte_order_mask );
+		message = _mm_add_epi32( message0, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 0 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+
+		/* Rounds 4-7
+		 */
+		message1 = _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) );
+		message1 = _mm_shuffle_epi8( message1, byte_order_mask );
+		message = _mm_add_epi32( message1, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 4 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message0 = _mm_sha256msg1_epu32( message0, message1 );
+
+		/* Rounds 8-11
+		 */
+		message2 = _mm_loadu_si128( (const __m128i *) &( data[ 32 ] ) );
+		message2 = _mm_shuffle_epi8( message2, byte_order_mask );
+		message = _mm_add_epi32( message2, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 8 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message1 = _mm_sha256msg1_epu32( message1, message2 );
+
+		/* Rounds 12-15
+		 */
+		message3 = _mm_loadu_si128( (const __m128i *) &( data[ 48 ] ) );
+		message3 = _mm_shuffle_epi8( message3, byte_order_mask );
+		message = _mm_add_epi32( message3, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 12 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message3, message2, 4 );
+		message0 = _mm_add_epi32( message0, temporary );
+		message0 = _mm_sha256msg2_epu32( message0, message3 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message2 = _mm_sha256msg1_epu32( message2, message3 );
+
+		/* Rounds 16-19
+		 */
+		message = _mm_add_epi32( message0, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 16 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message0, message3, 4 );
+		message1 = _mm_add_epi32( message1, temporary );
+		message1 = _mm_sha256msg2_epu32( message1, message0 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message3 = _mm_sha256msg1_epu32( message3, message0 );
+
+		/* Rounds 20-23
+		 */
+		message = _mm_add_epi32( message1, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 20 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message1, message0, 4 );
+		message2 = _mm_add_epi32( message2, temporary );
+		message2 = _mm_sha256msg2_epu32( message2, message1 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message0 = _mm_sha256msg1_epu32( message0, message1 );
+
+		/* Rounds 24-27
+		 */
+		message = _mm_add_epi32( message2, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 24 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message2, message1, 4 );
+		message3 = _mm_add_epi32( message3, temporary );
+		message3 = _mm_sha256msg2_epu32( message3, message2 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message1 = _mm_sha256msg1_epu32( message1, message2 );
+
+		/* Rounds 28-31
+		 */
+		message = _mm_add_epi32( message3, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 28 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message3, message2, 4 );
+		message0 = _mm_add_epi32( message0, temporary );
+		message0 = _mm_sha256msg2_epu32( message0, message3 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message2 = _mm_sha256msg1_epu32( message2, message3 );
+
+		/* Rounds 32-35
+		 */
+		message = _mm_add_epi32( message0, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 32 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message0, message3, 4 );
+		message1 = _mm_add_epi32( message1, temporary );
+		message1 = _mm_sha256msg2_epu32( message1, message0 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message3 = _mm_sha256msg1_epu32( message3, message0 );
+
+		/* Rounds 36-39
+		 */
+		message = _mm_add_epi32( message1, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 36 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message1, message0, 4 );
+		message2 = _mm_add_epi32( message2, temporary );
+		message2 = _mm_sha256msg2_epu32( message2, message1 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message0 = _mm_sha256msg1_epu32( message0, message1 );
+
+		/* Rounds 40-43
+		 */
+		message = _mm_add_epi32( message2, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 40 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message2, message1, 4 );
+		message3 = _mm_add_epi32( message3, temporary );
+		message3 = _mm_sha256msg2_epu32( message3, message2 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message1 = _mm_sha256msg1_epu32( message1, message2 );
+
+		/* Rounds 44-47
+		 */
+		message = _mm_add_epi32( message3, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 44 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message3, message2, 4 );
+		message0 = _mm_add_epi32( message0, temporary );
+		message0 = _mm_sha256msg2_epu32( message0, message3 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message2 = _mm_sha256msg1_epu32( message2, message3 );
+
+		/* Rounds 48-51
+		 */
+		message = _mm_add_epi32( message0, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 48 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message0, message3, 4 );
+		message1 = _mm_add_epi32( message1, temporary );
+		message1 = _mm_sha256msg2_epu32( message1, message0 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+		message3 = _mm_sha256msg1_epu32( message3, message0 );
+
+		/* Rounds 52-55
+		 */
+		message = _mm_add_epi32( message1, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 52 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message1, message0, 4 );
+		message2 = _mm_add_epi32( message2, temporary );
+		message2 = _mm_sha256msg2_epu32( message2, message1 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+
+		/* Rounds 56-59
+		 */
+		message = _mm_add_epi32( message2, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 56 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		temporary = _mm_alignr_epi8( message2, message1, 4 );
+		message3 = _mm_add_epi32( message3, temporary );
+		message3 = _mm_sha256msg2_epu32( message3, message2 );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+
+		/* Rounds 60-63
+		 */
+		message = _mm_add_epi32( message3, _mm_loadu_si128( (const __m128i *) &( sha256_hash_constants[ 60 ] ) ) );
+		value_cdgh = _mm_sha256rnds2_epu32( value_cdgh, value_abef, message );
+		message = _mm_shuffle_epi32( message, 0x0e );
+		value_abef = _mm_sha256rnds2_epu32( value_abef, value_cdgh, message );
+
+		value_abef = _mm_add_epi32( value_abef, saved_abef );
+		value_cdgh = _mm_add_epi32( value_cdgh, saved_cdgh );
+
+		data             += SHA256_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	temporary  = _mm_shuffle_epi32( value_abef, 0x1b );
+	value_cdgh = _mm_shuffle_epi32( value_cdgh, 0xb1 );
+	value_abef = _mm_blend_epi16( temporary, value_cdgh, 0xf0 );
+	value_cdgh = _mm_alignr_epi8( value_cdgh, temporary, 8 );
+
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 0 ] ), value_abef );
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 4 ] ), value_cdgh );
+}
+
+#endif /* defined( SHA256_HASH_HAVE_SHA_NI ) */
+
+/* Retrieves the transform best supported by the CPU
+ * Returns the transform
+ */
+sha256_hash_transform_t sha256_hash_get_transform(
+                         void )
+{
+	if( sha256_hash_transform_function == NULL )
+	{
+#if defined( SHA256_HASH_HAVE_SHA_NI )
+		__builtin_cpu_init();
+
+		if( __builtin_cpu_supports( "sha" )
+		 && __builtin_cpu_supports( "sse4.1" ) )
+		{
+			sha256_hash_transform_function = &sha256_hash_transform_sha_ni;
+		}
+		else
+		{
+			sha256_hash_transform_function = &sha256_hash_transform_scalar;
+		}
+#else
+		sha256_hash_transform_function = &sha256_hash_transform_scalar;
+#endif
+	}
+	return( sha256_hash_transform_function );
+}
+
+/* Calculates the SHA256 hash of a number of 64-byte blocks
+ */
+static void sha256_hash_transform(
+             uint32_t *hash_values,
+             const uint8_t *data,
+             size_t number_of_blocks )
+{
+	sha256_hash_transform_t transform = NULL;
+
+	transform = sha256_hash_get_transform();
+
+	transform(
+	 hash_values,
+	 data,
+	 number_of_blocks );
+}
+
+/* Creates a SHA256 hash
+ * Make sure the value sha256_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_initialize(
+     sha256_hash_t **sha256_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_hash_initialize";
+
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sha256_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid SHA256 hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sha256_hash = memory_allocate_structure(
+	               sha256_hash_t );
+
+	if( *sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *sha256_hash,
+	     0,
+	     sizeof( sha256_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear SHA256 hash.",
+		 function );
+
+		memory_free(
+		 *sha256_hash );
+
+		*sha256_hash = NULL;
+
+		return( -1 );
+	}
+	( *sha256_hash )->hash_values[ 0 ] = 0x6a09e667UL;
+	( *sha256_hash )->hash_values[ 1 ] = 0xbb67ae85UL;
+	( *sha256_hash )->hash_values[ 2 ] = 0x3c6ef372UL;
+	( *sha256_hash )->hash_values[ 3 ] = 0xa54ff53aUL;
+	( *sha256_hash )->hash_values[ 4 ] = 0x510e527fUL;
+	( *sha256_hash )->hash_values[ 5 ] = 0x9b05688cUL;
+	( *sha256_hash )->hash_values[ 6 ] = 0x1f83d9abUL;
+	( *sha256_hash )->hash_values[ 7 ] = 0x5be0cd19UL;
+
+	return( 1 );
+}
+
+/* Frees a SHA256 hash
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_free(
+     sha256_hash_t **sha256_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_hash_free";
+
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sha256_hash != NULL )
+	{
+		memory_free(
+		 *sha256_hash );
+
+		*sha256_hash = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the SHA256 hash
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_update(
+     sha256_hash_t *sha256_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "sha256_hash_update";
+	size_t fill_size        = 0;
+	size_t number_of_blocks = 0;
+
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sha256_hash->data_size += size;
+
+	if( sha256_hash->buffer_data_size > 0 )
+	{
+		fill_size = SHA256_HASH_BLOCK_SIZE - sha256_hash->buffer_data_size;
+
+		if( fill_size > size )
+		{
+			fill_size = size;
+		}
+		if( memory_copy(
+		     &( sha256_hash->buffer[ sha256_hash->buffer_data_size ] ),
+		     buffer,
+		     fill_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		sha256_hash->buffer_data_size += fill_size;
+
+		buffer += fill_size;
+		size   -= fill_size;
+
+		if( sha256_hash->buffer_data_size < SHA256_HASH_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		sha256_hash_transform(
+		 sha256_hash->hash_values,
+		 sha256_hash->buffer,
+		 1 );
+
+		sha256_hash->buffer_data_size = 0;
+	}
+	number_of_blocks = size / SHA256_HASH_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		sha256_hash_transform(
+		 sha256_hash->hash_values,
+		 buffer,
+		 number_of_blocks );
+
+		buffer += number_of_blocks * SHA256_HASH_BLOCK_SIZE;
+		size   -= number_of_blocks * SHA256_HASH_BLOCK_SIZE;
+	}
+	if( size > 0 )
+	{
+		if( memory_copy(
+		     sha256_hash->buffer,
+		     buffer,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		sha256_hash->buffer_data_size = size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the SHA256 hash
+ * The hash values and buffer are not changed so that the hash can be finalized more than once
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_finalize(
+     sha256_hash_t *sha256_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t blocks[ 2 * SHA256_HASH_BLOCK_SIZE ];
+	uint32_t hash_values[ 8 ];
+
+	static char *function   = "sha256_hash_finalize";
+	size_t blocks_data_size = 0;
+	uint64_t bit_size       = 0;
+	int value_index         = 0;
+
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		hash_values[ value_index ] = sha256_hash->hash_values[ value_index ];
+	}
+	/* The padding consists of a 0x80 byte value, 0-byte values and the size of the data in bits
+	 * as a 64-bit big-endian value at the end of the last block
+	 */
+	blocks_data_size = SHA256_HASH_BLOCK_SIZE;
+
+	if( sha256_hash->buffer_data_size >= ( SHA256_HASH_BLOCK_SIZE - 8 ) )
+	{
+		blocks_data_size += SHA256_HASH_BLOCK_SIZE;
+	}
+	if( memory_set(
+	     blocks,
+	     0,
+	     2 * SHA256_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     blocks,
+	     sha256_hash->buffer,
+	     sha256_hash->buffer_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	blocks[ sha256_hash->buffer_data_size ] = 0x80;
+
+	bit_size = (uint64_t) sha256_hash->data_size * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( blocks[ blocks_data_size - 8 ] ),
+	 bit_size );
+
+	sha256_hash_transform(
+	 hash_values,
+	 blocks,
+	 blocks_data_size / SHA256_HASH_BLOCK_SIZE );
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 hash_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Calculates the SHA256 hash of a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	sha256_hash_t *sha256_hash = NULL;
+	static char *function      = "sha256_hash_calculate";
+
+	if( sha256_hash_initialize(
+	     &sha256_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( sha256_hash_update(
+	     sha256_hash,
+	     buffer,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( sha256_hash_finalize(
+	     sha256_hash,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( sha256_hash_free(
+	     &sha256_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free SHA256 hash.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sha256_hash != NULL )
+	{
+		sha256_hash_free(
+		 &sha256_hash,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies the intermediate state of the hash to a byte stream
+ * The state is stored as:
+ *   the 8 hash values as 32-bit little-endian values
+ *   the block buffer
+ *   the block buffer data size as 32-bit little-endian value
+ *   the total data size as 64-bit little-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_copy_state_to_byte_stream(
+     sha256_hash_t *sha256_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "sha256_hash_copy_state_to_byte_stream";
+	size_t byte_stream_offset = 0;
+	int value_index           = 0;
+
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < SHA256_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 sha256_hash->hash_values[ value_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( memory_copy(
+	     &( byte_stream[ byte_stream_offset ] ),
+	     sha256_hash->buffer,
+	     SHA256_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset += SHA256_HASH_BLOCK_SIZE;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 (uint32_t) sha256_hash->buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 sha256_hash->data_size );
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_hash_copy_state_from_byte_stream(
+     sha256_hash_t *sha256_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "sha256_hash_copy_state_from_byte_stream";
+	size_t byte_stream_offset = 0;
+	uint64_t value_64bit      = 0;
+	uint32_t buffer_data_size = 0;
+	int value_index           = 0;
+
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < SHA256_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = ( 8 * 4 ) + SHA256_HASH_BLOCK_SIZE;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 value_64bit );
+
+	/* A full block is always processed hence the buffer cannot contain a full block
+	 */
+	if( ( buffer_data_size >= SHA256_HASH_BLOCK_SIZE )
+	 || ( ( value_64bit % SHA256_HASH_BLOCK_SIZE ) != buffer_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = 0;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 sha256_hash->hash_values[ value_index ] );
+
+		byte_stream_offset += 4;
+	}
+	if( memory_copy(
+	     sha256_hash->buffer,
+	     &( byte_stream[ byte_stream_offset ] ),
+	     SHA256_HASH_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	sha256_hash->buffer_data_size = (size_t) buffer_data_size;
+	sha256_hash->data_size        = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
@@ -21,10 +21,86 @@
 
 #include <common.h>
 #include <memory.h>
+#include <types.h>
 
 #include "odrawtools_libcerror.h"
 #include "storage_media_buffer.h"
 
+/* Allocates an aligned raw buffer
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_allocate_raw_buffer(
+     uint8_t **raw_buffer_allocation,
+     uint8_t **raw_buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_allocate_raw_buffer";
+	intptr_t misalignment = 0;
+
+	if( raw_buffer_allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw buffer allocation.",
+		 function );
+
+		return( -1 );
+	}
+	if( raw_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid raw buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( SSIZE_MAX - STORAGE_MEDIA_BUFFER_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The raw buffer is aligned within an allocation that is one alignment larger
+	 */
+	*raw_buffer_allocation = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * ( size + STORAGE_MEDIA_BUFFER_ALIGNMENT ) );
+
+	if( *raw_buffer_allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create raw buffer.",
+		 function );
+
+		return( -1 );
+	}
+	misalignment = (intptr_t) *raw_buffer_allocation % STORAGE_MEDIA_BUFFER_ALIGNMENT;
+
+	if( misalignment == 0 )
+	{
+		*raw_buffer = *raw_buffer_allocation;
+	}
+	else
+	{
+		*raw_buffer = &( ( *raw_buffer_allocation )[ STORAGE_MEDIA_BUFFER_ALIGNMENT - misalignment ] );
+	}
+	return( 1 );
+}
+
 /* Creates a storage media buffer
  * Make sure the value buffer is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -34,8 +110,7 @@ int storage_media_buffer_initialize(
      size_t size,
      libcerror_error_t **error )
 {
-	static char *function  = "storage_media_buffer_initialize";
-	size_t raw_buffer_size = 0;
+	static char *function = "storage_media_buffer_initialize";
 
 	if( buffer == NULL )
 	{
@@ -59,7 +134,7 @@ int storage_media_buffer_initialize(
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( size > (size_t) ( SSIZE_MAX - STORAGE_MEDIA_BUFFER_ALIGNMENT ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -105,29 +180,11 @@ int storage_media_buffer_initialize(
 	}
 	if( size > 0 )
 	{
-		raw_buffer_size = size;
-
-/* TODO can low level functions and direct IO be combined ? */
-#if defined( memory_allocate_aligned )
-		if( memory_allocate_aligned(
-		     (void **) &( ( *buffer )->raw_buffer ),
-		     raw_buffer_size,
-		     512 ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create aligned raw buffer.",
-			 function );
-
-			goto on_error;
-		}
-#else
-		( *buffer )->raw_buffer = (uint8_t *) memory_allocate(
-		                                       sizeof( uint8_t ) * raw_buffer_size );
-			
-		if( ( *buffer )->raw_buffer == NULL )
+		if( storage_media_buffer_allocate_raw_buffer(
+		     &( ( *buffer )->raw_buffer_allocation ),
+		     &( ( *buffer )->raw_buffer ),
+		     size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -138,8 +195,6 @@ int storage_media_buffer_initialize(
 
 			goto on_error;
 		}
-#endif /* defined( memory_allocate_aligned ) */
-
 		( *buffer )->raw_buffer_size = size;
 	}
 	return( 1 );
@@ -147,10 +202,10 @@ int storage_media_buffer_initialize(
 on_error:
 	if( *buffer != NULL )
 	{
-		if( ( *buffer )->raw_buffer != NULL )
+		if( ( *buffer )->raw_buffer_allocation != NULL )
 		{
 			memory_free(
-			 ( *buffer )->raw_buffer );
+			 ( *buffer )->raw_buffer_allocation );
 		}
 		memory_free(
 		 *buffer );
@@ -182,10 +237,10 @@ int storage_media_buffer_free(
 	}
 	if( *buffer != NULL )
 	{
-		if( ( *buffer )->raw_buffer != NULL )
+		if( ( *buffer )->raw_buffer_allocation != NULL )
 		{
 			memory_free(
-			 ( *buffer )->raw_buffer );
+			 ( *buffer )->raw_buffer_allocation );
 		}
 		memory_free(
 		 *buffer );
@@ -203,8 +258,9 @@ int storage_media_buffer_resize(
      size_t size,
      libcerror_error_t **error )
 {
-	void *reallocation    = NULL;
-	static char *function = "storage_media_buffer_resize";
+	uint8_t *raw_buffer            = NULL;
+	uint8_t *raw_buffer_allocation = NULL;
+	static char *function          = "storage_media_buffer_resize";
 
 	if( buffer == NULL )
 	{
@@ -219,24 +275,32 @@ int storage_media_buffer_resize(
 	}
 	if( size > buffer->raw_buffer_size )
 	{
-		reallocation = memory_reallocate(
-				buffer->raw_buffer,
-				sizeof( uint8_t ) * size );
-
-		if( reallocation == NULL )
+		/* The data is not preserved hence a new aligned raw buffer is allocated
+		 */
+		if( storage_media_buffer_allocate_raw_buffer(
+		     &raw_buffer_allocation,
+		     &raw_buffer,
+		     size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to reallocate read buffer.",
+			 "%s: unable to resize raw buffer.",
 			 function );
 
 			return( -1 );
 		}
-		buffer->raw_buffer           = (uint8_t *) reallocation;
-		buffer->raw_buffer_size      = size;
-		buffer->raw_buffer_data_size = 0;
+		if( buffer->raw_buffer_allocation != NULL )
+		{
+			memory_free(
+			 buffer->raw_buffer_allocation );
+		}
+		buffer->raw_buffer_allocation = raw_buffer_allocation;
+		buffer->raw_buffer            = raw_buffer;
+		buffer->raw_buffer_size       = size;
+		buffer->raw_buffer_data_size  = 0;
 	}
 	return( 1 );
 }
@@ -31,11 +31,21 @@
 extern "C" {
 #endif
 
+/* The alignment of the raw buffer
+ * which allows the data to be read using direct IO without an intermediate copy
+ */
+#define STORAGE_MEDIA_BUFFER_ALIGNMENT		4096
+
 typedef struct storage_media_buffer storage_media_buffer_t;
 
 struct storage_media_buffer
 {
+	/* The raw buffer allocation
+	 */
+	uint8_t *raw_buffer_allocation;
+
 	/* The raw buffer
+	 * which is aligned within the raw buffer allocation
 	 */
 	uint8_t *raw_buffer;
 
@@ -48,6 +58,12 @@ struct storage_media_buffer
 	size_t raw_buffer_data_size;
 };
 
+int storage_media_buffer_allocate_raw_buffer(
+     uint8_t **raw_buffer_allocation,
+     uint8_t **raw_buffer,
+     size_t size,
+     libcerror_error_t **error );
+
 int storage_media_buffer_initialize(
      storage_media_buffer_t **buffer,
      size_t size,
@@ -0,0 +1,1000 @@
+/*
+ * Storage media buffer queue
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
+#include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a storage media buffer queue
+ * Make sure the value queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_initialize(
+     storage_media_buffer_queue_t **queue,
+     int number_of_buffers,
+     size_t buffer_size,
+     int number_of_consumers,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_initialize";
+	int buffer_index      = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers <= 0 )
+	 || ( number_of_buffers > 1024 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_consumers < 0 )
+	 || ( number_of_consumers > 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of consumers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*queue = memory_allocate_structure(
+	          storage_media_buffer_queue_t );
+
+	if( *queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *queue,
+	     0,
+	     sizeof( storage_media_buffer_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+
+		return( -1 );
+	}
+	( *queue )->buffers = (storage_media_buffer_t **) memory_allocate(
+	                                                   sizeof( storage_media_buffer_t * ) * number_of_buffers );
+
+	if( ( *queue )->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *queue )->buffers,
+	     0,
+	     sizeof( storage_media_buffer_t * ) * number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		memory_free(
+		 ( *queue )->buffers );
+
+		( *queue )->buffers = NULL;
+
+		goto on_error;
+	}
+	( *queue )->number_of_buffers = number_of_buffers;
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &( ( *queue )->buffers[ buffer_index ] ),
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	( *queue )->reference_counts = (int *) memory_allocate(
+	                                        sizeof( int ) * number_of_buffers );
+
+	if( ( *queue )->reference_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reference counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *queue )->reference_counts,
+	     0,
+	     sizeof( int ) * number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reference counts.",
+		 function );
+
+		goto on_error;
+	}
+	/* Without consumers the buffers are released as soon as they are written
+	 */
+	if( number_of_consumers > 0 )
+	{
+		( *queue )->number_of_buffers_read = (uint64_t *) memory_allocate(
+		                                                   sizeof( uint64_t ) * number_of_consumers );
+
+		if( ( *queue )->number_of_buffers_read == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create number of buffers read.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *queue )->number_of_buffers_read,
+		     0,
+		     sizeof( uint64_t ) * number_of_consumers ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear number of buffers read.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *queue )->number_of_consumers = number_of_consumers;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *queue )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *queue )->empty_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create empty condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *queue )->full_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create full condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 queue,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a storage media buffer queue
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_free(
+     storage_media_buffer_queue_t **queue,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		if( ( *queue )->full_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *queue )->full_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free full condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *queue )->empty_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *queue )->empty_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free empty condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *queue )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *queue )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *queue )->number_of_buffers_read != NULL )
+		{
+			memory_free(
+			 ( *queue )->number_of_buffers_read );
+		}
+		if( ( *queue )->reference_counts != NULL )
+		{
+			memory_free(
+			 ( *queue )->reference_counts );
+		}
+		if( ( *queue )->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *queue )->number_of_buffers;
+			     buffer_index++ )
+			{
+				if( ( *queue )->buffers[ buffer_index ] == NULL )
+				{
+					continue;
+				}
+				if( storage_media_buffer_free(
+				     &( ( *queue )->buffers[ buffer_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free storage media buffer: %d.",
+					 function,
+					 buffer_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *queue )->buffers );
+		}
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( result );
+}
+
+/* Grabs the next buffer to be written by the producer
+ * Blocks until all consumers have released the buffer
+ * Returns 1 if successful, 0 if the queue was aborted or -1 on error
+ */
+int storage_media_buffer_queue_grab_for_write(
+     storage_media_buffer_queue_t *queue,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_grab_for_write";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_index = (int) ( queue->number_of_buffers_written % queue->number_of_buffers );
+
+	while( ( queue->is_aborted == 0 )
+	    && ( queue->reference_counts[ buffer_index ] > 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     queue->empty_condition,
+		     queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for empty condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( queue->is_aborted != 0 ) )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		*buffer = queue->buffers[ buffer_index ];
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases the buffer written by the producer to the consumers
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_release_for_write(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_release_for_write";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_index = (int) ( queue->number_of_buffers_written % queue->number_of_buffers );
+
+	queue->reference_counts[ buffer_index ] = queue->number_of_consumers;
+	queue->number_of_buffers_written       += 1;
+
+	if( libcthreads_condition_broadcast(
+	     queue->full_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast full condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Grabs the next buffer to be read by a specific consumer
+ * Blocks until the producer has released the buffer
+ * Returns 1 if successful, 0 if no more buffers are available or -1 on error
+ */
+int storage_media_buffer_queue_grab_for_read(
+     storage_media_buffer_queue_t *queue,
+     int consumer_index,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_grab_for_read";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( consumer_index < 0 )
+	 || ( consumer_index >= queue->number_of_consumers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid consumer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( queue->is_aborted == 0 )
+	    && ( queue->is_closed == 0 )
+	    && ( queue->number_of_buffers_read[ consumer_index ] >= queue->number_of_buffers_written ) )
+	{
+		if( libcthreads_condition_wait(
+		     queue->full_condition,
+		     queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for full condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* Buffers that were written before the queue was closed are still read
+	 */
+	if( ( result == 1 )
+	 && ( ( queue->is_aborted != 0 )
+	  ||  ( queue->number_of_buffers_read[ consumer_index ] >= queue->number_of_buffers_written ) ) )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		buffer_index = (int) ( queue->number_of_buffers_read[ consumer_index ] % queue->number_of_buffers );
+
+		*buffer = queue->buffers[ buffer_index ];
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases the buffer read by a specific consumer
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_release_for_read(
+     storage_media_buffer_queue_t *queue,
+     int consumer_index,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_release_for_read";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( consumer_index < 0 )
+	 || ( consumer_index >= queue->number_of_consumers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid consumer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_index = (int) ( queue->number_of_buffers_read[ consumer_index ] % queue->number_of_buffers );
+
+	queue->reference_counts[ buffer_index ]         -= 1;
+	queue->number_of_buffers_read[ consumer_index ] += 1;
+
+	if( queue->reference_counts[ buffer_index ] == 0 )
+	{
+		if( libcthreads_condition_signal(
+		     queue->empty_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal empty condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until all consumers have released all the buffers written by the producer
+ * Returns 1 if successful, 0 if the queue was aborted or -1 on error
+ */
+int storage_media_buffer_queue_wait_until_read(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_wait_until_read";
+	int consumer_index    = 0;
+	int result            = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( queue->is_aborted == 0 )
+	    && ( consumer_index < queue->number_of_consumers ) )
+	{
+		if( queue->number_of_buffers_read[ consumer_index ] == queue->number_of_buffers_written )
+		{
+			consumer_index++;
+
+			continue;
+		}
+		if( libcthreads_condition_wait(
+		     queue->empty_condition,
+		     queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for empty condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( queue->is_aborted != 0 ) )
+	{
+		result = 0;
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets a flag in the queue and wakes up all waiting threads
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_set_flag(
+     storage_media_buffer_queue_t *queue,
+     uint8_t *flag,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_set_flag";
+	int result            = 1;
+
+	if( libcthreads_mutex_grab(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*flag = 1;
+
+	if( libcthreads_condition_broadcast(
+	     queue->full_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast full condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_condition_broadcast(
+	     queue->empty_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast empty condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Closes the queue, the producer will not write more buffers
+ * The consumers can still read the buffers that were written
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_close(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_close";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_queue_set_flag(
+	     queue,
+	     &( queue->is_closed ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set closed flag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Aborts the queue, both the producer and consumers stop waiting
+ * Returns 1 if successful or -1 on error
+ */
+int storage_media_buffer_queue_abort(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error )
+{
+	static char *function = "storage_media_buffer_queue_abort";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer_queue_set_flag(
+	     queue,
+	     &( queue->is_aborted ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set aborted flag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,145 @@
+/*
+ * Storage media buffer queue
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STORAGE_MEDIA_BUFFER_QUEUE_H )
+#define _STORAGE_MEDIA_BUFFER_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct storage_media_buffer_queue storage_media_buffer_queue_t;
+
+/* A bounded ring of storage media buffers with a single producer and
+ * multiple consumers, where every consumer sees every buffer in order
+ */
+struct storage_media_buffer_queue
+{
+	/* The storage media buffers
+	 */
+	storage_media_buffer_t **buffers;
+
+	/* The number of storage media buffers
+	 */
+	int number_of_buffers;
+
+	/* The number of consumers per buffer that still need to release the buffer
+	 */
+	int *reference_counts;
+
+	/* The number of consumers
+	 */
+	int number_of_consumers;
+
+	/* The number of buffers released by the producer
+	 */
+	uint64_t number_of_buffers_written;
+
+	/* The number of buffers released by each consumer
+	 */
+	uint64_t *number_of_buffers_read;
+
+	/* Value to indicate the producer will not write more buffers
+	 */
+	uint8_t is_closed;
+
+	/* Value to indicate the queue was aborted
+	 */
+	uint8_t is_aborted;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a buffer was released by all consumers
+	 */
+	libcthreads_condition_t *empty_condition;
+
+	/* The condition that is signalled when a buffer was released by the producer
+	 */
+	libcthreads_condition_t *full_condition;
+};
+
+int storage_media_buffer_queue_initialize(
+     storage_media_buffer_queue_t **queue,
+     int number_of_buffers,
+     size_t buffer_size,
+     int number_of_consumers,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_free(
+     storage_media_buffer_queue_t **queue,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_grab_for_write(
+     storage_media_buffer_queue_t *queue,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_release_for_write(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_grab_for_read(
+     storage_media_buffer_queue_t *queue,
+     int consumer_index,
+     storage_media_buffer_t **buffer,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_release_for_read(
+     storage_media_buffer_queue_t *queue,
+     int consumer_index,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_wait_until_read(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_set_flag(
+     storage_media_buffer_queue_t *queue,
+     uint8_t *flag,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_close(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error );
+
+int storage_media_buffer_queue_abort(
+     storage_media_buffer_queue_t *queue,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _STORAGE_MEDIA_BUFFER_QUEUE_H ) */
+
@@ -0,0 +1,599 @@
+/*
+ * SHA256 tree hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "odrawtools_libcerror.h"
+#include "tree_hash.h"
+
+/* Creates a tree hash
+ * Make sure the value tree_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int tree_hash_initialize(
+     tree_hash_t **tree_hash,
+     size64_t data_size,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function     = "tree_hash_initialize";
+	uint64_t number_of_chunks = 0;
+
+	if( tree_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = data_size / TREE_HASH_CHUNK_SIZE;
+
+	if( ( data_size % TREE_HASH_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( number_of_chunks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / SHA256_HASH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*tree_hash = memory_allocate_structure(
+	              tree_hash_t );
+
+	if( *tree_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tree hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *tree_hash,
+	     0,
+	     sizeof( tree_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree hash.",
+		 function );
+
+		memory_free(
+		 *tree_hash );
+
+		*tree_hash = NULL;
+
+		return( -1 );
+	}
+	if( number_of_chunks > 0 )
+	{
+		( *tree_hash )->chunk_hashes = (uint8_t *) memory_allocate(
+		                                            sizeof( uint8_t ) * (size_t) number_of_chunks * SHA256_HASH_SIZE );
+
+		if( ( *tree_hash )->chunk_hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *tree_hash )->data_size         = data_size;
+	( *tree_hash )->number_of_chunks  = number_of_chunks;
+	( *tree_hash )->number_of_workers = number_of_workers;
+
+	return( 1 );
+
+on_error:
+	if( *tree_hash != NULL )
+	{
+		memory_free(
+		 *tree_hash );
+
+		*tree_hash = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a tree hash
+ * Returns 1 if successful or -1 on error
+ */
+int tree_hash_free(
+     tree_hash_t **tree_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "tree_hash_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( tree_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree_hash != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS;
+		     worker_index++ )
+		{
+			if( ( *tree_hash )->worker_contexts[ worker_index ] != NULL )
+			{
+				if( sha256_hash_free(
+				     &( ( *tree_hash )->worker_contexts[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d SHA256 hash.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+		}
+		if( ( *tree_hash )->chunk_hashes != NULL )
+		{
+			memory_free(
+			 ( *tree_hash )->chunk_hashes );
+		}
+		memory_free(
+		 *tree_hash );
+
+		*tree_hash = NULL;
+	}
+	return( result );
+}
+
+/* Determines the default number of workers, which is the number of processors
+ * Returns the number of workers
+ */
+int tree_hash_get_default_number_of_workers(
+     void )
+{
+#if defined( WINAPI )
+	SYSTEM_INFO system_info;
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	long number_of_processors = 0;
+#endif
+	int number_of_workers = 1;
+
+#if defined( WINAPI )
+	GetSystemInfo(
+	 &system_info );
+
+	if( system_info.dwNumberOfProcessors > (DWORD) TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		number_of_workers = TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS;
+	}
+	else if( system_info.dwNumberOfProcessors > 0 )
+	{
+		number_of_workers = (int) system_info.dwNumberOfProcessors;
+	}
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_processors = sysconf(
+	                        _SC_NPROCESSORS_ONLN );
+
+	if( number_of_processors > (long) TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		number_of_workers = TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS;
+	}
+	else if( number_of_processors > 0 )
+	{
+		number_of_workers = (int) number_of_processors;
+	}
+#endif
+	return( number_of_workers );
+}
+
+/* Updates the tree hash with the data of a specific worker
+ * Every worker is passed all the data in order and only hashes the chunks
+ * that are assigned to it, hence the workers can be run concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int tree_hash_update(
+     tree_hash_t *tree_hash,
+     int worker_index,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t leaf_prefix[ 1 ] = { 0x00 };
+
+	static char *function     = "tree_hash_update";
+	uint64_t chunk_end_offset = 0;
+	uint64_t chunk_index      = 0;
+	uint64_t current_offset   = 0;
+	size_t buffer_offset      = 0;
+	size_t update_size        = 0;
+
+	if( tree_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= tree_hash->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size > (size_t) SSIZE_MAX )
+	 || ( (size64_t) buffer_size > tree_hash->data_size )
+	 || ( (size64_t) offset > ( tree_hash->data_size - buffer_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		current_offset   = (uint64_t) offset + buffer_offset;
+		chunk_index      = current_offset / TREE_HASH_CHUNK_SIZE;
+		chunk_end_offset = ( chunk_index + 1 ) * TREE_HASH_CHUNK_SIZE;
+
+		if( chunk_end_offset > tree_hash->data_size )
+		{
+			chunk_end_offset = tree_hash->data_size;
+		}
+		update_size = buffer_size - buffer_offset;
+
+		if( (uint64_t) update_size > ( chunk_end_offset - current_offset ) )
+		{
+			update_size = (size_t) ( chunk_end_offset - current_offset );
+		}
+		if( (int) ( chunk_index % tree_hash->number_of_workers ) == worker_index )
+		{
+			if( tree_hash->worker_contexts[ worker_index ] == NULL )
+			{
+				if( sha256_hash_initialize(
+				     &( tree_hash->worker_contexts[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to initialize worker: %d SHA256 hash.",
+					 function,
+					 worker_index );
+
+					return( -1 );
+				}
+				if( sha256_hash_update(
+				     tree_hash->worker_contexts[ worker_index ],
+				     leaf_prefix,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update worker: %d SHA256 hash.",
+					 function,
+					 worker_index );
+
+					return( -1 );
+				}
+			}
+			if( sha256_hash_update(
+			     tree_hash->worker_contexts[ worker_index ],
+			     &( buffer[ buffer_offset ] ),
+			     update_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update worker: %d SHA256 hash.",
+				 function,
+				 worker_index );
+
+				return( -1 );
+			}
+			if( ( current_offset + update_size ) == chunk_end_offset )
+			{
+				if( sha256_hash_finalize(
+				     tree_hash->worker_contexts[ worker_index ],
+				     &( tree_hash->chunk_hashes[ chunk_index * SHA256_HASH_SIZE ] ),
+				     SHA256_HASH_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to finalize chunk: %" PRIu64 " SHA256 hash.",
+					 function,
+					 chunk_index );
+
+					return( -1 );
+				}
+				if( sha256_hash_free(
+				     &( tree_hash->worker_contexts[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d SHA256 hash.",
+					 function,
+					 worker_index );
+
+					return( -1 );
+				}
+			}
+		}
+		buffer_offset += update_size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the tree hash
+ * The chunk hashes are combined into the tree hash, level by level, where the last
+ * hash of a level with an odd number of hashes is moved to the next level as-is.
+ * This results in the same tree as the RFC 6962 definition.
+ * Returns 1 if successful or -1 on error
+ */
+int tree_hash_finalize(
+     tree_hash_t *tree_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t node_data[ 1 + ( 2 * SHA256_HASH_SIZE ) ];
+
+	static char *function     = "tree_hash_finalize";
+	uint64_t hash_index       = 0;
+	uint64_t number_of_hashes = 0;
+
+	if( tree_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree_hash->number_of_chunks == 0 )
+	{
+		if( sha256_hash_calculate(
+		     node_data,
+		     0,
+		     hash,
+		     hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate SHA256 hash of empty data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	node_data[ 0 ] = 0x01;
+
+	/* The hashes of a level are stored in place of the hashes of the previous level
+	 */
+	number_of_hashes = tree_hash->number_of_chunks;
+
+	while( number_of_hashes > 1 )
+	{
+		for( hash_index = 0;
+		     ( hash_index + 1 ) < number_of_hashes;
+		     hash_index += 2 )
+		{
+			if( memory_copy(
+			     &( node_data[ 1 ] ),
+			     &( tree_hash->chunk_hashes[ hash_index * SHA256_HASH_SIZE ] ),
+			     2 * SHA256_HASH_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy node data.",
+				 function );
+
+				return( -1 );
+			}
+			if( sha256_hash_calculate(
+			     node_data,
+			     1 + ( 2 * SHA256_HASH_SIZE ),
+			     &( tree_hash->chunk_hashes[ ( hash_index / 2 ) * SHA256_HASH_SIZE ] ),
+			     SHA256_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate SHA256 hash of node.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( number_of_hashes % 2 ) != 0 )
+		{
+			if( memory_copy(
+			     &( tree_hash->chunk_hashes[ ( hash_index / 2 ) * SHA256_HASH_SIZE ] ),
+			     &( tree_hash->chunk_hashes[ hash_index * SHA256_HASH_SIZE ] ),
+			     SHA256_HASH_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		number_of_hashes = ( number_of_hashes / 2 ) + ( number_of_hashes % 2 );
+	}
+	if( memory_copy(
+	     hash,
+	     tree_hash->chunk_hashes,
+	     SHA256_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy tree hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,114 @@
+/*
+ * SHA256 tree hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TREE_HASH_H )
+#define _TREE_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "sha256_hash.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SHA256 tree hash is the Merkle Tree Hash as defined in RFC 6962 section 2.1
+ * calculated over the data split into chunks of 1 MiB (1048576 bytes), where only
+ * the last chunk can be smaller.
+ *
+ * The hash of a chunk (leaf) is:  SHA256( 0x00 || chunk data )
+ * The hash of a node is:          SHA256( 0x01 || left hash || right hash )
+ *
+ * For n > 1 chunks the left sub tree contains the first k chunks, where k is
+ * the largest power of 2 smaller than n, and the right sub tree the remaining
+ * chunks. The tree hash of a single chunk is the hash of the chunk and the tree
+ * hash of empty data is SHA256 of the empty string.
+ *
+ * Since the chunk hashes are independent they can be calculated concurrently.
+ */
+#define TREE_HASH_CHUNK_SIZE			1048576
+
+/* The maximum number of workers that calculate chunk hashes concurrently
+ */
+#define TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS	16
+
+typedef struct tree_hash tree_hash_t;
+
+struct tree_hash
+{
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The number of chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The chunk hashes
+	 */
+	uint8_t *chunk_hashes;
+
+	/* The number of workers
+	 * chunk N is hashed by worker N modulus the number of workers
+	 */
+	int number_of_workers;
+
+	/* The SHA256 context of the chunk a worker is hashing
+	 * contains NULL if the worker is not hashing a chunk
+	 */
+	sha256_hash_t *worker_contexts[ TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS ];
+};
+
+int tree_hash_initialize(
+     tree_hash_t **tree_hash,
+     size64_t data_size,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int tree_hash_free(
+     tree_hash_t **tree_hash,
+     libcerror_error_t **error );
+
+int tree_hash_get_default_number_of_workers(
+     void );
+
+int tree_hash_update(
+     tree_hash_t *tree_hash,
+     int worker_index,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int tree_hash_finalize(
+     tree_hash_t *tree_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TREE_HASH_H ) */
+
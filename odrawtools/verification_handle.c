@@ -26,22 +26,46 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
 #include "byte_size_string.h"
+#include "checkpoint_file.h"
 #include "digest_hash.h"
 #include "log_handle.h"
 #include "odrawtools_libcerror.h"
 #include "odrawtools_libcsplit.h"
-#include "odrawtools_libhmac.h"
+#include "odrawtools_libcthreads.h"
 #include "odrawtools_libodraw.h"
 #include "odrawtools_system_split_string.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
 #include "verification_handle.h"
 
 #define VERIFICATION_HANDLE_VALUE_SIZE			64
 #define VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE	32
 #define VERIFICATION_HANDLE_NOTIFY_STREAM		stdout
 
+/* The number of storage media buffers in the queue between the reader and the digest threads
+ */
+#define VERIFICATION_HANDLE_NUMBER_OF_QUEUE_BUFFERS	8
+
+/* The maximum number of digest threads, which is a thread per digest hash
+ * and a thread per worker of the SHA256 tree hash and the CRC-32
+ */
+#define VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_DIGEST_THREADS	( 4 + ( 2 * TREE_HASH_MAXIMUM_NUMBER_OF_WORKERS ) )
+
+/* The minimum number of seconds between checkpoints
+ */
+#define VERIFICATION_HANDLE_CHECKPOINT_INTERVAL		60
+
 /* Creates a verification handle
  * Make sure the value verification_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -224,17 +248,17 @@ int verification_handle_free(
 
 			result = -1;
 		}
-		if( ( *verification_handle )->md5_context != NULL )
+		if( ( *verification_handle )->md5_hash != NULL )
 		{
-			if( libhmac_md5_free(
-			     &( ( *verification_handle )->md5_context ),
+			if( md5_hash_free(
+			     &( ( *verification_handle )->md5_hash ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free MD5 context.",
+				 "%s: unable to free MD5 hash.",
 				 function );
 
 				result = -1;
@@ -245,17 +269,17 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->calculated_md5_hash_string );
 		}
-		if( ( *verification_handle )->sha1_context != NULL )
+		if( ( *verification_handle )->sha1_hash != NULL )
 		{
-			if( libhmac_sha1_free(
-			     &( ( *verification_handle )->sha1_context ),
+			if( sha1_hash_free(
+			     &( ( *verification_handle )->sha1_hash ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free SHA1 context.",
+				 "%s: unable to free SHA1 hash.",
 				 function );
 
 				result = -1;
@@ -266,17 +290,17 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->calculated_sha1_hash_string );
 		}
-		if( ( *verification_handle )->sha256_context != NULL )
+		if( ( *verification_handle )->sha256_hash != NULL )
 		{
-			if( libhmac_sha256_free(
-			     &( ( *verification_handle )->sha256_context ),
+			if( sha256_hash_free(
+			     &( ( *verification_handle )->sha256_hash ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free SHA256 context.",
+				 "%s: unable to free SHA256 hash.",
 				 function );
 
 				result = -1;
@@ -287,6 +311,87 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->calculated_sha256_hash_string );
 		}
+		if( ( *verification_handle )->sha256_tree_hash != NULL )
+		{
+			if( tree_hash_free(
+			     &( ( *verification_handle )->sha256_tree_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 tree hash.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->calculated_sha256_tree_hash_string != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->calculated_sha256_tree_hash_string );
+		}
+		if( ( *verification_handle )->crc32_hash != NULL )
+		{
+			if( crc32_hash_free(
+			     &( ( *verification_handle )->crc32_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free CRC-32 hash.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->calculated_crc32_hash_string != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->calculated_crc32_hash_string );
+		}
+		if( ( *verification_handle )->xxh3_hash != NULL )
+		{
+			if( xxh3_hash_free(
+			     &( ( *verification_handle )->xxh3_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free XXH3 hash.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->calculated_xxh3_hash_string != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->calculated_xxh3_hash_string );
+		}
+		if( verification_handle_free_track_digests(
+		     *verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free track digests.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *verification_handle )->checkpoint_filename != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->checkpoint_filename );
+		}
 		memory_free(
 		 *verification_handle );
 
@@ -391,6 +496,22 @@ int verification_handle_open_input(
 
 		return( -1 );
 	}
+	/* Direct IO prevents verifying large numbers of images from evicting the page cache
+	 */
+	if( libodraw_handle_set_use_direct_io(
+	     verification_handle->input_handle,
+	     verification_handle->use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use direct IO.",
+		 function );
+
+		return( -1 );
+	}
 	if( libodraw_handle_open_data_files(
 	     verification_handle->input_handle,
 	     error ) != 1 )
@@ -404,6 +525,23 @@ int verification_handle_open_input(
 
 		return( -1 );
 	}
+	if( verification_handle->bytes_per_sector != 0 )
+	{
+		if( libodraw_handle_set_bytes_per_sector(
+		     verification_handle->input_handle,
+		     verification_handle->bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set bytes per sector.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -547,6 +685,8 @@ int verification_handle_initialize_integrity_hash(
      libcerror_error_t **error )
 {
 	static char *function = "verification_handle_initialize_integrity_hash";
+	size64_t media_size   = 0;
+	int number_of_workers = 1;
 
 	if( verification_handle == NULL )
 	{
@@ -561,15 +701,15 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_md5 != 0 )
 	{
-		if( libhmac_md5_initialize(
-		     &( verification_handle->md5_context ),
+		if( md5_hash_initialize(
+		     &( verification_handle->md5_hash ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize MD5 context.",
+			 "%s: unable to initialize MD5 hash.",
 			 function );
 
 			goto on_error;
@@ -578,15 +718,15 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_sha1 != 0 )
 	{
-		if( libhmac_sha1_initialize(
-		     &( verification_handle->sha1_context ),
+		if( sha1_hash_initialize(
+		     &( verification_handle->sha1_hash ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize SHA1 context.",
+			 "%s: unable to initialize SHA1 hash.",
 			 function );
 
 			goto on_error;
@@ -595,34 +735,152 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_sha256 != 0 )
 	{
-		if( libhmac_sha256_initialize(
-		     &( verification_handle->sha256_context ),
+		if( sha256_hash_initialize(
+		     &( verification_handle->sha256_hash ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize SHA256 context.",
+			 "%s: unable to initialize SHA256 hash.",
 			 function );
 
 			goto on_error;
 		}
 		verification_handle->sha256_context_initialized = 1;
 	}
+	if( ( verification_handle->calculate_sha256_tree != 0 )
+	 || ( verification_handle->calculate_crc32 != 0 ) )
+	{
+		if( libodraw_handle_get_media_size(
+		     verification_handle->input_handle,
+		     &media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve media size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The chunks are hashed by a digest thread per worker
+	 */
+	if( verification_handle->calculate_sha256_tree != 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		number_of_workers = tree_hash_get_default_number_of_workers();
+#endif
+		if( tree_hash_initialize(
+		     &( verification_handle->sha256_tree_hash ),
+		     media_size,
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 tree hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_crc32 != 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		number_of_workers = crc32_hash_get_default_number_of_workers();
+#endif
+		if( crc32_hash_initialize(
+		     &( verification_handle->crc32_hash ),
+		     media_size,
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize CRC-32 hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_xxh3 != 0 )
+	{
+		if( xxh3_hash_initialize(
+		     &( verification_handle->xxh3_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize XXH3 hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_track_digests != 0 )
+	{
+		if( verification_handle_initialize_track_digests(
+		     verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize track digests.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
-	if( verification_handle->sha1_context != NULL )
+	if( verification_handle->xxh3_hash != NULL )
+	{
+		xxh3_hash_free(
+		 &( verification_handle->xxh3_hash ),
+		 NULL );
+	}
+	if( verification_handle->crc32_hash != NULL )
 	{
-		libhmac_sha1_free(
-		 &( verification_handle->sha1_context ),
+		crc32_hash_free(
+		 &( verification_handle->crc32_hash ),
 		 NULL );
 	}
-	if( verification_handle->md5_context != NULL )
+	if( verification_handle->sha256_tree_hash != NULL )
 	{
-		libhmac_md5_free(
-		 &( verification_handle->md5_context ),
+		tree_hash_free(
+		 &( verification_handle->sha256_tree_hash ),
+		 NULL );
+	}
+	if( verification_handle->sha256_hash != NULL )
+	{
+		sha256_hash_free(
+		 &( verification_handle->sha256_hash ),
+		 NULL );
+	}
+	if( verification_handle->sha1_hash != NULL )
+	{
+		sha1_hash_free(
+		 &( verification_handle->sha1_hash ),
+		 NULL );
+	}
+	if( verification_handle->md5_hash != NULL )
+	{
+		md5_hash_free(
+		 &( verification_handle->md5_hash ),
 		 NULL );
 	}
 	return( -1 );
@@ -633,11 +891,13 @@ on_error:
  */
 int verification_handle_update_integrity_hash(
      verification_handle_t *verification_handle,
+     off64_t offset,
      uint8_t *buffer,
      size_t buffer_size,
      libcerror_error_t **error )
 {
 	static char *function = "verification_handle_update_integrity_hash";
+	int worker_index      = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -675,8 +935,9 @@ int verification_handle_update_integrity_hash(
 	}
 	if( verification_handle->calculate_md5 != 0 )
 	{
-		if( libhmac_md5_update(
-		     verification_handle->md5_context,
+		if( verification_handle_update_digest_hash(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_MD5,
 		     buffer,
 		     buffer_size,
 		     error ) != 1 )
@@ -690,11 +951,10 @@ int verification_handle_update_integrity_hash(
 
 			return( -1 );
 		}
-	}
-	if( verification_handle->calculate_sha1 != 0 )
-	{
-		if( libhmac_sha1_update(
-		     verification_handle->sha1_context,
+		if( verification_handle_update_track_digest_hashes(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_MD5,
+		     offset,
 		     buffer,
 		     buffer_size,
 		     error ) != 1 )
@@ -703,16 +963,17 @@ int verification_handle_update_integrity_hash(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA1 digest hash.",
+			 "%s: unable to update track MD5 digest hashes.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( verification_handle->calculate_sha256 != 0 )
+	if( verification_handle->calculate_sha1 != 0 )
 	{
-		if( libhmac_sha256_update(
-		     verification_handle->sha256_context,
+		if( verification_handle_update_digest_hash(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_SHA1,
 		     buffer,
 		     buffer_size,
 		     error ) != 1 )
@@ -721,115 +982,347 @@ int verification_handle_update_integrity_hash(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA256 digest hash.",
+			 "%s: unable to update SHA1 digest hash.",
 			 function );
 
 			return( -1 );
 		}
-	}
-	return( 1 );
-}
-
-/* Finalizes the integrity hash(es)
- * Returns 1 if successful or -1 on error
- */
-int verification_handle_finalize_integrity_hash(
-     verification_handle_t *verification_handle,
-     libcerror_error_t **error )
-{
-	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	uint8_t calculated_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
-	uint8_t calculated_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
-
-	static char *function = "verification_handle_finalize_integrity_hash";
-
-	if( verification_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid verification handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( verification_handle->calculate_md5 != 0 )
-	{
-		if( verification_handle->calculated_md5_hash_string == NULL )
+		if( verification_handle_update_track_digest_hashes(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_SHA1,
+		     offset,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid verification handle - missing calculated MD5 hash string.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update track SHA1 digest hashes.",
 			 function );
 
 			return( -1 );
 		}
-		if( libhmac_md5_finalize(
-		     verification_handle->md5_context,
-		     calculated_md5_hash,
-		     LIBHMAC_MD5_HASH_SIZE,
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		if( verification_handle_update_digest_hash(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_SHA256,
+		     buffer,
+		     buffer_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to finalize MD5 hash.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
 			 function );
 
 			return( -1 );
 		}
-		if( libhmac_md5_free(
-		     &( verification_handle->md5_context ),
+		if( verification_handle_update_track_digest_hashes(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_SHA256,
+		     offset,
+		     buffer,
+		     buffer_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free MD5 context.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update track SHA256 digest hashes.",
 			 function );
 
 			return( -1 );
 		}
-		if( digest_hash_copy_to_string(
-		     calculated_md5_hash,
-		     LIBHMAC_MD5_HASH_SIZE,
-		     verification_handle->calculated_md5_hash_string,
-		     33,
-		     error ) != 1 )
+	}
+	if( verification_handle->calculate_sha256_tree != 0 )
+	{
+		if( verification_handle->sha256_tree_hash == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBODRAW_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set calculated MD5 hash string.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing SHA256 tree hash.",
 			 function );
 
 			return( -1 );
 		}
+		for( worker_index = 0;
+		     worker_index < verification_handle->sha256_tree_hash->number_of_workers;
+		     worker_index++ )
+		{
+			if( tree_hash_update(
+			     verification_handle->sha256_tree_hash,
+			     worker_index,
+			     offset,
+			     buffer,
+			     buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update SHA256 tree hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
-	if( verification_handle->calculate_sha1 != 0 )
+	if( verification_handle->calculate_crc32 != 0 )
 	{
-		if( verification_handle->calculated_sha1_hash_string == NULL )
+		if( verification_handle->crc32_hash == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid verification handle - missing calculated SHA1 hash string.",
+			 "%s: invalid verification handle - missing CRC-32 hash.",
 			 function );
 
 			return( -1 );
 		}
-		if( libhmac_sha1_finalize(
-		     verification_handle->sha1_context,
-		     calculated_sha1_hash,
-		     LIBHMAC_SHA1_HASH_SIZE,
-		     error ) != 1 )
+		for( worker_index = 0;
+		     worker_index < verification_handle->crc32_hash->number_of_workers;
+		     worker_index++ )
+		{
+			if( crc32_hash_update(
+			     verification_handle->crc32_hash,
+			     worker_index,
+			     offset,
+			     buffer,
+			     buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update CRC-32 hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( verification_handle->calculate_xxh3 != 0 )
+	{
+		if( verification_handle_update_digest_hash(
+		     verification_handle,
+		     VERIFICATION_HANDLE_DIGEST_TYPE_XXH3,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update XXH3 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Updates a specific digest hash
+ * This function only accesses the context of the digest hash, so that the
+ * different digest hashes can be updated concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_update_digest_hash(
+     verification_handle_t *verification_handle,
+     int digest_type,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_update_digest_hash";
+	int result            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case VERIFICATION_HANDLE_DIGEST_TYPE_MD5:
+			result = md5_hash_update(
+			          verification_handle->md5_hash,
+			          buffer,
+			          buffer_size,
+			          error );
+			break;
+
+		case VERIFICATION_HANDLE_DIGEST_TYPE_SHA1:
+			result = sha1_hash_update(
+			          verification_handle->sha1_hash,
+			          buffer,
+			          buffer_size,
+			          error );
+			break;
+
+		case VERIFICATION_HANDLE_DIGEST_TYPE_SHA256:
+			result = sha256_hash_update(
+			          verification_handle->sha256_hash,
+			          buffer,
+			          buffer_size,
+			          error );
+			break;
+
+		case VERIFICATION_HANDLE_DIGEST_TYPE_XXH3:
+			result = xxh3_hash_update(
+			          verification_handle->xxh3_hash,
+			          buffer,
+			          buffer_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finalizes the integrity hash(es)
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_finalize_integrity_hash(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_md5_hash[ MD5_HASH_SIZE ];
+	uint8_t calculated_sha1_hash[ SHA1_HASH_SIZE ];
+	uint8_t calculated_sha256_hash[ SHA256_HASH_SIZE ];
+	uint8_t calculated_sha256_tree_hash[ SHA256_HASH_SIZE ];
+	uint8_t calculated_crc32_hash[ CRC32_HASH_SIZE ];
+	uint8_t calculated_xxh3_hash[ XXH3_HASH_SIZE ];
+
+	static char *function = "verification_handle_finalize_integrity_hash";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		if( verification_handle->calculated_md5_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( md5_hash_finalize(
+		     verification_handle->md5_hash,
+		     calculated_md5_hash,
+		     MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( md5_hash_free(
+		     &( verification_handle->md5_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_md5_hash,
+		     MD5_HASH_SIZE,
+		     verification_handle->calculated_md5_hash_string,
+		     33,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBODRAW_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set calculated MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		if( verification_handle->calculated_sha1_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated SHA1 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( sha1_hash_finalize(
+		     verification_handle->sha1_hash,
+		     calculated_sha1_hash,
+		     SHA1_HASH_SIZE,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -840,22 +1333,22 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha1_free(
-		     &( verification_handle->sha1_context ),
+		if( sha1_hash_free(
+		     &( verification_handle->sha1_hash ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free SHA1 context.",
+			 "%s: unable to free SHA1 hash.",
 			 function );
 
 			return( -1 );
 		}
 		if( digest_hash_copy_to_string(
 		     calculated_sha1_hash,
-		     LIBHMAC_SHA1_HASH_SIZE,
+		     SHA1_HASH_SIZE,
 		     verification_handle->calculated_sha1_hash_string,
 		     41,
 		     error ) != 1 )
@@ -883,10 +1376,10 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_finalize(
-		     verification_handle->sha256_context,
+		if( sha256_hash_finalize(
+		     verification_handle->sha256_hash,
 		     calculated_sha256_hash,
-		     LIBHMAC_SHA256_HASH_SIZE,
+		     SHA256_HASH_SIZE,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -898,22 +1391,22 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_free(
-		     &( verification_handle->sha256_context ),
+		if( sha256_hash_free(
+		     &( verification_handle->sha256_hash ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free SHA256 context.",
+			 "%s: unable to free SHA256 hash.",
 			 function );
 
 			return( -1 );
 		}
 		if( digest_hash_copy_to_string(
 		     calculated_sha256_hash,
-		     LIBHMAC_SHA256_HASH_SIZE,
+		     SHA256_HASH_SIZE,
 		     verification_handle->calculated_sha256_hash_string,
 		     65,
 		     error ) != 1 )
@@ -925,33 +1418,2517 @@ int verification_handle_finalize_integrity_hash(
 			 "%s: unable to create calculated SHA256 hash string.",
 			 function );
 
-			return( -1 );
+			return( -1 );
+		}
+	}
+	if( verification_handle->calculate_sha256_tree != 0 )
+	{
+		if( verification_handle->calculated_sha256_tree_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated SHA256 tree hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( tree_hash_finalize(
+		     verification_handle->sha256_tree_hash,
+		     calculated_sha256_tree_hash,
+		     SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 tree hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( tree_hash_free(
+		     &( verification_handle->sha256_tree_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 tree hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_sha256_tree_hash,
+		     SHA256_HASH_SIZE,
+		     verification_handle->calculated_sha256_tree_hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create calculated SHA256 tree hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->calculate_crc32 != 0 )
+	{
+		if( verification_handle->calculated_crc32_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated CRC-32 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( crc32_hash_finalize(
+		     verification_handle->crc32_hash,
+		     calculated_crc32_hash,
+		     CRC32_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize CRC-32 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( crc32_hash_free(
+		     &( verification_handle->crc32_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free CRC-32 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_crc32_hash,
+		     CRC32_HASH_SIZE,
+		     verification_handle->calculated_crc32_hash_string,
+		     9,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create calculated CRC-32 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->calculate_xxh3 != 0 )
+	{
+		if( verification_handle->calculated_xxh3_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated XXH3 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( xxh3_hash_finalize(
+		     verification_handle->xxh3_hash,
+		     calculated_xxh3_hash,
+		     XXH3_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize XXH3 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( xxh3_hash_free(
+		     &( verification_handle->xxh3_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free XXH3 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_xxh3_hash,
+		     XXH3_HASH_SIZE,
+		     verification_handle->calculated_xxh3_hash_string,
+		     17,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create calculated XXH3 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->track_digests != NULL )
+	{
+		if( verification_handle_finalize_track_digests(
+		     verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize track digests.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Initializes the track digests
+ * The track digests are calculated over the part of the media data of every track
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_initialize_track_digests(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_initialize_track_digests";
+	uint64_t data_file_start_sector                  = 0;
+	uint64_t number_of_sectors                       = 0;
+	uint64_t start_sector                            = 0;
+	uint32_t bytes_per_sector                        = 0;
+	uint8_t track_type                               = 0;
+	int data_file_index                              = 0;
+	int number_of_tracks                             = 0;
+	int track_index                                  = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->track_digests != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - track digests value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_bytes_per_sector(
+	     verification_handle->input_handle,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_handle_get_number_of_tracks(
+	     verification_handle->input_handle,
+	     &number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_tracks < 0 )
+	 || ( (size_t) number_of_tracks > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( verification_handle_track_digest_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tracks value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_tracks == 0 )
+	{
+		return( 1 );
+	}
+	verification_handle->track_digests = (verification_handle_track_digest_t *) memory_allocate(
+	                                      sizeof( verification_handle_track_digest_t ) * number_of_tracks );
+
+	if( verification_handle->track_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create track digests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verification_handle->track_digests,
+	     0,
+	     sizeof( verification_handle_track_digest_t ) * number_of_tracks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear track digests.",
+		 function );
+
+		memory_free(
+		 verification_handle->track_digests );
+
+		verification_handle->track_digests = NULL;
+
+		goto on_error;
+	}
+	verification_handle->number_of_track_digests = number_of_tracks;
+
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
+	{
+		track_digest = &( verification_handle->track_digests[ track_index ] );
+
+		if( libodraw_handle_get_track(
+		     verification_handle->input_handle,
+		     track_index,
+		     &start_sector,
+		     &number_of_sectors,
+		     &track_type,
+		     &data_file_index,
+		     &data_file_start_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track: %d.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+		/* The track data is located in the media data using the same bytes per sector
+		 * as the media data is read with
+		 */
+		track_digest->start_offset = (off64_t) ( start_sector * bytes_per_sector );
+		track_digest->size         = (size64_t) ( number_of_sectors * bytes_per_sector );
+
+		if( verification_handle->calculate_md5 != 0 )
+		{
+			if( md5_hash_initialize(
+			     &( track_digest->md5_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize track: %d MD5 hash.",
+				 function,
+				 track_index );
+
+				goto on_error;
+			}
+		}
+		if( verification_handle->calculate_sha1 != 0 )
+		{
+			if( sha1_hash_initialize(
+			     &( track_digest->sha1_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize track: %d SHA1 hash.",
+				 function,
+				 track_index );
+
+				goto on_error;
+			}
+		}
+		if( verification_handle->calculate_sha256 != 0 )
+		{
+			if( sha256_hash_initialize(
+			     &( track_digest->sha256_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize track: %d SHA256 hash.",
+				 function,
+				 track_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	verification_handle_free_track_digests(
+	 verification_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the track digests
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_free_track_digests(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_free_track_digests";
+	int result                                       = 1;
+	int track_index                                  = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->track_digests == NULL )
+	{
+		return( 1 );
+	}
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest = &( verification_handle->track_digests[ track_index ] );
+
+		if( track_digest->md5_hash != NULL )
+		{
+			if( md5_hash_free(
+			     &( track_digest->md5_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free track: %d MD5 hash.",
+				 function,
+				 track_index );
+
+				result = -1;
+			}
+		}
+		if( track_digest->sha1_hash != NULL )
+		{
+			if( sha1_hash_free(
+			     &( track_digest->sha1_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free track: %d SHA1 hash.",
+				 function,
+				 track_index );
+
+				result = -1;
+			}
+		}
+		if( track_digest->sha256_hash != NULL )
+		{
+			if( sha256_hash_free(
+			     &( track_digest->sha256_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free track: %d SHA256 hash.",
+				 function,
+				 track_index );
+
+				result = -1;
+			}
+		}
+	}
+	memory_free(
+	 verification_handle->track_digests );
+
+	verification_handle->track_digests           = NULL;
+	verification_handle->number_of_track_digests = 0;
+
+	return( result );
+}
+
+/* Updates a specific digest hash of the tracks
+ * The buffer is split at the track boundaries and every part is added
+ * to the digest hash of the track that contains it, digest hash types
+ * without track digests are ignored
+ * This function only accesses the contexts of the digest hash type, so that the
+ * different digest hashes can be updated concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_update_track_digest_hashes(
+     verification_handle_t *verification_handle,
+     int digest_type,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_update_track_digest_hashes";
+	off64_t buffer_end_offset                        = 0;
+	off64_t track_end_offset                         = 0;
+	off64_t update_end_offset                        = 0;
+	off64_t update_start_offset                      = 0;
+	size_t update_size                               = 0;
+	int result                                       = 0;
+	int track_index                                  = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->track_digests == NULL )
+	{
+		return( 1 );
+	}
+	/* The XXH3 hash is only calculated over the media data
+	 */
+	if( digest_type == VERIFICATION_HANDLE_DIGEST_TYPE_XXH3 )
+	{
+		return( 1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_end_offset = offset + (off64_t) buffer_size;
+
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest     = &( verification_handle->track_digests[ track_index ] );
+		track_end_offset = track_digest->start_offset + (off64_t) track_digest->size;
+
+		if( ( track_end_offset <= offset )
+		 || ( track_digest->start_offset >= buffer_end_offset ) )
+		{
+			continue;
+		}
+		update_start_offset = offset;
+
+		if( update_start_offset < track_digest->start_offset )
+		{
+			update_start_offset = track_digest->start_offset;
+		}
+		update_end_offset = buffer_end_offset;
+
+		if( update_end_offset > track_end_offset )
+		{
+			update_end_offset = track_end_offset;
+		}
+		update_size = (size_t) ( update_end_offset - update_start_offset );
+
+		switch( digest_type )
+		{
+			case VERIFICATION_HANDLE_DIGEST_TYPE_MD5:
+				result = md5_hash_update(
+				          track_digest->md5_hash,
+				          &( buffer[ update_start_offset - offset ] ),
+				          update_size,
+				          error );
+				break;
+
+			case VERIFICATION_HANDLE_DIGEST_TYPE_SHA1:
+				result = sha1_hash_update(
+				          track_digest->sha1_hash,
+				          &( buffer[ update_start_offset - offset ] ),
+				          update_size,
+				          error );
+				break;
+
+			case VERIFICATION_HANDLE_DIGEST_TYPE_SHA256:
+				result = sha256_hash_update(
+				          track_digest->sha256_hash,
+				          &( buffer[ update_start_offset - offset ] ),
+				          update_size,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported digest type: %d.",
+				 function,
+				 digest_type );
+
+				return( -1 );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update track: %d digest hash.",
+			 function,
+			 track_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the track digests
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_finalize_track_digests(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_md5_hash[ MD5_HASH_SIZE ];
+	uint8_t calculated_sha1_hash[ SHA1_HASH_SIZE ];
+	uint8_t calculated_sha256_hash[ SHA256_HASH_SIZE ];
+
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_finalize_track_digests";
+	int track_index                                  = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest = &( verification_handle->track_digests[ track_index ] );
+
+		if( track_digest->md5_hash != NULL )
+		{
+			if( md5_hash_finalize(
+			     track_digest->md5_hash,
+			     calculated_md5_hash,
+			     MD5_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize track: %d MD5 hash.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( md5_hash_free(
+			     &( track_digest->md5_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free track: %d MD5 hash.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+		if( verification_handle->calculate_md5 != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     calculated_md5_hash,
+			     MD5_HASH_SIZE,
+			     track_digest->calculated_md5_hash_string,
+			     33,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set calculated track: %d MD5 hash string.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+		if( track_digest->sha1_hash != NULL )
+		{
+			if( sha1_hash_finalize(
+			     track_digest->sha1_hash,
+			     calculated_sha1_hash,
+			     SHA1_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize track: %d SHA1 hash.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( sha1_hash_free(
+			     &( track_digest->sha1_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free track: %d SHA1 hash.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+		if( verification_handle->calculate_sha1 != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     calculated_sha1_hash,
+			     SHA1_HASH_SIZE,
+			     track_digest->calculated_sha1_hash_string,
+			     41,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set calculated track: %d SHA1 hash string.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+		if( track_digest->sha256_hash != NULL )
+		{
+			if( sha256_hash_finalize(
+			     track_digest->sha256_hash,
+			     calculated_sha256_hash,
+			     SHA256_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize track: %d SHA256 hash.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( sha256_hash_free(
+			     &( track_digest->sha256_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free track: %d SHA256 hash.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+		if( verification_handle->calculate_sha256 != 0 )
+		{
+			if( digest_hash_copy_to_string(
+			     calculated_sha256_hash,
+			     SHA256_HASH_SIZE,
+			     track_digest->calculated_sha256_hash_string,
+			     65,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set calculated track: %d SHA256 hash string.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the digest flags and the size of the state of the digest hashes
+ * that are stored in a checkpoint in addition to the SHA256 tree hash and CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_get_digest_state_size(
+     verification_handle_t *verification_handle,
+     uint32_t *digest_flags,
+     size_t *digest_state_size,
+     libcerror_error_t **error )
+{
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_get_digest_state_size";
+	size_t safe_digest_state_size                    = 0;
+	size_t track_digest_state_size                   = 0;
+	uint32_t safe_digest_flags                       = 0;
+	int track_index                                  = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_state_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest state size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->md5_hash != NULL )
+	{
+		safe_digest_flags      |= CHECKPOINT_FILE_DIGEST_FLAG_MD5;
+		safe_digest_state_size += MD5_HASH_STATE_SIZE;
+	}
+	if( verification_handle->sha1_hash != NULL )
+	{
+		safe_digest_flags      |= CHECKPOINT_FILE_DIGEST_FLAG_SHA1;
+		safe_digest_state_size += SHA1_HASH_STATE_SIZE;
+	}
+	if( verification_handle->sha256_hash != NULL )
+	{
+		safe_digest_flags      |= CHECKPOINT_FILE_DIGEST_FLAG_SHA256;
+		safe_digest_state_size += SHA256_HASH_STATE_SIZE;
+	}
+	if( verification_handle->xxh3_hash != NULL )
+	{
+		safe_digest_flags      |= CHECKPOINT_FILE_DIGEST_FLAG_XXH3;
+		safe_digest_state_size += XXH3_HASH_STATE_SIZE;
+	}
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest            = &( verification_handle->track_digests[ track_index ] );
+		track_digest_state_size = 0;
+
+		if( track_digest->md5_hash != NULL )
+		{
+			track_digest_state_size += MD5_HASH_STATE_SIZE;
+		}
+		if( track_digest->sha1_hash != NULL )
+		{
+			track_digest_state_size += SHA1_HASH_STATE_SIZE;
+		}
+		if( track_digest->sha256_hash != NULL )
+		{
+			track_digest_state_size += SHA256_HASH_STATE_SIZE;
+		}
+		if( track_digest_state_size > 0 )
+		{
+			safe_digest_flags      |= CHECKPOINT_FILE_DIGEST_FLAG_TRACKS;
+			safe_digest_state_size += track_digest_state_size;
+		}
+	}
+	*digest_flags      = safe_digest_flags;
+	*digest_state_size = safe_digest_state_size;
+
+	return( 1 );
+}
+
+/* Copies the state of the digest hashes to a byte stream
+ * The digest hashes must have hashed the media data up to the verify count
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_copy_digest_state_to_byte_stream(
+     verification_handle_t *verification_handle,
+     size64_t verify_count,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_copy_digest_state_to_byte_stream";
+	size64_t track_data_size                         = 0;
+	size_t byte_stream_offset                        = 0;
+	size_t digest_state_size                         = 0;
+	uint32_t digest_flags                            = 0;
+	int track_index                                  = 0;
+
+	if( verification_handle_get_digest_state_size(
+	     verification_handle,
+	     &digest_flags,
+	     &digest_state_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest state size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < digest_state_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->md5_hash != NULL )
+	{
+		if( verification_handle->md5_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid MD5 hash - data size value does not match verify count.",
+			 function );
+
+			return( -1 );
+		}
+		if( md5_hash_copy_state_to_byte_stream(
+		     verification_handle->md5_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy MD5 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += MD5_HASH_STATE_SIZE;
+	}
+	if( verification_handle->sha1_hash != NULL )
+	{
+		if( verification_handle->sha1_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid SHA1 hash - data size value does not match verify count.",
+			 function );
+
+			return( -1 );
+		}
+		if( sha1_hash_copy_state_to_byte_stream(
+		     verification_handle->sha1_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += SHA1_HASH_STATE_SIZE;
+	}
+	if( verification_handle->sha256_hash != NULL )
+	{
+		if( verification_handle->sha256_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid SHA256 hash - data size value does not match verify count.",
+			 function );
+
+			return( -1 );
+		}
+		if( sha256_hash_copy_state_to_byte_stream(
+		     verification_handle->sha256_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += SHA256_HASH_STATE_SIZE;
+	}
+	if( verification_handle->xxh3_hash != NULL )
+	{
+		if( verification_handle->xxh3_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid XXH3 hash - data size value does not match verify count.",
+			 function );
+
+			return( -1 );
+		}
+		if( xxh3_hash_copy_state_to_byte_stream(
+		     verification_handle->xxh3_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy XXH3 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += XXH3_HASH_STATE_SIZE;
+	}
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest    = &( verification_handle->track_digests[ track_index ] );
+		track_data_size = 0;
+
+		/* A track digest only hashes the part of the media data that is part of the track
+		 */
+		if( verify_count > (size64_t) track_digest->start_offset )
+		{
+			track_data_size = verify_count - (size64_t) track_digest->start_offset;
+
+			if( track_data_size > track_digest->size )
+			{
+				track_data_size = track_digest->size;
+			}
+		}
+		if( track_digest->md5_hash != NULL )
+		{
+			if( track_digest->md5_hash->data_size != track_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid track: %d MD5 hash - data size value does not match verify count.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( md5_hash_copy_state_to_byte_stream(
+			     track_digest->md5_hash,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     byte_stream_size - byte_stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy track: %d MD5 hash state.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_offset += MD5_HASH_STATE_SIZE;
+		}
+		if( track_digest->sha1_hash != NULL )
+		{
+			if( track_digest->sha1_hash->data_size != track_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid track: %d SHA1 hash - data size value does not match verify count.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( sha1_hash_copy_state_to_byte_stream(
+			     track_digest->sha1_hash,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     byte_stream_size - byte_stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy track: %d SHA1 hash state.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_offset += SHA1_HASH_STATE_SIZE;
+		}
+		if( track_digest->sha256_hash != NULL )
+		{
+			if( track_digest->sha256_hash->data_size != track_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid track: %d SHA256 hash - data size value does not match verify count.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( sha256_hash_copy_state_to_byte_stream(
+			     track_digest->sha256_hash,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     byte_stream_size - byte_stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy track: %d SHA256 hash state.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_offset += SHA256_HASH_STATE_SIZE;
+		}
+	}
+	return( 1 );
+}
+
+/* Copies the state of the digest hashes from a byte stream
+ * The digest hashes must be initialized but not yet updated
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_copy_digest_state_from_byte_stream(
+     verification_handle_t *verification_handle,
+     size64_t verify_count,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_copy_digest_state_from_byte_stream";
+	size64_t track_data_size                         = 0;
+	size_t byte_stream_offset                        = 0;
+	size_t digest_state_size                         = 0;
+	uint32_t digest_flags                            = 0;
+	int track_index                                  = 0;
+
+	if( verification_handle_get_digest_state_size(
+	     verification_handle,
+	     &digest_flags,
+	     &digest_state_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest state size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < digest_state_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->md5_hash != NULL )
+	{
+		if( md5_hash_copy_state_from_byte_stream(
+		     verification_handle->md5_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy MD5 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		if( verification_handle->md5_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: mismatch in MD5 hash data size and verify count.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += MD5_HASH_STATE_SIZE;
+	}
+	if( verification_handle->sha1_hash != NULL )
+	{
+		if( sha1_hash_copy_state_from_byte_stream(
+		     verification_handle->sha1_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		if( verification_handle->sha1_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: mismatch in SHA1 hash data size and verify count.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += SHA1_HASH_STATE_SIZE;
+	}
+	if( verification_handle->sha256_hash != NULL )
+	{
+		if( sha256_hash_copy_state_from_byte_stream(
+		     verification_handle->sha256_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		if( verification_handle->sha256_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: mismatch in SHA256 hash data size and verify count.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += SHA256_HASH_STATE_SIZE;
+	}
+	if( verification_handle->xxh3_hash != NULL )
+	{
+		if( xxh3_hash_copy_state_from_byte_stream(
+		     verification_handle->xxh3_hash,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy XXH3 hash state.",
+			 function );
+
+			return( -1 );
+		}
+		if( verification_handle->xxh3_hash->data_size != verify_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: mismatch in XXH3 hash data size and verify count.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += XXH3_HASH_STATE_SIZE;
+	}
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest    = &( verification_handle->track_digests[ track_index ] );
+		track_data_size = 0;
+
+		/* A track digest only hashes the part of the media data that is part of the track
+		 */
+		if( verify_count > (size64_t) track_digest->start_offset )
+		{
+			track_data_size = verify_count - (size64_t) track_digest->start_offset;
+
+			if( track_data_size > track_digest->size )
+			{
+				track_data_size = track_digest->size;
+			}
+		}
+		if( track_digest->md5_hash != NULL )
+		{
+			if( md5_hash_copy_state_from_byte_stream(
+			     track_digest->md5_hash,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     byte_stream_size - byte_stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy track: %d MD5 hash state.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( track_digest->md5_hash->data_size != track_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: mismatch in track: %d MD5 hash data size and verify count.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_offset += MD5_HASH_STATE_SIZE;
+		}
+		if( track_digest->sha1_hash != NULL )
+		{
+			if( sha1_hash_copy_state_from_byte_stream(
+			     track_digest->sha1_hash,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     byte_stream_size - byte_stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy track: %d SHA1 hash state.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( track_digest->sha1_hash->data_size != track_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: mismatch in track: %d SHA1 hash data size and verify count.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_offset += SHA1_HASH_STATE_SIZE;
+		}
+		if( track_digest->sha256_hash != NULL )
+		{
+			if( sha256_hash_copy_state_from_byte_stream(
+			     track_digest->sha256_hash,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     byte_stream_size - byte_stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy track: %d SHA256 hash state.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( track_digest->sha256_hash->data_size != track_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: mismatch in track: %d SHA256 hash data size and verify count.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_offset += SHA256_HASH_STATE_SIZE;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the checkpoint and continues the integrity hash(es) from the checkpoint
+ * The integrity hash(es) must be initialized but not yet updated
+ * Returns 1 if successful, 0 if no checkpoint was available or -1 on error
+ */
+int verification_handle_read_checkpoint(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size64_t *verify_count,
+     libcerror_error_t **error )
+{
+	uint8_t *digest_state    = NULL;
+	static char *function    = "verification_handle_read_checkpoint";
+	size_t digest_state_size = 0;
+	off64_t offset           = 0;
+	uint32_t digest_flags    = 0;
+	int result               = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify count.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->checkpoint_filename == NULL )
+	{
+		return( 0 );
+	}
+	if( verification_handle_get_digest_state_size(
+	     verification_handle,
+	     &digest_flags,
+	     &digest_state_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest state size.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_state_size > 0 )
+	{
+		digest_state = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * digest_state_size );
+
+		if( digest_state == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create digest state.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = checkpoint_file_read(
+	          verification_handle->checkpoint_filename,
+	          media_size,
+	          &offset,
+	          verification_handle->sha256_tree_hash,
+	          verification_handle->crc32_hash,
+	          digest_flags,
+	          digest_state,
+	          digest_state_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( digest_state != NULL )
+		{
+			memory_free(
+			 digest_state );
+		}
+		return( 0 );
+	}
+	if( digest_state != NULL )
+	{
+		if( verification_handle_copy_digest_state_from_byte_stream(
+		     verification_handle,
+		     (size64_t) offset,
+		     digest_state,
+		     digest_state_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy digest state.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 digest_state );
+
+		digest_state = NULL;
+	}
+	if( libodraw_handle_seek_offset(
+	     verification_handle->input_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) != offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek checkpoint offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	verification_handle->last_offset_read = offset;
+
+	*verify_count = (size64_t) offset;
+
+	return( 1 );
+
+on_error:
+	if( digest_state != NULL )
+	{
+		memory_free(
+		 digest_state );
+	}
+	return( -1 );
+}
+
+/* Determines if a checkpoint should be written after the data up to the verify count was hashed
+ * A checkpoint is only written on a chunk boundary, at most once every checkpoint interval
+ * Returns 1 if a checkpoint is due or 0 if not
+ */
+int verification_handle_is_checkpoint_due(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size64_t verify_count )
+{
+	if( verification_handle == NULL )
+	{
+		return( 0 );
+	}
+	if( verification_handle->checkpoint_filename == NULL )
+	{
+		return( 0 );
+	}
+	if( ( verify_count >= media_size )
+	 || ( ( verify_count % CHECKPOINT_FILE_CHUNK_SIZE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( time( NULL ) - verification_handle->last_checkpoint_timestamp ) < VERIFICATION_HANDLE_CHECKPOINT_INTERVAL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Writes a checkpoint of the integrity hash(es) after the data up to the verify count was hashed
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_write_checkpoint(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size64_t verify_count,
+     libcerror_error_t **error )
+{
+	uint8_t *digest_state    = NULL;
+	static char *function    = "verification_handle_write_checkpoint";
+	size_t digest_state_size = 0;
+	uint32_t digest_flags    = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle_get_digest_state_size(
+	     verification_handle,
+	     &digest_flags,
+	     &digest_state_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve digest state size.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_state_size > 0 )
+	{
+		digest_state = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * digest_state_size );
+
+		if( digest_state == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create digest state.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle_copy_digest_state_to_byte_stream(
+		     verification_handle,
+		     verify_count,
+		     digest_state,
+		     digest_state_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy digest state.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( checkpoint_file_write(
+	     verification_handle->checkpoint_filename,
+	     media_size,
+	     (off64_t) verify_count,
+	     verification_handle->sha256_tree_hash,
+	     verification_handle->crc32_hash,
+	     digest_flags,
+	     digest_state,
+	     digest_state_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_state != NULL )
+	{
+		memory_free(
+		 digest_state );
+	}
+	verification_handle->last_checkpoint_timestamp = time(
+	                                                  NULL );
+
+	return( 1 );
+
+on_error:
+	if( digest_state != NULL )
+	{
+		memory_free(
+		 digest_state );
+	}
+	return( -1 );
+}
+
+/* Verifies the input
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_input(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	process_status_t *process_status             = NULL;
+	static char *function                        = "verification_handle_verify_input";
+	size64_t media_size                          = 0;
+	size64_t verify_count                        = 0;
+	size_t process_buffer_size                   = 0;
+	int result                                   = 0;
+	int status                                   = PROCESS_STATUS_COMPLETED;
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	uint8_t *data                                = NULL;
+	size_t data_size                             = 0;
+	size_t read_size                             = 0;
+	ssize_t process_count                        = 0;
+	ssize_t read_count                           = 0;
+#endif
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_media_size(
+	     verification_handle->input_handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->process_buffer_size == 0 )
+	{
+		process_buffer_size = 32768;
+	}
+	else
+	{
+		process_buffer_size = verification_handle->process_buffer_size;
+	}
+	if( verification_handle_initialize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->resume != 0 )
+	{
+		result = verification_handle_read_checkpoint(
+		          verification_handle,
+		          media_size,
+		          &verify_count,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resume from checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			fprintf(
+			 verification_handle->notify_stream,
+			 "Resuming verification at offset: %" PRIu64 ".\n\n",
+			 verify_count );
+		}
+	}
+	verification_handle->last_checkpoint_timestamp = time(
+	                                                  NULL );
+
+	if( process_status_initialize(
+	     &process_status,
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle_verify_input_multi_threaded(
+	     verification_handle,
+	     process_status,
+	     media_size,
+	     process_buffer_size,
+	     &verify_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify input.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( verify_count < media_size )
+	{
+		read_size = process_buffer_size;
+
+		if( ( media_size - verify_count ) < read_size )
+		{
+			read_size = (size_t) ( media_size - verify_count );
+		}
+		/* Make sure a read does not cross a chunk boundary so that every chunk boundary can be checkpointed
+		 */
+		if( ( verification_handle->checkpoint_filename != NULL )
+		 && ( ( CHECKPOINT_FILE_CHUNK_SIZE - ( verify_count % CHECKPOINT_FILE_CHUNK_SIZE ) ) < read_size ) )
+		{
+			read_size = (size_t) ( CHECKPOINT_FILE_CHUNK_SIZE - ( verify_count % CHECKPOINT_FILE_CHUNK_SIZE ) );
+		}
+		read_count = verification_handle_read_buffer(
+		              verification_handle,
+		              storage_media_buffer,
+		              read_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			"%s: unable to read data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data.",
+			 function );
+
+			goto on_error;
+		}
+		process_count = verification_handle_prepare_read_buffer(
+		                 verification_handle,
+		                 storage_media_buffer,
+		                 error );
+
+		if( process_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			"%s: unable to prepare buffer after read.",
+			 function );
+
+			goto on_error;
+		}
+		if( process_count > (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: more bytes read than requested.",
+			 function );
+
+			goto on_error;
+		}
+		if( storage_media_buffer_get_data(
+		     storage_media_buffer,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine storage media buffer data.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle_update_integrity_hash(
+		     verification_handle,
+		     (off64_t) verify_count,
+		     data,
+		     process_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to update integrity hash(es).",
+			 function );
+
+			goto on_error;
+		}
+		verify_count += (size64_t) process_count;
+
+		if( verification_handle_is_checkpoint_due(
+		     verification_handle,
+		     media_size,
+		     verify_count ) != 0 )
+		{
+			if( verification_handle_write_checkpoint(
+			     verification_handle,
+			     media_size,
+			     verify_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( process_status_update(
+		     process_status,
+		     verify_count,
+		     media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update process status.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle->abort != 0 )
+		{
+			break;
+		}
+  	}
+	if( storage_media_buffer_free(
+	     &storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( verification_handle_finalize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->abort != 0 )
+	{
+		status = PROCESS_STATUS_ABORTED;
+	}
+	if( process_status_stop(
+	     process_status,
+	     verify_count,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_free(
+	     &process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( verification_handle->abort == 0 )
+	 && ( verification_handle->checkpoint_filename != NULL ) )
+	{
+		/* The verification completed hence the checkpoint is no longer needed
+		 */
+		if( checkpoint_file_remove(
+		     verification_handle->checkpoint_filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove checkpoint file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->abort == 0 )
+	{
+		if( verification_handle_hash_values_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hash values.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 verification_handle->notify_stream,
+		 "\n" );
+
+		if( log_handle != NULL )
+		{
+			if( verification_handle_hash_values_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print hash values in log handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+/* TODO use the information file to retrieve the stored hashes */
+	return( 1 );
+
+on_error:
+	if( process_status != NULL )
+	{
+		process_status_stop(
+		 process_status,
+		 verify_count,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &process_status,
+		 NULL );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates a digest hash of the buffers in the storage media buffer queue
+ * This function is run in a separate thread per digest hash
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_digest_thread_callback(
+     verification_handle_digest_thread_t *digest_thread )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	uint8_t *data                                = NULL;
+	static char *function                        = "verification_handle_digest_thread_callback";
+	size_t data_size                             = 0;
+	off64_t offset                               = 0;
+	int result                                   = 0;
+
+	if( digest_thread == NULL )
+	{
+		return( -1 );
+	}
+	offset = digest_thread->start_offset;
+
+	while( 1 )
+	{
+		result = storage_media_buffer_queue_grab_for_read(
+		          digest_thread->storage_media_buffer_queue,
+		          digest_thread->consumer_index,
+		          &storage_media_buffer,
+		          &( digest_thread->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( digest_thread->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab storage media buffer from queue.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( storage_media_buffer_get_data(
+		     storage_media_buffer,
+		     &data,
+		     &data_size,
+		     &( digest_thread->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( digest_thread->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine storage media buffer data.",
+			 function );
+
+			goto on_error;
+		}
+		/* The buffers are processed in order hence the offset of the data
+		 * in the media data is the number of bytes processed so far
+		 */
+		if( digest_thread->digest_type == VERIFICATION_HANDLE_DIGEST_TYPE_SHA256_TREE )
+		{
+			/* Every tree hash worker sees all the data but only hashes its own chunks
+			 */
+			if( tree_hash_update(
+			     digest_thread->verification_handle->sha256_tree_hash,
+			     digest_thread->worker_index,
+			     offset,
+			     data,
+			     data_size,
+			     &( digest_thread->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( digest_thread->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update SHA256 tree hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( digest_thread->digest_type == VERIFICATION_HANDLE_DIGEST_TYPE_CRC32 )
+		{
+			/* Every CRC-32 worker sees all the data but only calculates the CRC-32 of its own chunks
+			 */
+			if( crc32_hash_update(
+			     digest_thread->verification_handle->crc32_hash,
+			     digest_thread->worker_index,
+			     offset,
+			     data,
+			     data_size,
+			     &( digest_thread->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( digest_thread->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update CRC-32 hash.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( verification_handle_update_digest_hash(
+			     digest_thread->verification_handle,
+			     digest_thread->digest_type,
+			     data,
+			     data_size,
+			     &( digest_thread->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( digest_thread->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update digest hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( verification_handle_update_track_digest_hashes(
+			     digest_thread->verification_handle,
+			     digest_thread->digest_type,
+			     offset,
+			     data,
+			     data_size,
+			     &( digest_thread->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( digest_thread->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update track digest hashes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		offset += (off64_t) data_size;
+
+		if( storage_media_buffer_queue_release_for_read(
+		     digest_thread->storage_media_buffer_queue,
+		     digest_thread->consumer_index,
+		     &( digest_thread->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( digest_thread->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release storage media buffer to queue.",
+			 function );
+
+			goto on_error;
 		}
 	}
 	return( 1 );
+
+on_error:
+	/* Make sure the reader and the other digest threads do not wait indefinitely
+	 */
+	storage_media_buffer_queue_abort(
+	 digest_thread->storage_media_buffer_queue,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Verifies the input
- * Returns 1 if successful, 0 if not or -1 on error
+/* Verifies the input using a reader and a thread per digest hash
+ * The reader fills a ring of storage media buffers that are hashed concurrently
+ * by the digest threads, every digest thread processes the buffers in order
+ * Returns 1 if successful or -1 on error
  */
-int verification_handle_verify_input(
+int verification_handle_verify_input_multi_threaded(
      verification_handle_t *verification_handle,
-     uint8_t print_status_information,
-     log_handle_t *log_handle,
+     process_status_t *process_status,
+     size64_t media_size,
+     size_t process_buffer_size,
+     size64_t *verify_count,
      libcerror_error_t **error )
 {
-	process_status_t *process_status             = NULL;
-	storage_media_buffer_t *storage_media_buffer = NULL;
-	uint8_t *data                                = NULL;
-	static char *function                        = "verification_handle_verify_input";
-	size64_t media_size                          = 0;
-	size64_t verify_count                        = 0;
-	size_t data_size                             = 0;
-	size_t process_buffer_size                   = 0;
-	size_t read_size                             = 0;
-	ssize_t process_count                        = 0;
-	ssize_t read_count                           = 0;
-	int status                                   = PROCESS_STATUS_COMPLETED;
+	verification_handle_digest_thread_t digest_threads[ VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_DIGEST_THREADS ];
+
+	storage_media_buffer_queue_t *storage_media_buffer_queue = NULL;
+	storage_media_buffer_t *storage_media_buffer             = NULL;
+	static char *function                                    = "verification_handle_verify_input_multi_threaded";
+	size_t read_size                                         = 0;
+	ssize_t process_count                                    = 0;
+	ssize_t read_count                                       = 0;
+	int digest_thread_index                                  = 0;
+	int number_of_digest_threads                             = 0;
+	int result                                               = 0;
+	int worker_index                                         = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -964,104 +3941,150 @@ int verification_handle_verify_input(
 
 		return( -1 );
 	}
-	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	if( verify_count == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid process buffer size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify count.",
 		 function );
 
 		return( -1 );
 	}
-	if( libodraw_handle_get_media_size(
-	     verification_handle->input_handle,
-	     &media_size,
-	     error ) != 1 )
+	if( memory_set(
+	     digest_threads,
+	     0,
+	     sizeof( verification_handle_digest_thread_t ) * VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_DIGEST_THREADS ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve media size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest threads.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( verification_handle->process_buffer_size == 0 )
+	if( verification_handle->calculate_md5 != 0 )
 	{
-		process_buffer_size = 32768;
+		digest_threads[ number_of_digest_threads++ ].digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_MD5;
 	}
-	else
+	if( verification_handle->calculate_sha1 != 0 )
 	{
-		process_buffer_size = verification_handle->process_buffer_size;
+		digest_threads[ number_of_digest_threads++ ].digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_SHA1;
 	}
-	if( storage_media_buffer_initialize(
-	     &storage_media_buffer,
-	     process_buffer_size,
-	     error ) != 1 )
+	if( verification_handle->calculate_sha256 != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create storage media buffer.",
-		 function );
+		digest_threads[ number_of_digest_threads++ ].digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_SHA256;
+	}
+	if( verification_handle->sha256_tree_hash != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < verification_handle->sha256_tree_hash->number_of_workers;
+		     worker_index++ )
+		{
+			digest_threads[ number_of_digest_threads ].digest_type  = VERIFICATION_HANDLE_DIGEST_TYPE_SHA256_TREE;
+			digest_threads[ number_of_digest_threads ].worker_index = worker_index;
 
-		goto on_error;
+			number_of_digest_threads++;
+		}
 	}
-	if( verification_handle_initialize_integrity_hash(
-	     verification_handle,
-	     error ) != 1 )
+	if( verification_handle->crc32_hash != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize integrity hash(es).",
-		 function );
+		for( worker_index = 0;
+		     worker_index < verification_handle->crc32_hash->number_of_workers;
+		     worker_index++ )
+		{
+			digest_threads[ number_of_digest_threads ].digest_type  = VERIFICATION_HANDLE_DIGEST_TYPE_CRC32;
+			digest_threads[ number_of_digest_threads ].worker_index = worker_index;
 
-		goto on_error;
+			number_of_digest_threads++;
+		}
 	}
-	if( process_status_initialize(
-	     &process_status,
-	     _SYSTEM_STRING( "Verify" ),
-	     _SYSTEM_STRING( "verified" ),
-	     _SYSTEM_STRING( "Read" ),
-	     verification_handle->notify_stream,
-	     print_status_information,
+	if( verification_handle->calculate_xxh3 != 0 )
+	{
+		digest_threads[ number_of_digest_threads++ ].digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_XXH3;
+	}
+	if( storage_media_buffer_queue_initialize(
+	     &storage_media_buffer_queue,
+	     VERIFICATION_HANDLE_NUMBER_OF_QUEUE_BUFFERS,
+	     process_buffer_size,
+	     number_of_digest_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create process status.",
+		 "%s: unable to create storage media buffer queue.",
 		 function );
 
 		goto on_error;
 	}
-	if( process_status_start(
-	     process_status,
-	     error ) != 1 )
+	for( digest_thread_index = 0;
+	     digest_thread_index < number_of_digest_threads;
+	     digest_thread_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to start process status.",
-		 function );
+		digest_threads[ digest_thread_index ].verification_handle        = verification_handle;
+		digest_threads[ digest_thread_index ].storage_media_buffer_queue = storage_media_buffer_queue;
+		digest_threads[ digest_thread_index ].consumer_index             = digest_thread_index;
+		digest_threads[ digest_thread_index ].start_offset               = (off64_t) *verify_count;
+
+		if( libcthreads_thread_create(
+		     &( digest_threads[ digest_thread_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &verification_handle_digest_thread_callback,
+		     (void *) &( digest_threads[ digest_thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create digest thread: %d.",
+			 function,
+			 digest_thread_index );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	while( verify_count < media_size )
+	while( *verify_count < media_size )
 	{
 		read_size = process_buffer_size;
 
-		if( ( media_size - verify_count ) < read_size )
+		if( ( media_size - *verify_count ) < read_size )
 		{
-			read_size = (size_t) ( media_size - verify_count );
+			read_size = (size_t) ( media_size - *verify_count );
+		}
+		/* Make sure a read does not cross a chunk boundary so that every chunk boundary can be checkpointed
+		 */
+		if( ( verification_handle->checkpoint_filename != NULL )
+		 && ( ( CHECKPOINT_FILE_CHUNK_SIZE - ( *verify_count % CHECKPOINT_FILE_CHUNK_SIZE ) ) < read_size ) )
+		{
+			read_size = (size_t) ( CHECKPOINT_FILE_CHUNK_SIZE - ( *verify_count % CHECKPOINT_FILE_CHUNK_SIZE ) );
+		}
+		result = storage_media_buffer_queue_grab_for_write(
+		          storage_media_buffer_queue,
+		          &storage_media_buffer,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab storage media buffer from queue.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* A digest thread failed and aborted the queue
+			 */
+			break;
 		}
 		read_count = verification_handle_read_buffer(
 		              verification_handle,
@@ -1118,41 +4141,69 @@ int verification_handle_verify_input(
 
 			goto on_error;
 		}
-		verify_count += (size64_t) process_count;
-
-		if( storage_media_buffer_get_data(
-		     storage_media_buffer,
-		     &data,
-		     &data_size,
+		if( storage_media_buffer_queue_release_for_write(
+		     storage_media_buffer_queue,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine storage media buffer data.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release storage media buffer to queue.",
 			 function );
 
 			goto on_error;
 		}
-		if( verification_handle_update_integrity_hash(
+		*verify_count += (size64_t) process_count;
+
+		if( verification_handle_is_checkpoint_due(
 		     verification_handle,
-		     data,
-		     process_count,
-		     error ) != 1 )
+		     media_size,
+		     *verify_count ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to update integrity hash(es).",
-			 function );
+			/* The digest threads must have hashed all the buffers written so far
+			 * before the state of the integrity hash(es) can be stored
+			 */
+			result = storage_media_buffer_queue_wait_until_read(
+			          storage_media_buffer_queue,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for storage media buffer queue to be read.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* A digest thread failed and aborted the queue
+				 */
+				break;
+			}
+			if( verification_handle_write_checkpoint(
+			     verification_handle,
+			     media_size,
+			     *verify_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		if( process_status_update(
 		     process_status,
-		     verify_count,
+		     *verify_count,
 		     media_size,
 		     error ) != 1 )
 		{
@@ -1169,127 +4220,117 @@ int verification_handle_verify_input(
 		{
 			break;
 		}
-  	}
-	if( storage_media_buffer_free(
-	     &storage_media_buffer,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free storage media buffer.",
-		 function );
-
-		goto on_error;
-	}
-	if( verification_handle_finalize_integrity_hash(
-	     verification_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize integrity hash(es).",
-		 function );
-
-		goto on_error;
-	}
-	if( verification_handle->abort != 0 )
-	{
-		status = PROCESS_STATUS_ABORTED;
 	}
-	if( process_status_stop(
-	     process_status,
-	     verify_count,
-	     status,
+	if( storage_media_buffer_queue_close(
+	     storage_media_buffer_queue,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to stop process status.",
-		 function );
-
-		goto on_error;
-	}
-	if( process_status_free(
-	     &process_status,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free process status.",
+		 "%s: unable to close storage media buffer queue.",
 		 function );
 
 		goto on_error;
 	}
-	if( verification_handle->abort == 0 )
+	for( digest_thread_index = 0;
+	     digest_thread_index < number_of_digest_threads;
+	     digest_thread_index++ )
 	{
-		if( verification_handle_hash_values_fprint(
-		     verification_handle,
-		     verification_handle->notify_stream,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print hash values.",
-			 function );
-
-			goto on_error;
-		}
-		fprintf(
-		 verification_handle->notify_stream,
-		 "\n" );
-
-		if( log_handle != NULL )
+		if( libcthreads_thread_join(
+		     &( digest_threads[ digest_thread_index ].thread ),
+		     NULL ) != 1 )
 		{
-			if( verification_handle_hash_values_fprint(
-			     verification_handle,
-			     log_handle->log_stream,
-			     error ) != 1 )
+			/* The thread error is reported below
+			 */
+			if( digest_threads[ digest_thread_index ].error == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print hash values in log handle.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join digest thread: %d.",
+				 function,
+				 digest_thread_index );
 
 				goto on_error;
 			}
 		}
 	}
-/* TODO use the information file to retrieve the stored hashes */
+	for( digest_thread_index = 0;
+	     digest_thread_index < number_of_digest_threads;
+	     digest_thread_index++ )
+	{
+		if( digest_threads[ digest_thread_index ].error != NULL )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = digest_threads[ digest_thread_index ].error;
+
+				digest_threads[ digest_thread_index ].error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: digest thread: %d failed.",
+			 function,
+			 digest_thread_index );
+
+			goto on_error;
+		}
+	}
+	if( storage_media_buffer_queue_free(
+	     &storage_media_buffer_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer queue.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
-	if( process_status != NULL )
+	if( storage_media_buffer_queue != NULL )
 	{
-		process_status_stop(
-		 process_status,
-		 verify_count,
-		 PROCESS_STATUS_FAILED,
-		 NULL );
-		process_status_free(
-		 &process_status,
+		storage_media_buffer_queue_abort(
+		 storage_media_buffer_queue,
 		 NULL );
 	}
-	if( storage_media_buffer != NULL )
+	for( digest_thread_index = 0;
+	     digest_thread_index < number_of_digest_threads;
+	     digest_thread_index++ )
 	{
-		storage_media_buffer_free(
-		 &storage_media_buffer,
+		if( digest_threads[ digest_thread_index ].thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( digest_threads[ digest_thread_index ].thread ),
+			 NULL );
+		}
+		if( digest_threads[ digest_thread_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( digest_threads[ digest_thread_index ].error ) );
+		}
+	}
+	if( storage_media_buffer_queue != NULL )
+	{
+		storage_media_buffer_queue_free(
+		 &storage_media_buffer_queue,
 		 NULL );
 	}
 	return( -1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Sets the process buffer size
  * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
@@ -1348,6 +4389,144 @@ int verification_handle_set_process_buffer_size(
 	return( result );
 }
 
+/* Sets the bytes per sector of the media data
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_bytes_per_sector(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_bytes_per_sector";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "2048" ),
+		     4 ) == 0 )
+		{
+			verification_handle->bytes_per_sector = 2048;
+			result                                = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "2352" ),
+		          4 ) == 0 )
+		{
+			verification_handle->bytes_per_sector = 2352;
+			result                                = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the checkpoint filename
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_set_checkpoint_filename(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "verification_handle_set_checkpoint_filename";
+	size_t filename_length = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->checkpoint_filename != NULL )
+	{
+		memory_free(
+		 verification_handle->checkpoint_filename );
+
+		verification_handle->checkpoint_filename = NULL;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	verification_handle->checkpoint_filename = system_string_allocate(
+	                                            filename_length + 1 );
+
+	if( verification_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     verification_handle->checkpoint_filename,
+	     filename,
+	     filename_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy checkpoint filename.",
+		 function );
+
+		memory_free(
+		 verification_handle->checkpoint_filename );
+
+		verification_handle->checkpoint_filename = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the additional digest types
  * Returns 1 if successful or -1 on error
  */
@@ -1363,6 +4542,9 @@ int verification_handle_set_additional_digest_types(
 	size_t string_segment_size             = 0;
 	uint8_t calculate_sha1                 = 0;
 	uint8_t calculate_sha256               = 0;
+	uint8_t calculate_sha256_tree          = 0;
+	uint8_t calculate_crc32                = 0;
+	uint8_t calculate_xxh3                 = 0;
 	int number_of_segments                 = 0;
 	int result                             = 0;
 	int segment_index                      = 0;
@@ -1460,6 +4642,20 @@ int verification_handle_set_additional_digest_types(
 			{
 				calculate_sha1 = 1;
 			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "xxh3" ),
+			          4 ) == 0 )
+			{
+				calculate_xxh3 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "XXH3" ),
+			          4 ) == 0 )
+			{
+				calculate_xxh3 = 1;
+			}
 		}
 		else if( string_segment_size == 6 )
 		{
@@ -1491,6 +4687,20 @@ int verification_handle_set_additional_digest_types(
 			{
 				calculate_sha1 = 1;
 			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "crc32" ),
+			          5 ) == 0 )
+			{
+				calculate_crc32 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "CRC32" ),
+			          5 ) == 0 )
+			{
+				calculate_crc32 = 1;
+			}
 		}
 		else if( string_segment_size == 7 )
 		{
@@ -1508,6 +4718,20 @@ int verification_handle_set_additional_digest_types(
 			{
 				calculate_sha256 = 1;
 			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "crc-32" ),
+			          6 ) == 0 )
+			{
+				calculate_crc32 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "CRC-32" ),
+			          6 ) == 0 )
+			{
+				calculate_crc32 = 1;
+			}
 		}
 		else if( string_segment_size == 8 )
 		{
@@ -1539,6 +4763,65 @@ int verification_handle_set_additional_digest_types(
 			{
 				calculate_sha256 = 1;
 			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "xxh3-64" ),
+			          7 ) == 0 )
+			{
+				calculate_xxh3 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "xxh3_64" ),
+			          7 ) == 0 )
+			{
+				calculate_xxh3 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "XXH3-64" ),
+			          7 ) == 0 )
+			{
+				calculate_xxh3 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "XXH3_64" ),
+			          7 ) == 0 )
+			{
+				calculate_xxh3 = 1;
+			}
+		}
+		else if( string_segment_size == 12 )
+		{
+			if( system_string_compare(
+			     string_segment,
+			     _SYSTEM_STRING( "sha256-tree" ),
+			     11 ) == 0 )
+			{
+				calculate_sha256_tree = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "sha256_tree" ),
+			          11 ) == 0 )
+			{
+				calculate_sha256_tree = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA256-tree" ),
+			          11 ) == 0 )
+			{
+				calculate_sha256_tree = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA256_tree" ),
+			          11 ) == 0 )
+			{
+				calculate_sha256_tree = 1;
+			}
 		}
 	}
 	if( ( calculate_sha1 != 0 )
@@ -1579,6 +4862,63 @@ int verification_handle_set_additional_digest_types(
 		}
 		verification_handle->calculate_sha256 = 1;
 	}
+	if( ( calculate_sha256_tree != 0 )
+	 && ( verification_handle->calculate_sha256_tree == 0 ) )
+	{
+		verification_handle->calculated_sha256_tree_hash_string = system_string_allocate(
+		                                                           65 );
+
+		if( verification_handle->calculated_sha256_tree_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated SHA256 tree digest hash string.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->calculate_sha256_tree = 1;
+	}
+	if( ( calculate_crc32 != 0 )
+	 && ( verification_handle->calculate_crc32 == 0 ) )
+	{
+		verification_handle->calculated_crc32_hash_string = system_string_allocate(
+		                                                     9 );
+
+		if( verification_handle->calculated_crc32_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated CRC-32 hash string.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->calculate_crc32 = 1;
+	}
+	if( ( calculate_xxh3 != 0 )
+	 && ( verification_handle->calculate_xxh3 == 0 ) )
+	{
+		verification_handle->calculated_xxh3_hash_string = system_string_allocate(
+		                                                    17 );
+
+		if( verification_handle->calculated_xxh3_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated XXH3 hash string.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->calculate_xxh3 = 1;
+	}
 	if( system_split_string_free(
 	     &string_elements,
 	     error ) != 1 )
@@ -1612,7 +4952,9 @@ int verification_handle_hash_values_fprint(
      FILE *stream,
      libcerror_error_t **error )
 {
-	static char *function = "verification_handle_hash_values_fprint";
+	verification_handle_track_digest_t *track_digest = NULL;
+	static char *function                            = "verification_handle_hash_values_fprint";
+	int track_index                                  = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -1657,6 +4999,60 @@ int verification_handle_hash_values_fprint(
 		 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
 		 verification_handle->calculated_sha256_hash_string );
 	}
+	if( verification_handle->calculate_sha256_tree != 0 )
+	{
+		fprintf(
+		 stream,
+		 "SHA256 tree hash calculated over data:\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_sha256_tree_hash_string );
+	}
+	if( verification_handle->calculate_crc32 != 0 )
+	{
+		fprintf(
+		 stream,
+		 "CRC-32 calculated over data:\t\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_crc32_hash_string );
+	}
+	if( verification_handle->calculate_xxh3 != 0 )
+	{
+		fprintf(
+		 stream,
+		 "XXH3 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_xxh3_hash_string );
+	}
+	for( track_index = 0;
+	     track_index < verification_handle->number_of_track_digests;
+	     track_index++ )
+	{
+		track_digest = &( verification_handle->track_digests[ track_index ] );
+
+		fprintf(
+		 stream,
+		 "\nTrack: %d\n",
+		 track_index + 1 );
+
+		if( verification_handle->calculate_md5 != 0 )
+		{
+			fprintf(
+			 stream,
+			 "MD5 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+			 track_digest->calculated_md5_hash_string );
+		}
+		if( verification_handle->calculate_sha1 != 0 )
+		{
+			fprintf(
+			 stream,
+			 "SHA1 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+			 track_digest->calculated_sha1_hash_string );
+		}
+		if( verification_handle->calculate_sha256 != 0 )
+		{
+			fprintf(
+			 stream,
+			 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
+			 track_digest->calculated_sha256_hash_string );
+		}
+	}
 	return( 1 );
 }
 
@@ -25,12 +25,20 @@
 #include <common.h>
 #include <types.h>
 
+#include "crc32_hash.h"
 #include "digest_hash.h"
 #include "log_handle.h"
+#include "md5_hash.h"
 #include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
 #include "odrawtools_libodraw.h"
-#include "odrawtools_libhmac.h"
+#include "process_status.h"
+#include "sha1_hash.h"
+#include "sha256_hash.h"
 #include "storage_media_buffer.h"
+#include "storage_media_buffer_queue.h"
+#include "tree_hash.h"
+#include "xxh3_hash.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -42,6 +50,53 @@ enum VERIFICATION_HANDLE_INPUT_FORMATS
 	VERIFICATION_HANDLE_INPUT_FORMAT_RAW	= (int) 'r'
 };
 
+enum VERIFICATION_HANDLE_DIGEST_TYPES
+{
+	VERIFICATION_HANDLE_DIGEST_TYPE_MD5	= 1,
+	VERIFICATION_HANDLE_DIGEST_TYPE_SHA1	= 2,
+	VERIFICATION_HANDLE_DIGEST_TYPE_SHA256	= 3,
+	VERIFICATION_HANDLE_DIGEST_TYPE_SHA256_TREE	= 4,
+	VERIFICATION_HANDLE_DIGEST_TYPE_CRC32	= 5,
+	VERIFICATION_HANDLE_DIGEST_TYPE_XXH3	= 6
+};
+
+typedef struct verification_handle_track_digest verification_handle_track_digest_t;
+
+struct verification_handle_track_digest
+{
+	/* The offset of the track in the media data
+	 */
+	off64_t start_offset;
+
+	/* The size of the track in the media data
+	 */
+	size64_t size;
+
+	/* The MD5 hash
+	 */
+	md5_hash_t *md5_hash;
+
+	/* The calculated MD5 digest hash string
+	 */
+	system_character_t calculated_md5_hash_string[ 33 ];
+
+	/* The SHA1 hash
+	 */
+	sha1_hash_t *sha1_hash;
+
+	/* The calculated SHA1 digest hash string
+	 */
+	system_character_t calculated_sha1_hash_string[ 41 ];
+
+	/* The SHA256 hash
+	 */
+	sha256_hash_t *sha256_hash;
+
+	/* The calculated SHA256 digest hash string
+	 */
+	system_character_t calculated_sha256_hash_string[ 65 ];
+};
+
 typedef struct verification_handle verification_handle_t;
 
 struct verification_handle
@@ -50,11 +105,11 @@ struct verification_handle
 	 */
 	uint8_t calculate_md5;
 
-	/* The MD5 digest context
+	/* The MD5 hash
 	 */
-	libhmac_md5_context_t *md5_context;
+	md5_hash_t *md5_hash;
 
-	/* Value to indicate the MD5 digest context was initialized
+	/* Value to indicate the MD5 hash was initialized
 	 */
 	uint8_t md5_context_initialized;
 
@@ -66,11 +121,11 @@ struct verification_handle
 	 */
 	uint8_t calculate_sha1;
 
-	/* The SHA1 digest context
+	/* The SHA1 hash
 	 */
-	libhmac_sha1_context_t *sha1_context;
+	sha1_hash_t *sha1_hash;
 
-	/* Value to indicate the SHA1 digest context was initialized
+	/* Value to indicate the SHA1 hash was initialized
 	 */
 	uint8_t sha1_context_initialized;
 
@@ -82,11 +137,11 @@ struct verification_handle
 	 */
 	uint8_t calculate_sha256;
 
-	/* The SHA256 digest context
+	/* The SHA256 hash
 	 */
-	libhmac_sha256_context_t *sha256_context;
+	sha256_hash_t *sha256_hash;
 
-	/* Value to indicate the SHA256 digest context was initialized
+	/* Value to indicate the SHA256 hash was initialized
 	 */
 	uint8_t sha256_context_initialized;
 
@@ -94,10 +149,80 @@ struct verification_handle
 	 */
 	system_character_t *calculated_sha256_hash_string;
 
+	/* Value to indicate if the SHA256 tree hash should be calculated
+	 */
+	uint8_t calculate_sha256_tree;
+
+	/* The SHA256 tree hash
+	 */
+	tree_hash_t *sha256_tree_hash;
+
+	/* The calculated SHA256 tree hash string
+	 */
+	system_character_t *calculated_sha256_tree_hash_string;
+
+	/* Value to indicate if the CRC-32 should be calculated
+	 */
+	uint8_t calculate_crc32;
+
+	/* The CRC-32 hash
+	 */
+	crc32_hash_t *crc32_hash;
+
+	/* The calculated CRC-32 string
+	 */
+	system_character_t *calculated_crc32_hash_string;
+
+	/* Value to indicate if the XXH3 64-bit hash should be calculated
+	 */
+	uint8_t calculate_xxh3;
+
+	/* The XXH3 64-bit hash
+	 */
+	xxh3_hash_t *xxh3_hash;
+
+	/* The calculated XXH3 64-bit hash string
+	 */
+	system_character_t *calculated_xxh3_hash_string;
+
+	/* Value to indicate if the digest hashes should also be calculated per track
+	 */
+	uint8_t calculate_track_digests;
+
+	/* The track digests
+	 */
+	verification_handle_track_digest_t *track_digests;
+
+	/* The number of track digests
+	 */
+	int number_of_track_digests;
+
+	/* The checkpoint filename
+	 * contains NULL if no checkpoints should be written
+	 */
+	system_character_t *checkpoint_filename;
+
+	/* Value to indicate if the verification should resume from the checkpoint
+	 */
+	uint8_t resume;
+
+	/* Value to indicate if the data files should be read using direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The timestamp of the last checkpoint
+	 */
+	time_t last_checkpoint_timestamp;
+
 	/* The libodraw input handle
 	 */
 	libodraw_handle_t *input_handle;
 
+	/* The bytes per sector of the media data
+	 * contains 0 to use the default of the input handle
+	 */
+	uint32_t bytes_per_sector;
+
 	/* The last offset read
 	 */
 	off64_t last_offset_read;
@@ -115,6 +240,47 @@ struct verification_handle
 	int abort;
 };
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct verification_handle_digest_thread verification_handle_digest_thread_t;
+
+struct verification_handle_digest_thread
+{
+	/* The verification handle
+	 */
+	verification_handle_t *verification_handle;
+
+	/* The storage media buffer queue
+	 */
+	storage_media_buffer_queue_t *storage_media_buffer_queue;
+
+	/* The consumer index in the storage media buffer queue
+	 */
+	int consumer_index;
+
+	/* The digest type
+	 */
+	int digest_type;
+
+	/* The worker index of the SHA256 tree hash or the CRC-32
+	 */
+	int worker_index;
+
+	/* The offset in the media data of the first buffer
+	 */
+	off64_t start_offset;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The error of the thread
+	 */
+	libcerror_error_t *error;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int verification_handle_initialize(
      verification_handle_t **verification_handle,
      uint8_t calculate_md5,
@@ -154,25 +320,115 @@ int verification_handle_initialize_integrity_hash(
 
 int verification_handle_update_integrity_hash(
      verification_handle_t *verification_handle,
+     off64_t offset,
      uint8_t *buffer,
      size_t buffer_size,
      libcerror_error_t **error );
 
+int verification_handle_update_digest_hash(
+     verification_handle_t *verification_handle,
+     int digest_type,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 int verification_handle_finalize_integrity_hash(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
 
+int verification_handle_initialize_track_digests(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_free_track_digests(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_update_track_digest_hashes(
+     verification_handle_t *verification_handle,
+     int digest_type,
+     off64_t offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int verification_handle_finalize_track_digests(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_get_digest_state_size(
+     verification_handle_t *verification_handle,
+     uint32_t *digest_flags,
+     size_t *digest_state_size,
+     libcerror_error_t **error );
+
+int verification_handle_copy_digest_state_to_byte_stream(
+     verification_handle_t *verification_handle,
+     size64_t verify_count,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int verification_handle_copy_digest_state_from_byte_stream(
+     verification_handle_t *verification_handle,
+     size64_t verify_count,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int verification_handle_read_checkpoint(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size64_t *verify_count,
+     libcerror_error_t **error );
+
+int verification_handle_is_checkpoint_due(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size64_t verify_count );
+
+int verification_handle_write_checkpoint(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size64_t verify_count,
+     libcerror_error_t **error );
+
 int verification_handle_verify_input(
      verification_handle_t *verification_handle,
      uint8_t print_status_information,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_handle_digest_thread_callback(
+     verification_handle_digest_thread_t *digest_thread );
+
+int verification_handle_verify_input_multi_threaded(
+     verification_handle_t *verification_handle,
+     process_status_t *process_status,
+     size64_t media_size,
+     size_t process_buffer_size,
+     size64_t *verify_count,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int verification_handle_set_process_buffer_size(
      verification_handle_t *verification_handle,
      const system_character_t *string,
      libcerror_error_t **error );
 
+int verification_handle_set_bytes_per_sector(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verification_handle_set_checkpoint_filename(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int verification_handle_set_additional_digest_types(
      verification_handle_t *verification_handle,
      const system_character_t *string,
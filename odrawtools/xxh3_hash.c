@@ -0,0 +1,1012 @@
+/*
+ * XXH3 64-bit hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "xxh3_hash.h"
+
+#define XXH3_HASH_PRIME32_1		0x9e3779b1UL
+#define XXH3_HASH_PRIME32_2		0x85ebca77UL
+#define XXH3_HASH_PRIME32_3		0xc2b2ae3dUL
+
+#define XXH3_HASH_PRIME64_1		0x9e3779b185ebca87ULL
+#define XXH3_HASH_PRIME64_2		0xc2b2ae3d27d4eb4fULL
+#define XXH3_HASH_PRIME64_3		0x165667b19e3779f9ULL
+#define XXH3_HASH_PRIME64_4		0x85ebca77c2b2ae63ULL
+#define XXH3_HASH_PRIME64_5		0x27d4eb2f165667c5ULL
+
+#define XXH3_HASH_PRIME_MX1		0x165667919e3779f9ULL
+#define XXH3_HASH_PRIME_MX2		0x9fb21c651e98df25ULL
+
+/* The size of a stripe, which is the data processed per accumulate
+ */
+#define XXH3_HASH_STRIPE_SIZE		64
+
+/* The number of stripes in a block, after which the accumulators are scrambled
+ */
+#define XXH3_HASH_STRIPES_PER_BLOCK	16
+
+/* The size of the secret
+ */
+#define XXH3_HASH_SECRET_SIZE		192
+
+/* The maximum data size that is hashed without the accumulators
+ */
+#define XXH3_HASH_MIDSIZE_MAXIMUM	240
+
+/* The default secret
+ */
+const uint8_t xxh3_hash_secret[ XXH3_HASH_SECRET_SIZE ] = {
+	0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+	0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+	0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+	0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+	0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+	0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+	0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+	0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+	0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+	0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+	0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+	0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+/* Reads a 32-bit little-endian value
+ * Returns the value
+ */
+static inline uint32_t xxh3_hash_read_uint32(
+                        const uint8_t *data )
+{
+	uint32_t value_32bit = 0;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 value_32bit );
+
+	return( value_32bit );
+}
+
+/* Reads a 64-bit little-endian value
+ * Returns the value
+ */
+static inline uint64_t xxh3_hash_read_uint64(
+                        const uint8_t *data )
+{
+	uint64_t value_64bit = 0;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 data,
+	 value_64bit );
+
+	return( value_64bit );
+}
+
+/* Swaps the byte order of a 64-bit value
+ * Returns the swapped value
+ */
+static inline uint64_t xxh3_hash_swap_uint64(
+                        uint64_t value )
+{
+	uint8_t value_data[ 8 ];
+
+	byte_stream_copy_from_uint64_big_endian(
+	 value_data,
+	 value );
+
+	return( xxh3_hash_read_uint64( value_data ) );
+}
+
+/* Multiplies two 64-bit values into a 128-bit product and folds the upper 64-bit into the lower
+ * Returns the folded product
+ */
+static inline uint64_t xxh3_hash_multiply_fold(
+                        uint64_t first_value,
+                        uint64_t second_value )
+{
+#if defined( __SIZEOF_INT128__ )
+	unsigned __int128 product = (unsigned __int128) first_value * second_value;
+
+	return( (uint64_t) product ^ (uint64_t) ( product >> 64 ) );
+#else
+	uint64_t cross_product = 0;
+	uint64_t high_high     = 0;
+	uint64_t high_low      = 0;
+	uint64_t low_high      = 0;
+	uint64_t low_low       = 0;
+
+	low_low  = ( first_value & 0xffffffffUL ) * ( second_value & 0xffffffffUL );
+	high_low = ( first_value >> 32 ) * ( second_value & 0xffffffffUL );
+	low_high = ( first_value & 0xffffffffUL ) * ( second_value >> 32 );
+	high_high = ( first_value >> 32 ) * ( second_value >> 32 );
+
+	cross_product = ( low_low >> 32 ) + ( high_low & 0xffffffffUL ) + low_high;
+	high_high    += ( high_low >> 32 ) + ( cross_product >> 32 );
+	low_low       = ( cross_product << 32 ) | ( low_low & 0xffffffffUL );
+
+	return( low_low ^ high_high );
+#endif
+}
+
+/* Mixes the bits of a 64-bit value using the XXH64 avalanche
+ * Returns the mixed value
+ */
+static inline uint64_t xxh3_hash_xxh64_avalanche(
+                        uint64_t value )
+{
+	value ^= value >> 33;
+	value *= XXH3_HASH_PRIME64_2;
+	value ^= value >> 29;
+	value *= XXH3_HASH_PRIME64_3;
+	value ^= value >> 32;
+
+	return( value );
+}
+
+/* Mixes the bits of a 64-bit value using the XXH3 avalanche
+ * Returns the mixed value
+ */
+static inline uint64_t xxh3_hash_avalanche(
+                        uint64_t value )
+{
+	value ^= value >> 37;
+	value *= XXH3_HASH_PRIME_MX1;
+	value ^= value >> 32;
+
+	return( value );
+}
+
+/* Mixes the bits of a 64-bit value and the data size
+ * Returns the mixed value
+ */
+static inline uint64_t xxh3_hash_rrmxmx(
+                        uint64_t value,
+                        uint64_t data_size )
+{
+	value ^= byte_stream_bit_rotate_left_64bit( value, 49 ) ^ byte_stream_bit_rotate_left_64bit( value, 24 );
+	value *= XXH3_HASH_PRIME_MX2;
+	value ^= ( value >> 35 ) + data_size;
+	value *= XXH3_HASH_PRIME_MX2;
+	value ^= value >> 28;
+
+	return( value );
+}
+
+/* Mixes 16 bytes of data with 16 bytes of the secret
+ * Returns the mixed value
+ */
+static inline uint64_t xxh3_hash_mix16(
+                        const uint8_t *data,
+                        const uint8_t *secret )
+{
+	return( xxh3_hash_multiply_fold(
+	         xxh3_hash_read_uint64( data ) ^ xxh3_hash_read_uint64( secret ),
+	         xxh3_hash_read_uint64( &( data[ 8 ] ) ) ^ xxh3_hash_read_uint64( &( secret[ 8 ] ) ) ) );
+}
+
+/* Calculates the hash of data of 240 bytes or less
+ * Returns the hash
+ */
+static uint64_t xxh3_hash_calculate_short(
+                 const uint8_t *data,
+                 size_t data_size )
+{
+	const uint8_t *secret = xxh3_hash_secret;
+	uint64_t value_64bit1 = 0;
+	uint64_t value_64bit2 = 0;
+	uint64_t hash_value   = 0;
+	size_t data_offset    = 0;
+	size_t round_index    = 0;
+
+	if( data_size == 0 )
+	{
+		return( xxh3_hash_xxh64_avalanche(
+		         xxh3_hash_read_uint64( &( secret[ 56 ] ) ) ^ xxh3_hash_read_uint64( &( secret[ 64 ] ) ) ) );
+	}
+	else if( data_size <= 3 )
+	{
+		value_64bit1 = ( (uint64_t) data[ 0 ] << 16 )
+		             | ( (uint64_t) data[ data_size >> 1 ] << 24 )
+		             | (uint64_t) data[ data_size - 1 ]
+		             | ( (uint64_t) data_size << 8 );
+
+		value_64bit2 = (uint64_t) ( xxh3_hash_read_uint32( secret ) ^ xxh3_hash_read_uint32( &( secret[ 4 ] ) ) );
+
+		return( xxh3_hash_xxh64_avalanche(
+		         value_64bit1 ^ value_64bit2 ) );
+	}
+	else if( data_size <= 8 )
+	{
+		value_64bit1 = (uint64_t) xxh3_hash_read_uint32( &( data[ data_size - 4 ] ) )
+		             + ( (uint64_t) xxh3_hash_read_uint32( data ) << 32 );
+
+		value_64bit2 = xxh3_hash_read_uint64( &( secret[ 8 ] ) ) ^ xxh3_hash_read_uint64( &( secret[ 16 ] ) );
+
+		return( xxh3_hash_rrmxmx(
+		         value_64bit1 ^ value_64bit2,
+		         (uint64_t) data_size ) );
+	}
+	else if( data_size <= 16 )
+	{
+		value_64bit1 = xxh3_hash_read_uint64( data )
+		             ^ xxh3_hash_read_uint64( &( secret[ 24 ] ) )
+		             ^ xxh3_hash_read_uint64( &( secret[ 32 ] ) );
+
+		value_64bit2 = xxh3_hash_read_uint64( &( data[ data_size - 8 ] ) )
+		             ^ xxh3_hash_read_uint64( &( secret[ 40 ] ) )
+		             ^ xxh3_hash_read_uint64( &( secret[ 48 ] ) );
+
+		hash_value = (uint64_t) data_size
+		           + xxh3_hash_swap_uint64( value_64bit1 )
+		           + value_64bit2
+		           + xxh3_hash_multiply_fold(
+		              value_64bit1,
+		              value_64bit2 );
+
+		return( xxh3_hash_avalanche(
+		         hash_value ) );
+	}
+	hash_value = (uint64_t) data_size * XXH3_HASH_PRIME64_1;
+
+	if( data_size <= 128 )
+	{
+		/* Mix pairs of 16 bytes from the start and the end of the data towards the middle
+		 */
+		for( data_offset = 0;
+		     ( data_offset * 2 ) < ( ( data_size + 31 ) / 32 ) * 32;
+		     data_offset += 16 )
+		{
+			hash_value += xxh3_hash_mix16(
+			               &( data[ data_offset ] ),
+			               &( secret[ data_offset * 2 ] ) );
+			hash_value += xxh3_hash_mix16(
+			               &( data[ data_size - 16 - data_offset ] ),
+			               &( secret[ ( data_offset * 2 ) + 16 ] ) );
+		}
+		return( xxh3_hash_avalanche(
+		         hash_value ) );
+	}
+	for( round_index = 0;
+	     round_index < 8;
+	     round_index++ )
+	{
+		hash_value += xxh3_hash_mix16(
+		               &( data[ round_index * 16 ] ),
+		               &( secret[ round_index * 16 ] ) );
+	}
+	hash_value = xxh3_hash_avalanche(
+	              hash_value );
+
+	for( round_index = 8;
+	     round_index < ( data_size / 16 );
+	     round_index++ )
+	{
+		hash_value += xxh3_hash_mix16(
+		               &( data[ round_index * 16 ] ),
+		               &( secret[ ( ( round_index - 8 ) * 16 ) + 3 ] ) );
+	}
+	hash_value += xxh3_hash_mix16(
+	               &( data[ data_size - 16 ] ),
+	               &( secret[ 136 - 17 ] ) );
+
+	return( xxh3_hash_avalanche(
+	         hash_value ) );
+}
+
+/* Accumulates a stripe of data
+ */
+static inline void xxh3_hash_accumulate_stripe(
+                    uint64_t *accumulators,
+                    const uint8_t *data,
+                    const uint8_t *secret )
+{
+	uint64_t data_key   = 0;
+	uint64_t data_value = 0;
+	int value_index     = 0;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		data_value = xxh3_hash_read_uint64( &( data[ value_index * 8 ] ) );
+		data_key   = data_value ^ xxh3_hash_read_uint64( &( secret[ value_index * 8 ] ) );
+
+		accumulators[ value_index ^ 1 ] += data_value;
+		accumulators[ value_index ]     += ( data_key & 0xffffffffUL ) * ( data_key >> 32 );
+	}
+}
+
+/* Scrambles the accumulators at the end of a block
+ */
+static inline void xxh3_hash_scramble(
+                    uint64_t *accumulators,
+                    const uint8_t *secret )
+{
+	uint64_t value_64bit = 0;
+	int value_index      = 0;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		value_64bit  = accumulators[ value_index ];
+		value_64bit ^= value_64bit >> 47;
+		value_64bit ^= xxh3_hash_read_uint64( &( secret[ value_index * 8 ] ) );
+		value_64bit *= XXH3_HASH_PRIME32_1;
+
+		accumulators[ value_index ] = value_64bit;
+	}
+}
+
+/* Accumulates a number of stripes, scrambling the accumulators at the end of every block
+ */
+static void xxh3_hash_accumulate_stripes(
+             uint64_t *accumulators,
+             size_t *number_of_block_stripes,
+             const uint8_t *data,
+             size_t number_of_stripes )
+{
+	while( number_of_stripes > 0 )
+	{
+		xxh3_hash_accumulate_stripe(
+		 accumulators,
+		 data,
+		 &( xxh3_hash_secret[ *number_of_block_stripes * 8 ] ) );
+
+		*number_of_block_stripes += 1;
+
+		if( *number_of_block_stripes == XXH3_HASH_STRIPES_PER_BLOCK )
+		{
+			xxh3_hash_scramble(
+			 accumulators,
+			 &( xxh3_hash_secret[ XXH3_HASH_SECRET_SIZE - XXH3_HASH_STRIPE_SIZE ] ) );
+
+			*number_of_block_stripes = 0;
+		}
+		data              += XXH3_HASH_STRIPE_SIZE;
+		number_of_stripes -= 1;
+	}
+}
+
+/* Creates a XXH3 64-bit hash
+ * Make sure the value xxh3_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int xxh3_hash_initialize(
+     xxh3_hash_t **xxh3_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "xxh3_hash_initialize";
+
+	if( xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xxh3_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XXH3 hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*xxh3_hash = memory_allocate_structure(
+	              xxh3_hash_t );
+
+	if( *xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *xxh3_hash,
+	     0,
+	     sizeof( xxh3_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XXH3 hash.",
+		 function );
+
+		memory_free(
+		 *xxh3_hash );
+
+		*xxh3_hash = NULL;
+
+		return( -1 );
+	}
+	( *xxh3_hash )->accumulators[ 0 ] = XXH3_HASH_PRIME32_3;
+	( *xxh3_hash )->accumulators[ 1 ] = XXH3_HASH_PRIME64_1;
+	( *xxh3_hash )->accumulators[ 2 ] = XXH3_HASH_PRIME64_2;
+	( *xxh3_hash )->accumulators[ 3 ] = XXH3_HASH_PRIME64_3;
+	( *xxh3_hash )->accumulators[ 4 ] = XXH3_HASH_PRIME64_4;
+	( *xxh3_hash )->accumulators[ 5 ] = XXH3_HASH_PRIME32_2;
+	( *xxh3_hash )->accumulators[ 6 ] = XXH3_HASH_PRIME64_5;
+	( *xxh3_hash )->accumulators[ 7 ] = XXH3_HASH_PRIME32_1;
+
+	return( 1 );
+}
+
+/* Frees a XXH3 64-bit hash
+ * Returns 1 if successful or -1 on error
+ */
+int xxh3_hash_free(
+     xxh3_hash_t **xxh3_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "xxh3_hash_free";
+
+	if( xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xxh3_hash != NULL )
+	{
+		memory_free(
+		 *xxh3_hash );
+
+		*xxh3_hash = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the XXH3 64-bit hash
+ * Returns 1 if successful or -1 on error
+ */
+int xxh3_hash_update(
+     xxh3_hash_t *xxh3_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "xxh3_hash_update";
+	size_t fill_size      = 0;
+
+	if( xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	xxh3_hash->data_size += size;
+
+	/* At least 1 byte is kept in the buffer since the last stripe is processed
+	 * differently and the data of 240 bytes or less is not accumulated at all
+	 */
+	if( size <= ( XXH3_HASH_BUFFER_SIZE - xxh3_hash->buffer_data_size ) )
+	{
+		if( memory_copy(
+		     &( xxh3_hash->buffer[ xxh3_hash->buffer_data_size ] ),
+		     buffer,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		xxh3_hash->buffer_data_size += size;
+
+		return( 1 );
+	}
+	if( xxh3_hash->buffer_data_size > 0 )
+	{
+		fill_size = XXH3_HASH_BUFFER_SIZE - xxh3_hash->buffer_data_size;
+
+		if( memory_copy(
+		     &( xxh3_hash->buffer[ xxh3_hash->buffer_data_size ] ),
+		     buffer,
+		     fill_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		xxh3_hash_accumulate_stripes(
+		 xxh3_hash->accumulators,
+		 &( xxh3_hash->number_of_stripes ),
+		 xxh3_hash->buffer,
+		 XXH3_HASH_BUFFER_SIZE / XXH3_HASH_STRIPE_SIZE );
+
+		buffer += fill_size;
+		size   -= fill_size;
+
+		xxh3_hash->buffer_data_size = 0;
+	}
+	if( size > XXH3_HASH_BUFFER_SIZE )
+	{
+		do
+		{
+			xxh3_hash_accumulate_stripes(
+			 xxh3_hash->accumulators,
+			 &( xxh3_hash->number_of_stripes ),
+			 buffer,
+			 XXH3_HASH_BUFFER_SIZE / XXH3_HASH_STRIPE_SIZE );
+
+			buffer += XXH3_HASH_BUFFER_SIZE;
+			size   -= XXH3_HASH_BUFFER_SIZE;
+		}
+		while( size > XXH3_HASH_BUFFER_SIZE );
+
+		/* Keep the last stripe of the accumulated data, which is needed
+		 * when less than a stripe remains buffered
+		 */
+		if( memory_copy(
+		     &( xxh3_hash->buffer[ XXH3_HASH_BUFFER_SIZE - XXH3_HASH_STRIPE_SIZE ] ),
+		     &( buffer[ -XXH3_HASH_STRIPE_SIZE ] ),
+		     XXH3_HASH_STRIPE_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy last stripe to buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     xxh3_hash->buffer,
+	     buffer,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	xxh3_hash->buffer_data_size = size;
+
+	return( 1 );
+}
+
+/* Finalizes the XXH3 64-bit hash
+ * The hash is stored as a 64-bit big-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int xxh3_hash_finalize(
+     xxh3_hash_t *xxh3_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t last_stripe[ XXH3_HASH_STRIPE_SIZE ];
+	uint64_t accumulators[ 8 ];
+
+	const uint8_t *last_stripe_data = NULL;
+	static char *function           = "xxh3_hash_finalize";
+	size_t number_of_stripes        = 0;
+	size_t remaining_size           = 0;
+	uint64_t hash_value             = 0;
+	int value_index                 = 0;
+
+	if( xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < XXH3_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( xxh3_hash->data_size <= XXH3_HASH_MIDSIZE_MAXIMUM )
+	{
+		hash_value = xxh3_hash_calculate_short(
+		              xxh3_hash->buffer,
+		              (size_t) xxh3_hash->data_size );
+	}
+	else
+	{
+		/* Work on a copy of the accumulators so that the hash can be finalized more than once
+		 */
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			accumulators[ value_index ] = xxh3_hash->accumulators[ value_index ];
+		}
+		number_of_stripes = xxh3_hash->number_of_stripes;
+
+		if( xxh3_hash->buffer_data_size >= XXH3_HASH_STRIPE_SIZE )
+		{
+			xxh3_hash_accumulate_stripes(
+			 accumulators,
+			 &number_of_stripes,
+			 xxh3_hash->buffer,
+			 ( xxh3_hash->buffer_data_size - 1 ) / XXH3_HASH_STRIPE_SIZE );
+
+			last_stripe_data = &( xxh3_hash->buffer[ xxh3_hash->buffer_data_size - XXH3_HASH_STRIPE_SIZE ] );
+		}
+		else
+		{
+			/* The last stripe consists of the end of the previous stripe and the buffered data
+			 */
+			remaining_size = XXH3_HASH_STRIPE_SIZE - xxh3_hash->buffer_data_size;
+
+			if( memory_copy(
+			     last_stripe,
+			     &( xxh3_hash->buffer[ XXH3_HASH_BUFFER_SIZE - remaining_size ] ),
+			     remaining_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy last stripe.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( last_stripe[ remaining_size ] ),
+			     xxh3_hash->buffer,
+			     xxh3_hash->buffer_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy last stripe.",
+				 function );
+
+				return( -1 );
+			}
+			last_stripe_data = last_stripe;
+		}
+		xxh3_hash_accumulate_stripe(
+		 accumulators,
+		 last_stripe_data,
+		 &( xxh3_hash_secret[ XXH3_HASH_SECRET_SIZE - XXH3_HASH_STRIPE_SIZE - 7 ] ) );
+
+		/* Merge the accumulators
+		 */
+		hash_value = xxh3_hash->data_size * XXH3_HASH_PRIME64_1;
+
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index += 2 )
+		{
+			hash_value += xxh3_hash_multiply_fold(
+			               accumulators[ value_index ] ^ xxh3_hash_read_uint64( &( xxh3_hash_secret[ 11 + ( value_index * 8 ) ] ) ),
+			               accumulators[ value_index + 1 ] ^ xxh3_hash_read_uint64( &( xxh3_hash_secret[ 11 + ( value_index * 8 ) + 8 ] ) ) );
+		}
+		hash_value = xxh3_hash_avalanche(
+		              hash_value );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 hash,
+	 hash_value );
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash to a byte stream
+ * The state is stored as:
+ *   the 8 accumulators as 64-bit little-endian values
+ *   the buffer
+ *   the buffer data size as 32-bit little-endian value
+ *   the number of stripes in the current block as 32-bit little-endian value
+ *   the total data size as 64-bit little-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int xxh3_hash_copy_state_to_byte_stream(
+     xxh3_hash_t *xxh3_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "xxh3_hash_copy_state_to_byte_stream";
+	size_t byte_stream_offset = 0;
+	int value_index           = 0;
+
+	if( xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < XXH3_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 xxh3_hash->accumulators[ value_index ] );
+
+		byte_stream_offset += 8;
+	}
+	if( memory_copy(
+	     &( byte_stream[ byte_stream_offset ] ),
+	     xxh3_hash->buffer,
+	     XXH3_HASH_BUFFER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset += XXH3_HASH_BUFFER_SIZE;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 (uint32_t) xxh3_hash->buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 (uint32_t) xxh3_hash->number_of_stripes );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 xxh3_hash->data_size );
+
+	return( 1 );
+}
+
+/* Copies the intermediate state of the hash from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int xxh3_hash_copy_state_from_byte_stream(
+     xxh3_hash_t *xxh3_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "xxh3_hash_copy_state_from_byte_stream";
+	size_t byte_stream_offset  = 0;
+	uint64_t value_64bit       = 0;
+	uint32_t buffer_data_size  = 0;
+	uint32_t number_of_stripes = 0;
+	int value_index            = 0;
+
+	if( xxh3_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XXH3 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < XXH3_HASH_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = ( 8 * 8 ) + XXH3_HASH_BUFFER_SIZE;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 buffer_data_size );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 number_of_stripes );
+
+	byte_stream_offset += 4;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 value_64bit );
+
+	if( buffer_data_size > XXH3_HASH_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_stripes >= XXH3_HASH_STRIPES_PER_BLOCK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of stripes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = 0;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 xxh3_hash->accumulators[ value_index ] );
+
+		byte_stream_offset += 8;
+	}
+	if( memory_copy(
+	     xxh3_hash->buffer,
+	     &( byte_stream[ byte_stream_offset ] ),
+	     XXH3_HASH_BUFFER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	xxh3_hash->buffer_data_size  = (size_t) buffer_data_size;
+	xxh3_hash->number_of_stripes = (size_t) number_of_stripes;
+	xxh3_hash->data_size         = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
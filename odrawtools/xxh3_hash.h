@@ -0,0 +1,114 @@
+/*
+ * XXH3 64-bit hash
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _XXH3_HASH_H )
+#define _XXH3_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The XXH3 64-bit hash is the 64-bit variant of the XXH3 hash of xxHash
+ * version 0.8 with the default secret and seed 0, which is the value
+ * calculated by "xxhsum -H3"
+ */
+
+/* The size of a XXH3 64-bit hash
+ */
+#define XXH3_HASH_SIZE			8
+
+/* The size of the internal buffer
+ */
+#define XXH3_HASH_BUFFER_SIZE		256
+
+/* The size of the intermediate state of the hash
+ */
+#define XXH3_HASH_STATE_SIZE		( ( 8 * 8 ) + XXH3_HASH_BUFFER_SIZE + 4 + 4 + 8 )
+
+typedef struct xxh3_hash xxh3_hash_t;
+
+struct xxh3_hash
+{
+	/* The accumulators
+	 */
+	uint64_t accumulators[ 8 ];
+
+	/* The buffer
+	 * the last bytes are kept buffered since they are processed differently
+	 */
+	uint8_t buffer[ XXH3_HASH_BUFFER_SIZE ];
+
+	/* The buffer data size
+	 */
+	size_t buffer_data_size;
+
+	/* The number of stripes processed in the current block
+	 */
+	size_t number_of_stripes;
+
+	/* The total data size
+	 */
+	size64_t data_size;
+};
+
+int xxh3_hash_initialize(
+     xxh3_hash_t **xxh3_hash,
+     libcerror_error_t **error );
+
+int xxh3_hash_free(
+     xxh3_hash_t **xxh3_hash,
+     libcerror_error_t **error );
+
+int xxh3_hash_update(
+     xxh3_hash_t *xxh3_hash,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int xxh3_hash_finalize(
+     xxh3_hash_t *xxh3_hash,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int xxh3_hash_copy_state_to_byte_stream(
+     xxh3_hash_t *xxh3_hash,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int xxh3_hash_copy_state_from_byte_stream(
+     xxh3_hash_t *xxh3_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _XXH3_HASH_H ) */
+
@@ -0,0 +1,175 @@
+/*
+ * Byte swap micro benchmark
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_byte_swap.h"
+
+/* The number of sectors per iteration, 294 KiB of audio data which fits in the L2 cache
+ */
+#define ODRAW_BENCH_NUMBER_OF_SECTORS	128
+
+/* The number of iterations per run
+ */
+#define ODRAW_BENCH_NUMBER_OF_ITERATIONS	4096
+
+/* The number of runs, the fastest run is reported
+ */
+#define ODRAW_BENCH_NUMBER_OF_RUNS		8
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Prints the throughput of a benchmark
+ */
+void odraw_bench_print_result(
+      const char *name,
+      clock_t elapsed_clocks )
+{
+	double elapsed_time = (double) elapsed_clocks / (double) CLOCKS_PER_SEC;
+	double data_size    = (double) ODRAW_BENCH_NUMBER_OF_SECTORS * 2352.0 * (double) ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+
+	if( elapsed_time <= 0.0 )
+	{
+		elapsed_time = 1.0 / (double) CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%-40s %8.2f GB/s\n",
+	 name,
+	 data_size / elapsed_time / 1000000000.0 );
+}
+
+/* Benchmarks a byte swap kernel
+ */
+void odraw_bench_kernel(
+      const char *name,
+      libodraw_byte_swap_kernel_t kernel,
+      uint8_t *sector_data )
+{
+	clock_t elapsed_clocks = 0;
+	clock_t fastest_clocks = 0;
+	clock_t start_time     = 0;
+	int iteration          = 0;
+	int run                = 0;
+
+	for( run = 0;
+	     run < ODRAW_BENCH_NUMBER_OF_RUNS;
+	     run++ )
+	{
+		start_time = clock();
+
+		for( iteration = 0;
+		     iteration < ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+		     iteration++ )
+		{
+			kernel(
+			 sector_data,
+			 ODRAW_BENCH_NUMBER_OF_SECTORS * 2352 );
+		}
+		elapsed_clocks = clock() - start_time;
+
+		if( ( run == 0 )
+		 || ( elapsed_clocks < fastest_clocks ) )
+		{
+			fastest_clocks = elapsed_clocks;
+		}
+	}
+	odraw_bench_print_result(
+	 name,
+	 fastest_clocks );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	uint8_t *sector_data = NULL;
+	size_t byte_index    = 0;
+#endif
+
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ODRAW_BENCH_NUMBER_OF_SECTORS * 2352 );
+
+	if( sector_data == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	for( byte_index = 0;
+	     byte_index < ODRAW_BENCH_NUMBER_OF_SECTORS * 2352;
+	     byte_index++ )
+	{
+		sector_data[ byte_index ] = (uint8_t) ( byte_index * 7 );
+	}
+	odraw_bench_kernel(
+	 "scalar",
+	 &libodraw_byte_swap_16bit_scalar,
+	 sector_data );
+
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+	odraw_bench_kernel(
+	 "sse2",
+	 &libodraw_byte_swap_16bit_sse2,
+	 sector_data );
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		odraw_bench_kernel(
+		 "avx2",
+		 &libodraw_byte_swap_16bit_avx2,
+		 sector_data );
+	}
+#endif
+	memory_free(
+	 sector_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+}
+
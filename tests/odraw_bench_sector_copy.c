@@ -0,0 +1,365 @@
+/*
+ * Sector copy micro benchmark
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_sector_data.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_io_handle.h"
+#include "../libodraw/libodraw_sector_copy.h"
+
+/* The number of sectors per iteration
+ */
+#define ODRAW_BENCH_NUMBER_OF_SECTORS	128
+
+/* The number of iterations per run
+ */
+#define ODRAW_BENCH_NUMBER_OF_ITERATIONS	2048
+
+/* The number of runs, the fastest run is reported
+ */
+#define ODRAW_BENCH_NUMBER_OF_RUNS		8
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Prints the throughput of a benchmark
+ */
+void odraw_bench_print_result(
+      const char *name,
+      uint32_t output_bytes_per_sector,
+      clock_t elapsed_clocks )
+{
+	double elapsed_time = (double) elapsed_clocks / (double) CLOCKS_PER_SEC;
+	double data_size    = (double) ODRAW_BENCH_NUMBER_OF_SECTORS * (double) output_bytes_per_sector * (double) ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+
+	if( elapsed_time <= 0.0 )
+	{
+		elapsed_time = 1.0 / (double) CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%-48s %8.2f GB/s\n",
+	 name,
+	 data_size / elapsed_time / 1000000000.0 );
+}
+
+/* Benchmarks copying sectors using a sector copy function
+ * or the generic copy function if the sector copy function is NULL
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_bench_copy(
+     const char *name,
+     libodraw_io_handle_t *io_handle,
+     libodraw_sector_copy_function_t copy_function,
+     uint8_t track_type,
+     uint32_t bytes_per_sector,
+     uint32_t output_bytes_per_sector,
+     const uint8_t *sector_data,
+     uint8_t *buffer,
+     size_t number_of_sectors_per_call )
+{
+	libcerror_error_t *error = NULL;
+	clock_t elapsed_clocks   = 0;
+	clock_t fastest_clocks   = 0;
+	clock_t start_time       = 0;
+	ssize_t copy_count       = 0;
+	size_t sector_index      = 0;
+	int iteration            = 0;
+	int result               = 0;
+	int run                  = 0;
+
+	for( run = 0;
+	     run < ODRAW_BENCH_NUMBER_OF_RUNS;
+	     run++ )
+	{
+		start_time = clock();
+
+		for( iteration = 0;
+		     iteration < ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+		     iteration++ )
+		{
+			for( sector_index = 0;
+			     sector_index < ODRAW_BENCH_NUMBER_OF_SECTORS;
+			     sector_index += number_of_sectors_per_call )
+			{
+				if( copy_function == NULL )
+				{
+					copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+					              io_handle,
+					              &( sector_data[ sector_index * bytes_per_sector ] ),
+					              number_of_sectors_per_call * bytes_per_sector,
+					              bytes_per_sector,
+					              track_type,
+					              output_bytes_per_sector,
+					              &( buffer[ sector_index * output_bytes_per_sector ] ),
+					              number_of_sectors_per_call * output_bytes_per_sector,
+					              (uint32_t) sector_index,
+					              0,
+					              &error );
+
+					result = ( copy_count == -1 ) ? -1 : 1;
+				}
+				else
+				{
+					result = copy_function(
+					          io_handle,
+					          &( sector_data[ sector_index * bytes_per_sector ] ),
+					          number_of_sectors_per_call,
+					          track_type,
+					          (uint32_t) sector_index,
+					          &( buffer[ sector_index * output_bytes_per_sector ] ),
+					          &error );
+				}
+				if( result != 1 )
+				{
+					libcerror_error_free(
+					 &error );
+
+					return( 0 );
+				}
+			}
+		}
+		elapsed_clocks = clock() - start_time;
+
+		if( ( run == 0 )
+		 || ( elapsed_clocks < fastest_clocks ) )
+		{
+			fastest_clocks = elapsed_clocks;
+		}
+	}
+	odraw_bench_print_result(
+	 name,
+	 output_bytes_per_sector,
+	 fastest_clocks );
+
+	return( 1 );
+}
+
+/* Benchmarks the generic copy function against a sector copy function
+ * for a specific track type and output bytes per sector
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_bench_track_type(
+     const char *name,
+     libodraw_io_handle_t *io_handle,
+     libodraw_sector_copy_function_t copy_function,
+     uint8_t track_type,
+     uint32_t bytes_per_sector,
+     uint32_t output_bytes_per_sector,
+     uint8_t *sector_data,
+     uint8_t *buffer )
+{
+	char benchmark_name[ 64 ];
+
+	size_t number_of_sectors_per_call = 1;
+
+	odraw_test_sector_data_fill(
+	 sector_data,
+	 ODRAW_BENCH_NUMBER_OF_SECTORS,
+	 track_type,
+	 bytes_per_sector );
+
+	while( number_of_sectors_per_call <= 32 )
+	{
+		snprintf(
+		 benchmark_name,
+		 64,
+		 "%s generic, %" PRIzu " per call",
+		 name,
+		 number_of_sectors_per_call );
+
+		if( odraw_bench_copy(
+		     benchmark_name,
+		     io_handle,
+		     NULL,
+		     track_type,
+		     bytes_per_sector,
+		     output_bytes_per_sector,
+		     sector_data,
+		     buffer,
+		     number_of_sectors_per_call ) != 1 )
+		{
+			return( 0 );
+		}
+		snprintf(
+		 benchmark_name,
+		 64,
+		 "%s specialised, %" PRIzu " per call",
+		 name,
+		 number_of_sectors_per_call );
+
+		if( odraw_bench_copy(
+		     benchmark_name,
+		     io_handle,
+		     copy_function,
+		     track_type,
+		     bytes_per_sector,
+		     output_bytes_per_sector,
+		     sector_data,
+		     buffer,
+		     number_of_sectors_per_call ) != 1 )
+		{
+			return( 0 );
+		}
+		number_of_sectors_per_call *= 32;
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	libodraw_io_handle_t *io_handle = NULL;
+	uint8_t *buffer                 = NULL;
+	uint8_t *sector_data            = NULL;
+	int result                      = 0;
+#endif
+
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ODRAW_BENCH_NUMBER_OF_SECTORS * 2352 );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ODRAW_BENCH_NUMBER_OF_SECTORS * 2352 );
+
+	if( ( sector_data == NULL )
+	 || ( buffer == NULL ) )
+	{
+		goto on_error;
+	}
+	if( libodraw_io_handle_initialize(
+	     &io_handle,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	result = odraw_bench_track_type(
+	          "MODE1/2352 to 2048",
+	          io_handle,
+	          &libodraw_sector_copy_2352_to_2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          2352,
+	          2048,
+	          sector_data,
+	          buffer );
+
+	if( result == 1 )
+	{
+		result = odraw_bench_track_type(
+		          "MODE2/2352 to 2048",
+		          io_handle,
+		          &libodraw_sector_copy_2352_to_2048,
+		          LIBODRAW_TRACK_TYPE_MODE2_2352,
+		          2352,
+		          2048,
+		          sector_data,
+		          buffer );
+	}
+	if( result == 1 )
+	{
+		result = odraw_bench_track_type(
+		          "MODE2/2336 to 2048",
+		          io_handle,
+		          &libodraw_sector_copy_mode2_2336_to_2048,
+		          LIBODRAW_TRACK_TYPE_MODE2_2336,
+		          2336,
+		          2048,
+		          sector_data,
+		          buffer );
+	}
+	if( result == 1 )
+	{
+		result = odraw_bench_track_type(
+		          "MODE1/2048 to 2352",
+		          io_handle,
+		          &libodraw_sector_copy_encode_to_2352,
+		          LIBODRAW_TRACK_TYPE_MODE1_2048,
+		          2048,
+		          2352,
+		          sector_data,
+		          buffer );
+	}
+	libodraw_io_handle_free(
+	 &io_handle,
+	 NULL );
+
+	memory_free(
+	 buffer );
+	memory_free(
+	 sector_data );
+
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+on_error:
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( EXIT_FAILURE );
+#endif
+}
+
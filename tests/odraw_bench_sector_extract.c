@@ -0,0 +1,518 @@
+/*
+ * Sector extraction micro benchmark
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_io_handle.h"
+#include "../libodraw/libodraw_sector_extract.h"
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+#include <immintrin.h>
+#endif
+
+/* The number of sectors per iteration, 256 KiB of user data which fits in the L2 cache
+ */
+#define ODRAW_BENCH_NUMBER_OF_SECTORS	128
+
+/* The number of iterations per run
+ */
+#define ODRAW_BENCH_NUMBER_OF_ITERATIONS	4096
+
+/* The number of runs, the fastest run is reported
+ */
+#define ODRAW_BENCH_NUMBER_OF_RUNS		8
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+
+/* The sector synchronisation data padded to 16 bytes
+ * only the first 12 bytes are compared
+ */
+static uint8_t odraw_bench_synchronisation_data[ 16 ] = \
+	{ 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Determines if the headers of 2 successive sectors are valid
+ * Returns 1 if both headers are valid or 0 if not
+ */
+__attribute__((target("avx2"))) int odraw_bench_avx2_check_headers(
+                                     const uint8_t *sector_data,
+                                     uint8_t track_type,
+                                     __m256i synchronisation )
+{
+	__m256i value    = _mm256_setzero_si256();
+	int compare_mask = 0;
+
+	value = _mm256_inserti128_si256(
+	         _mm256_castsi128_si256(
+	          _mm_loadu_si128( (const __m128i *) sector_data ) ),
+	         _mm_loadu_si128( (const __m128i *) &( sector_data[ 2352 ] ) ),
+	         1 );
+
+	compare_mask = _mm256_movemask_epi8( _mm256_cmpeq_epi8( value, synchronisation ) );
+
+	if( ( (uint32_t) compare_mask & 0x0fff0fffUL ) != 0x0fff0fffUL )
+	{
+		return( 0 );
+	}
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	{
+		value = _mm256_inserti128_si256(
+		         _mm256_castsi128_si256(
+		          _mm_loadl_epi64( (const __m128i *) &( sector_data[ 16 ] ) ) ),
+		         _mm_loadl_epi64( (const __m128i *) &( sector_data[ 2352 + 16 ] ) ),
+		         1 );
+
+		compare_mask = _mm256_movemask_epi8( _mm256_cmpeq_epi8( value, _mm256_srli_si256( value, 4 ) ) );
+
+		if( ( ( (uint32_t) compare_mask & 0x000f000fUL ) != 0x000f000fUL )
+		 || ( sector_data[ 17 ] >= 32 )
+		 || ( sector_data[ 2352 + 17 ] >= 32 ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the header of a single sector is valid
+ * This function is compiled for AVX2 so that the 128-bit instructions are VEX encoded
+ * Returns 1 if the header is valid or 0 if not
+ */
+__attribute__((target("avx2"))) int odraw_bench_avx2_check_header(
+                                     const uint8_t *sector_data,
+                                     uint8_t track_type,
+                                     __m256i synchronisation )
+{
+	__m128i value    = _mm_loadu_si128( (const __m128i *) sector_data );
+	int compare_mask = 0;
+
+	compare_mask = _mm_movemask_epi8( _mm_cmpeq_epi8( value, _mm256_castsi256_si128( synchronisation ) ) );
+
+	if( ( compare_mask & 0x0fff ) != 0x0fff )
+	{
+		return( 0 );
+	}
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	{
+		value        = _mm_loadl_epi64( (const __m128i *) &( sector_data[ 16 ] ) );
+		compare_mask = _mm_movemask_epi8( _mm_cmpeq_epi8( value, _mm_srli_si128( value, 4 ) ) );
+
+		if( ( ( compare_mask & 0x000f ) != 0x000f )
+		 || ( sector_data[ 17 ] >= 32 ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies the 2048 bytes of user data of a sector
+ * The user data is only 16-byte aligned in the sector data, hence 128-bit
+ * instead of 256-bit loads and stores are used to prevent cache line splits
+ */
+__attribute__((target("avx2"))) void odraw_bench_avx2_copy(
+                                      const uint8_t *data,
+                                      uint8_t *buffer )
+{
+	__m128i value0     = _mm_setzero_si128();
+	__m128i value1     = _mm_setzero_si128();
+	__m128i value2     = _mm_setzero_si128();
+	__m128i value3     = _mm_setzero_si128();
+	size_t copy_offset = 0;
+
+	for( copy_offset = 0;
+	     copy_offset < 2048;
+	     copy_offset += 64 )
+	{
+		value0 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset ] ) );
+		value1 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset + 16 ] ) );
+		value2 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset + 32 ] ) );
+		value3 = _mm_loadu_si128( (const __m128i *) &( data[ copy_offset + 48 ] ) );
+
+		_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset ] ), value0 );
+		_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset + 16 ] ), value1 );
+		_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset + 32 ] ), value2 );
+		_mm_storeu_si128( (__m128i *) &( buffer[ copy_offset + 48 ] ), value3 );
+	}
+}
+
+/* Extracts the 2048 bytes of user data of raw (2352 bytes per sector) Mode 1 or Mode 2 Form 1 sectors
+ * This kernel uses AVX2 and validates the headers of 2 sectors per compare,
+ * it is only used to compare against the SSE2 kernel of the library
+ * Only call this function if the CPU supports AVX2
+ * Returns the number of sectors extracted
+ */
+__attribute__((target("avx2"))) size_t odraw_bench_sector_extract_2352_to_2048_avx2(
+                                        const uint8_t *sector_data,
+                                        size_t number_of_sectors,
+                                        uint8_t track_type,
+                                        uint8_t *buffer )
+{
+	__m256i synchronisation = _mm256_broadcastsi128_si256(
+	                           _mm_loadu_si128( (const __m128i *) odraw_bench_synchronisation_data ) );
+	size_t data_offset      = 16;
+	size_t sector_index     = 0;
+
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	{
+		data_offset = 24;
+	}
+	while( ( sector_index + 2 ) <= number_of_sectors )
+	{
+		if( odraw_bench_avx2_check_headers(
+		     sector_data,
+		     track_type,
+		     synchronisation ) == 0 )
+		{
+			break;
+		}
+		odraw_bench_avx2_copy(
+		 &( sector_data[ data_offset ] ),
+		 buffer );
+
+		odraw_bench_avx2_copy(
+		 &( sector_data[ 2352 + data_offset ] ),
+		 &( buffer[ 2048 ] ) );
+
+		sector_data  += 2 * 2352;
+		buffer       += 2 * 2048;
+		sector_index += 2;
+	}
+	/* Handle the remaining sector or determine which of the 2 sectors
+	 * failed validation, the SSE2 kernel is not used here since mixing
+	 * legacy SSE and AVX instructions incurs a transition penalty
+	 */
+	while( sector_index < number_of_sectors )
+	{
+		if( odraw_bench_avx2_check_header(
+		     sector_data,
+		     track_type,
+		     synchronisation ) == 0 )
+		{
+			break;
+		}
+		odraw_bench_avx2_copy(
+		 &( sector_data[ data_offset ] ),
+		 buffer );
+
+		sector_data  += 2352;
+		buffer       += 2048;
+		sector_index += 1;
+	}
+	return( sector_index );
+}
+
+#endif /* defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD ) */
+
+/* Prints the throughput of a benchmark
+ */
+void odraw_bench_print_result(
+      const char *name,
+      clock_t elapsed_clocks )
+{
+	double elapsed_time = (double) elapsed_clocks / (double) CLOCKS_PER_SEC;
+	double data_size    = (double) ODRAW_BENCH_NUMBER_OF_SECTORS * 2048.0 * (double) ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+
+	if( elapsed_time <= 0.0 )
+	{
+		elapsed_time = 1.0 / (double) CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%-40s %8.2f GB/s\n",
+	 name,
+	 data_size / elapsed_time / 1000000000.0 );
+}
+
+/* Benchmarks a sector extraction kernel
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_bench_kernel(
+     const char *name,
+     libodraw_sector_extract_kernel_t kernel,
+     const uint8_t *sector_data,
+     uint8_t *buffer )
+{
+	clock_t elapsed_clocks = 0;
+	clock_t fastest_clocks = 0;
+	clock_t start_time     = 0;
+	int iteration          = 0;
+	int run                = 0;
+
+	for( run = 0;
+	     run < ODRAW_BENCH_NUMBER_OF_RUNS;
+	     run++ )
+	{
+		start_time = clock();
+
+		for( iteration = 0;
+		     iteration < ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+		     iteration++ )
+		{
+			if( kernel(
+			     sector_data,
+			     ODRAW_BENCH_NUMBER_OF_SECTORS,
+			     LIBODRAW_TRACK_TYPE_MODE1_2352,
+			     buffer ) != ODRAW_BENCH_NUMBER_OF_SECTORS )
+			{
+				return( 0 );
+			}
+		}
+		elapsed_clocks = clock() - start_time;
+
+		if( ( run == 0 )
+		 || ( elapsed_clocks < fastest_clocks ) )
+		{
+			fastest_clocks = elapsed_clocks;
+		}
+	}
+	odraw_bench_print_result(
+	 name,
+	 fastest_clocks );
+
+	return( 1 );
+}
+
+/* Benchmarks libodraw_io_handle_copy_sector_data_to_buffer
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_bench_copy_sector_data_to_buffer(
+     const char *name,
+     libodraw_io_handle_t *io_handle,
+     const uint8_t *sector_data,
+     uint8_t *buffer,
+     size_t number_of_sectors_per_call )
+{
+	libcerror_error_t *error = NULL;
+	clock_t elapsed_clocks   = 0;
+	clock_t fastest_clocks   = 0;
+	clock_t start_time       = 0;
+	size_t sector_index      = 0;
+	int iteration            = 0;
+	int run                  = 0;
+
+	for( run = 0;
+	     run < ODRAW_BENCH_NUMBER_OF_RUNS;
+	     run++ )
+	{
+		start_time = clock();
+
+		for( iteration = 0;
+		     iteration < ODRAW_BENCH_NUMBER_OF_ITERATIONS;
+		     iteration++ )
+		{
+			for( sector_index = 0;
+			     sector_index < ODRAW_BENCH_NUMBER_OF_SECTORS;
+			     sector_index += number_of_sectors_per_call )
+			{
+				if( libodraw_io_handle_copy_sector_data_to_buffer(
+				     io_handle,
+				     &( sector_data[ sector_index * 2352 ] ),
+				     number_of_sectors_per_call * 2352,
+				     2352,
+				     LIBODRAW_TRACK_TYPE_MODE1_2352,
+				     &( buffer[ sector_index * 2048 ] ),
+				     number_of_sectors_per_call * 2048,
+				     (uint32_t) sector_index,
+				     0,
+				     &error ) == -1 )
+				{
+					libcerror_error_free(
+					 &error );
+
+					return( 0 );
+				}
+			}
+		}
+		elapsed_clocks = clock() - start_time;
+
+		if( ( run == 0 )
+		 || ( elapsed_clocks < fastest_clocks ) )
+		{
+			fastest_clocks = elapsed_clocks;
+		}
+	}
+	odraw_bench_print_result(
+	 name,
+	 fastest_clocks );
+
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	libodraw_io_handle_t *io_handle = NULL;
+	uint8_t *buffer                 = NULL;
+	uint8_t *sector_data            = NULL;
+	size_t byte_index               = 0;
+	size_t sector_index             = 0;
+	int result                      = 0;
+#endif
+
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ODRAW_BENCH_NUMBER_OF_SECTORS * 2352 );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ODRAW_BENCH_NUMBER_OF_SECTORS * 2048 );
+
+	if( ( sector_data == NULL )
+	 || ( buffer == NULL ) )
+	{
+		goto on_error;
+	}
+	for( sector_index = 0;
+	     sector_index < ODRAW_BENCH_NUMBER_OF_SECTORS;
+	     sector_index++ )
+	{
+		for( byte_index = 0;
+		     byte_index < 2352;
+		     byte_index++ )
+		{
+			sector_data[ ( sector_index * 2352 ) + byte_index ] = (uint8_t) ( byte_index ^ sector_index );
+		}
+		memory_set(
+		 &( sector_data[ sector_index * 2352 ] ),
+		 0xff,
+		 12 );
+
+		sector_data[ sector_index * 2352 ]          = 0x00;
+		sector_data[ ( sector_index * 2352 ) + 11 ] = 0x00;
+		sector_data[ ( sector_index * 2352 ) + 15 ] = 1;
+	}
+	if( libodraw_io_handle_initialize(
+	     &io_handle,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	result = odraw_bench_copy_sector_data_to_buffer(
+	          "copy_sector_data_to_buffer (1 sector)",
+	          io_handle,
+	          sector_data,
+	          buffer,
+	          1 );
+
+	if( result == 1 )
+	{
+		result = odraw_bench_copy_sector_data_to_buffer(
+		          "copy_sector_data_to_buffer (32 sectors)",
+		          io_handle,
+		          sector_data,
+		          buffer,
+		          32 );
+	}
+	if( result == 1 )
+	{
+		result = odraw_bench_kernel(
+		          "scalar",
+		          &libodraw_sector_extract_2352_to_2048_scalar,
+		          sector_data,
+		          buffer );
+	}
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+	if( result == 1 )
+	{
+		result = odraw_bench_kernel(
+		          "sse2",
+		          &libodraw_sector_extract_2352_to_2048_sse2,
+		          sector_data,
+		          buffer );
+	}
+	if( ( result == 1 )
+	 && __builtin_cpu_supports( "avx2" ) )
+	{
+		result = odraw_bench_kernel(
+		          "avx2",
+		          &odraw_bench_sector_extract_2352_to_2048_avx2,
+		          sector_data,
+		          buffer );
+	}
+#endif
+	libodraw_io_handle_free(
+	 &io_handle,
+	 NULL );
+
+	memory_free(
+	 buffer );
+	memory_free(
+	 sector_data );
+
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+on_error:
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( EXIT_FAILURE );
+#endif
+}
+
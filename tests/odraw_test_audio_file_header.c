@@ -0,0 +1,1035 @@
+/*
+ * Library audio_file_header type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libbfio.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_audio_file_header.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* The size of the test WAVE file
+ */
+#define ODRAW_TEST_AUDIO_FILE_HEADER_WAVE_FILE_SIZE	( 56 + 2352 )
+
+/* The size of the test AIFF file
+ */
+#define ODRAW_TEST_AUDIO_FILE_HEADER_AIFF_FILE_SIZE	( 54 + 2352 )
+
+/* The header of the test WAVE file
+ * contains a format chunk, a list chunk of an odd size and the start of the data chunk
+ */
+uint8_t odraw_test_audio_file_header_wave_header_data[ 56 ] = {
+	'R', 'I', 'F', 'F', 0x60, 0x09, 0x00, 0x00, 'W', 'A', 'V', 'E',
+	'f', 'm', 't', ' ', 0x10, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x02, 0x00, 0x44, 0xac, 0x00, 0x00, 0x10, 0xb1, 0x02, 0x00, 0x04, 0x00, 0x10, 0x00,
+	'L', 'I', 'S', 'T', 0x03, 0x00, 0x00, 0x00, 'a', 'b', 'c', 0x00,
+	'd', 'a', 't', 'a', 0x30, 0x09, 0x00, 0x00 };
+
+/* The header of the test AIFF file
+ * contains a common chunk and the start of the sound data chunk
+ */
+uint8_t odraw_test_audio_file_header_aiff_header_data[ 54 ] = {
+	'F', 'O', 'R', 'M', 0x00, 0x00, 0x09, 0x5e, 'A', 'I', 'F', 'F',
+	'C', 'O', 'M', 'M', 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x02, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x10, 0x40, 0x0e, 0xac, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00,
+	'S', 'S', 'N', 'D', 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t odraw_test_audio_file_header_file_data[ ODRAW_TEST_AUDIO_FILE_HEADER_WAVE_FILE_SIZE ];
+
+/* Creates a file IO pool that contains the test file data
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_audio_file_header_open_file_io_pool(
+     libbfio_pool_t **file_io_pool,
+     const uint8_t *header_data,
+     size_t header_data_size,
+     size_t file_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "odraw_test_audio_file_header_open_file_io_pool";
+	int entry_index                  = 0;
+
+	memory_set(
+	 odraw_test_audio_file_header_file_data,
+	 0x5a,
+	 ODRAW_TEST_AUDIO_FILE_HEADER_WAVE_FILE_SIZE );
+
+	memory_copy(
+	 odraw_test_audio_file_header_file_data,
+	 header_data,
+	 header_data_size );
+
+	if( libbfio_pool_initialize(
+	     file_io_pool,
+	     0,
+	     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     odraw_test_audio_file_header_file_data,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_append_handle(
+	     *file_io_pool,
+	     &entry_index,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handle to pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( *file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 file_io_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libodraw_audio_file_header_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_audio_file_header_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libodraw_audio_file_header_t *audio_file_header = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_audio_file_header_initialize(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "audio_file_header",
+	 audio_file_header );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_audio_file_header_free(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "audio_file_header",
+	 audio_file_header );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_audio_file_header_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	audio_file_header = (libodraw_audio_file_header_t *) 0x12345678UL;
+
+	result = libodraw_audio_file_header_initialize(
+	          &audio_file_header,
+	          &error );
+
+	audio_file_header = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_audio_file_header_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_audio_file_header_initialize(
+		          &audio_file_header,
+			          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( audio_file_header != NULL )
+			{
+				libodraw_audio_file_header_free(
+				 &audio_file_header,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "audio_file_header",
+			 audio_file_header );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( audio_file_header != NULL )
+	{
+		libodraw_audio_file_header_free(
+		 &audio_file_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_audio_file_header_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_audio_file_header_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_audio_file_header_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_audio_file_header_read_wave_format_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_audio_file_header_read_wave_format_data(
+     void )
+{
+	uint8_t format_data[ 16 ] = {
+		0x01, 0x00, 0x02, 0x00, 0x44, 0xac, 0x00, 0x00, 0x10, 0xb1, 0x02, 0x00, 0x04, 0x00, 0x10, 0x00 };
+
+	libcerror_error_t *error                        = NULL;
+	libodraw_audio_file_header_t *audio_file_header = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_audio_file_header_initialize(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "audio_file_header",
+	 audio_file_header );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_audio_file_header_read_wave_format_data(
+	          audio_file_header,
+	          format_data,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "audio_file_header->number_of_channels",
+	 audio_file_header->number_of_channels,
+	 (uint16_t) 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "audio_file_header->sample_rate",
+	 audio_file_header->sample_rate,
+	 (uint32_t) 44100 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "audio_file_header->bits_per_sample",
+	 audio_file_header->bits_per_sample,
+	 (uint16_t) 16 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "audio_file_header->byte_order",
+	 audio_file_header->byte_order,
+	 (uint8_t) _BYTE_STREAM_ENDIAN_LITTLE );
+
+	/* Test error cases
+	 */
+	result = libodraw_audio_file_header_read_wave_format_data(
+	          NULL,
+	          format_data,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_audio_file_header_read_wave_format_data(
+	          audio_file_header,
+	          NULL,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_audio_file_header_read_wave_format_data(
+	          audio_file_header,
+	          format_data,
+	          15,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported format type
+	 */
+	format_data[ 0 ] = 0x55;
+
+	result = libodraw_audio_file_header_read_wave_format_data(
+	          audio_file_header,
+	          format_data,
+	          16,
+	          &error );
+
+	format_data[ 0 ] = 0x01;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_audio_file_header_free(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( audio_file_header != NULL )
+	{
+		libodraw_audio_file_header_free(
+		 &audio_file_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_audio_file_header_read_aiff_common_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_audio_file_header_read_aiff_common_data(
+     void )
+{
+	uint8_t common_data[ 22 ] = {
+		0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x0e, 0xac, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 's', 'o', 'w', 't' };
+
+	libcerror_error_t *error                        = NULL;
+	libodraw_audio_file_header_t *audio_file_header = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_audio_file_header_initialize(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "audio_file_header",
+	 audio_file_header );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_audio_file_header_read_aiff_common_data(
+	          audio_file_header,
+	          common_data,
+	          18,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "audio_file_header->number_of_channels",
+	 audio_file_header->number_of_channels,
+	 (uint16_t) 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "audio_file_header->sample_rate",
+	 audio_file_header->sample_rate,
+	 (uint32_t) 44100 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "audio_file_header->bits_per_sample",
+	 audio_file_header->bits_per_sample,
+	 (uint16_t) 16 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "audio_file_header->byte_order",
+	 audio_file_header->byte_order,
+	 (uint8_t) _BYTE_STREAM_ENDIAN_BIG );
+
+	/* AIFF-C files with the sowt compression type contain little-endian samples
+	 */
+	result = libodraw_audio_file_header_read_aiff_common_data(
+	          audio_file_header,
+	          common_data,
+	          22,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "audio_file_header->byte_order",
+	 audio_file_header->byte_order,
+	 (uint8_t) _BYTE_STREAM_ENDIAN_LITTLE );
+
+	/* Test error cases
+	 */
+	result = libodraw_audio_file_header_read_aiff_common_data(
+	          NULL,
+	          common_data,
+	          18,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_audio_file_header_read_aiff_common_data(
+	          audio_file_header,
+	          common_data,
+	          18,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported compression type
+	 */
+	common_data[ 18 ] = 'u';
+
+	result = libodraw_audio_file_header_read_aiff_common_data(
+	          audio_file_header,
+	          common_data,
+	          22,
+	          1,
+	          &error );
+
+	common_data[ 18 ] = 's';
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_audio_file_header_free(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( audio_file_header != NULL )
+	{
+		libodraw_audio_file_header_free(
+		 &audio_file_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_audio_file_header_read_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_audio_file_header_read_file_io_pool(
+     void )
+{
+	libbfio_pool_t *file_io_pool                    = NULL;
+	libcerror_error_t *error                        = NULL;
+	libodraw_audio_file_header_t *audio_file_header = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_audio_file_header_initialize(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "audio_file_header",
+	 audio_file_header );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_audio_file_header_open_file_io_pool(
+	          &file_io_pool,
+	          odraw_test_audio_file_header_wave_header_data,
+	          56,
+	          ODRAW_TEST_AUDIO_FILE_HEADER_WAVE_FILE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_audio_file_header_read_file_io_pool(
+	          audio_file_header,
+	          file_io_pool,
+	          0,
+	          LIBODRAW_FILE_TYPE_AUDIO_WAVE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "audio_file_header->data_offset",
+	 (int64_t) audio_file_header->data_offset,
+	 (int64_t) 56 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "audio_file_header->data_size",
+	 (uint64_t) audio_file_header->data_size,
+	 (uint64_t) 2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "audio_file_header->byte_order",
+	 audio_file_header->byte_order,
+	 (uint8_t) _BYTE_STREAM_ENDIAN_LITTLE );
+
+	/* Test error cases
+	 */
+	result = libodraw_audio_file_header_read_file_io_pool(
+	          NULL,
+	          file_io_pool,
+	          0,
+	          LIBODRAW_FILE_TYPE_AUDIO_WAVE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_audio_file_header_read_file_io_pool(
+	          audio_file_header,
+	          file_io_pool,
+	          0,
+	          LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a WAVE file that is read as an AIFF file
+	 */
+	result = libodraw_audio_file_header_read_file_io_pool(
+	          audio_file_header,
+	          file_io_pool,
+	          0,
+	          LIBODRAW_FILE_TYPE_AUDIO_AIFF,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with an AIFF file
+	 */
+	result = odraw_test_audio_file_header_open_file_io_pool(
+	          &file_io_pool,
+	          odraw_test_audio_file_header_aiff_header_data,
+	          54,
+	          ODRAW_TEST_AUDIO_FILE_HEADER_AIFF_FILE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_audio_file_header_read_file_io_pool(
+	          audio_file_header,
+	          file_io_pool,
+	          0,
+	          LIBODRAW_FILE_TYPE_AUDIO_AIFF,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "audio_file_header->data_offset",
+	 (int64_t) audio_file_header->data_offset,
+	 (int64_t) 54 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "audio_file_header->data_size",
+	 (uint64_t) audio_file_header->data_size,
+	 (uint64_t) 2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "audio_file_header->byte_order",
+	 audio_file_header->byte_order,
+	 (uint8_t) _BYTE_STREAM_ENDIAN_BIG );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_audio_file_header_free(
+	          &audio_file_header,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( audio_file_header != NULL )
+	{
+		libodraw_audio_file_header_free(
+		 &audio_file_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_audio_file_header_initialize",
+	 odraw_test_audio_file_header_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_audio_file_header_free",
+	 odraw_test_audio_file_header_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_audio_file_header_read_wave_format_data",
+	 odraw_test_audio_file_header_read_wave_format_data );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_audio_file_header_read_aiff_common_data",
+	 odraw_test_audio_file_header_read_aiff_common_data );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_audio_file_header_read_file_io_pool",
+	 odraw_test_audio_file_header_read_file_io_pool );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,371 @@
+/*
+ * Library byte swap functions test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_byte_swap.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* The size of the test data, which is not a multiple of the vector sizes
+ * to test the handling of the trailing data
+ */
+#define ODRAW_TEST_BYTE_SWAP_DATA_SIZE		( 2352 + 98 )
+
+uint8_t odraw_test_byte_swap_data[ ODRAW_TEST_BYTE_SWAP_DATA_SIZE ];
+
+/* Fills the test data with a pattern
+ */
+void odraw_test_byte_swap_fill_data(
+      void )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < ODRAW_TEST_BYTE_SWAP_DATA_SIZE;
+	     data_offset++ )
+	{
+		odraw_test_byte_swap_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + ( data_offset >> 8 ) );
+	}
+}
+
+/* Determines if the test data was byte swapped in a specific range
+ * Returns 1 if the data was byte swapped or 0 if not
+ */
+int odraw_test_byte_swap_compare_data(
+     size_t swap_offset,
+     size_t swap_size )
+{
+	size_t data_offset  = 0;
+	size_t value_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < ODRAW_TEST_BYTE_SWAP_DATA_SIZE;
+	     data_offset++ )
+	{
+		value_offset = data_offset;
+
+		if( ( data_offset >= swap_offset )
+		 && ( data_offset < ( swap_offset + swap_size ) ) )
+		{
+			value_offset = ( ( data_offset - swap_offset ) ^ 1 ) + swap_offset;
+		}
+		if( odraw_test_byte_swap_data[ data_offset ] != (uint8_t) ( ( value_offset * 7 ) + ( value_offset >> 8 ) ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests a byte swap kernel
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_byte_swap_kernel(
+     libodraw_byte_swap_kernel_t kernel )
+{
+	size_t data_offset = 0;
+	size_t data_size   = 0;
+	int result         = 0;
+
+	/* Test regular cases with all sizes and unaligned data
+	 */
+	for( data_offset = 0;
+	     data_offset < 4;
+	     data_offset++ )
+	{
+		for( data_size = 0;
+		     ( data_offset + data_size ) <= ODRAW_TEST_BYTE_SWAP_DATA_SIZE;
+		     data_size += 2 )
+		{
+			odraw_test_byte_swap_fill_data();
+
+			kernel(
+			 &( odraw_test_byte_swap_data[ data_offset ] ),
+			 data_size );
+
+			result = odraw_test_byte_swap_compare_data(
+			          data_offset,
+			          data_size );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* Test that swapping twice restores the data
+	 */
+	odraw_test_byte_swap_fill_data();
+
+	kernel(
+	 odraw_test_byte_swap_data,
+	 ODRAW_TEST_BYTE_SWAP_DATA_SIZE );
+
+	kernel(
+	 odraw_test_byte_swap_data,
+	 ODRAW_TEST_BYTE_SWAP_DATA_SIZE );
+
+	result = odraw_test_byte_swap_compare_data(
+	          0,
+	          0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_byte_swap_16bit_scalar function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_byte_swap_16bit_scalar(
+     void )
+{
+	return( odraw_test_byte_swap_kernel(
+	         &libodraw_byte_swap_16bit_scalar ) );
+}
+
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+
+/* Tests the libodraw_byte_swap_16bit_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_byte_swap_16bit_sse2(
+     void )
+{
+	return( odraw_test_byte_swap_kernel(
+	         &libodraw_byte_swap_16bit_sse2 ) );
+}
+
+/* Tests the libodraw_byte_swap_16bit_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_byte_swap_16bit_avx2(
+     void )
+{
+	__builtin_cpu_init();
+
+	if( !__builtin_cpu_supports( "avx2" ) )
+	{
+		return( 1 );
+	}
+	return( odraw_test_byte_swap_kernel(
+	         &libodraw_byte_swap_16bit_avx2 ) );
+}
+
+#endif /* defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD ) */
+
+/* Tests the libodraw_byte_swap_get_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_byte_swap_get_kernel(
+     void )
+{
+	libodraw_byte_swap_kernel_t kernel = NULL;
+
+	kernel = libodraw_byte_swap_get_kernel();
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "kernel",
+	 kernel );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "kernel",
+	 (intptr_t) libodraw_byte_swap_get_kernel(),
+	 (intptr_t) kernel );
+
+	return( odraw_test_byte_swap_kernel(
+	         kernel ) );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_byte_swap_16bit function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_byte_swap_16bit(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	odraw_test_byte_swap_fill_data();
+
+	result = libodraw_byte_swap_16bit(
+	          odraw_test_byte_swap_data,
+	          ODRAW_TEST_BYTE_SWAP_DATA_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_byte_swap_compare_data(
+	          0,
+	          ODRAW_TEST_BYTE_SWAP_DATA_SIZE );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libodraw_byte_swap_16bit(
+	          NULL,
+	          ODRAW_TEST_BYTE_SWAP_DATA_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_byte_swap_16bit(
+	          odraw_test_byte_swap_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_byte_swap_16bit(
+	          odraw_test_byte_swap_data,
+	          ODRAW_TEST_BYTE_SWAP_DATA_SIZE - 1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_byte_swap_16bit_scalar",
+	 odraw_test_byte_swap_16bit_scalar );
+
+#if defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_byte_swap_16bit_sse2",
+	 odraw_test_byte_swap_16bit_sse2 );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_byte_swap_16bit_avx2",
+	 odraw_test_byte_swap_16bit_avx2 );
+
+#endif /* defined( LIBODRAW_BYTE_SWAP_HAVE_SIMD ) */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_byte_swap_get_kernel",
+	 odraw_test_byte_swap_get_kernel );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_byte_swap_16bit",
+	 odraw_test_byte_swap_16bit );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
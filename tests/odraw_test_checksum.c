@@ -0,0 +1,457 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_checksum.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* The first and last 8 bytes of the P and Q parity of the test sector
+ */
+uint8_t odraw_test_checksum_ecc_p_parity_start[ 8 ] = {
+	0x2a, 0x67, 0xe5, 0x4b, 0xda, 0x45, 0x54, 0x43 };
+
+uint8_t odraw_test_checksum_ecc_p_parity_end[ 8 ] = {
+	0x2f, 0xe7, 0x8f, 0x93, 0x1c, 0x49, 0x91, 0x87 };
+
+uint8_t odraw_test_checksum_ecc_q_parity_start[ 8 ] = {
+	0xa3, 0xe3, 0xdc, 0xa9, 0x8e, 0x18, 0x94, 0xf1 };
+
+uint8_t odraw_test_checksum_ecc_q_parity_end[ 8 ] = {
+	0xe3, 0x46, 0xea, 0x4a, 0xc4, 0xeb, 0x3e, 0x7a };
+
+/* Fills the test sector with a pattern
+ */
+void odraw_test_checksum_fill_sector(
+      uint8_t *sector_data )
+{
+	size_t byte_index = 0;
+
+	for( byte_index = 0;
+	     byte_index < 2352;
+	     byte_index++ )
+	{
+		sector_data[ byte_index ] = (uint8_t) ( ( byte_index * 7 ) + 3 );
+	}
+}
+
+/* Tests the libodraw_checksum_calculate_edc function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_edc(
+     void )
+{
+	uint8_t sector_data[ 2352 ];
+
+	libcerror_error_t *error = NULL;
+	size_t byte_index        = 0;
+	size_t size              = 0;
+	uint32_t byte_wise_edc   = 0;
+	uint32_t edc             = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_checksum_calculate_edc(
+	          &edc,
+	          (uint8_t *) "123456789",
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "edc",
+	 edc,
+	 (uint32_t) 0x6ec2edc4UL );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	odraw_test_checksum_fill_sector(
+	 sector_data );
+
+	result = libodraw_checksum_calculate_edc(
+	          &edc,
+	          sector_data,
+	          2064,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "edc",
+	 edc,
+	 (uint32_t) 0x0fdf3e6dUL );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the slice-by-8 calculation matches the byte-wise calculation
+	 * for sizes that are not a multiple of 8
+	 */
+	for( size = 0;
+	     size < 32;
+	     size++ )
+	{
+		result = libodraw_checksum_calculate_edc(
+		          &edc,
+		          &( sector_data[ 5 ] ),
+		          size,
+		          0x12345678UL,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		byte_wise_edc = 0x12345678UL;
+
+		for( byte_index = 0;
+		     byte_index < size;
+		     byte_index++ )
+		{
+			result = libodraw_checksum_calculate_edc(
+			          &byte_wise_edc,
+			          &( sector_data[ 5 + byte_index ] ),
+			          1,
+			          byte_wise_edc,
+			          &error );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		ODRAW_TEST_ASSERT_EQUAL_UINT32(
+		 "edc",
+		 edc,
+		 byte_wise_edc );
+	}
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_edc(
+	          NULL,
+	          sector_data,
+	          2064,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_edc(
+	          &edc,
+	          NULL,
+	          2064,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_edc(
+	          &edc,
+	          sector_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_checksum_calculate_ecc_p and libodraw_checksum_calculate_ecc_q functions
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_ecc(
+     void )
+{
+	uint8_t sector_data[ 2352 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	odraw_test_checksum_fill_sector(
+	 sector_data );
+
+	result = libodraw_checksum_calculate_ecc_p(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+	          &( sector_data[ 12 + LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( sector_data[ 2076 ] ),
+	          odraw_test_checksum_ecc_p_parity_start,
+	          8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( sector_data[ 2076 + 164 ] ),
+	          odraw_test_checksum_ecc_p_parity_end,
+	          8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The Q parity covers the P parity
+	 */
+	result = libodraw_checksum_calculate_ecc_q(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE,
+	          &( sector_data[ 12 + LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE ] ),
+	          LIBODRAW_CHECKSUM_ECC_Q_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( sector_data[ 2248 ] ),
+	          odraw_test_checksum_ecc_q_parity_start,
+	          8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( sector_data[ 2248 + 96 ] ),
+	          odraw_test_checksum_ecc_q_parity_end,
+	          8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_ecc_p(
+	          NULL,
+	          LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+	          &( sector_data[ 2076 ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_ecc_p(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE - 1,
+	          &( sector_data[ 2076 ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_ecc_p(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+	          NULL,
+	          LIBODRAW_CHECKSUM_ECC_P_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_ecc_q(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE,
+	          &( sector_data[ 2248 ] ),
+	          LIBODRAW_CHECKSUM_ECC_Q_SIZE - 1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_edc",
+	 odraw_test_checksum_calculate_edc );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_ecc",
+	 odraw_test_checksum_calculate_ecc );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -42,6 +42,13 @@ int libodraw_cue_parser_parse_buffer(
      size_t buffer_size,
      libcerror_error_t **error );
 
+extern \
+int libodraw_cue_parser_parse_terminated_buffer(
+     libodraw_handle_t *handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 #if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
 
 /* Tests the libodraw_cue_parser_parse_buffer function
@@ -84,6 +91,85 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libodraw_cue_parser_parse_terminated_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_parser_parse_terminated_buffer(
+     void )
+{
+	uint8_t buffer[ 4 ]      = { 'R', 'E', 'M', 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_cue_parser_parse_terminated_buffer(
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_parser_parse_terminated_buffer(
+	          NULL,
+	          buffer,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test buffer without 2 terminating zero bytes
+	 */
+	result = libodraw_cue_parser_parse_terminated_buffer(
+	          NULL,
+	          buffer,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 /* The main program
@@ -113,6 +199,10 @@ int main(
 	 "libodraw_cue_parser_parse_buffer",
 	 odraw_test_cue_parser_parse_buffer );
 
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_parser_parse_terminated_buffer",
+	 odraw_test_cue_parser_parse_terminated_buffer );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,506 @@
+/*
+ * Library data_file_segment type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_data_file_segment.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Sets the values of a data file segment
+ */
+void odraw_test_data_file_segment_set(
+      libodraw_data_file_segment_t *segment,
+      int data_file_index,
+      off64_t data_file_offset,
+      size_t size )
+{
+	segment->data_file_index  = data_file_index;
+	segment->data_file_offset = data_file_offset;
+	segment->size             = size;
+	segment->buffer           = NULL;
+}
+
+/* Tests the libodraw_data_file_segments_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_segments_sort(
+     void )
+{
+	libodraw_data_file_segment_t segments[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	odraw_test_data_file_segment_set(
+	 &( segments[ 0 ] ),
+	 1,
+	 0,
+	 2048 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 1 ] ),
+	 0,
+	 4096,
+	 2048 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 2 ] ),
+	 0,
+	 0,
+	 2048 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 3 ] ),
+	 0,
+	 2048,
+	 2048 );
+
+	result = libodraw_data_file_segments_sort(
+	          segments,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "segments[ 0 ].data_file_index",
+	 segments[ 0 ].data_file_index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segments[ 0 ].data_file_offset",
+	 (int64_t) segments[ 0 ].data_file_offset,
+	 (int64_t) 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segments[ 1 ].data_file_offset",
+	 (int64_t) segments[ 1 ].data_file_offset,
+	 (int64_t) 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segments[ 2 ].data_file_offset",
+	 (int64_t) segments[ 2 ].data_file_offset,
+	 (int64_t) 4096 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "segments[ 3 ].data_file_index",
+	 segments[ 3 ].data_file_index,
+	 1 );
+
+	result = libodraw_data_file_segments_sort(
+	          segments,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_data_file_segments_sort(
+	          NULL,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_data_file_segments_sort(
+	          segments,
+	          -1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_data_file_segments_get_run function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_segments_get_run(
+     void )
+{
+	libodraw_data_file_segment_t segments[ 5 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t run_size            = 0;
+	int number_of_run_segments = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	odraw_test_data_file_segment_set(
+	 &( segments[ 0 ] ),
+	 0,
+	 0,
+	 2048 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 1 ] ),
+	 0,
+	 2048,
+	 4096 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 2 ] ),
+	 0,
+	 8192,
+	 2048 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 3 ] ),
+	 1,
+	 10240,
+	 2048 );
+
+	odraw_test_data_file_segment_set(
+	 &( segments[ 4 ] ),
+	 1,
+	 12288,
+	 2048 );
+
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          0,
+	          65536,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_segments",
+	 number_of_run_segments,
+	 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) 6144 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Segments in different data files are not part of the same run
+	 */
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          2,
+	          65536,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_segments",
+	 number_of_run_segments,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) 2048 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          3,
+	          65536,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_segments",
+	 number_of_run_segments,
+	 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) 4096 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first segment is part of the run even if it exceeds the maximum run size
+	 */
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          0,
+	          1024,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_segments",
+	 number_of_run_segments,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) 2048 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          0,
+	          4096,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_segments",
+	 number_of_run_segments,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_data_file_segments_get_run(
+	          NULL,
+	          5,
+	          0,
+	          65536,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          5,
+	          65536,
+	          &number_of_run_segments,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          0,
+	          65536,
+	          NULL,
+	          &run_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_data_file_segments_get_run(
+	          segments,
+	          5,
+	          0,
+	          65536,
+	          &number_of_run_segments,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_segments_sort",
+	 odraw_test_data_file_segments_sort );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_segments_get_run",
+	 odraw_test_data_file_segments_get_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
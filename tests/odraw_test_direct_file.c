@@ -0,0 +1,888 @@
+/*
+ * Library direct_file type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_direct_file.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* The test file is larger than the window and ends with a tail that is not a multitude of the alignment
+ */
+#define ODRAW_TEST_DIRECT_FILE_NAME	"odraw_test_direct_file.raw"
+#define ODRAW_TEST_DIRECT_FILE_SIZE	( ( 2 * LIBODRAW_DIRECT_FILE_WINDOW_SIZE ) + 2352 + 100 )
+
+/* Retrieves the test data byte at a specific offset
+ */
+#define odraw_test_direct_file_get_byte( offset ) \
+	(uint8_t) ( ( ( offset ) * 7 ) + ( ( offset ) >> 12 ) )
+
+/* Creates the test file
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_direct_file_create_test_file(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	FILE *file_stream   = NULL;
+	size_t buffer_index = 0;
+	size_t write_size   = 0;
+	off64_t offset      = 0;
+
+	file_stream = file_stream_open(
+	               ODRAW_TEST_DIRECT_FILE_NAME,
+	               "wb" );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	while( offset < (off64_t) ODRAW_TEST_DIRECT_FILE_SIZE )
+	{
+		write_size = sizeof( buffer );
+
+		if( write_size > (size_t) ( ODRAW_TEST_DIRECT_FILE_SIZE - offset ) )
+		{
+			write_size = (size_t) ( ODRAW_TEST_DIRECT_FILE_SIZE - offset );
+		}
+		for( buffer_index = 0;
+		     buffer_index < write_size;
+		     buffer_index++ )
+		{
+			buffer[ buffer_index ] = odraw_test_direct_file_get_byte( offset + buffer_index );
+		}
+		if( file_stream_write(
+		     file_stream,
+		     buffer,
+		     write_size ) != write_size )
+		{
+			file_stream_close(
+			 file_stream );
+
+			return( -1 );
+		}
+		offset += write_size;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares a buffer with the test data at a specific offset
+ * Returns 1 if equal or 0 if not
+ */
+int odraw_test_direct_file_compare_test_data(
+     const uint8_t *buffer,
+     size_t size,
+     off64_t offset )
+{
+	size_t buffer_index = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < size;
+	     buffer_index++ )
+	{
+		if( buffer[ buffer_index ] != odraw_test_direct_file_get_byte( offset + buffer_index ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libodraw_direct_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_direct_file_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_direct_file_t *direct_file = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file",
+	 direct_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_direct_file_free(
+	          &direct_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "direct_file",
+	 direct_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_direct_file_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	direct_file = (libodraw_direct_file_t *) 0x12345678UL;
+
+	result = libodraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	direct_file = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_direct_file_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_direct_file_initialize(
+		          &direct_file,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( direct_file != NULL )
+			{
+				libodraw_direct_file_free(
+				 &direct_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "direct_file",
+			 direct_file );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_direct_file_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_direct_file_initialize(
+		          &direct_file,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( direct_file != NULL )
+			{
+				libodraw_direct_file_free(
+				 &direct_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "direct_file",
+			 direct_file );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file != NULL )
+	{
+		libodraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_direct_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_direct_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_direct_file_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_direct_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_direct_file_open(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_direct_file_t *direct_file = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file",
+	 direct_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_direct_file_open(
+	          NULL,
+	          "test",
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_direct_file_open(
+	          direct_file,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_direct_file_free(
+	          &direct_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "direct_file",
+	 direct_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file != NULL )
+	{
+		libodraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_direct_file_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_direct_file_read_buffer_at_offset(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_direct_file_t *direct_file = NULL;
+	uint8_t *buffer                     = NULL;
+	uint8_t *buffer_allocation          = NULL;
+	ssize_t read_count                  = 0;
+	int file_created                    = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file",
+	 direct_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a direct file that is not open cannot be read
+	 */
+	buffer_allocation = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ( ODRAW_TEST_DIRECT_FILE_SIZE + LIBODRAW_DIRECT_FILE_ALIGNMENT ) );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer_allocation",
+	 buffer_allocation );
+
+	buffer = &( buffer_allocation[ LIBODRAW_DIRECT_FILE_ALIGNMENT - ( (intptr_t) buffer_allocation % LIBODRAW_DIRECT_FILE_ALIGNMENT ) ] );
+
+	read_count = libodraw_direct_file_read_buffer_at_offset(
+	              direct_file,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = odraw_test_direct_file_create_test_file();
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	result = libodraw_direct_file_open(
+	          direct_file,
+	          ODRAW_TEST_DIRECT_FILE_NAME,
+	          &error );
+
+	ODRAW_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Direct IO is not supported by every file system
+	 */
+	if( result != 0 )
+	{
+		/* Test regular cases
+		 * an aligned read of at least the window size is read directly into the buffer
+		 */
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              LIBODRAW_DIRECT_FILE_WINDOW_SIZE + 8192,
+		              4096,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) ( LIBODRAW_DIRECT_FILE_WINDOW_SIZE + 8192 ) );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = odraw_test_direct_file_compare_test_data(
+		          buffer,
+		          LIBODRAW_DIRECT_FILE_WINDOW_SIZE + 8192,
+		          4096 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test an unaligned read of raw sectors into an unaligned buffer
+		 */
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              &( buffer[ 1 ] ),
+		              2352 * 3,
+		              2352 * 17,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) ( 2352 * 3 ) );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = odraw_test_direct_file_compare_test_data(
+		          &( buffer[ 1 ] ),
+		          2352 * 3,
+		          2352 * 17 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test a read that crosses the end of the window
+		 */
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              4096,
+		              LIBODRAW_DIRECT_FILE_WINDOW_SIZE - 100,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = odraw_test_direct_file_compare_test_data(
+		          buffer,
+		          4096,
+		          LIBODRAW_DIRECT_FILE_WINDOW_SIZE - 100 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test a read of the entire file, which ends with an unaligned tail
+		 */
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              ODRAW_TEST_DIRECT_FILE_SIZE,
+		              0,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) ODRAW_TEST_DIRECT_FILE_SIZE );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = odraw_test_direct_file_compare_test_data(
+		          buffer,
+		          ODRAW_TEST_DIRECT_FILE_SIZE,
+		          0 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test a read beyond the end of the file
+		 */
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              4096,
+		              ODRAW_TEST_DIRECT_FILE_SIZE - 10,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 10 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              4096,
+		              ODRAW_TEST_DIRECT_FILE_SIZE + 8192,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              NULL,
+		              buffer,
+		              512,
+		              0,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              NULL,
+		              512,
+		              0,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              (size_t) SSIZE_MAX + 1,
+		              0,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		read_count = libodraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              buffer,
+		              512,
+		              -1,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libodraw_direct_file_close(
+		          direct_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	remove(
+	 ODRAW_TEST_DIRECT_FILE_NAME );
+
+	file_created = 0;
+
+	memory_free(
+	 buffer_allocation );
+
+	buffer_allocation = NULL;
+
+	result = libodraw_direct_file_free(
+	          &direct_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "direct_file",
+	 direct_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_created != 0 )
+	{
+		remove(
+		 ODRAW_TEST_DIRECT_FILE_NAME );
+	}
+	if( buffer_allocation != NULL )
+	{
+		memory_free(
+		 buffer_allocation );
+	}
+	if( direct_file != NULL )
+	{
+		libodraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_direct_file_initialize",
+	 odraw_test_direct_file_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_direct_file_free",
+	 odraw_test_direct_file_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_direct_file_open",
+	 odraw_test_direct_file_open );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_direct_file_read_buffer_at_offset",
+	 odraw_test_direct_file_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1843 @@
+/*
+ * Library extent_table type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_extent_table.h"
+#include "../libodraw/libodraw_libcdata.h"
+#include "../libodraw/libodraw_sector_range.h"
+#include "../libodraw/libodraw_track_value.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Appends a track value to an array
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_extent_table_append_track_value(
+     libcdata_array_t *array,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libodraw_track_value_t *track_value = NULL;
+	int entry_index                     = 0;
+
+	if( libodraw_track_value_initialize(
+	     &track_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libodraw_track_value_set(
+	     track_value,
+	     start_sector,
+	     number_of_sectors,
+	     LIBODRAW_TRACK_TYPE_MODE1_2048,
+	     0,
+	     start_sector,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     array,
+	     &entry_index,
+	     (intptr_t *) track_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( track_value != NULL )
+	{
+		libodraw_track_value_free(
+		 &track_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a sector range to an array
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_extent_table_append_sector_range(
+     libcdata_array_t *array,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libodraw_sector_range_t *sector_range = NULL;
+	int entry_index                       = 0;
+
+	if( libodraw_sector_range_initialize(
+	     &sector_range,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libodraw_sector_range_set(
+	     sector_range,
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     array,
+	     &entry_index,
+	     (intptr_t *) sector_range,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sector_range != NULL )
+	{
+		libodraw_sector_range_free(
+		 &sector_range,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libodraw_extent_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libodraw_extent_table_t *extent_table = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_table = (libodraw_extent_table_t *) 0x12345678UL;
+
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	extent_table = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_extent_table_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_extent_table_initialize(
+		          &extent_table,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( extent_table != NULL )
+			{
+				libodraw_extent_table_free(
+				 &extent_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "extent_table",
+			 extent_table );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_extent_table_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_extent_table_initialize(
+		          &extent_table,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( extent_table != NULL )
+			{
+				libodraw_extent_table_free(
+				 &extent_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "extent_table",
+			 extent_table );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libodraw_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_extent_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_extent_table_build function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_build(
+     void )
+{
+	libcdata_array_t *lead_outs_array     = NULL;
+	libcdata_array_t *run_outs_array      = NULL;
+	libcdata_array_t *tracks_array        = NULL;
+	libcerror_error_t *error              = NULL;
+	libodraw_extent_t *extent             = NULL;
+	libodraw_extent_table_t *extent_table = NULL;
+	int number_of_extents                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &tracks_array,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &run_outs_array,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &lead_outs_array,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The second track is stored before the first to test the sorting
+	 */
+	result = odraw_test_extent_table_append_track_value(
+	          tracks_array,
+	          150,
+	          50,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = odraw_test_extent_table_append_track_value(
+	          tracks_array,
+	          0,
+	          100,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = odraw_test_extent_table_append_sector_range(
+	          lead_outs_array,
+	          100,
+	          50,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_extent_table_build(
+	          extent_table,
+	          tracks_array,
+	          run_outs_array,
+	          lead_outs_array,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent_table->number_of_extents",
+	 extent_table->number_of_extents,
+	 3 );
+
+	result = libodraw_extent_table_get_number_of_extents_by_type(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_number_of_extents_by_type(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_RUN_OUT,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_index(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->start_sector",
+	 extent->start_sector,
+	 (uint64_t) 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_index(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_LEAD_OUT,
+	          0,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->end_sector",
+	 extent->end_sector,
+	 (uint64_t) 150 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->data_file_index",
+	 extent->data_file_index,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_build(
+	          NULL,
+	          tracks_array,
+	          run_outs_array,
+	          lead_outs_array,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_index(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          2,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_number_of_extents_by_type(
+	          extent_table,
+	          LIBODRAW_NUMBER_OF_EXTENT_TYPES,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &lead_outs_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_free(
+	          &run_outs_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_free(
+	          &tracks_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lead_outs_array != NULL )
+	{
+		libcdata_array_free(
+		 &lead_outs_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+		 NULL );
+	}
+	if( run_outs_array != NULL )
+	{
+		libcdata_array_free(
+		 &run_outs_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+		 NULL );
+	}
+	if( tracks_array != NULL )
+	{
+		libcdata_array_free(
+		 &tracks_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
+		 NULL );
+	}
+	if( extent_table != NULL )
+	{
+		libodraw_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_extent_table_get_extent_by_type_and_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_get_extent_by_type_and_sector(
+     void )
+{
+	libodraw_extent_t extents[ 3 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_extent_t *extent             = NULL;
+	libodraw_extent_table_t *extent_table = NULL;
+	int extent_index                      = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Tracks: 0 - 100, 150 - 200 and 300 - 400
+	 * stored out of order in the tracks array to test that the array index is returned
+	 */
+	extents[ 0 ].start_sector = 0;
+	extents[ 0 ].end_sector   = 100;
+	extents[ 0 ].index        = 2;
+	extents[ 1 ].start_sector = 150;
+	extents[ 1 ].end_sector   = 200;
+	extents[ 1 ].index        = 0;
+	extents[ 2 ].start_sector = 300;
+	extents[ 2 ].end_sector   = 400;
+	extents[ 2 ].index        = 1;
+
+	extent_table->extents                                                  = extents;
+	extent_table->number_of_extents                                        = 3;
+	extent_table->first_extent_index[ LIBODRAW_EXTENT_TYPE_TRACK ]         = 0;
+	extent_table->number_of_extents_per_type[ LIBODRAW_EXTENT_TYPE_TRACK ] = 3;
+
+	/* Test regular cases
+	 */
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 2 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          199,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sector in between extents returns the index of the next extent
+	 */
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          200,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sector beyond the last extent returns the number of extents
+	 */
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          400,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 3 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_LEAD_OUT,
+	          0,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          NULL,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_NUMBER_OF_EXTENT_TYPES,
+	          0,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          NULL,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          &extent_index,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	extent_table->extents = NULL;
+
+	result = libodraw_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		extent_table->extents = NULL;
+
+		libodraw_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_extent_table_get_previous_extent_by_type_and_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_get_previous_extent_by_type_and_sector(
+     void )
+{
+	libodraw_extent_t extents[ 3 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_extent_t *extent             = NULL;
+	libodraw_extent_table_t *extent_table = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Tracks: 0 - 100, 150 - 200 and 300 - 400
+	 * stored out of order in the tracks array
+	 */
+	extents[ 0 ].start_sector = 0;
+	extents[ 0 ].end_sector   = 100;
+	extents[ 0 ].index        = 2;
+	extents[ 1 ].start_sector = 150;
+	extents[ 1 ].end_sector   = 200;
+	extents[ 1 ].index        = 0;
+	extents[ 2 ].start_sector = 300;
+	extents[ 2 ].end_sector   = 400;
+	extents[ 2 ].index        = 1;
+
+	extent_table->extents                                                  = extents;
+	extent_table->number_of_extents                                        = 3;
+	extent_table->first_extent_index[ LIBODRAW_EXTENT_TYPE_TRACK ]         = 0;
+	extent_table->number_of_extents_per_type[ LIBODRAW_EXTENT_TYPE_TRACK ] = 3;
+
+	/* Test regular cases
+	 */
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          50,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sector in between extents returns the extent that precedes it
+	 */
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          120,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          250,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          350,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          400,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          NULL,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_NUMBER_OF_EXTENT_TYPES,
+	          0,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_previous_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	extent_table->extents = NULL;
+
+	result = libodraw_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		extent_table->extents = NULL;
+
+		libodraw_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_extent_table_get_next_extent_by_type_and_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_get_next_extent_by_type_and_sector(
+     void )
+{
+	libodraw_extent_t extents[ 3 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_extent_t *extent             = NULL;
+	libodraw_extent_table_t *extent_table = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Tracks: 0 - 100, 150 - 200 and 300 - 400
+	 * stored out of order in the tracks array
+	 */
+	extents[ 0 ].start_sector = 0;
+	extents[ 0 ].end_sector   = 100;
+	extents[ 0 ].index        = 2;
+	extents[ 1 ].start_sector = 150;
+	extents[ 1 ].end_sector   = 200;
+	extents[ 1 ].index        = 0;
+	extents[ 2 ].start_sector = 300;
+	extents[ 2 ].end_sector   = 400;
+	extents[ 2 ].index        = 1;
+
+	extent_table->extents                                                  = extents;
+	extent_table->number_of_extents                                        = 3;
+	extent_table->first_extent_index[ LIBODRAW_EXTENT_TYPE_TRACK ]         = 0;
+	extent_table->number_of_extents_per_type[ LIBODRAW_EXTENT_TYPE_TRACK ] = 3;
+
+	/* Test regular cases
+	 */
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          50,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sector in between extents returns the extent that follows it
+	 */
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          120,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          250,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "extent->index",
+	 extent->index,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sector in the last extent or beyond it has no next extent
+	 */
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          350,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          400,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          NULL,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_NUMBER_OF_EXTENT_TYPES,
+	          0,
+	          &extent,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_next_extent_by_type_and_sector(
+	          extent_table,
+	          LIBODRAW_EXTENT_TYPE_TRACK,
+	          0,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	extent_table->extents = NULL;
+
+	result = libodraw_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		extent_table->extents = NULL;
+
+		libodraw_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_extent_table_get_next_extent_start_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_extent_table_get_next_extent_start_sector(
+     void )
+{
+	libodraw_extent_t extents[ 3 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_extent_table_t *extent_table = NULL;
+	uint64_t start_sector                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_extent_table_initialize(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Tracks: 0 - 100 and 300 - 400, lead-out: 150 - 200
+	 */
+	extents[ 0 ].start_sector = 0;
+	extents[ 0 ].end_sector   = 100;
+	extents[ 1 ].start_sector = 300;
+	extents[ 1 ].end_sector   = 400;
+	extents[ 2 ].start_sector = 150;
+	extents[ 2 ].end_sector   = 200;
+
+	extent_table->extents                                                     = extents;
+	extent_table->number_of_extents                                           = 3;
+	extent_table->first_extent_index[ LIBODRAW_EXTENT_TYPE_TRACK ]            = 0;
+	extent_table->number_of_extents_per_type[ LIBODRAW_EXTENT_TYPE_TRACK ]    = 2;
+	extent_table->first_extent_index[ LIBODRAW_EXTENT_TYPE_RUN_OUT ]          = 2;
+	extent_table->number_of_extents_per_type[ LIBODRAW_EXTENT_TYPE_RUN_OUT ]  = 0;
+	extent_table->first_extent_index[ LIBODRAW_EXTENT_TYPE_LEAD_OUT ]         = 2;
+	extent_table->number_of_extents_per_type[ LIBODRAW_EXTENT_TYPE_LEAD_OUT ] = 1;
+
+	/* Test regular cases
+	 */
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          extent_table,
+	          50,
+	          &start_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 50 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          extent_table,
+	          100,
+	          &start_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 150 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          extent_table,
+	          200,
+	          &start_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 300 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sector beyond the last extent has no next extent
+	 */
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          extent_table,
+	          400,
+	          &start_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          NULL,
+	          0,
+	          &start_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_extent_table_get_next_extent_start_sector(
+	          extent_table,
+	          0,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	extent_table->extents = NULL;
+
+	result = libodraw_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		extent_table->extents = NULL;
+
+		libodraw_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_initialize",
+	 odraw_test_extent_table_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_free",
+	 odraw_test_extent_table_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_build",
+	 odraw_test_extent_table_build );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_get_extent_by_type_and_sector",
+	 odraw_test_extent_table_get_extent_by_type_and_sector );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_get_previous_extent_by_type_and_sector",
+	 odraw_test_extent_table_get_previous_extent_by_type_and_sector );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_get_next_extent_by_type_and_sector",
+	 odraw_test_extent_table_get_next_extent_by_type_and_sector );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_extent_table_get_next_extent_start_sector",
+	 odraw_test_extent_table_get_next_extent_start_sector );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
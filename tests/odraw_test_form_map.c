@@ -0,0 +1,762 @@
+/*
+ * Library form_map type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_form_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_form_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_form_map_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_form_map_t *form_map   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_form_map_initialize(
+	          &form_map,
+	          2050,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "form_map",
+	 form_map );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "form_map->number_of_blocks",
+	 form_map->number_of_blocks,
+	 (uint64_t) 3 );
+
+	result = libodraw_form_map_free(
+	          &form_map,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "form_map",
+	 form_map );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_form_map_initialize(
+	          NULL,
+	          2050,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	form_map = (libodraw_form_map_t *) 0x12345678UL;
+
+	result = libodraw_form_map_initialize(
+	          &form_map,
+	          2050,
+	          &error );
+
+	form_map = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_form_map_initialize(
+	          &form_map,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_form_map_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_form_map_initialize(
+		          &form_map,
+		          2050,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( form_map != NULL )
+			{
+				libodraw_form_map_free(
+				 &form_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "form_map",
+			 form_map );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( form_map != NULL )
+	{
+		libodraw_form_map_free(
+		 &form_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_form_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_form_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_form_map_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_form_map_get_block_range function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_form_map_get_block_range(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libodraw_form_map_t *form_map     = NULL;
+	uint64_t block_number_of_sectors  = 0;
+	uint64_t block_start_sector_index = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_form_map_initialize(
+	          &form_map,
+	          2050,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "form_map",
+	 form_map );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_form_map_get_block_range(
+	          form_map,
+	          1500,
+	          &block_start_sector_index,
+	          &block_number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "block_start_sector_index",
+	 block_start_sector_index,
+	 (uint64_t) 1024 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "block_number_of_sectors",
+	 block_number_of_sectors,
+	 (uint64_t) 1024 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last block contains the remaining sectors
+	 */
+	result = libodraw_form_map_get_block_range(
+	          form_map,
+	          2049,
+	          &block_start_sector_index,
+	          &block_number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "block_start_sector_index",
+	 block_start_sector_index,
+	 (uint64_t) 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "block_number_of_sectors",
+	 block_number_of_sectors,
+	 (uint64_t) 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_form_map_get_block_range(
+	          NULL,
+	          0,
+	          &block_start_sector_index,
+	          &block_number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_form_map_get_block_range(
+	          form_map,
+	          2050,
+	          &block_start_sector_index,
+	          &block_number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_form_map_free(
+	          &form_map,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( form_map != NULL )
+	{
+		libodraw_form_map_free(
+		 &form_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_form_map_set_forms and libodraw_form_map_get_form functions
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_form_map_set_forms(
+     void )
+{
+	uint8_t sector_data[ 4 * 2352 ];
+
+	libcerror_error_t *error      = NULL;
+	libodraw_form_map_t *form_map = NULL;
+	uint8_t form                  = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_form_map_initialize(
+	          &form_map,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "form_map",
+	 form_map );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 sector_data,
+	 0,
+	 4 * 2352 );
+
+	/* Sector 1 is a Form 2 sector in the 2336 bytes per sector layout
+	 */
+	sector_data[ 2336 + 2 ] = 0x20;
+
+	/* Test regular cases
+	 */
+	result = libodraw_form_map_get_form(
+	          form_map,
+	          1,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Setting part of the block does not make the forms known
+	 */
+	result = libodraw_form_map_set_forms(
+	          form_map,
+	          0,
+	          sector_data,
+	          2 * 2336,
+	          2336,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_form_map_get_form(
+	          form_map,
+	          1,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_form_map_set_forms(
+	          form_map,
+	          0,
+	          sector_data,
+	          4 * 2336,
+	          2336,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_form_map_get_form(
+	          form_map,
+	          0,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "form",
+	 form,
+	 (uint8_t) 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_form_map_get_form(
+	          form_map,
+	          1,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "form",
+	 form,
+	 (uint8_t) 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sector 3 is a Form 2 sector in the 2352 bytes per sector layout
+	 */
+	sector_data[ 2352 + 16 + 2 ] = 0x20;
+
+	result = libodraw_form_map_set_forms(
+	          form_map,
+	          2,
+	          sector_data,
+	          2 * 2352,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_form_map_get_form(
+	          form_map,
+	          3,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "form",
+	 form,
+	 (uint8_t) 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_form_map_set_forms(
+	          NULL,
+	          0,
+	          sector_data,
+	          2336,
+	          2336,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_form_map_set_forms(
+	          form_map,
+	          0,
+	          sector_data,
+	          2048,
+	          2048,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_form_map_set_forms(
+	          form_map,
+	          3,
+	          sector_data,
+	          2 * 2336,
+	          2336,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_form_map_get_form(
+	          form_map,
+	          4,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_form_map_free(
+	          &form_map,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( form_map != NULL )
+	{
+		libodraw_form_map_free(
+		 &form_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_form_map_initialize",
+	 odraw_test_form_map_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_form_map_free",
+	 odraw_test_form_map_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_form_map_get_block_range",
+	 odraw_test_form_map_get_block_range );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_form_map_set_forms",
+	 odraw_test_form_map_set_forms );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -425,6 +426,300 @@ on_error:
 	return( 0 );
 }
 
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_internal_handle_grab_sector_data_buffer and libodraw_internal_handle_release_sector_data_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_internal_handle_grab_sector_data_buffer(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libodraw_handle_t *handle                         = NULL;
+	libodraw_sector_data_buffer_t *pooled_buffer      = NULL;
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint8_t *data                                     = NULL;
+	uint64_t number_of_allocations                    = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_internal_handle_grab_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          2352,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	pooled_buffer = sector_data_buffer;
+
+	result = libodraw_internal_handle_release_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The released sector data buffer is reused by the next grab
+	 * and its data is not reallocated
+	 */
+	result = libodraw_internal_handle_grab_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "sector_data_buffer",
+	 (intptr_t) sector_data_buffer,
+	 (intptr_t) pooled_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          2352,
+	          2352,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_data_buffer_get_number_of_allocations(
+	          sector_data_buffer,
+	          &number_of_allocations,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_internal_handle_grab_sector_data_buffer(
+	          NULL,
+	          &pooled_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_internal_handle_grab_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_internal_handle_grab_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_internal_handle_release_sector_data_buffer(
+	          NULL,
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_internal_handle_release_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_internal_handle_release_sector_data_buffer(
+	          (libodraw_internal_handle_t *) handle,
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_internal_handle_release_sector_data_buffer(
+		 (libodraw_internal_handle_t *) handle,
+		 &sector_data_buffer,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
 /* Tests the libodraw_handle_open function
  * Returns 1 if successful or 0 if not
  */
@@ -772,63 +1067,651 @@ int odraw_test_handle_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libodraw_handle_open_wide(
-	          handle,
-	          source,
-	          LIBODRAW_OPEN_READ,
-	          &error );
-#else
-	result = libodraw_handle_open(
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libodraw_handle_open_wide(
+	          handle,
+	          source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+#else
+	result = libodraw_handle_open(
+	          handle,
+	          source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+#endif
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_close(
+	          handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_handle_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_signal_abort(
+     libodraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_handle_signal_abort(
+	          handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_signal_abort(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_handle_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_read_buffer(
+     libodraw_handle_t *handle )
+{
+	uint8_t buffer[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	ssize_t read_count       = 0;
+
+	/* Test regular cases
+	 */
+	read_count = libodraw_handle_read_buffer(
+	              handle,
+	              buffer,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libodraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libodraw_handle_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_handle_read_buffer(
+	              handle,
+	              NULL,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_handle_read_buffer(
+	              handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_handle_pread_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_pread_buffer(
+     libodraw_handle_t *handle )
+{
+	uint8_t buffer[ 128 ];
+	uint8_t reference_buffer[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              handle,
+	              reference_buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_handle_pread_buffer(
+	              handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          reference_buffer,
+	          16 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Make sure the current offset was not changed
+	 */
+	result = libodraw_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libodraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libodraw_handle_pread_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_handle_pread_buffer(
+	              handle,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_handle_pread_buffer(
+	              handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_handle_pread_buffer(
+	              handle,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_handle_read_sectors_vectored function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_read_sectors_vectored(
+     libodraw_handle_t *handle )
+{
+	libodraw_sector_vector_t vectors[ 2 ];
+
+	uint8_t buffer[ 2 * 2352 ];
+	uint8_t reference_buffer[ 2 * 2352 ];
+
+	libcerror_error_t *error   = NULL;
+	uint64_t number_of_sectors = 0;
+	ssize_t read_count         = 0;
+	uint32_t bytes_per_sector  = 0;
+	int number_of_vectors      = 0;
+	int result                 = 0;
+
+	result = libodraw_handle_get_bytes_per_sector(
+	          handle,
+	          &bytes_per_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_get_number_of_sectors(
+	          handle,
+	          &number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > 2352 )
+	 || ( number_of_sectors == 0 ) )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	if( number_of_sectors > 2 )
+	{
+		number_of_sectors = 2;
+	}
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              handle,
+	              reference_buffer,
+	              (size_t) ( number_of_sectors * bytes_per_sector ),
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( number_of_sectors * bytes_per_sector ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sectors are requested in reverse order
+	 */
+	for( number_of_vectors = 0;
+	     number_of_vectors < (int) number_of_sectors;
+	     number_of_vectors++ )
+	{
+		vectors[ number_of_vectors ].start_sector      = number_of_sectors - 1 - number_of_vectors;
+		vectors[ number_of_vectors ].number_of_sectors = 1;
+		vectors[ number_of_vectors ].buffer            = &( buffer[ number_of_vectors * bytes_per_sector ] );
+		vectors[ number_of_vectors ].buffer_size       = bytes_per_sector;
+	}
+	result = libodraw_handle_read_sectors_vectored(
+	          handle,
+	          vectors,
+	          number_of_vectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( reference_buffer[ ( number_of_sectors - 1 ) * bytes_per_sector ] ),
+	          bytes_per_sector );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ ( number_of_sectors - 1 ) * bytes_per_sector ] ),
+	          reference_buffer,
+	          bytes_per_sector );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_read_sectors_vectored(
+	          NULL,
+	          vectors,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_read_sectors_vectored(
+	          handle,
+	          NULL,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_read_sectors_vectored(
 	          handle,
-	          source,
-	          LIBODRAW_OPEN_READ,
+	          vectors,
+	          -1,
 	          &error );
-#endif
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	ODRAW_TEST_ASSERT_IS_NULL(
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libodraw_handle_close(
+	libcerror_error_free(
+	 &error );
+
+	vectors[ 0 ].buffer_size = bytes_per_sector - 1;
+
+	result = libodraw_handle_read_sectors_vectored(
 	          handle,
+	          vectors,
+	          1,
 	          &error );
 
+	vectors[ 0 ].buffer_size = bytes_per_sector;
+
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	ODRAW_TEST_ASSERT_IS_NULL(
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libodraw_handle_free(
-	          &handle,
+	libcerror_error_free(
+	 &error );
+
+	vectors[ 0 ].number_of_sectors = (uint64_t) UINT32_MAX + 1;
+
+	result = libodraw_handle_read_sectors_vectored(
+	          handle,
+	          vectors,
+	          1,
 	          &error );
 
+	vectors[ 0 ].number_of_sectors = 1;
+
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ODRAW_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
+	 -1 );
 
-	ODRAW_TEST_ASSERT_IS_NULL(
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -837,28 +1720,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( handle != NULL )
-	{
-		libodraw_handle_free(
-		 &handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libodraw_handle_signal_abort function
+/* Tests the libodraw_handle_read_sectors function
  * Returns 1 if successful or 0 if not
  */
-int odraw_test_handle_signal_abort(
+int odraw_test_handle_read_sectors(
      libodraw_handle_t *handle )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint8_t buffer[ 2 * 2352 ];
+	uint8_t reference_buffer[ 2 * 2352 ];
 
-	/* Test regular cases
-	 */
-	result = libodraw_handle_signal_abort(
+	libcerror_error_t *error   = NULL;
+	uint64_t number_of_sectors = 0;
+	ssize_t read_count         = 0;
+	uint32_t bytes_per_sector  = 0;
+	uint8_t read_mode          = 0;
+	int result                 = 0;
+
+	result = libodraw_handle_get_bytes_per_sector(
 	          handle,
+	          &bytes_per_sector,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -870,87 +1753,93 @@ int odraw_test_handle_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libodraw_handle_signal_abort(
-	          NULL,
+	result = libodraw_handle_get_number_of_sectors(
+	          handle,
+	          &number_of_sectors,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
+	if( bytes_per_sector == 2048 )
 	{
-		libcerror_error_free(
-		 &error );
+		read_mode = LIBODRAW_SECTOR_READ_MODE_COOKED;
+	}
+	else if( bytes_per_sector == 2352 )
+	{
+		read_mode = LIBODRAW_SECTOR_READ_MODE_RAW;
+	}
+	if( ( read_mode == 0 )
+	 || ( number_of_sectors == 0 ) )
+	{
+		return( 1 );
+	}
+	if( number_of_sectors > 2 )
+	{
+		number_of_sectors = 2;
 	}
-	return( 0 );
-}
-
-/* Tests the libodraw_handle_read_buffer function
- * Returns 1 if successful or 0 if not
- */
-int odraw_test_handle_read_buffer(
-     libodraw_handle_t *handle )
-{
-	uint8_t buffer[ 128 ];
-
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	ssize_t read_count       = 0;
-
 	/* Test regular cases
+	 * a read mode that matches the bytes per sector of the handle reads the same data as read buffer
 	 */
-	read_count = libodraw_handle_read_buffer(
+	read_count = libodraw_handle_read_buffer_at_offset(
 	              handle,
-	              buffer,
-	              16,
+	              reference_buffer,
+	              (size_t) ( number_of_sectors * bytes_per_sector ),
+	              0,
 	              &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) 16 );
+	 (ssize_t) ( number_of_sectors * bytes_per_sector ) );
 
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
-	 */
-	offset = libodraw_handle_seek_offset(
-	          handle,
-	          0,
-	          SEEK_SET,
-	          &error );
+	read_count = libodraw_handle_read_sectors(
+	              handle,
+	              0,
+	              number_of_sectors,
+	              read_mode,
+	              buffer,
+	              2 * 2352,
+	              &error );
 
-	ODRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( number_of_sectors * bytes_per_sector ) );
 
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          buffer,
+	          reference_buffer,
+	          (size_t) ( number_of_sectors * bytes_per_sector ) );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	read_count = libodraw_handle_read_buffer(
+	read_count = libodraw_handle_read_sectors(
 	              NULL,
+	              0,
+	              1,
+	              read_mode,
 	              buffer,
-	              16,
+	              2 * 2352,
 	              &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
@@ -965,10 +1854,34 @@ int odraw_test_handle_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libodraw_handle_read_buffer(
+	read_count = libodraw_handle_read_sectors(
+	              handle,
+	              0,
+	              1,
+	              0xff,
+	              buffer,
+	              2 * 2352,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_handle_read_sectors(
 	              handle,
+	              0,
+	              1,
+	              read_mode,
 	              NULL,
-	              16,
+	              2 * 2352,
 	              &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
@@ -983,10 +1896,13 @@ int odraw_test_handle_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libodraw_handle_read_buffer(
+	read_count = libodraw_handle_read_sectors(
 	              handle,
+	              0,
+	              1,
+	              read_mode,
 	              buffer,
-	              (size_t) SSIZE_MAX + 1,
+	              (size_t) bytes_per_sector - 1,
 	              &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
@@ -1012,6 +1928,113 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libodraw_handle_get_sector_form function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_get_sector_form(
+     libodraw_handle_t *handle )
+{
+	libcerror_error_t *error   = NULL;
+	uint64_t number_of_sectors = 0;
+	uint8_t form               = 0;
+	int result                 = 0;
+
+	result = libodraw_handle_get_number_of_sectors(
+	          handle,
+	          &number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sectors == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libodraw_handle_get_sector_form(
+	          handle,
+	          0,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		ODRAW_TEST_ASSERT_NOT_EQUAL_INT8(
+		 "form",
+		 (int8_t) form,
+		 (int8_t) 0 );
+
+		ODRAW_TEST_ASSERT_LESS_THAN_UINT8(
+		 "form",
+		 form,
+		 (uint8_t) 3 );
+	}
+	/* Test error cases
+	 */
+	result = libodraw_handle_get_sector_form(
+	          NULL,
+	          0,
+	          &form,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_get_sector_form(
+	          handle,
+	          0,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libodraw_handle_seek_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -1776,6 +2799,14 @@ int main(
 	 "libodraw_handle_free",
 	 odraw_test_handle_free );
 
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_internal_handle_grab_sector_data_buffer",
+	 odraw_test_internal_handle_grab_sector_data_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1868,6 +2899,26 @@ int main(
 
 		/* TODO: add tests for libodraw_handle_read_buffer_at_offset */
 
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_pread_buffer",
+		 odraw_test_handle_pread_buffer,
+		 handle );
+
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_read_sectors_vectored",
+		 odraw_test_handle_read_sectors_vectored,
+		 handle );
+
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_read_sectors",
+		 odraw_test_handle_read_sectors,
+		 handle );
+
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_get_sector_form",
+		 odraw_test_handle_get_sector_form,
+		 handle );
+
 		/* TODO: add tests for libodraw_handle_write_buffer */
 
 		/* TODO: add tests for libodraw_handle_write_buffer_at_offset */
@@ -19,8 +19,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +35,7 @@
 #include "odraw_test_memory.h"
 #include "odraw_test_unused.h"
 
+#include "../libodraw/libodraw_checksum.h"
 #include "../libodraw/libodraw_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
@@ -398,6 +401,1249 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libodraw_io_handle_copy_sector_data_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_handle_copy_sector_data_to_buffer(
+     void )
+{
+	uint8_t buffer[ 3 * 2048 ];
+	uint8_t sector_data[ 3 * 2352 ];
+
+	libcerror_error_t *error          = NULL;
+	libodraw_io_handle_t *io_handle   = NULL;
+	size_t byte_index                 = 0;
+	size_t sector_index               = 0;
+	ssize_t copy_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sector_index = 0;
+	     sector_index < 3;
+	     sector_index++ )
+	{
+		for( byte_index = 0;
+		     byte_index < 2352;
+		     byte_index++ )
+		{
+			sector_data[ ( sector_index * 2352 ) + byte_index ] = (uint8_t) ( byte_index + sector_index );
+		}
+		memory_set(
+		 &( sector_data[ sector_index * 2352 ] ),
+		 0xff,
+		 12 );
+
+		sector_data[ sector_index * 2352 ]          = 0x00;
+		sector_data[ ( sector_index * 2352 ) + 11 ] = 0x00;
+		sector_data[ ( sector_index * 2352 ) + 15 ] = 1;
+	}
+	/* Test regular cases
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              sector_data,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              3 * 2048,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( 3 * 2048 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sector_index = 0;
+	     sector_index < 3;
+	     sector_index++ )
+	{
+		result = memory_compare(
+		          &( buffer[ sector_index * 2048 ] ),
+		          &( sector_data[ ( sector_index * 2352 ) + 16 ] ),
+		          2048 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test with a buffer that ends in the middle of a sector
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              sector_data,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              2048 + 1024,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( 2048 + 1024 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( buffer[ 2048 ] ),
+	          &( sector_data[ 2352 + 16 ] ),
+	          1024 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a sector offset
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              sector_data,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              3 * 2048,
+	              0,
+	              512,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( ( 3 * 2048 ) - 512 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( sector_data[ 16 + 512 ] ),
+	          2048 - 512 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error case where the synchronisation data is corrupt
+	 */
+	sector_data[ 2352 + 5 ] = 0;
+
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              sector_data,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              3 * 2048,
+	              0,
+	              0,
+	              &error );
+
+	sector_data[ 2352 + 5 ] = 0xff;
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              NULL,
+	              sector_data,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              3 * 2048,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              NULL,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              3 * 2048,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              sector_data,
+	              3 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              NULL,
+	              3 * 2048,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_handle_copy_sector_data_to_buffer_with_sector_size(
+     void )
+{
+	uint8_t buffer[ 2 * 2352 ];
+	uint8_t raw_sector[ 2352 ];
+	uint8_t sector_data[ 2 * 2352 ];
+
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	size_t byte_index               = 0;
+	ssize_t copy_count              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( byte_index = 0;
+	     byte_index < ( 2 * 2352 );
+	     byte_index++ )
+	{
+		sector_data[ byte_index ] = (uint8_t) byte_index;
+	}
+	/* Test regular cases
+	 * the output bytes per sector is independent of the bytes per sector of the IO handle
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              io_handle,
+	              sector_data,
+	              2 * 2048,
+	              2048,
+	              LIBODRAW_TRACK_TYPE_MODE1_2048,
+	              2352,
+	              buffer,
+	              2 * 2352,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( 2 * 2352 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          &( sector_data[ 2048 ] ),
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          1,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( buffer[ 2352 ] ),
+	          raw_sector,
+	          2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The raw sectors are copied back to their user data
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              io_handle,
+	              buffer,
+	              2 * 2352,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              2048,
+	              sector_data,
+	              2 * 2048,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( 2 * 2048 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( sector_data[ 2048 ] ),
+	          &( raw_sector[ 16 ] ),
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->bytes_per_sector",
+	 io_handle->bytes_per_sector,
+	 (uint32_t) 2048 );
+
+	/* Test error cases
+	 */
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              io_handle,
+	              sector_data,
+	              2 * 2048,
+	              2048,
+	              LIBODRAW_TRACK_TYPE_MODE1_2048,
+	              0,
+	              buffer,
+	              2 * 2352,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              NULL,
+	              sector_data,
+	              2 * 2048,
+	              2048,
+	              LIBODRAW_TRACK_TYPE_MODE1_2048,
+	              2352,
+	              buffer,
+	              2 * 2352,
+	              0,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_handle_verify_sector_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_handle_verify_sector_data(
+     void )
+{
+	uint8_t sector_data[ 2352 ];
+
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	size_t byte_index               = 0;
+	uint32_t edc                    = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Create a Mode 1 sector with a valid EDC and ECC
+	 */
+	for( byte_index = 0;
+	     byte_index < 2352;
+	     byte_index++ )
+	{
+		sector_data[ byte_index ] = (uint8_t) ( ( byte_index * 7 ) + 3 );
+	}
+	memory_set(
+	 sector_data,
+	 0xff,
+	 12 );
+
+	sector_data[ 0 ]  = 0x00;
+	sector_data[ 11 ] = 0x00;
+	sector_data[ 15 ] = 1;
+
+	result = libodraw_checksum_calculate_edc(
+	          &edc,
+	          sector_data,
+	          2064,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( sector_data[ 2064 ] ),
+	 edc );
+
+	memory_set(
+	 &( sector_data[ 2068 ] ),
+	 0,
+	 8 );
+
+	result = libodraw_checksum_calculate_ecc_p(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE,
+	          &( sector_data[ 12 + LIBODRAW_CHECKSUM_ECC_P_DATA_SIZE ] ),
+	          LIBODRAW_CHECKSUM_ECC_P_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_checksum_calculate_ecc_q(
+	          &( sector_data[ 12 ] ),
+	          LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE,
+	          &( sector_data[ 12 + LIBODRAW_CHECKSUM_ECC_Q_DATA_SIZE ] ),
+	          LIBODRAW_CHECKSUM_ECC_Q_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          sector_data,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC | LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Corrupt the Q parity, which is only detected by the ECC verification
+	 */
+	sector_data[ 2351 ] ^= 0x01;
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          sector_data,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          sector_data,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sector_data[ 2351 ] ^= 0x01;
+
+	/* Corrupt the user data
+	 */
+	sector_data[ 1000 ] ^= 0x80;
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          sector_data,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Track types without EDC and ECC are not verified
+	 */
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          sector_data,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_AUDIO,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC | LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_io_handle_verify_sector_data(
+	          NULL,
+	          sector_data,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          NULL,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          sector_data,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_handle_encode_raw_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_handle_encode_raw_sector(
+     void )
+{
+	uint8_t buffer[ 2 * 2352 ];
+	uint8_t raw_sector[ 2352 ];
+	uint8_t sector_data[ 2 * 2336 ];
+
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	size_t byte_index               = 0;
+	ssize_t copy_count              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( byte_index = 0;
+	     byte_index < ( 2 * 2336 );
+	     byte_index++ )
+	{
+		sector_data[ byte_index ] = (uint8_t) ( byte_index * 7 );
+	}
+	/* Test regular cases
+	 */
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          sector_data,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          0,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first sector of the media is at MSF 00:02:00
+	 */
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 12 ]",
+	 raw_sector[ 12 ],
+	 0x00 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 13 ]",
+	 raw_sector[ 13 ],
+	 0x02 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 14 ]",
+	 raw_sector[ 14 ],
+	 0x00 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 15 ]",
+	 raw_sector[ 15 ],
+	 1 );
+
+	result = memory_compare(
+	          &( raw_sector[ 16 ] ),
+	          sector_data,
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          raw_sector,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC | LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sector 4350 is at MSF 01:00:00 and sector 12345 is at MSF 02:46:45
+	 */
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          sector_data,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE2_2048,
+	          12345,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 12 ]",
+	 raw_sector[ 12 ],
+	 0x02 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 13 ]",
+	 raw_sector[ 13 ],
+	 0x46 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 14 ]",
+	 raw_sector[ 14 ],
+	 0x45 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 15 ]",
+	 raw_sector[ 15 ],
+	 2 );
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          raw_sector,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC | LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          sector_data,
+	          2324,
+	          LIBODRAW_TRACK_TYPE_MODE2_2324,
+	          4350,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 12 ]",
+	 raw_sector[ 12 ],
+	 0x01 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 13 ]",
+	 raw_sector[ 13 ],
+	 0x00 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "raw_sector[ 18 ]",
+	 raw_sector[ 18 ],
+	 0x20 );
+
+	result = libodraw_io_handle_verify_sector_data(
+	          io_handle,
+	          raw_sector,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          LIBODRAW_SECTOR_VERIFICATION_FLAG_EDC | LIBODRAW_SECTOR_VERIFICATION_FLAG_ECC,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copy of raw sectors with a sector offset
+	 */
+	io_handle->bytes_per_sector = 2352;
+
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              io_handle,
+	              sector_data,
+	              2 * 2048,
+	              2048,
+	              LIBODRAW_TRACK_TYPE_MODE1_2048,
+	              buffer,
+	              2 * 2352,
+	              0,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( ( 2 * 2352 ) - 16 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          &( sector_data[ 2048 ] ),
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          1,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          &( buffer[ 2352 - 16 ] ),
+	          raw_sector,
+	          2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	io_handle->bytes_per_sector = 2048;
+
+	/* Test error cases
+	 */
+	result = libodraw_io_handle_encode_raw_sector(
+	          NULL,
+	          sector_data,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          0,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          NULL,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          0,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          sector_data,
+	          1024,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          0,
+	          raw_sector,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          sector_data,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          0,
+	          NULL,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_handle_encode_raw_sector(
+	          io_handle,
+	          sector_data,
+	          2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          0,
+	          raw_sector,
+	          2048,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 /* The main program
@@ -429,7 +1675,21 @@ int main(
 	 "libodraw_io_handle_clear",
 	 odraw_test_io_handle_clear );
 
-	/* TODO: add tests for libodraw_io_handle_copy_sector_data_to_buffer */
+	ODRAW_TEST_RUN(
+	 "libodraw_io_handle_copy_sector_data_to_buffer",
+	 odraw_test_io_handle_copy_sector_data_to_buffer );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size",
+	 odraw_test_io_handle_copy_sector_data_to_buffer_with_sector_size );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_handle_verify_sector_data",
+	 odraw_test_io_handle_verify_sector_data );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_handle_encode_raw_sector",
+	 odraw_test_io_handle_encode_raw_sector );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
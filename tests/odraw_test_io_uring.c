@@ -0,0 +1,785 @@
+/*
+ * Library io_uring type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_io_uring.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_io_uring_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_uring_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_io_uring_t *io_uring = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_io_uring_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_uring = (libodraw_io_uring_t *) 0x12345678UL;
+
+	result = libodraw_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	io_uring = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_io_uring_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_io_uring_initialize(
+		          &io_uring,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( io_uring != NULL )
+			{
+				libodraw_io_uring_free(
+				 &io_uring,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "io_uring",
+			 io_uring );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_io_uring_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_io_uring_initialize(
+		          &io_uring,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( io_uring != NULL )
+			{
+				libodraw_io_uring_free(
+				 &io_uring,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "io_uring",
+			 io_uring );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libodraw_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_uring_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_uring_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_io_uring_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_uring_open function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_uring_open(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libodraw_io_uring_t *io_uring = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * io_uring is not supported by every kernel hence 0 is an expected result
+	 */
+	result = libodraw_io_uring_open(
+	          io_uring,
+	          LIBODRAW_IO_URING_DEFAULT_QUEUE_DEPTH,
+	          4096,
+	          &error );
+
+	ODRAW_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 1 )
+	{
+		result = libodraw_io_uring_is_open(
+		          io_uring,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libodraw_io_uring_close(
+		          io_uring,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libodraw_io_uring_is_open(
+	          io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_io_uring_open(
+	          NULL,
+	          LIBODRAW_IO_URING_DEFAULT_QUEUE_DEPTH,
+	          4096,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_uring_open(
+	          io_uring,
+	          0,
+	          4096,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_uring_open(
+	          io_uring,
+	          LIBODRAW_IO_URING_DEFAULT_QUEUE_DEPTH,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libodraw_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_uring_set_file function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_uring_set_file(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libodraw_io_uring_t *io_uring = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_io_uring_set_file(
+	          io_uring,
+	          0,
+	          "test",
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_io_uring_set_file(
+	          NULL,
+	          0,
+	          "test",
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_uring_set_file(
+	          io_uring,
+	          -1,
+	          "test",
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_uring_set_file(
+	          io_uring,
+	          0,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libodraw_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_io_uring_read_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_uring_read_requests(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libodraw_io_uring_request_t request;
+
+	libcerror_error_t *error      = NULL;
+	libodraw_io_uring_t *io_uring = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_uring_initialize(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	request.file_index = 0;
+	request.buffer     = buffer;
+	request.size       = 16;
+	request.offset     = 0;
+	request.read_size  = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_io_uring_read_requests(
+	          io_uring,
+	          &request,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_io_uring_read_requests(
+	          NULL,
+	          &request,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_uring_read_requests(
+	          io_uring,
+	          NULL,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_io_uring_read_requests(
+	          io_uring,
+	          &request,
+	          -1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libodraw_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_uring_initialize",
+	 odraw_test_io_uring_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_uring_free",
+	 odraw_test_io_uring_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_uring_open",
+	 odraw_test_io_uring_open );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_uring_set_file",
+	 odraw_test_io_uring_set_file );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_io_uring_read_requests",
+	 odraw_test_io_uring_read_requests );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
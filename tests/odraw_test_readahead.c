@@ -0,0 +1,734 @@
+/*
+ * Library readahead type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libbfio.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_readahead.h"
+
+/* The size of the test data
+ */
+#define ODRAW_TEST_READAHEAD_DATA_SIZE		( ( 64 * 1024 ) + 100 )
+
+/* The window size used by the tests
+ */
+#define ODRAW_TEST_READAHEAD_WINDOW_SIZE	4096
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+uint8_t odraw_test_readahead_data[ ODRAW_TEST_READAHEAD_DATA_SIZE ];
+
+/* Creates a file IO pool that contains the test data
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_readahead_open_file_io_pool(
+     libbfio_pool_t **file_io_pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "odraw_test_readahead_open_file_io_pool";
+	size_t data_offset               = 0;
+	int entry_index                  = 0;
+
+	for( data_offset = 0;
+	     data_offset < ODRAW_TEST_READAHEAD_DATA_SIZE;
+	     data_offset++ )
+	{
+		odraw_test_readahead_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) ^ ( data_offset >> 8 ) );
+	}
+	if( libbfio_pool_initialize(
+	     file_io_pool,
+	     0,
+	     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     odraw_test_readahead_data,
+	     ODRAW_TEST_READAHEAD_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_append_handle(
+	     *file_io_pool,
+	     &entry_index,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handle to pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( *file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 file_io_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libodraw_readahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_readahead_initialize(
+     void )
+{
+	libbfio_pool_t *file_io_pool    = NULL;
+	libcerror_error_t *error        = NULL;
+	libodraw_readahead_t *readahead = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_readahead_open_file_io_pool(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_readahead_initialize(
+	          &readahead,
+	          file_io_pool,
+	          ODRAW_TEST_READAHEAD_WINDOW_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_readahead_free(
+	          &readahead,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_readahead_initialize(
+	          NULL,
+	          file_io_pool,
+	          ODRAW_TEST_READAHEAD_WINDOW_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	readahead = (libodraw_readahead_t *) 0x12345678UL;
+
+	result = libodraw_readahead_initialize(
+	          &readahead,
+	          file_io_pool,
+	          ODRAW_TEST_READAHEAD_WINDOW_SIZE,
+	          &error );
+
+	readahead = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_readahead_initialize(
+	          &readahead,
+	          NULL,
+	          ODRAW_TEST_READAHEAD_WINDOW_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_readahead_initialize(
+	          &readahead,
+	          file_io_pool,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_readahead_initialize(
+	          &readahead,
+	          file_io_pool,
+	          (size_t) LIBODRAW_READAHEAD_MAXIMUM_WINDOW_SIZE + 1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( readahead != NULL )
+	{
+		libodraw_readahead_free(
+		 &readahead,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_readahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_readahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_readahead_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_readahead_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_readahead_read_buffer(
+     void )
+{
+	uint8_t buffer[ 3000 ];
+
+	libbfio_pool_t *file_io_pool    = NULL;
+	libcerror_error_t *error        = NULL;
+	libodraw_readahead_t *readahead = NULL;
+	ssize_t read_count              = 0;
+	off64_t offset                  = 0;
+	size_t read_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_readahead_open_file_io_pool(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_readahead_initialize(
+	          &readahead,
+	          file_io_pool,
+	          ODRAW_TEST_READAHEAD_WINDOW_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * read the data sequentially with a read size that does not align with the window size
+	 */
+	while( offset < (off64_t) ODRAW_TEST_READAHEAD_DATA_SIZE )
+	{
+		read_size = 3000;
+
+		if( read_size > (size_t) ( ODRAW_TEST_READAHEAD_DATA_SIZE - offset ) )
+		{
+			read_size = (size_t) ( ODRAW_TEST_READAHEAD_DATA_SIZE - offset );
+		}
+		read_count = libodraw_readahead_read_buffer(
+		              readahead,
+		              0,
+		              buffer,
+		              read_size,
+		              offset,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( odraw_test_readahead_data[ offset ] ),
+		          read_size );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		offset += (off64_t) read_size;
+	}
+	/* Read beyond the end of the data
+	 */
+	read_count = libodraw_readahead_read_buffer(
+	              readahead,
+	              0,
+	              buffer,
+	              3000,
+	              (off64_t) ODRAW_TEST_READAHEAD_DATA_SIZE - 1000,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( odraw_test_readahead_data[ ODRAW_TEST_READAHEAD_DATA_SIZE - 1000 ] ),
+	          1000 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read a non-sequential buffer
+	 */
+	read_count = libodraw_readahead_read_buffer(
+	              readahead,
+	              0,
+	              buffer,
+	              2048,
+	              5000,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( odraw_test_readahead_data[ 5000 ] ),
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libodraw_readahead_read_buffer(
+	              NULL,
+	              0,
+	              buffer,
+	              2048,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_readahead_read_buffer(
+	              readahead,
+	              0,
+	              NULL,
+	              2048,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_readahead_read_buffer(
+	              readahead,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_readahead_read_buffer(
+	              readahead,
+	              0,
+	              buffer,
+	              2048,
+	              -1,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_readahead_free(
+	          &readahead,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "readahead",
+	 readahead );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( readahead != NULL )
+	{
+		libodraw_readahead_free(
+		 &readahead,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_readahead_initialize",
+	 odraw_test_readahead_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_readahead_free",
+	 odraw_test_readahead_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_readahead_read_buffer",
+	 odraw_test_readahead_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
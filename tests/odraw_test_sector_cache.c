@@ -0,0 +1,1036 @@
+/*
+ * Library sector_cache type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_sector_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_sector_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_cache_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libodraw_sector_cache_t *sector_cache = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 4;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          2048,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_cache_initialize(
+	          NULL,
+	          16,
+	          2048,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sector_cache = (libodraw_sector_cache_t *) 0x12345678UL;
+
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          2048,
+	          &error );
+
+	sector_cache = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          0,
+	          2048,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_sector_cache_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_sector_cache_initialize(
+		          &sector_cache,
+		          16,
+		          2048,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( sector_cache != NULL )
+			{
+				libodraw_sector_cache_free(
+				 &sector_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "sector_cache",
+			 sector_cache );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_sector_cache_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_sector_cache_initialize(
+		          &sector_cache,
+		          16,
+		          2048,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( sector_cache != NULL )
+			{
+				libodraw_sector_cache_free(
+				 &sector_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "sector_cache",
+			 sector_cache );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libodraw_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_cache_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_cache_get_sector_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_cache_get_sector_data(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_sector_cache_t *sector_cache = NULL;
+	uint8_t *sector_data                  = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          4,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          16,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 data,
+	 'A',
+	 512 );
+
+	result = libodraw_sector_cache_set_sector_data(
+	          sector_cache,
+	          0,
+	          16,
+	          data,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          16,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data",
+	 sector_data );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          sector_data,
+	          data,
+	          512 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the data file index is part of the key
+	 */
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          1,
+	          16,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_cache_get_sector_data(
+	          NULL,
+	          0,
+	          16,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          16,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libodraw_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_cache_set_sector_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_cache_set_sector_data(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_sector_cache_t *sector_cache = NULL;
+	uint8_t *sector_data                  = NULL;
+	uint64_t sector                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          4,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( sector = 0;
+	     sector < 4;
+	     sector++ )
+	{
+		memory_set(
+		 data,
+		 'A' + (int) sector,
+		 512 );
+
+		result = libodraw_sector_cache_set_sector_data(
+		          sector_cache,
+		          0,
+		          sector,
+		          data,
+		          512,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "sector_cache->number_of_entries",
+	 sector_cache->number_of_entries,
+	 4 );
+
+	/* Make sector 0 the most recently used entry
+	 */
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if setting a new sector replaces the least recently used entry
+	 */
+	memory_set(
+	 data,
+	 'E',
+	 512 );
+
+	result = libodraw_sector_cache_set_sector_data(
+	          sector_cache,
+	          0,
+	          4,
+	          data,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "sector_cache->number_of_entries",
+	 sector_cache->number_of_entries,
+	 4 );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          1,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data[ 0 ]",
+	 sector_data[ 0 ],
+	 (uint8_t) 'A' );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          4,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data[ 0 ]",
+	 sector_data[ 0 ],
+	 (uint8_t) 'E' );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_cache_set_sector_data(
+	          NULL,
+	          0,
+	          0,
+	          data,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_set_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          NULL,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_set_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          data,
+	          256,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libodraw_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_cache_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_cache_get_statistics(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error              = NULL;
+	libodraw_sector_cache_t *sector_cache = NULL;
+	uint8_t *sector_data                  = NULL;
+	uint64_t number_of_hits               = 0;
+	uint64_t number_of_misses             = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_sector_cache_initialize(
+	          &sector_cache,
+	          4,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_sector_cache_set_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          data,
+	          512,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_sector_cache_get_sector_data(
+	          sector_cache,
+	          0,
+	          0,
+	          &sector_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_cache_get_statistics(
+	          sector_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_cache_get_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_get_statistics(
+	          sector_cache,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_cache_get_statistics(
+	          sector_cache,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libodraw_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_cache_initialize",
+	 odraw_test_sector_cache_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_cache_free",
+	 odraw_test_sector_cache_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_cache_get_sector_data",
+	 odraw_test_sector_cache_get_sector_data );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_cache_set_sector_data",
+	 odraw_test_sector_cache_set_sector_data );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_cache_get_statistics",
+	 odraw_test_sector_cache_get_statistics );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,794 @@
+/*
+ * Library sector copy functions test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_sector_data.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_io_handle.h"
+#include "../libodraw/libodraw_sector_copy.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+#define ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS	5
+
+uint8_t odraw_test_sector_copy_sector_data[ ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * 2352 ];
+
+uint8_t odraw_test_sector_copy_buffer[ ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * 2352 ];
+
+uint8_t odraw_test_sector_copy_expected_buffer[ ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * 2352 ];
+
+/* Tests a sector copy function against the generic copy function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_copy_compare_with_generic(
+     libodraw_io_handle_t *io_handle,
+     libodraw_sector_copy_function_t copy_function,
+     uint8_t track_type,
+     uint32_t bytes_per_sector,
+     uint32_t output_bytes_per_sector )
+{
+	libcerror_error_t *error = NULL;
+	size_t buffer_size       = 0;
+	ssize_t copy_count       = 0;
+	int result               = 0;
+
+	buffer_size = ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * output_bytes_per_sector;
+
+	odraw_test_sector_data_fill(
+	 odraw_test_sector_copy_sector_data,
+	 ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	 track_type,
+	 bytes_per_sector );
+
+	memory_set(
+	 odraw_test_sector_copy_expected_buffer,
+	 0xaa,
+	 ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * 2352 );
+
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer_with_sector_size(
+	              io_handle,
+	              odraw_test_sector_copy_sector_data,
+	              ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * bytes_per_sector,
+	              bytes_per_sector,
+	              track_type,
+	              output_bytes_per_sector,
+	              odraw_test_sector_copy_expected_buffer,
+	              buffer_size,
+	              150,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) buffer_size );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 odraw_test_sector_copy_buffer,
+	 0x55,
+	 ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS * 2352 );
+
+	result = copy_function(
+	          io_handle,
+	          odraw_test_sector_copy_sector_data,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          track_type,
+	          150,
+	          odraw_test_sector_copy_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          odraw_test_sector_copy_buffer,
+	          odraw_test_sector_copy_expected_buffer,
+	          buffer_size );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_copy_2352_to_2048 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_copy_2352_to_2048(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = odraw_test_sector_copy_compare_with_generic(
+	          io_handle,
+	          &libodraw_sector_copy_2352_to_2048,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          2352,
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = odraw_test_sector_copy_compare_with_generic(
+	          io_handle,
+	          &libodraw_sector_copy_2352_to_2048,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          2352,
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error case where the synchronisation data of a sector is corrupt
+	 */
+	odraw_test_sector_copy_sector_data[ ( 3 * 2352 ) + 6 ] = 0xfe;
+
+	result = libodraw_sector_copy_2352_to_2048(
+	          io_handle,
+	          odraw_test_sector_copy_sector_data,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          150,
+	          odraw_test_sector_copy_buffer,
+	          &error );
+
+	odraw_test_sector_copy_sector_data[ ( 3 * 2352 ) + 6 ] = 0xff;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_copy_mode2_2336_to_2048 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_copy_mode2_2336_to_2048(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = odraw_test_sector_copy_compare_with_generic(
+	          io_handle,
+	          &libodraw_sector_copy_mode2_2336_to_2048,
+	          LIBODRAW_TRACK_TYPE_MODE2_2336,
+	          2336,
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error case where the XA sub-header of a sector is corrupt
+	 */
+	odraw_test_sector_copy_sector_data[ ( 2 * 2336 ) + 6 ] = 0x20;
+
+	result = libodraw_sector_copy_mode2_2336_to_2048(
+	          io_handle,
+	          odraw_test_sector_copy_sector_data,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          LIBODRAW_TRACK_TYPE_MODE2_2336,
+	          150,
+	          odraw_test_sector_copy_buffer,
+	          &error );
+
+	odraw_test_sector_copy_sector_data[ ( 2 * 2336 ) + 6 ] = 0x08;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_copy_mode2_2336_to_2048(
+	          io_handle,
+	          NULL,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          LIBODRAW_TRACK_TYPE_MODE2_2336,
+	          150,
+	          odraw_test_sector_copy_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_copy_mode2_2336_to_2048(
+	          io_handle,
+	          odraw_test_sector_copy_sector_data,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          LIBODRAW_TRACK_TYPE_MODE2_2336,
+	          150,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_copy_audio_to_2048 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_copy_audio_to_2048(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = odraw_test_sector_copy_compare_with_generic(
+	          io_handle,
+	          &libodraw_sector_copy_audio_to_2048,
+	          LIBODRAW_TRACK_TYPE_AUDIO,
+	          2352,
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_copy_audio_to_2048(
+	          io_handle,
+	          odraw_test_sector_copy_sector_data,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          LIBODRAW_TRACK_TYPE_AUDIO,
+	          150,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_copy_encode_to_2352 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_copy_encode_to_2352(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = odraw_test_sector_copy_compare_with_generic(
+	          io_handle,
+	          &libodraw_sector_copy_encode_to_2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          2048,
+	          2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = odraw_test_sector_copy_compare_with_generic(
+	          io_handle,
+	          &libodraw_sector_copy_encode_to_2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2336,
+	          2336,
+	          2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_copy_encode_to_2352(
+	          io_handle,
+	          odraw_test_sector_copy_sector_data,
+	          ODRAW_TEST_SECTOR_COPY_NUMBER_OF_SECTORS,
+	          LIBODRAW_TRACK_TYPE_AUDIO,
+	          150,
+	          odraw_test_sector_copy_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_copy_get_function function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_copy_get_function(
+     void )
+{
+	libodraw_sector_copy_function_t copy_function = NULL;
+
+	/* Test cases without a sector copy function
+	 */
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_MODE1_2048,
+	                 2048,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "copy_function",
+	 copy_function );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_AUDIO,
+	                 2352,
+	                 2352 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "copy_function",
+	 copy_function );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_MODE1_2352,
+	                 2352,
+	                 2336 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "copy_function",
+	 copy_function );
+
+#if !defined( HAVE_DEBUG_OUTPUT ) && !defined( HAVE_VERBOSE_OUTPUT )
+
+	/* Test cases with a sector copy function
+	 */
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_MODE1_2352,
+	                 2352,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_2352_to_2048 );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_MODE2_2352,
+	                 2352,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_2352_to_2048 );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_MODE2_2336,
+	                 2336,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_mode2_2336_to_2048 );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_CDI_2352,
+	                 2352,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_2352_to_2048 );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_CDI_2336,
+	                 2336,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_mode2_2336_to_2048 );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_AUDIO,
+	                 2352,
+	                 2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_audio_to_2048 );
+
+	copy_function = libodraw_sector_copy_get_function(
+	                 LIBODRAW_TRACK_TYPE_MODE1_2048,
+	                 2048,
+	                 2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "copy_function",
+	 (intptr_t) copy_function,
+	 (intptr_t) &libodraw_sector_copy_encode_to_2352 );
+
+#endif /* !defined( HAVE_DEBUG_OUTPUT ) && !defined( HAVE_VERBOSE_OUTPUT ) */
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_copy_2352_to_2048",
+	 odraw_test_sector_copy_2352_to_2048 );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_copy_mode2_2336_to_2048",
+	 odraw_test_sector_copy_mode2_2336_to_2048 );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_copy_audio_to_2048",
+	 odraw_test_sector_copy_audio_to_2048 );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_copy_encode_to_2352",
+	 odraw_test_sector_copy_encode_to_2352 );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_copy_get_function",
+	 odraw_test_sector_copy_get_function );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Sector data functions for testing
+ *
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "odraw_test_libodraw.h"
+#include "odraw_test_sector_data.h"
+
+/* Fills the sector data with valid sectors of a specific track type
+ * The sector data must be large enough to contain the number of sectors
+ * of the bytes per sector
+ */
+void odraw_test_sector_data_fill(
+      uint8_t *sector_data,
+      size_t number_of_sectors,
+      uint8_t track_type,
+      uint32_t bytes_per_sector )
+{
+	uint8_t *sector     = NULL;
+	size_t byte_index   = 0;
+	size_t sector_index = 0;
+
+	if( sector_data == NULL )
+	{
+		return;
+	}
+	for( sector_index = 0;
+	     sector_index < number_of_sectors;
+	     sector_index++ )
+	{
+		sector = &( sector_data[ sector_index * bytes_per_sector ] );
+
+		for( byte_index = 0;
+		     byte_index < bytes_per_sector;
+		     byte_index++ )
+		{
+			sector[ byte_index ] = (uint8_t) ( ( byte_index * 7 ) + sector_index );
+		}
+		if( bytes_per_sector == 2352 )
+		{
+			sector[ 0 ] = 0x00;
+
+			for( byte_index = 1;
+			     byte_index < 11;
+			     byte_index++ )
+			{
+				sector[ byte_index ] = 0xff;
+			}
+			sector[ 11 ] = 0x00;
+			sector[ 15 ] = ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) ? 2 : 1;
+
+			sector = &( sector[ 16 ] );
+		}
+		if( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
+		 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+		{
+			sector[ 0 ] = sector[ 4 ] = 1;
+			sector[ 1 ] = sector[ 5 ] = (uint8_t) sector_index;
+			sector[ 2 ] = sector[ 6 ] = 0x08;
+			sector[ 3 ] = sector[ 7 ] = 0;
+		}
+	}
+}
+
@@ -1,5 +1,6 @@
 /*
- * The libhmac header wrapper
+ * Sector data functions for testing
+ *
  *
  * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -19,33 +20,25 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#if !defined( _ODRAWTOOLS_LIBHMAC_H )
-#define _ODRAWTOOLS_LIBHMAC_H
+#if !defined( _ODRAW_TEST_SECTOR_DATA_H )
+#define _ODRAW_TEST_SECTOR_DATA_H
 
 #include <common.h>
+#include <types.h>
 
-#if defined( HAVE_LOCAL_LIBHMAC )
-
-#include <libhmac_definitions.h>
-#include <libhmac_md5.h>
-#include <libhmac_sha1.h>
-#include <libhmac_sha256.h>
-#include <libhmac_sha512.h>
-#include <libhmac_support.h>
-#include <libhmac_types.h>
-
-#else
-
-/* If libtool DLL support is enabled set LIBHMAC_DLL_IMPORT
- * before including libhmac.h
- */
-#if defined( _WIN32 ) && defined( DLL_IMPORT ) && !defined( HAVE_STATIC_EXECUTABLES )
-#define LIBHMAC_DLL_IMPORT
+#if defined( __cplusplus )
+extern "C" {
 #endif
 
-#include <libhmac.h>
+void odraw_test_sector_data_fill(
+      uint8_t *sector_data,
+      size_t number_of_sectors,
+      uint8_t track_type,
+      uint32_t bytes_per_sector );
 
-#endif /* defined( HAVE_LOCAL_LIBHMAC ) */
+#if defined( __cplusplus )
+}
+#endif
 
-#endif /* !defined( _ODRAWTOOLS_LIBHMAC_H ) */
+#endif /* !defined( _ODRAW_TEST_SECTOR_DATA_H ) */
 
@@ -0,0 +1,753 @@
+/*
+ * Library sector_data_buffer type test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_sector_data_buffer.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_sector_data_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_data_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_data_buffer_initialize(
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_data_buffer_free(
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_data_buffer_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sector_data_buffer = (libodraw_sector_data_buffer_t *) 0x12345678UL;
+
+	result = libodraw_sector_data_buffer_initialize(
+	          &sector_data_buffer,
+	          &error );
+
+	sector_data_buffer = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_sector_data_buffer_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_sector_data_buffer_initialize(
+		          &sector_data_buffer,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( sector_data_buffer != NULL )
+			{
+				libodraw_sector_data_buffer_free(
+				 &sector_data_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "sector_data_buffer",
+			 sector_data_buffer );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_sector_data_buffer_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_sector_data_buffer_initialize(
+		          &sector_data_buffer,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( sector_data_buffer != NULL )
+			{
+				libodraw_sector_data_buffer_free(
+				 &sector_data_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "sector_data_buffer",
+			 sector_data_buffer );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_sector_data_buffer_free(
+		 &sector_data_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_data_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_data_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_data_buffer_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_data_buffer_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_data_buffer_get_data(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint8_t *data                                     = NULL;
+	uint8_t *previous_data                            = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_sector_data_buffer_initialize(
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          2352,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "sector_data_buffer->data_size",
+	 sector_data_buffer->data_size,
+	 (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "data alignment",
+	 (int) ( (intptr_t) data % LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT ),
+	 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_data_buffer->number_of_allocations",
+	 sector_data_buffer->number_of_allocations,
+	 (uint64_t) 1 );
+
+	previous_data = data;
+
+	/* Test if a smaller or equal size reuses the data
+	 */
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 ( data == previous_data ),
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_data_buffer->number_of_allocations",
+	 sector_data_buffer->number_of_allocations,
+	 (uint64_t) 1 );
+
+	/* Test if the data is aligned relative to the data offset
+	 */
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          3 * 2352,
+	          LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 ( data == &( previous_data[ ( 3 * 2352 ) % LIBODRAW_SECTOR_DATA_BUFFER_ALIGNMENT ] ) ),
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_data_buffer->number_of_allocations",
+	 sector_data_buffer->number_of_allocations,
+	 (uint64_t) 1 );
+
+	/* Test if a larger size grows the data to the next size class
+	 */
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE + 1,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "sector_data_buffer->data_size",
+	 sector_data_buffer->data_size,
+	 (size_t) ( 2 * LIBODRAW_SECTOR_DATA_BUFFER_MINIMUM_SIZE ) );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_data_buffer->number_of_allocations",
+	 sector_data_buffer->number_of_allocations,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_data_buffer_get_data(
+	          NULL,
+	          0,
+	          2352,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          -1,
+	          2352,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          0,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          (size_t) LIBODRAW_SECTOR_DATA_BUFFER_MAXIMUM_SIZE + 1,
+	          &data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_data_buffer_get_data(
+	          sector_data_buffer,
+	          0,
+	          2352,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if clear retains the number of allocations
+	 */
+	result = libodraw_sector_data_buffer_clear(
+	          sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_data_buffer->data",
+	 sector_data_buffer->data );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_data_buffer->number_of_allocations",
+	 sector_data_buffer->number_of_allocations,
+	 (uint64_t) 2 );
+
+	/* Clean up
+	 */
+	result = libodraw_sector_data_buffer_free(
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_sector_data_buffer_free(
+		 &sector_data_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_data_buffer_get_number_of_allocations function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_data_buffer_get_number_of_allocations(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libodraw_sector_data_buffer_t *sector_data_buffer = NULL;
+	uint64_t number_of_allocations                    = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_sector_data_buffer_initialize(
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_data_buffer_get_number_of_allocations(
+	          sector_data_buffer,
+	          &number_of_allocations,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_data_buffer_get_number_of_allocations(
+	          NULL,
+	          &number_of_allocations,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_data_buffer_get_number_of_allocations(
+	          sector_data_buffer,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_sector_data_buffer_free(
+	          &sector_data_buffer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_data_buffer",
+	 sector_data_buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data_buffer != NULL )
+	{
+		libodraw_sector_data_buffer_free(
+		 &sector_data_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_data_buffer_initialize",
+	 odraw_test_sector_data_buffer_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_data_buffer_free",
+	 odraw_test_sector_data_buffer_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_data_buffer_get_data",
+	 odraw_test_sector_data_buffer_get_data );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_data_buffer_get_number_of_allocations",
+	 odraw_test_sector_data_buffer_get_number_of_allocations );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,481 @@
+/*
+ * Library sector extraction functions test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_sector_data.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_sector_extract.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* An odd number of sectors to test the handling of a trailing sector
+ */
+#define ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS	9
+
+uint8_t odraw_test_sector_extract_sector_data[ ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352 ];
+
+uint8_t odraw_test_sector_extract_buffer[ ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048 ];
+
+/* Determines if the test buffer contains the user data of the first number of sectors
+ * Returns 1 if the user data matches or 0 if not
+ */
+int odraw_test_sector_extract_compare_buffer(
+     uint8_t track_type,
+     size_t number_of_sectors )
+{
+	size_t data_offset  = 16;
+	size_t sector_index = 0;
+
+	if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+	{
+		data_offset = 24;
+	}
+	for( sector_index = 0;
+	     sector_index < number_of_sectors;
+	     sector_index++ )
+	{
+		if( memory_compare(
+		     &( odraw_test_sector_extract_buffer[ sector_index * 2048 ] ),
+		     &( odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + data_offset ] ),
+		     2048 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests a sector extraction kernel
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_extract_kernel(
+     libodraw_sector_extract_kernel_t kernel )
+{
+	uint8_t track_types[ 2 ] = { LIBODRAW_TRACK_TYPE_MODE1_2352, LIBODRAW_TRACK_TYPE_MODE2_2352 };
+	size_t number_of_sectors = 0;
+	size_t sector_index      = 0;
+	int result               = 0;
+	int track_type_index     = 0;
+
+	for( track_type_index = 0;
+	     track_type_index < 2;
+	     track_type_index++ )
+	{
+		/* Test regular cases
+		 */
+		odraw_test_sector_data_fill(
+		 odraw_test_sector_extract_sector_data,
+		 ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+		 track_types[ track_type_index ],
+		 2352 );
+
+		for( number_of_sectors = 0;
+		     number_of_sectors <= ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS;
+		     number_of_sectors++ )
+		{
+			memory_set(
+			 odraw_test_sector_extract_buffer,
+			 0,
+			 ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048 );
+
+			ODRAW_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_extracted_sectors",
+			 kernel(
+			  odraw_test_sector_extract_sector_data,
+			  number_of_sectors,
+			  track_types[ track_type_index ],
+			  odraw_test_sector_extract_buffer ),
+			 number_of_sectors );
+
+			result = odraw_test_sector_extract_compare_buffer(
+			          track_types[ track_type_index ],
+			          number_of_sectors );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		/* Test error case where the synchronisation data of a sector is corrupt
+		 */
+		for( sector_index = 0;
+		     sector_index < ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS;
+		     sector_index++ )
+		{
+			odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 6 ] = 0xfe;
+
+			ODRAW_TEST_ASSERT_EQUAL_SIZE(
+			 "number_of_extracted_sectors",
+			 kernel(
+			  odraw_test_sector_extract_sector_data,
+			  ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+			  track_types[ track_type_index ],
+			  odraw_test_sector_extract_buffer ),
+			 sector_index );
+
+			odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 6 ] = 0xff;
+		}
+	}
+	/* Test error case where the XA sub-header of a sector is corrupt
+	 */
+	for( sector_index = 0;
+	     sector_index < ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS;
+	     sector_index++ )
+	{
+		odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 22 ] = 0x20;
+
+		ODRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "number_of_extracted_sectors",
+		 kernel(
+		  odraw_test_sector_extract_sector_data,
+		  ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+		  LIBODRAW_TRACK_TYPE_MODE2_2352,
+		  odraw_test_sector_extract_buffer ),
+		 sector_index );
+
+		odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 22 ] = 0x08;
+	}
+	/* Test error case where the XA sub-header channel number of a sector is out of bounds
+	 */
+	for( sector_index = 0;
+	     sector_index < ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS;
+	     sector_index++ )
+	{
+		odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 17 ] = 32;
+		odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 21 ] = 32;
+
+		ODRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "number_of_extracted_sectors",
+		 kernel(
+		  odraw_test_sector_extract_sector_data,
+		  ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+		  LIBODRAW_TRACK_TYPE_MODE2_2352,
+		  odraw_test_sector_extract_buffer ),
+		 sector_index );
+
+		odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 17 ] = (uint8_t) sector_index;
+		odraw_test_sector_extract_sector_data[ ( sector_index * 2352 ) + 21 ] = (uint8_t) sector_index;
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_extract_2352_to_2048_scalar function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_extract_2352_to_2048_scalar(
+     void )
+{
+	return( odraw_test_sector_extract_kernel(
+	         &libodraw_sector_extract_2352_to_2048_scalar ) );
+}
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+
+/* Tests the libodraw_sector_extract_2352_to_2048_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_extract_2352_to_2048_sse2(
+     void )
+{
+	return( odraw_test_sector_extract_kernel(
+	         &libodraw_sector_extract_2352_to_2048_sse2 ) );
+}
+
+#endif /* defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD ) */
+
+/* Tests the libodraw_sector_extract_get_kernel function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_extract_get_kernel(
+     void )
+{
+	libodraw_sector_extract_kernel_t kernel = NULL;
+
+	kernel = libodraw_sector_extract_get_kernel();
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "kernel",
+	 kernel );
+
+	ODRAW_TEST_ASSERT_EQUAL_INTPTR(
+	 "kernel",
+	 (intptr_t) libodraw_sector_extract_get_kernel(),
+	 (intptr_t) kernel );
+
+	return( odraw_test_sector_extract_kernel(
+	         kernel ) );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_extract_2352_to_2048 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_extract_2352_to_2048(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	odraw_test_sector_data_fill(
+	 odraw_test_sector_extract_sector_data,
+	 ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	 LIBODRAW_TRACK_TYPE_MODE2_2352,
+	 2352 );
+
+	result = libodraw_sector_extract_2352_to_2048(
+	          odraw_test_sector_extract_sector_data,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          odraw_test_sector_extract_buffer,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_sector_extract_compare_buffer(
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_extract_2352_to_2048(
+	          NULL,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          odraw_test_sector_extract_buffer,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_extract_2352_to_2048(
+	          odraw_test_sector_extract_sector_data,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          NULL,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_extract_2352_to_2048(
+	          odraw_test_sector_extract_sector_data,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2048,
+	          odraw_test_sector_extract_buffer,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_extract_2352_to_2048(
+	          odraw_test_sector_extract_sector_data,
+	          ( ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352 ) - 1,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          odraw_test_sector_extract_buffer,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_extract_2352_to_2048(
+	          odraw_test_sector_extract_sector_data,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          odraw_test_sector_extract_buffer,
+	          ( ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048 ) - 1,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the sector data is corrupt
+	 */
+	odraw_test_sector_extract_sector_data[ ( 4 * 2352 ) + 6 ] = 0xfe;
+
+	result = libodraw_sector_extract_2352_to_2048(
+	          odraw_test_sector_extract_sector_data,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2352,
+	          LIBODRAW_TRACK_TYPE_MODE2_2352,
+	          odraw_test_sector_extract_buffer,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS * 2048,
+	          ODRAW_TEST_SECTOR_EXTRACT_NUMBER_OF_SECTORS,
+	          &error );
+
+	odraw_test_sector_extract_sector_data[ ( 4 * 2352 ) + 6 ] = 0xff;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_extract_2352_to_2048_scalar",
+	 odraw_test_sector_extract_2352_to_2048_scalar );
+
+#if defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_extract_2352_to_2048_sse2",
+	 odraw_test_sector_extract_2352_to_2048_sse2 );
+
+#endif /* defined( LIBODRAW_SECTOR_EXTRACT_HAVE_SIMD ) */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_extract_get_kernel",
+	 odraw_test_sector_extract_get_kernel );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_extract_2352_to_2048",
+	 odraw_test_sector_extract_2352_to_2048 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,732 @@
+/*
+ * Tools checkpoint file functions test program
+ *
+ * Copyright (C) 2010-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../odrawtools/checkpoint_file.h"
+#include "../odrawtools/md5_hash.h"
+#include "../odrawtools/sha1_hash.h"
+#include "../odrawtools/sha256_hash.h"
+
+/* The media data ends with a tail that is not a multitude of the chunk size or the hash block size
+ * and the verification is interrupted after the first chunk
+ */
+#define ODRAW_TEST_CHECKPOINT_FILE_NAME		_SYSTEM_STRING( "odraw_test_tools_checkpoint_file.ckp" )
+#define ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE	( ( 2 * CHECKPOINT_FILE_CHUNK_SIZE ) + 2352 + 100 )
+#define ODRAW_TEST_CHECKPOINT_FILE_OFFSET	CHECKPOINT_FILE_CHUNK_SIZE
+
+#define ODRAW_TEST_CHECKPOINT_FILE_DIGEST_STATE_SIZE \
+	( MD5_HASH_STATE_SIZE + SHA1_HASH_STATE_SIZE + SHA256_HASH_STATE_SIZE )
+
+#define ODRAW_TEST_CHECKPOINT_FILE_DIGEST_FLAGS \
+	( CHECKPOINT_FILE_DIGEST_FLAG_MD5 | CHECKPOINT_FILE_DIGEST_FLAG_SHA1 | CHECKPOINT_FILE_DIGEST_FLAG_SHA256 )
+
+/* The digest hashes of the media data
+ */
+uint8_t odraw_test_checkpoint_file_md5_hash[ MD5_HASH_SIZE ] = {
+	0x30, 0xe0, 0x55, 0x93, 0x8e, 0x3f, 0x4c, 0xcd, 0x05, 0xda, 0x2d, 0xb6, 0xb8, 0x10, 0x7f, 0x4b };
+
+uint8_t odraw_test_checkpoint_file_sha1_hash[ SHA1_HASH_SIZE ] = {
+	0xd4, 0x17, 0x0e, 0x4a, 0x08, 0xe5, 0x8b, 0xab, 0xeb, 0x02, 0xad, 0x7c, 0x0c, 0x27, 0x29, 0x7a,
+	0x6f, 0xc3, 0x44, 0x87 };
+
+uint8_t odraw_test_checkpoint_file_sha256_hash[ SHA256_HASH_SIZE ] = {
+	0x9e, 0x26, 0x09, 0xc8, 0x63, 0x82, 0xa3, 0x23, 0x35, 0x5c, 0x06, 0x9c, 0xc0, 0xf4, 0x92, 0x38,
+	0x48, 0xd4, 0x10, 0x16, 0x5b, 0xed, 0x14, 0xa6, 0x13, 0x56, 0x67, 0x48, 0x5c, 0xc6, 0x0b, 0xd9 };
+
+/* Fills the media data with a pattern
+ */
+void odraw_test_checkpoint_file_fill_media_data(
+      uint8_t *media_data )
+{
+	size_t byte_index = 0;
+
+	for( byte_index = 0;
+	     byte_index < ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE;
+	     byte_index++ )
+	{
+		media_data[ byte_index ] = (uint8_t) ( ( byte_index * 7 ) + ( byte_index >> 12 ) );
+	}
+}
+
+/* Updates the digest hashes with media data
+ * The media data is passed in parts of a size that is not a multitude of the hash block size
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_checkpoint_file_update_hashes(
+     md5_hash_t *md5_hash,
+     sha1_hash_t *sha1_hash,
+     sha256_hash_t *sha256_hash,
+     const uint8_t *media_data,
+     size_t start_offset,
+     size_t end_offset,
+     libcerror_error_t **error )
+{
+	size_t read_size = 0;
+
+	while( start_offset < end_offset )
+	{
+		read_size = end_offset - start_offset;
+
+		if( read_size > 32771 )
+		{
+			read_size = 32771;
+		}
+		if( md5_hash_update(
+		     md5_hash,
+		     &( media_data[ start_offset ] ),
+		     read_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( sha1_hash_update(
+		     sha1_hash,
+		     &( media_data[ start_offset ] ),
+		     read_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( sha256_hash_update(
+		     sha256_hash,
+		     &( media_data[ start_offset ] ),
+		     read_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		start_offset += read_size;
+	}
+	return( 1 );
+}
+
+/* Tests interrupting and resuming the digest hashes with a checkpoint file
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_tools_checkpoint_file_resume(
+     void )
+{
+	uint8_t digest_state[ ODRAW_TEST_CHECKPOINT_FILE_DIGEST_STATE_SIZE ];
+	uint8_t md5_hash_value[ MD5_HASH_SIZE ];
+	uint8_t sha1_hash_value[ SHA1_HASH_SIZE ];
+	uint8_t sha256_hash_value[ SHA256_HASH_SIZE ];
+
+	libcerror_error_t *error   = NULL;
+	md5_hash_t *md5_hash       = NULL;
+	sha1_hash_t *sha1_hash     = NULL;
+	sha256_hash_t *sha256_hash = NULL;
+	uint8_t *media_data        = NULL;
+	off64_t offset             = 0;
+	int file_created           = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	media_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "media_data",
+	 media_data );
+
+	odraw_test_checkpoint_file_fill_media_data(
+	 media_data );
+
+	result = md5_hash_initialize(
+	          &md5_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha1_hash_initialize(
+	          &sha1_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha256_hash_initialize(
+	          &sha256_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Hash the media data up to the checkpoint offset and write the checkpoint
+	 */
+	result = odraw_test_checkpoint_file_update_hashes(
+	          md5_hash,
+	          sha1_hash,
+	          sha256_hash,
+	          media_data,
+	          0,
+	          ODRAW_TEST_CHECKPOINT_FILE_OFFSET,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = md5_hash_copy_state_to_byte_stream(
+	          md5_hash,
+	          digest_state,
+	          MD5_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha1_hash_copy_state_to_byte_stream(
+	          sha1_hash,
+	          &( digest_state[ MD5_HASH_STATE_SIZE ] ),
+	          SHA1_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha256_hash_copy_state_to_byte_stream(
+	          sha256_hash,
+	          &( digest_state[ MD5_HASH_STATE_SIZE + SHA1_HASH_STATE_SIZE ] ),
+	          SHA256_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = checkpoint_file_write(
+	          ODRAW_TEST_CHECKPOINT_FILE_NAME,
+	          ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE,
+	          ODRAW_TEST_CHECKPOINT_FILE_OFFSET,
+	          NULL,
+	          NULL,
+	          ODRAW_TEST_CHECKPOINT_FILE_DIGEST_FLAGS,
+	          digest_state,
+	          ODRAW_TEST_CHECKPOINT_FILE_DIGEST_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_created = 1;
+
+	/* Interrupt the verification
+	 */
+	result = md5_hash_free(
+	          &md5_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha1_hash_free(
+	          &sha1_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha256_hash_free(
+	          &sha256_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( memory_set(
+	     digest_state,
+	     0,
+	     ODRAW_TEST_CHECKPOINT_FILE_DIGEST_STATE_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test error case where the digest types do not match those of the checkpoint
+	 */
+	result = checkpoint_file_read(
+	          ODRAW_TEST_CHECKPOINT_FILE_NAME,
+	          ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE,
+	          &offset,
+	          NULL,
+	          NULL,
+	          CHECKPOINT_FILE_DIGEST_FLAG_MD5,
+	          digest_state,
+	          MD5_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Resume the verification from the checkpoint
+	 */
+	result = md5_hash_initialize(
+	          &md5_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha1_hash_initialize(
+	          &sha1_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha256_hash_initialize(
+	          &sha256_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = checkpoint_file_read(
+	          ODRAW_TEST_CHECKPOINT_FILE_NAME,
+	          ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE,
+	          &offset,
+	          NULL,
+	          NULL,
+	          ODRAW_TEST_CHECKPOINT_FILE_DIGEST_FLAGS,
+	          digest_state,
+	          ODRAW_TEST_CHECKPOINT_FILE_DIGEST_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ODRAW_TEST_CHECKPOINT_FILE_OFFSET );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = md5_hash_copy_state_from_byte_stream(
+	          md5_hash,
+	          digest_state,
+	          MD5_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "md5_hash->data_size",
+	 (uint64_t) md5_hash->data_size,
+	 (uint64_t) ODRAW_TEST_CHECKPOINT_FILE_OFFSET );
+
+	result = sha1_hash_copy_state_from_byte_stream(
+	          sha1_hash,
+	          &( digest_state[ MD5_HASH_STATE_SIZE ] ),
+	          SHA1_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sha1_hash->data_size",
+	 (uint64_t) sha1_hash->data_size,
+	 (uint64_t) ODRAW_TEST_CHECKPOINT_FILE_OFFSET );
+
+	result = sha256_hash_copy_state_from_byte_stream(
+	          sha256_hash,
+	          &( digest_state[ MD5_HASH_STATE_SIZE + SHA1_HASH_STATE_SIZE ] ),
+	          SHA256_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sha256_hash->data_size",
+	 (uint64_t) sha256_hash->data_size,
+	 (uint64_t) ODRAW_TEST_CHECKPOINT_FILE_OFFSET );
+
+	/* Hash the remainder of the media data and compare the digest hashes
+	 * with those of the uninterrupted media data
+	 */
+	result = odraw_test_checkpoint_file_update_hashes(
+	          md5_hash,
+	          sha1_hash,
+	          sha256_hash,
+	          media_data,
+	          (size_t) offset,
+	          ODRAW_TEST_CHECKPOINT_FILE_MEDIA_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = md5_hash_finalize(
+	          md5_hash,
+	          md5_hash_value,
+	          MD5_HASH_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          md5_hash_value,
+	          odraw_test_checkpoint_file_md5_hash,
+	          MD5_HASH_SIZE );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = sha1_hash_finalize(
+	          sha1_hash,
+	          sha1_hash_value,
+	          SHA1_HASH_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          sha1_hash_value,
+	          odraw_test_checkpoint_file_sha1_hash,
+	          SHA1_HASH_SIZE );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = sha256_hash_finalize(
+	          sha256_hash,
+	          sha256_hash_value,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          sha256_hash_value,
+	          odraw_test_checkpoint_file_sha256_hash,
+	          SHA256_HASH_SIZE );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error case where the state does not consist of complete blocks and the buffered data
+	 */
+	digest_state[ ( MD5_HASH_STATE_SIZE - 12 ) ] = 0x40;
+
+	result = md5_hash_copy_state_from_byte_stream(
+	          md5_hash,
+	          digest_state,
+	          MD5_HASH_STATE_SIZE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = checkpoint_file_remove(
+	          ODRAW_TEST_CHECKPOINT_FILE_NAME,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 0;
+
+	result = sha256_hash_free(
+	          &sha256_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sha1_hash_free(
+	          &sha1_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = md5_hash_free(
+	          &md5_hash,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 media_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_created != 0 )
+	{
+		checkpoint_file_remove(
+		 ODRAW_TEST_CHECKPOINT_FILE_NAME,
+		 NULL );
+	}
+	if( sha256_hash != NULL )
+	{
+		sha256_hash_free(
+		 &sha256_hash,
+		 NULL );
+	}
+	if( sha1_hash != NULL )
+	{
+		sha1_hash_free(
+		 &sha1_hash,
+		 NULL );
+	}
+	if( md5_hash != NULL )
+	{
+		md5_hash_free(
+		 &md5_hash,
+		 NULL );
+	}
+	if( media_data != NULL )
+	{
+		memory_free(
+		 media_data );
+	}
+	return( 0 );
+}
+
+#if defined( SHA1_HASH_HAVE_SHA_NI ) && defined( SHA256_HASH_HAVE_SHA_NI )
+
+/* Tests that the SHA extensions (SHA-NI) transforms match the scalar transforms
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_tools_checkpoint_file_sha_ni_transforms(
+     void )
+{
+	uint32_t scalar_hash_values[ 8 ];
+	uint32_t sha_ni_hash_values[ 8 ];
+	uint8_t data[ 16 * 64 ];
+
+	size_t byte_index = 0;
+	int result        = 0;
+	int value_index   = 0;
+
+	__builtin_cpu_init();
+
+	if( !__builtin_cpu_supports( "sha" ) )
+	{
+		return( 1 );
+	}
+	for( byte_index = 0;
+	     byte_index < ( 16 * 64 );
+	     byte_index++ )
+	{
+		data[ byte_index ] = (uint8_t) ( ( byte_index * 7 ) + ( byte_index >> 6 ) );
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		scalar_hash_values[ value_index ] = (uint32_t) ( 0x01234567UL * ( value_index + 1 ) );
+		sha_ni_hash_values[ value_index ] = scalar_hash_values[ value_index ];
+	}
+	sha1_hash_transform_scalar(
+	 scalar_hash_values,
+	 data,
+	 16 );
+
+	sha1_hash_transform_sha_ni(
+	 sha_ni_hash_values,
+	 data,
+	 16 );
+
+	result = memory_compare(
+	          sha_ni_hash_values,
+	          scalar_hash_values,
+	          sizeof( uint32_t ) * 5 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sha256_hash_transform_scalar(
+	 scalar_hash_values,
+	 data,
+	 16 );
+
+	sha256_hash_transform_sha_ni(
+	 sha_ni_hash_values,
+	 data,
+	 16 );
+
+	result = memory_compare(
+	          sha_ni_hash_values,
+	          scalar_hash_values,
+	          sizeof( uint32_t ) * 8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( SHA1_HASH_HAVE_SHA_NI ) && defined( SHA256_HASH_HAVE_SHA_NI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ODRAW_TEST_RUN(
+	 "checkpoint_file_resume",
+	 odraw_test_tools_checkpoint_file_resume );
+
+#if defined( SHA1_HASH_HAVE_SHA_NI ) && defined( SHA256_HASH_HAVE_SHA_NI )
+
+	ODRAW_TEST_RUN(
+	 "checkpoint_file_sha_ni_transforms",
+	 odraw_test_tools_checkpoint_file_sha_ni_transforms );
+
+#endif /* defined( SHA1_HASH_HAVE_SHA_NI ) && defined( SHA256_HASH_HAVE_SHA_NI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
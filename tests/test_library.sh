@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="cue_parser data_file data_file_descriptor error io_handle notify sector_range support track_value";
+LIBRARY_TESTS="audio_file_header byte_swap checksum cue_parser data_file data_file_descriptor data_file_segment direct_file error extent_table form_map io_handle io_uring mapped_file notify readahead sector_cache sector_copy sector_data_buffer sector_extract sector_range support tools_checkpoint_file track_value";
 LIBRARY_TESTS_WITH_INPUT="handle";
 OPTION_SETS="";
 